@@ -14,12 +14,44 @@
 #include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/AnimationNodeConfig.h"
 #include "ramses-logic/AnimationTypes.h"
+#include "impl/AnimationNodeImpl.h"
 #include "fmt/format.h"
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Counts heap allocations of the whole benchmark executable, used to check that the animation update loop does not allocate
+static std::atomic<size_t> g_allocationCount{ 0u };
+
+void* operator new(std::size_t size)
+{
+    ++g_allocationCount;
+    if (void* ptr = std::malloc(size)) // NOLINT(cppcoreguidelines-no-malloc) replacement of global operator new
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr); // NOLINT(cppcoreguidelines-no-malloc) replacement of global operator delete
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr); // NOLINT(cppcoreguidelines-no-malloc) replacement of global operator delete
+}
+
 namespace rlogic
 {
     const auto  animationIterations = 100;
 
+    // Number of heap allocations done in the measured loop, divided by number of updates
+    static void ReportAllocationsPerUpdate(benchmark::State& state, size_t allocationCount)
+    {
+        state.counters["AllocationsPerUpdate"] = benchmark::Counter(static_cast<double>(allocationCount), benchmark::Counter::kAvgIterations);
+    }
+
     static void RunAnimation(LogicEngine& logicEngine, benchmark::State& state, Property* progressProp)
     {
         while (state.KeepRunning())
@@ -155,6 +187,176 @@ namespace rlogic
         RunAnimation(logicEngine, state, progressProp);
     }
 
+    static void BM_AnimationManyNodes(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        const auto channelCount = static_cast<size_t>(state.range(0));
+        const auto interpolationType = static_cast<EInterpolationType>(state.range(1));
+        if (!logicEngine.setUpdateThreadCount(static_cast<size_t>(state.range(2))))
+        {
+            state.SkipWithError("failed to set update thread count");
+            return;
+        }
+
+        // skeleton-like animation nodes, each animating rotation and translation of few joints
+        const auto* timeStamps = logicEngine.createDataArray(std::vector<float>{ 0.f, 0.5f, 1.f, 1.5f });
+        const auto* rotations = logicEngine.createDataArray(std::vector<rlogic::vec4f>{ {1.f, 0.f, 0.f, 0.f}, {0.f, 1.f, 0.f, 0.f}, {0.f, 0.f, 1.f, 0.f}, {0.f, 0.f, 0.f, 1.f} });
+        const auto* translations = logicEngine.createDataArray(std::vector<rlogic::vec3f>{ {0.f, 0.f, 0.f}, {0.f, 1.f, 2.f}, {3.f, 1.f, 0.f}, {0.f, 0.f, 5.f} });
+        const auto* rotationTangents = logicEngine.createDataArray(std::vector<rlogic::vec4f>(4u, rlogic::vec4f{ 0.f, 0.5f, 0.5f, 0.f }));
+        const auto* translationTangents = logicEngine.createDataArray(std::vector<rlogic::vec3f>(4u, rlogic::vec3f{ 1.f, 0.f, -1.f }));
+        const bool isCubic = (interpolationType == EInterpolationType::Cubic);
+
+        constexpr size_t channelsPerNode = 10u;
+        std::vector<Property*> progressProps;
+        for (size_t nodeIdx = 0u; nodeIdx < channelCount / channelsPerNode; ++nodeIdx)
+        {
+            AnimationNodeConfig config;
+            for (size_t joint = 0u; joint < channelsPerNode / 2u; ++joint)
+            {
+                config.addChannel({ fmt::format("rotation{}", joint), timeStamps, rotations,
+                    isCubic ? EInterpolationType::Cubic_Quaternions : EInterpolationType::Linear_Quaternions, isCubic ? rotationTangents : nullptr, isCubic ? rotationTangents : nullptr });
+                config.addChannel({ fmt::format("translation{}", joint), timeStamps, translations, interpolationType,
+                    isCubic ? translationTangents : nullptr, isCubic ? translationTangents : nullptr });
+            }
+            progressProps.push_back(logicEngine.createAnimationNode(config)->getInputs()->getChild("progress"));
+        }
+
+        int iteration = 0;
+        size_t allocationCount = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            const float progress = float(iteration++ % animationIterations) / animationIterations;
+            for (Property* progressProp : progressProps)
+                progressProp->set(progress);
+            const size_t allocationCountBefore = g_allocationCount;
+            if (!logicEngine.update())
+                state.SkipWithError("failure running update()");
+            allocationCount += g_allocationCount - allocationCountBefore;
+        }
+
+        state.counters["Channels"] = static_cast<double>(channelCount);
+        ReportAllocationsPerUpdate(state, allocationCount);
+    }
+
+    static void BM_AnimationLongChannels(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        const auto keyframeCount = static_cast<size_t>(state.range(0));
+        const bool uniformlySampled = (state.range(1) != 0);
+        const bool jumping = (state.range(2) != 0);
+
+        // baked animation, e.g. 60 samples per second, optionally with irregular sampling
+        std::vector<float> timestamps(keyframeCount);
+        std::vector<rlogic::vec3f> keyframes(keyframeCount);
+        for (size_t i = 0u; i < keyframeCount; ++i)
+        {
+            timestamps[i] = static_cast<float>(i) / 60.f;
+            if (!uniformlySampled)
+                timestamps[i] += static_cast<float>(i % 3u) / 200.f;
+            keyframes[i] = { static_cast<float>(i % 7u), static_cast<float>(i % 11u), static_cast<float>(i % 13u) };
+        }
+        const auto* animTimestamps = logicEngine.createDataArray(timestamps);
+        const auto* animKeyframes = logicEngine.createDataArray(keyframes);
+
+        AnimationNodeConfig config;
+        for (size_t i = 0u; i < 10u; ++i)
+            config.addChannel({ fmt::format("channel{}", i), animTimestamps, animKeyframes, EInterpolationType::Linear });
+        auto* progressProp = logicEngine.createAnimationNode(config)->getInputs()->getChild("progress");
+
+        // progress moves by (fraction of) single frame every update, or jumps to other position of the animation
+        const size_t frameCount = keyframeCount * 2u;
+        size_t frame = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            frame = (jumping ? (frame + frameCount / 3u + 1u) : (frame + 1u)) % frameCount;
+            progressProp->set(static_cast<float>(frame) / static_cast<float>(frameCount));
+            if (!logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+    }
+
+    static void BM_AnimationNodesSharingData(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        const auto nodeCount = static_cast<size_t>(state.range(0));
+        const auto keyframeCount = static_cast<size_t>(state.range(1));
+
+        // e.g. many instances of one glTF model animated with the same animation
+        std::vector<float> timestamps(keyframeCount);
+        for (size_t i = 0u; i < keyframeCount; ++i)
+            timestamps[i] = static_cast<float>(i) / 30.f;
+        const auto* animTimestamps = logicEngine.createDataArray(timestamps);
+        const auto* animKeyframes = logicEngine.createDataArray(std::vector<rlogic::vec4f>(keyframeCount, rlogic::vec4f{ 0.f, 0.f, 0.f, 1.f }));
+        AnimationNodeConfig config;
+        config.addChannel({ "rotation", animTimestamps, animKeyframes, EInterpolationType::Linear_Quaternions });
+
+        std::vector<AnimationNode*> nodes;
+        for (size_t i = 0u; i < nodeCount; ++i)
+            nodes.push_back(logicEngine.createAnimationNode(config));
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (size_t i = 0u; i < nodeCount; ++i)
+                nodes[i]->getInputs()->getChild("progress")->set(static_cast<float>(i) / static_cast<float>(nodeCount));
+            if (!logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+
+        size_t channelDataMemory = 0u;
+        for (const AnimationNode* node : nodes)
+            channelDataMemory += node->m_animationNodeImpl.getChannelDataMemoryUsage();
+        // every node used to hold a copy of timestamps and keyframes
+        const size_t sharedDataSize = keyframeCount * (sizeof(float) + sizeof(rlogic::vec4f));
+        state.counters["ChannelDataMemoryTotal"] = benchmark::Counter(static_cast<double>(channelDataMemory), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+        state.counters["MemorySaved"] = benchmark::Counter(static_cast<double>(nodeCount * sharedDataSize), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    }
+
+    static void BM_AnimationMorphWeights(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        const auto weightCount = static_cast<size_t>(state.range(0));
+        const auto interpolationType = static_cast<EInterpolationType>(state.range(1));
+
+        // morph target weights, every keyframe is an array of weights
+        constexpr size_t keyframeCount = 100u;
+        std::vector<float> timestamps(keyframeCount);
+        std::vector<std::vector<float>> weights(keyframeCount, std::vector<float>(weightCount));
+        for (size_t i = 0u; i < keyframeCount; ++i)
+        {
+            timestamps[i] = static_cast<float>(i) / 30.f;
+            for (size_t w = 0u; w < weightCount; ++w)
+                weights[i][w] = static_cast<float>((i + w) % 10u) / 10.f;
+        }
+        const auto* animTimestamps = logicEngine.createDataArray(timestamps);
+        const auto* animWeights = logicEngine.createDataArray(weights);
+        const auto* weightTangents = logicEngine.createDataArray(std::vector<std::vector<float>>(keyframeCount, std::vector<float>(weightCount, 0.1f)));
+        const bool isCubic = (interpolationType == EInterpolationType::Cubic);
+
+        AnimationNodeConfig config;
+        for (size_t i = 0u; i < 10u; ++i)
+            config.addChannel({ fmt::format("weights{}", i), animTimestamps, animWeights, interpolationType, isCubic ? weightTangents : nullptr, isCubic ? weightTangents : nullptr });
+        auto* node = logicEngine.createAnimationNode(config);
+        auto* progressProp = node->getInputs()->getChild("progress");
+
+        // node is updated directly to measure only the animation update, first update sizes buffers used for interpolation
+        auto& nodeImpl = node->m_animationNodeImpl;
+        (void)nodeImpl.update();
+
+        size_t iteration = 0u;
+        size_t allocationCount = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            progressProp->set(static_cast<float>(iteration++ % animationIterations) / animationIterations);
+            const size_t allocationCountBefore = g_allocationCount;
+            (void)nodeImpl.update();
+            allocationCount += g_allocationCount - allocationCountBefore;
+        }
+
+        ReportAllocationsPerUpdate(state, allocationCount);
+        if (allocationCount != 0u)
+            state.SkipWithError("animation node update allocated heap memory");
+    }
+
     // Compares animation objects with animations done in lua
     // ARG: number of animation channels
     BENCHMARK(BM_AnimationScriptLinear)->Arg(1)->Arg(10);
@@ -162,5 +364,34 @@ namespace rlogic
     BENCHMARK(BM_AnimationLinear)->Arg(1)->Arg(10);
     BENCHMARK(BM_AnimationKeyframes)->Arg(1)->Arg(10);
     BENCHMARK(BM_AnimationKeyframesCubic)->Arg(1)->Arg(10);
+
+    // Many animation nodes updated every frame, their channels are interpolated in batches
+    // ARG: number of animation channels in total (10 channels per animation node)
+    // ARG: interpolation type (1 = linear, 2 = cubic)
+    // ARG: update thread count
+    BENCHMARK(BM_AnimationManyNodes)
+        ->Args({ 100, 1, 1 })->Args({ 1000, 1, 1 })->Args({ 10000, 1, 1 })
+        ->Args({ 100, 2, 1 })->Args({ 1000, 2, 1 })->Args({ 10000, 2, 1 })
+        ->Args({ 10000, 1, 4 })->Args({ 10000, 2, 4 });
+
+    // Animation node with float array channels (morph target weights), fails if update allocates heap memory
+    // ARG: number of weights in each of the 10 channels
+    // ARG: interpolation type (0 = step, 1 = linear, 2 = cubic)
+    BENCHMARK(BM_AnimationMorphWeights)
+        ->Args({ 8, 0 })->Args({ 8, 1 })->Args({ 8, 2 })
+        ->Args({ 64, 0 })->Args({ 64, 1 })->Args({ 64, 2 });
+
+    // Animation channels with many keyframes (e.g. baked animations)
+    // ARG: number of keyframes in each of the 10 channels
+    // ARG: 1 = uniformly sampled timestamps, 0 = irregular timestamps
+    // ARG: 0 = progress moves in small steps, 1 = progress jumps
+    BENCHMARK(BM_AnimationLongChannels)
+        ->Args({ 10000, 1, 0 })->Args({ 10000, 0, 0 })->Args({ 10000, 1, 1 })->Args({ 10000, 0, 1 })
+        ->Args({ 100000, 1, 0 })->Args({ 100000, 0, 0 })->Args({ 100000, 1, 1 })->Args({ 100000, 0, 1 });
+
+    // Animation nodes using the same data arrays, reports memory of channel data owned by the nodes
+    // ARG: number of animation nodes
+    // ARG: number of keyframes
+    BENCHMARK(BM_AnimationNodesSharingData)->Args({ 500, 1000 })->Args({ 500, 10000 });
 }
 
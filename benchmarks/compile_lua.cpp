@@ -10,6 +10,9 @@
 
 #include "ramses-logic/LogicEngine.h"
 #include "ramses-logic/LuaScript.h"
+#include "impl/LogicEngineImpl.h"
+#include "internals/ApiObjects.h"
+#include "internals/SolState.h"
 #include "fmt/format.h"
 
 namespace rlogic
@@ -48,6 +51,96 @@ namespace rlogic
     // Measures compilation times depending on the number of inputs in the interface
     // ARG: number of inputs in script's interface()
     BENCHMARK(BM_CompileLua_Interface)->Arg(1)->Arg(10)->Arg(100);
-}
 
+    static void BM_CreateLuaEnvironments_StdModules(benchmark::State& state)
+    {
+        const auto environmentCount = static_cast<size_t>(state.range(0));
+        const internal::StandardModules allStdModules{ EStandardModule::Base, EStandardModule::String, EStandardModule::Table, EStandardModule::Math, EStandardModule::Debug };
+
+        size_t memoryPerEnvironment = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            internal::SolState solState;
+            const size_t memoryBefore = solState.getLuaMemoryUsage();
+
+            std::vector<sol::environment> environments;
+            environments.reserve(environmentCount);
+            for (size_t i = 0; i < environmentCount; ++i)
+                environments.push_back(solState.createEnvironment(allStdModules, {}, false));
+
+            memoryPerEnvironment = (solState.getLuaMemoryUsage() - memoryBefore) / environmentCount;
+        }
+
+        state.counters["LuaMemoryPerEnv"] = benchmark::Counter(static_cast<double>(memoryPerEnvironment), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    }
+
+    // Measures creation time and Lua memory of environments of scripts which use all standard modules
+    // ARG: number of environments (one per script)
+    BENCHMARK(BM_CreateLuaEnvironments_StdModules)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+    static void BM_CompileLua_StdModules(benchmark::State& state)
+    {
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::All);
+
+        const std::string_view scriptSrc = R"(
+            function interface(IN,OUT)
+                IN.param = Type:Float()
+            end
+            function run(IN,OUT)
+            end
+        )";
 
+        const int64_t scriptCount = state.range(0);
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LogicEngine logicEngine;
+            for (int64_t i = 0; i < scriptCount; ++i)
+                logicEngine.createLuaScript(scriptSrc, config);
+        }
+    }
+
+    // Measures creation time of scripts which use all standard modules
+    // ARG: number of scripts
+    BENCHMARK(BM_CompileLua_StdModules)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+    static void BM_CreateLuaScripts_SameSource(benchmark::State& state)
+    {
+        const int64_t scriptCount = state.range(0);
+        const bool sameSource = state.range(1) != 0;
+
+        std::vector<std::string> sources;
+        sources.reserve(static_cast<size_t>(scriptCount));
+        for (int64_t i = 0; i < scriptCount; ++i)
+        {
+            // distinct sources differ only in a comment, so that compiling them takes the same time
+            sources.push_back(fmt::format(R"(
+                -- script {}
+                function interface(IN,OUT)
+                    for i = 0,20,1 do
+                        IN["param"..tostring(i)] = Type:Int32()
+                        OUT["result"..tostring(i)] = Type:Int32()
+                    end
+                end
+                function run(IN,OUT)
+                end
+            )", sameSource ? 0 : i));
+        }
+
+        internal::LuaCompilationCache::Statistics statistics;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LogicEngine logicEngine;
+            for (const auto& source : sources)
+                logicEngine.createLuaScript(source);
+            statistics = logicEngine.m_impl->getApiObjects().getLuaCompilationCache().getStatistics();
+        }
+
+        state.counters["CacheHits"] = static_cast<double>(statistics.hits);
+        state.counters["CacheMisses"] = static_cast<double>(statistics.misses);
+    }
+
+    // Measures creation of many scripts from the same source (reusing compilation) compared to distinct sources
+    // ARG: number of scripts, same source (0 = each script has distinct source, 1 = all scripts have same source)
+    BENCHMARK(BM_CreateLuaScripts_SameSource)->Args({ 1000, 0 })->Args({ 1000, 1 })->Unit(benchmark::kMillisecond);
+}
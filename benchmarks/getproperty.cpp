@@ -130,6 +130,80 @@ namespace rlogic
         Run(state, scriptSrc);
     }
 
+    // Same as BM_GetProperty, but field names are too long to be interned by Lua (more than 40 characters),
+    // so they can't be found by their interned key and are always resolved by name
+    static void BM_GetPropertyLongNames(benchmark::State& state)
+    {
+        const int64_t scriptSize = state.range(0);
+        const std::string scriptSrc = fmt::format(R"(
+            function interface(IN,OUT)
+                for i = 0,{},1 do
+                    IN["parameter_with_a_name_too_long_to_be_interned_"..tostring(i)] = Type:Int32()
+                end
+                OUT.param = Type:Int32()
+            end
+            function run(IN,OUT)
+                local result = 0
+                for i = 0,10000,1 do
+                    result = result + IN.parameter_with_a_name_too_long_to_be_interned_0 + IN.parameter_with_a_name_too_long_to_be_interned_{}
+                end
+                OUT.param = result
+            end
+        )", scriptSize, scriptSize);
+        Run(state, scriptSrc);
+    }
+
+    static void BM_GetPropertyWideStruct(benchmark::State& state)
+    {
+        const int64_t fieldCount = state.range(0);
+        const std::string scriptSrc = fmt::format(R"(
+            function interface(IN,OUT)
+                IN.struct = {{}}
+                for i = 0,{},1 do
+                    IN.struct["field"..tostring(i)] = Type:Int32()
+                end
+                OUT.param = Type:Int32()
+            end
+            function run(IN,OUT)
+                local result = 0
+                for i = 0,10000,1 do
+                    result = result + IN.struct.field0 + IN.struct.field{}
+                end
+                OUT.param = result
+            end
+        )", fieldCount - 1, fieldCount - 1);
+        Run(state, scriptSrc);
+    }
+
+    static void BM_GetChildByNameWideStruct(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t fieldCount = state.range(0);
+        const std::string scriptSrc = fmt::format(R"(
+            function interface(IN,OUT)
+                IN.struct = {{}}
+                for i = 0,{},1 do
+                    IN.struct["field"..tostring(i)] = Type:Int32()
+                end
+            end
+            function run(IN,OUT)
+            end
+        )", fieldCount - 1);
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+        const LuaScript* script = logicEngine.createLuaScript(scriptSrc, config);
+        const Property* wideStruct = script->getInputs()->getChild("struct");
+        const std::string lastFieldName = fmt::format("field{}", fieldCount - 1);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            benchmark::DoNotOptimize(wideStruct->getChild("field0"));
+            benchmark::DoNotOptimize(wideStruct->getChild(lastFieldName));
+        }
+    }
+
     struct Userdata
     {
         inline static const char* const name = "Userdata";
@@ -402,6 +476,11 @@ namespace rlogic
     BENCHMARK(BM_GetPropertyGlobal)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
     BENCHMARK(BM_GetProperty)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
     BENCHMARK(BM_GetPropertyNested)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
+    BENCHMARK(BM_GetPropertyLongNames)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
+    // Access to first and last field of a struct from Lua and from C++ (Property::getChild)
+    // ARG: number of fields in the struct
+    BENCHMARK(BM_GetPropertyWideStruct)->Arg(10)->Arg(100)->Arg(500)->Unit(benchmark::TimeUnit::kMillisecond);
+    BENCHMARK(BM_GetChildByNameWideStruct)->Arg(10)->Arg(100)->Arg(500);
     // for comparison: Simple userdata with pure sol
     BENCHMARK(BM_GetSolUserdataIndex)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
     BENCHMARK(BM_GetSolUserdataBind)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
@@ -109,5 +109,154 @@ namespace rlogic
     // Same as BM_Links_CreateDestroyLink, but tests with many scripts (how fast is link (re)creation depending on scripts count)
     // ARG: script count
     BENCHMARK(BM_Links_CreateDestroyLink_ManyScripts)->Arg(8)->Arg(32)->Arg(128);
-}
 
+    static void BM_Links_LinkUnlinkAndUpdate_ManyNodes(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::string scriptSrc = R"(
+            function interface(IN,OUT)
+                IN.target1 = Type:Int32()
+                IN.target2 = Type:Int32()
+                OUT.src = Type:Int32()
+            end
+            function run(IN,OUT)
+            end
+        )";
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+
+        // Pairs of linked scripts, otherwise independent of each other
+        std::vector<LuaScript*> scripts(scriptCount);
+        for (int64_t i = 0; i < scriptCount; ++i)
+        {
+            scripts[i] = logicEngine.createLuaScript(scriptSrc, config);
+            if (i % 2 == 1)
+                logicEngine.link(*scripts[i - 1]->getOutputs()->getChild("src"), *scripts[i]->getInputs()->getChild("target1"));
+        }
+        logicEngine.update();
+
+        // Link last created script to the first one, i.e. against the order in which nodes were created,
+        // which requires the topological order to be adjusted
+        const Property* lastScriptOutput = scripts.back()->getOutputs()->getChild("src");
+        const Property* firstScriptInput = scripts.front()->getInputs()->getChild("target2");
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.link(*lastScriptOutput, *firstScriptInput);
+            logicEngine.update();
+            logicEngine.unlink(*lastScriptOutput, *firstScriptInput);
+            logicEngine.update();
+        }
+    }
+
+    // Measures cost of relinking few properties and updating in a large scene (only the relinked nodes are dirty,
+    // so this is dominated by maintaining the topological order of nodes)
+    // ARG: script count
+    BENCHMARK(BM_Links_LinkUnlinkAndUpdate_ManyNodes)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    static void BM_Links_ActivateLinks_DeeplyNestedOutputs(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t nestingDepth = state.range(0);
+
+        const std::string srcScriptSrc = fmt::format(R"(
+            function interface(IN,OUT)
+                IN.trigger = Type:Int32()
+                local function makeLevel(depth)
+                    local level = {{}}
+                    for i = 0,7,1 do
+                        level["value"..tostring(i)] = Type:Int32()
+                    end
+                    level.array = Type:Array(8, Type:Vec3f())
+                    if depth > 1 then
+                        level.nested = makeLevel(depth - 1)
+                    end
+                    return level
+                end
+                OUT.data = makeLevel({})
+            end
+            function run(IN,OUT)
+            end
+        )", nestingDepth);
+
+        const std::string destScriptSrc = R"(
+            function interface(IN,OUT)
+                IN.top = Type:Int32()
+                IN.deep = Type:Int32()
+            end
+            function run(IN,OUT)
+            end
+        )";
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+
+        LuaScript* srcScript = logicEngine.createLuaScript(srcScriptSrc, config);
+        LuaScript* destScript = logicEngine.createLuaScript(destScriptSrc, config);
+
+        // Only one leaf on the top level and one on the deepest level are linked
+        const Property* topLevel = srcScript->getOutputs()->getChild("data");
+        const Property* deepestLevel = topLevel;
+        for (int64_t i = 1; i < nestingDepth; ++i)
+            deepestLevel = deepestLevel->getChild("nested");
+        logicEngine.link(*topLevel->getChild("value0"), *destScript->getInputs()->getChild("top"));
+        logicEngine.link(*deepestLevel->getChild("value0"), *destScript->getInputs()->getChild("deep"));
+        logicEngine.update();
+
+        Property* trigger = srcScript->getInputs()->getChild("trigger");
+        int32_t triggerValue = 0;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // source script is executed every update, its outputs do not change so the destination script is not
+            trigger->set(++triggerValue);
+            logicEngine.update();
+        }
+    }
+
+    // Measures the cost of activating links after the execution of a node whose outputs form a deep hierarchy
+    // of structs and arrays, out of which only two leaves are linked (each nesting level adds 16 output properties)
+    // ARG: nesting depth of the output structs
+    BENCHMARK(BM_Links_ActivateLinks_DeeplyNestedOutputs)->Arg(1)->Arg(10)->Arg(50)->Unit(benchmark::kMicrosecond);
+
+    static void BM_Links_GetPropertyLinks(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::string scriptSrc = R"(
+            function interface(IN,OUT)
+                IN.target = Type:Int32()
+                IN.data = { a = Type:Vec3f(), b = Type:Array(8, Type:Float()) }
+                OUT.src = Type:Int32()
+                OUT.data = { a = Type:Vec3f(), b = Type:Array(8, Type:Float()) }
+            end
+            function run(IN,OUT)
+            end
+        )";
+
+        // Chain of linked scripts
+        std::vector<LuaScript*> scripts(scriptCount);
+        for (int64_t i = 0; i < scriptCount; ++i)
+        {
+            scripts[i] = logicEngine.createLuaScript(scriptSrc);
+            if (i >= 1)
+                logicEngine.link(*scripts[i - 1]->getOutputs()->getChild("src"), *scripts[i]->getInputs()->getChild("target"));
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // links don't change between calls, like an editor polling links every frame
+            benchmark::DoNotOptimize(logicEngine.getPropertyLinks().size());
+        }
+    }
+
+    // Measures the cost of retrieving all links when they did not change since previous call
+    // ARG: script count
+    BENCHMARK(BM_Links_GetPropertyLinks)->Arg(10)->Arg(100)->Arg(1000);
+}
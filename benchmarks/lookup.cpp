@@ -0,0 +1,92 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/TimerNode.h"
+#include "ramses-logic/DataArray.h"
+
+#include "fmt/format.h"
+
+#include <deque>
+
+namespace rlogic
+{
+    static void CreateNamedObjects(LogicEngine& logicEngine, int64_t objectCount)
+    {
+        for (int64_t i = 0; i < objectCount; ++i)
+        {
+            // mix types, so that typed lookup has to skip objects of other types with similar names
+            if (i % 2 == 0)
+                logicEngine.createTimerNode(fmt::format("timer{}", i));
+            else
+                logicEngine.createDataArray(std::vector<float>{ 1.f }, fmt::format("data{}", i));
+        }
+    }
+
+    static void BM_FindByName(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t objectCount = state.range(0);
+        CreateNamedObjects(logicEngine, objectCount);
+
+        // last created object is the worst case when searching linearly
+        const std::string name = fmt::format("timer{}", (objectCount - 1) / 2 * 2);
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            benchmark::DoNotOptimize(logicEngine.findByName<TimerNode>(name));
+        }
+    }
+
+    // ARG: number of objects in logic engine
+    BENCHMARK(BM_FindByName)->Arg(1000)->Arg(10000)->Arg(100000);
+
+    static void BM_FindByNames(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t objectCount = state.range(0);
+        CreateNamedObjects(logicEngine, objectCount);
+
+        // resolve a few hundred objects spread over all objects, like an application would do after loading
+        std::vector<std::string> names;
+        for (int64_t i = 0; i < objectCount; i += objectCount / 500)
+            names.push_back(fmt::format("timer{}", i / 2 * 2));
+        const std::vector<std::string_view> nameViews(names.cbegin(), names.cend());
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            benchmark::DoNotOptimize(logicEngine.findByNames<TimerNode>(nameViews));
+        }
+    }
+
+    // ARG: number of objects in logic engine
+    BENCHMARK(BM_FindByNames)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+    static void BM_CreateAndDestroyObject(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        std::deque<LogicObject*> objects;
+        for (int64_t i = 0; i < state.range(0); ++i)
+            objects.push_back(logicEngine.createDataArray(std::vector<float>{ 1.f }, fmt::format("data{}", i)));
+
+        // always destroy the oldest object, worst case when erasing objects from a vector
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            objects.push_back(logicEngine.createDataArray(std::vector<float>{ 1.f }, "data"));
+            logicEngine.destroy(*objects.front());
+            objects.pop_front();
+        }
+    }
+
+    // ARG: number of objects in logic engine
+    BENCHMARK(BM_CreateAndDestroyObject)->Arg(1000)->Arg(10000)->Arg(100000);
+}
@@ -10,9 +10,11 @@
 
 #include "ramses-logic/LogicEngine.h"
 #include "ramses-logic/LuaScript.h"
+#include "ramses-logic/LuaInterface.h"
 #include "ramses-logic/Property.h"
 
 #include "impl/LogicEngineImpl.h"
+#include "impl/PropertyImpl.h"
 #include "fmt/format.h"
 
 namespace rlogic
@@ -49,6 +51,118 @@ namespace rlogic
     // Measures time to set the value of a property to script based on how many properties are there in the script's interface()
     // ARG: how many properties are in the script's interface
     BENCHMARK(BM_Property_SetIntValue)->Arg(10)->Arg(100)->Arg(1000);
-}
 
+    static void BM_Property_MemoryFootprint_LinkedInterfaces(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t nodeCount = state.range(0);
+
+        const std::string interfaceSrc = R"(
+            function interface(inout)
+                inout.value = Type:Float()
+                inout.struct = {
+                    int = Type:Int32(),
+                    float = Type:Float(),
+                    vec3f = Type:Vec3f(),
+                    vec4f = Type:Vec4f(),
+                    flag = Type:Bool(),
+                    name = Type:String()
+                }
+                inout.array = Type:Array(4, Type:Vec3f())
+            end
+        )";
+
+        // Chain of interfaces, each linked to the previous one with few properties
+        std::vector<LuaInterface*> interfaces(static_cast<size_t>(nodeCount));
+        size_t propertyMemory = 0u;
+        for (size_t i = 0; i < interfaces.size(); ++i)
+        {
+            interfaces[i] = logicEngine.createLuaInterface(interfaceSrc, fmt::format("intf{}", i));
+            propertyMemory += interfaces[i]->getInputs()->m_impl->getMemoryUsage();
+
+            if (i >= 1)
+            {
+                const Property* source = interfaces[i - 1]->getOutputs();
+                Property* target = interfaces[i]->getInputs();
+                logicEngine.link(*source->getChild("value"), *target->getChild("value"));
+                logicEngine.link(*source->getChild("struct")->getChild("vec4f"), *target->getChild("struct")->getChild("vec4f"));
+                logicEngine.link(*source->getChild("array")->getChild(0), *target->getChild("array")->getChild(0));
+            }
+        }
+        logicEngine.update();
+
+        Property* chainInput = interfaces.front()->getInputs()->getChild("value");
+        float value = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // value propagates through the whole chain
+            chainInput->set<float>(value);
+            value += 1.f;
+            logicEngine.update();
+        }
+
+        // Memory occupied by the property trees (property objects and their values) of all nodes
+        state.counters["PropertyMemoryTotal"] = benchmark::Counter(static_cast<double>(propertyMemory), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+        state.counters["PropertyMemoryPerNode"] = benchmark::Counter(static_cast<double>(propertyMemory) / static_cast<double>(nodeCount));
+    }
+
+    // Reports memory footprint of the properties in a scene of linked interfaces (each with 14 properties)
+    // and measures propagation of a value through the links of all nodes
+    // ARG: node count
+    BENCHMARK(BM_Property_MemoryFootprint_LinkedInterfaces)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    static void BM_Property_MemoryFootprint_ScriptsWithSameSource(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::string scriptSrc = R"(
+            function interface(IN,OUT)
+                IN.transform = {
+                    translation = Type:Vec3f(),
+                    rotation = Type:Vec4f(),
+                    scaling = Type:Vec3f()
+                }
+                IN.material = {
+                    baseColor = Type:Vec4f(),
+                    roughness = Type:Float(),
+                    metallic = Type:Float(),
+                    textureName = Type:String()
+                }
+                IN.weights = Type:Array(8, Type:Float())
+                OUT.transform = {
+                    translation = Type:Vec3f(),
+                    rotation = Type:Vec4f(),
+                    scaling = Type:Vec3f()
+                }
+                OUT.visible = Type:Bool()
+            end
+            function run(IN,OUT)
+            end
+        )";
+
+        // All scripts have the same interface, names and types of their properties are shared, only values are per script
+        size_t propertyMemory = 0u;
+        for (int64_t i = 0; i < scriptCount; ++i)
+        {
+            const LuaScript* script = logicEngine.createLuaScript(scriptSrc, {}, fmt::format("script{}", i));
+            propertyMemory += script->getInputs()->m_impl->getMemoryUsage() + script->getOutputs()->m_impl->getMemoryUsage();
+        }
 
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LuaScript* script = logicEngine.createLuaScript(scriptSrc, {}, "script");
+            logicEngine.destroy(*script);
+        }
+
+        state.counters["PropertyMemoryTotal"] = benchmark::Counter(static_cast<double>(propertyMemory), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+        state.counters["PropertyMemoryPerScript"] = benchmark::Counter(static_cast<double>(propertyMemory) / static_cast<double>(scriptCount));
+    }
+
+    // Reports memory footprint of the properties of many scripts created from the same source (25 properties each)
+    // and measures creation of one more such script
+    // ARG: script count
+    BENCHMARK(BM_Property_MemoryFootprint_ScriptsWithSameSource)->Arg(100)->Arg(10000)->Unit(benchmark::kMicrosecond);
+}
@@ -12,17 +12,30 @@
 #include "ramses-logic/LuaScript.h"
 #include "ramses-logic/Property.h"
 #include "ramses-logic/Logger.h"
+#include "ramses-logic/DataArray.h"
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/AnimationNodeConfig.h"
+#include "impl/LogicEngineImpl.h"
 
 #include "fmt/format.h"
 #include <fstream>
+#include <algorithm>
+#include <cmath>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 namespace rlogic
 {
-    static std::vector<char> CreateLargeLogicEngineBuffer(std::string_view fileName, int64_t scriptCount)
+    static std::vector<char> CreateLargeLogicEngineBuffer(std::string_view fileName, int64_t scriptCount, EFeatureLevel featureLevel = EFeatureLevel_01)
     {
         Logger::SetLogVerbosityLimit(ELogMessageType::Off);
 
-        LogicEngine logicEngine;
+        LogicEngine logicEngine{ featureLevel };
 
         const std::string scriptSrc = R"(
             function interface(IN,OUT)
@@ -101,5 +114,288 @@ namespace rlogic
 
     // ARG: script count
     BENCHMARK(BM_LoadFromBuffer_WithoutVerifier)->Arg(8)->Arg(32)->Arg(128)->Unit(benchmark::kMicrosecond);
-}
 
+    static void BM_LoadFromBuffer_Threads(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+        const auto threadCount = static_cast<size_t>(state.range(1));
+        const auto luaStateCount = static_cast<size_t>(state.range(2));
+
+        const std::vector<char> buffer = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount);
+
+        internal::DeserializationTimings timings;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LogicEngine logicEngine;
+            logicEngine.setLuaStateCount(luaStateCount);
+            logicEngine.setLoadThreadCount(threadCount);
+            logicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+            timings = logicEngine.m_impl->getLastLoadTimings();
+        }
+
+        // durations of the phases of the last load
+        state.counters["ModulesUs"] = static_cast<double>(timings.luaModules.count());
+        state.counters["IndependentObjectsUs"] = static_cast<double>(timings.independentObjects.count());
+        state.counters["ScriptsUs"] = static_cast<double>(timings.luaScripts.count());
+        state.counters["OtherObjectsUs"] = static_cast<double>(timings.otherObjects.count());
+        state.counters["LinksUs"] = static_cast<double>(timings.links.count());
+    }
+
+    // ARG: script count, load thread count, Lua state count
+    BENCHMARK(BM_LoadFromBuffer_Threads)
+        ->Args({ 3000, 1, 1 })->Args({ 3000, 2, 1 })->Args({ 3000, 4, 1 })->Args({ 3000, 8, 1 })
+        ->Args({ 3000, 1, 4 })->Args({ 3000, 2, 4 })->Args({ 3000, 4, 4 })->Args({ 3000, 8, 4 })
+        ->Unit(benchmark::kMillisecond);
+
+    // Time to first frame: load and first update, with or without lazy loading of Lua scripts
+    static void BM_LoadFromBuffer_LazyScripts(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+        const bool lazyLoading = state.range(1) != 0;
+
+        const std::vector<char> buffer = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LogicEngine logicEngine;
+            logicEngine.enableLazyLuaScriptLoading(lazyLoading);
+            logicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+            logicEngine.update();
+        }
+    }
+
+    // ARG: script count, lazy loading of scripts (0 = off, 1 = on)
+    BENCHMARK(BM_LoadFromBuffer_LazyScripts)
+        ->Args({ 300, 0 })->Args({ 300, 1 })->Args({ 3000, 0 })->Args({ 3000, 1 })
+        ->Unit(benchmark::kMillisecond);
+
+    // Compares encoding of properties per feature level, feature level 06 stores property trees with columnar encoding
+    static void BM_LoadFromBuffer_PropertyEncoding(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+        const auto featureLevel = static_cast<EFeatureLevel>(state.range(1));
+
+        const std::vector<char> buffer = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount, featureLevel);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LogicEngine logicEngine{ featureLevel };
+            logicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+        }
+
+        state.counters["FileSize"] = benchmark::Counter(static_cast<double>(buffer.size()), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    }
+
+    // ARG: script count, feature level
+    BENCHMARK(BM_LoadFromBuffer_PropertyEncoding)
+        ->Args({ 128, EFeatureLevel_05 })->Args({ 128, EFeatureLevel_06 })->Args({ 3000, EFeatureLevel_05 })->Args({ 3000, EFeatureLevel_06 })
+        ->Unit(benchmark::kMillisecond);
+
+    static void CreateAnimationKeyframes(LogicEngine& logicEngine, size_t keyframeCount)
+    {
+        std::vector<float> timestamps(keyframeCount);
+        std::vector<vec3f> translations(keyframeCount);
+        std::vector<vec4f> rotations(keyframeCount);
+        std::vector<std::vector<float>> morphWeights(keyframeCount, std::vector<float>(8u));
+        for (size_t i = 0u; i < keyframeCount; ++i)
+        {
+            const float t = static_cast<float>(i) / 60.f;
+            timestamps[i] = t;
+            translations[i] = { 10.f * std::sin(t), 0.5f * t, 2.f * std::cos(3.f * t) };
+            const float angle = 0.25f * t;
+            rotations[i] = { 0.48f * std::sin(angle), 0.64f * std::sin(angle), 0.6f * std::sin(angle), std::cos(angle) };
+            for (size_t w = 0u; w < morphWeights[i].size(); ++w)
+                morphWeights[i][w] = 0.5f + 0.5f * std::sin(t + static_cast<float>(w));
+        }
+
+        AnimationNodeConfig config;
+        const auto* timestampsArray = logicEngine.createDataArray(timestamps, "timestamps");
+        config.addChannel({ "translation", timestampsArray, logicEngine.createDataArray(translations, "translations"), EInterpolationType::Linear });
+        config.addChannel({ "rotation", timestampsArray, logicEngine.createDataArray(rotations, "rotations"), EInterpolationType::Linear_Quaternions });
+        config.addChannel({ "weights", timestampsArray, logicEngine.createDataArray(morphWeights, "weights"), EInterpolationType::Linear });
+        logicEngine.createAnimationNode(config, "animNode");
+    }
+
+    template <typename T>
+    static float GetMaxDifference(const LogicEngine& original, const LogicEngine& loaded, std::string_view dataArrayName)
+    {
+        const auto& originalData = *original.findByName<DataArray>(dataArrayName)->getData<T>();
+        const auto& loadedData = *loaded.findByName<DataArray>(dataArrayName)->getData<T>();
+        float maxDifference = 0.f;
+        for (size_t i = 0u; i < originalData.size(); ++i)
+        {
+            if constexpr (std::is_same_v<T, float>)
+            {
+                maxDifference = std::max(maxDifference, std::abs(originalData[i] - loadedData[i]));
+            }
+            else
+            {
+                for (size_t c = 0u; c < originalData[i].size(); ++c)
+                    maxDifference = std::max(maxDifference, std::abs(originalData[i][c] - loadedData[i][c]));
+            }
+        }
+        return maxDifference;
+    }
+
+    // File size, accuracy and decoding time of compressed data arrays (feature level 07)
+    static void BM_LoadFromBuffer_DataArrayCompression(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const auto keyframeCount = static_cast<size_t>(state.range(0));
+        const auto compression = static_cast<EDataArrayCompression>(state.range(1));
+
+        LogicEngine logicEngine{ EFeatureLevel_07 };
+        CreateAnimationKeyframes(logicEngine, keyframeCount);
+
+        SaveFileConfig config;
+        config.setValidationEnabled(false);
+        config.setDataArrayCompression(compression);
+        std::vector<char> buffer;
+        logicEngine.saveToBuffer(buffer, config);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LogicEngine loadedLogicEngine{ EFeatureLevel_07 };
+            loadedLogicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+        }
+
+        LogicEngine loadedLogicEngine{ EFeatureLevel_07 };
+        loadedLogicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+        state.counters["FileSize"] = benchmark::Counter(static_cast<double>(buffer.size()), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+        state.counters["MaxTimestampError"] = GetMaxDifference<float>(logicEngine, loadedLogicEngine, "timestamps");
+        state.counters["MaxTranslationError"] = GetMaxDifference<vec3f>(logicEngine, loadedLogicEngine, "translations");
+        state.counters["MaxRotationError"] = GetMaxDifference<vec4f>(logicEngine, loadedLogicEngine, "rotations");
+        state.counters["MaxWeightError"] = GetMaxDifference<std::vector<float>>(logicEngine, loadedLogicEngine, "weights");
+    }
+
+    // ARG: keyframe count, compression (0 = none, 1 = quantized keyframes)
+    BENCHMARK(BM_LoadFromBuffer_DataArrayCompression)
+        ->Args({ 1000, 0 })->Args({ 1000, 1 })->Args({ 100000, 0 })->Args({ 100000, 1 })
+        ->Unit(benchmark::kMicrosecond);
+
+    // Peak resident memory of the whole process so far, i.e. benchmark results are only comparable when run separately
+    // (using --benchmark_filter), otherwise the highest peak of all previously executed benchmarks is reported
+    static double GetPeakResidentMemory()
+    {
+#if defined(_WIN32)
+        return 0.0;
+#else
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access) system struct
+        return static_cast<double>(usage.ru_maxrss) * 1024.0;
+#endif
+    }
+
+    static void BM_LoadFromFile(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+
+        const size_t fileSize = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount).size();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LogicEngine logicEngine;
+            logicEngine.loadFromFile("largeFile.bin", nullptr, false);
+        }
+
+        state.counters["FileSize"] = benchmark::Counter(static_cast<double>(fileSize), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+        state.counters["PeakRSS"] = benchmark::Counter(GetPeakResidentMemory(), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    }
+
+    // Loads the file the way loadFromFile did before it used memory mapping: read whole file to memory, then load from the copy
+    static void BM_LoadFromFile_ReadIntoBuffer(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+
+        const size_t fileSize = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount).size();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            std::ifstream fileStream("largeFile.bin", std::ifstream::binary);
+            std::vector<char> byteBuffer(fileSize);
+            fileStream.read(byteBuffer.data(), static_cast<std::streamsize>(byteBuffer.size()));
+
+            LogicEngine logicEngine;
+            logicEngine.loadFromBuffer(byteBuffer.data(), byteBuffer.size(), nullptr, false);
+        }
+
+        state.counters["FileSize"] = benchmark::Counter(static_cast<double>(fileSize), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+        state.counters["PeakRSS"] = benchmark::Counter(GetPeakResidentMemory(), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    }
+
+    // ARG: script count (large counts produce files of more than 10MB)
+    BENCHMARK(BM_LoadFromFile)->Arg(128)->Arg(4096)->Unit(benchmark::kMillisecond);
+    BENCHMARK(BM_LoadFromFile_ReadIntoBuffer)->Arg(128)->Arg(4096)->Unit(benchmark::kMillisecond);
+
+#if !defined(_WIN32)
+    static void CreateLargeDataArrays(LogicEngine& logicEngine, int64_t dataArraySizeMB)
+    {
+        constexpr int64_t DataArrayCount = 8;
+        const auto elementCount = static_cast<size_t>(dataArraySizeMB * 1024 * 1024) / sizeof(vec4f);
+        for (int64_t i = 0; i < DataArrayCount; ++i)
+        {
+            logicEngine.createDataArray(std::vector<vec4f>(elementCount, vec4f{ 1.f, 2.f, 3.f, 4.f }), fmt::format("data{}", i));
+        }
+    }
+
+    // Peak memory when saving content dominated by large data arrays, run each variant separately (see GetPeakResidentMemory)
+    static void BM_SaveLargeDataArrays(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t dataArraySizeMB = state.range(0);
+        const int64_t saveMode = state.range(1);
+
+        LogicEngine logicEngine{ EFeatureLevel_Latest };
+        CreateLargeDataArrays(logicEngine, dataArraySizeMB);
+        const double memoryBeforeSaving = GetPeakResidentMemory();
+
+        SaveFileConfig configNoValidation;
+        configNoValidation.setValidationEnabled(false);
+        std::vector<char> buffer;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            switch (saveMode)
+            {
+            case 0:
+                logicEngine.saveToFile("largeFile.bin", configNoValidation);
+                break;
+            case 1:
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) system call
+                const int fd = ::open("largeFile.bin", O_CREAT | O_TRUNC | O_WRONLY, S_IRUSR | S_IWUSR);
+                logicEngine.saveToFileDescriptor(fd, configNoValidation);
+                ::close(fd);
+                break;
+            }
+            default:
+                logicEngine.saveToBuffer(buffer, configNoValidation);
+                break;
+            }
+        }
+
+        const double peakMemory = GetPeakResidentMemory();
+        state.counters["PeakRSS"] = benchmark::Counter(peakMemory, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+        // memory needed for saving on top of the content
+        state.counters["SavingPeakRSS"] = benchmark::Counter(peakMemory - memoryBeforeSaving, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+        state.counters["FileSize"] = benchmark::Counter(static_cast<double>(buffer.empty() ? logicEngine.getTotalSerializedSize() : buffer.size()), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    }
+
+    // ARG: size of each of the 8 data arrays in MB, save mode (0 = to file, 1 = to file descriptor, 2 = to buffer)
+    BENCHMARK(BM_SaveLargeDataArrays)
+        ->Args({ 16, 0 })->Args({ 16, 1 })->Args({ 16, 2 })
+        ->Unit(benchmark::kMillisecond);
+#endif
+}
@@ -0,0 +1,124 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "impl/LogicNodeImpl.h"
+#include "internals/DirectedAcyclicGraph.h"
+
+#include "fmt/format.h"
+
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+namespace rlogic::internal
+{
+    // Node without properties, only used as graph vertex
+    class TopologyBenchmarkNode : public LogicNodeImpl
+    {
+    public:
+        explicit TopologyBenchmarkNode(std::string_view name)
+            : LogicNodeImpl(name, 1u)
+        {
+        }
+
+        std::optional<LogicNodeRuntimeError> update() override
+        {
+            return std::nullopt;
+        }
+
+        void createRootProperties() final {}
+    };
+
+    // Creates 'nodeCount' nodes where every node has edges to the next 3 nodes (if any)
+    static std::vector<std::unique_ptr<TopologyBenchmarkNode>> CreateLayeredGraph(DirectedAcyclicGraph& graph, int64_t nodeCount)
+    {
+        std::vector<std::unique_ptr<TopologyBenchmarkNode>> nodes;
+        nodes.reserve(static_cast<size_t>(nodeCount));
+        for (int64_t i = 0; i < nodeCount; ++i)
+        {
+            nodes.push_back(std::make_unique<TopologyBenchmarkNode>(fmt::format("node{}", i)));
+            graph.addNode(*nodes.back());
+        }
+
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            for (size_t j = i + 1; j < std::min(i + 4, nodes.size()); ++j)
+                graph.addEdge(*nodes[i], *nodes[j]);
+        }
+
+        return nodes;
+    }
+
+    static void BM_TopologySort_AddRemoveEdgeAgainstOrder(benchmark::State& state)
+    {
+        DirectedAcyclicGraph graph;
+        const auto nodes = CreateLayeredGraph(graph, state.range(0));
+
+        // Extra node which is alternately linked before the first and after the last node,
+        // each link contradicts the current order and forces reordering of the whole graph
+        TopologyBenchmarkNode extraNode("extra");
+        graph.addNode(extraNode);
+        (void)graph.getTopologicallySortedNodes();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            graph.addEdge(extraNode, *nodes.front());
+            benchmark::DoNotOptimize(graph.getTopologicallySortedNodes());
+            graph.removeEdge(extraNode, *nodes.front());
+
+            graph.addEdge(*nodes.back(), extraNode);
+            benchmark::DoNotOptimize(graph.getTopologicallySortedNodes());
+            graph.removeEdge(*nodes.back(), extraNode);
+        }
+    }
+
+    // Measures topology sort only (no logic nodes update), worst case where every node has to be reordered
+    // ARG: node count
+    BENCHMARK(BM_TopologySort_AddRemoveEdgeAgainstOrder)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    static void BM_TopologySort_AddRemoveEdgeInOrder(benchmark::State& state)
+    {
+        DirectedAcyclicGraph graph;
+        const auto nodes = CreateLayeredGraph(graph, state.range(0));
+        (void)graph.getTopologicallySortedNodes();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            graph.addEdge(*nodes.front(), *nodes.back());
+            benchmark::DoNotOptimize(graph.getTopologicallySortedNodes());
+            graph.removeEdge(*nodes.front(), *nodes.back());
+        }
+    }
+
+    // Same as above, but the edge agrees with current order, i.e. no reordering is needed
+    // ARG: node count
+    BENCHMARK(BM_TopologySort_AddRemoveEdgeInOrder)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    static void BM_TopologySort_AddRemoveNode(benchmark::State& state)
+    {
+        DirectedAcyclicGraph graph;
+        const auto nodes = CreateLayeredGraph(graph, state.range(0));
+        (void)graph.getTopologicallySortedNodes();
+
+        TopologyBenchmarkNode extraNode("extra");
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            graph.addNode(extraNode);
+            graph.addEdge(extraNode, *nodes.front());
+            benchmark::DoNotOptimize(graph.getTopologicallySortedNodes());
+            graph.removeNode(extraNode);
+            benchmark::DoNotOptimize(graph.getTopologicallySortedNodes());
+        }
+    }
+
+    // Measures cost of adding/removing node and querying the resulting order
+    // ARG: node count
+    BENCHMARK(BM_TopologySort_AddRemoveNode)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+}
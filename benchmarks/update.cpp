@@ -10,7 +10,11 @@
 
 #include "ramses-logic/LogicEngine.h"
 #include "ramses-logic/LuaScript.h"
+#include "ramses-logic/LuaModule.h"
 #include "ramses-logic/Property.h"
+#include "ramses-logic/DataArray.h"
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/AnimationNodeConfig.h"
 
 #include "impl/LogicEngineImpl.h"
 #include "fmt/format.h"
@@ -132,14 +136,15 @@ namespace rlogic
     // first in the list has its 'dirty_trigger' value changed, all scripts in the change will be
     // triggered for re-execution, whereas setting the trigger on the last script will only have the
     // last script executed
-    // Read the results like this: the higher the arg (0 .. 99) the faster the update should be, ideally
-    // when the arg is close to 99, the time to update should be close to zero
+    // Read the results like this: the higher the first arg (0 .. script count - 1) the faster the update should be, ideally
+    // when the arg is close to the last script, the time to update should be close to zero - also with large script count,
+    // because only dirty scripts are visited during update
     static void BM_Update_IsFasterWithFewerDirtyScripts(benchmark::State& state)
     {
         LogicEngine logicEngine;
 
         const int64_t scriptToSetDirty = state.range(0);
-        constexpr int64_t scriptCount = 100;
+        const int64_t scriptCount = state.range(1);
 
         const std::string scriptSrc = R"(
             function interface(IN,OUT)
@@ -197,7 +202,115 @@ namespace rlogic
         }
     }
 
-    BENCHMARK(BM_Update_IsFasterWithFewerDirtyScripts)->Arg(0)->Arg(49)->Arg(99)->Unit(benchmark::kMillisecond);
-}
+    // ARG: index of script to set dirty
+    // ARG: script count
+    BENCHMARK(BM_Update_IsFasterWithFewerDirtyScripts)
+        ->Args({ 0, 100 })->Args({ 49, 100 })->Args({ 99, 100 })
+        ->Args({ 0, 10000 })->Args({ 9949, 10000 })->Args({ 9999, 10000 })
+        ->Unit(benchmark::kMillisecond);
+
+    static void BM_Update_ParallelAnimations(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const auto threadCount = static_cast<size_t>(state.range(0));
+        const int64_t animationCount = state.range(1);
+        constexpr size_t channelCount = 10u;
+        constexpr size_t keyframeCount = 100u;
+
+        std::vector<float> timeStamps(keyframeCount);
+        std::vector<vec4f> keyframes(keyframeCount);
+        for (size_t i = 0u; i < keyframeCount; ++i)
+        {
+            timeStamps[i] = static_cast<float>(i);
+            keyframes[i] = { static_cast<float>(i), 0.f, 1.f, 2.f };
+        }
+        const auto timeStampsArray = logicEngine.createDataArray(timeStamps);
+        const auto keyframesArray = logicEngine.createDataArray(keyframes);
+
+        AnimationNodeConfig config;
+        for (size_t i = 0u; i < channelCount; ++i)
+            config.addChannel({ fmt::format("channel{}", i), timeStampsArray, keyframesArray, EInterpolationType::Linear });
+
+        // all animations are independent, i.e. in single update level
+        std::vector<Property*> progressInputs;
+        for (int64_t i = 0; i < animationCount; ++i)
+            progressInputs.push_back(logicEngine.createAnimationNode(config, fmt::format("animation{}", i))->getInputs()->getChild("progress"));
+
+        logicEngine.setUpdateThreadCount(threadCount);
+
+        float progress = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            progress = (progress > 0.9f ? 0.f : progress + 0.01f);
+            for (auto input : progressInputs)
+                input->set(progress);
+            logicEngine.update();
+        }
+    }
+
+    // Measures update() of many independent animation nodes executed on multiple threads
+    // ARG: thread count
+    // ARG: animation node count (each with 10 channels)
+    BENCHMARK(BM_Update_ParallelAnimations)
+        ->Args({ 1, 100 })->Args({ 2, 100 })->Args({ 4, 100 })->Args({ 8, 100 })
+        ->Args({ 1, 1000 })->Args({ 2, 1000 })->Args({ 4, 1000 })->Args({ 8, 1000 })
+        ->Unit(benchmark::kMicrosecond);
+
+    static void BM_Update_ParallelScriptsInLuaStates(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
 
+        const auto luaStateCount = static_cast<size_t>(state.range(0));
+        constexpr int64_t scriptCount = 200;
 
+        logicEngine.setLuaStateCount(luaStateCount);
+        logicEngine.setUpdateThreadCount(luaStateCount);
+
+        const std::string_view moduleSrc = R"(
+            local mymath = {}
+            function mymath.wave(x)
+                return math.sin(x) * math.cos(x * 0.5)
+            end
+            return mymath
+        )";
+        LuaConfig moduleConfig;
+        moduleConfig.addStandardModuleDependency(EStandardModule::Math);
+        const auto module = logicEngine.createLuaModule(moduleSrc, moduleConfig);
+
+        const std::string_view scriptSrc = R"(
+            modules("mymath")
+            function interface(IN,OUT)
+                IN.value = Type:Float()
+                OUT.value = Type:Float()
+            end
+            function run(IN,OUT)
+                local sum = 0
+                for i = 1,200 do
+                    sum = sum + mymath.wave(IN.value + i)
+                end
+                OUT.value = sum
+            end
+        )";
+        LuaConfig config;
+        config.addDependency("mymath", *module);
+
+        // all scripts are independent, i.e. in single update level
+        std::vector<Property*> inputs;
+        for (int64_t i = 0; i < scriptCount; ++i)
+            inputs.push_back(logicEngine.createLuaScript(scriptSrc, config, fmt::format("script{}", i))->getInputs()->getChild("value"));
+
+        float value = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            value += 0.01f;
+            for (auto input : inputs)
+                input->set(value);
+            logicEngine.update();
+        }
+    }
+
+    // Measures update() of 200 independent scripts distributed among multiple Lua states, each Lua state gets its own update thread
+    // ARG: Lua state count (= update thread count)
+    BENCHMARK(BM_Update_ParallelScriptsInLuaStates)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMicrosecond);
+}
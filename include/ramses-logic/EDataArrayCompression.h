@@ -0,0 +1,31 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+namespace rlogic
+{
+    /**
+     * Modes determining how to store the data of #rlogic::DataArray instances when saving.
+     * Compressed data is decoded when loading, loaded #rlogic::DataArray instances hold float values as usual.
+     */
+    enum class EDataArrayCompression
+    {
+        /// All data is stored as provided when #rlogic::DataArray was created (full precision).
+        None,
+        /// Keyframes and tangents of #rlogic::AnimationNode channels are stored compressed (available for feature level #rlogic::EFeatureLevel_07 and higher):
+        ///  - keyframes of quaternion channels (#rlogic::EInterpolationType::Linear_Quaternions and #rlogic::EInterpolationType::Cubic_Quaternions)
+        ///    use 6 bytes per quaternion instead of 16, maximum error of a quaternion component is about 1e-4
+        ///  - all other float based keyframes and tangents use 16 bits per component, every component is quantized within its range of values
+        ///    over the whole #rlogic::DataArray, i.e. maximum error is half of that range divided by 65535
+        /// Timestamps and #rlogic::DataArray instances not used by any #rlogic::AnimationNode are always stored with full precision,
+        /// so are data which can't be compressed (e.g. contain values which are not finite or quaternions which are not normalized).
+        /// **Important!** This compression is lossy, values loaded from file differ slightly from the values provided when #rlogic::DataArray was created.
+        QuantizedKeyframes
+    };
+}
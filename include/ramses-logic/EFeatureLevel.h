@@ -70,10 +70,18 @@ namespace rlogic
         /// - RamsesMeshNodeBinding
         EFeatureLevel_05 = 5,
 
+        /// Added features:
+        /// - Columnar encoding of properties in serialized files (smaller files, faster loading)
+        EFeatureLevel_06 = 6,
+
+        /// Added features:
+        /// - Compressed #rlogic::DataArray data in serialized files, see #rlogic::SaveFileConfig::setDataArrayCompression
+        EFeatureLevel_07 = 7,
+
         /// Equals to the latest feature level
-        EFeatureLevel_Latest = EFeatureLevel_05
+        EFeatureLevel_Latest = EFeatureLevel_07
     };
 
     /// List of all supported feature levels
-    constexpr std::array<EFeatureLevel, 5u> AllFeatureLevels{ EFeatureLevel_01, EFeatureLevel_02, EFeatureLevel_03, EFeatureLevel_04, EFeatureLevel_05 };
+    constexpr std::array<EFeatureLevel, 7u> AllFeatureLevels{ EFeatureLevel_01, EFeatureLevel_02, EFeatureLevel_03, EFeatureLevel_04, EFeatureLevel_05, EFeatureLevel_06, EFeatureLevel_07 };
 }
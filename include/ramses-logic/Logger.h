@@ -58,6 +58,8 @@ namespace rlogic::Logger
     * Sets a custom log handler function, which is called each time a log message occurs.
     * Note: setting a custom logger incurs a slight performance cost because log messages
     * will be assembled and reported, even if default logging is disabled (#SetDefaultLogging).
+    * When a #rlogic::LogicEngine updates with more than one thread (see #rlogic::LogicEngine::setUpdateThreadCount),
+    * the function can be called from any of the update threads, but never concurrently.
     *
     * @ param logHandlerFunc function which is called for each log message
     */
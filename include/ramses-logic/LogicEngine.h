@@ -133,6 +133,20 @@ namespace rlogic
         template <typename T>
         [[nodiscard]] T* findByName(std::string_view name);
 
+        /**
+        * Same as #findByName for every name in \p names, use this to resolve many objects at once (e.g. after loading content).
+        * The lookup of each name does not depend on the number of objects in the #LogicEngine.
+        *
+        * @param names the names of the logic objects to search for
+        * @return pointers to the logic objects in same order as \p names, nullptr for each name for which no object was found
+        */
+        template <typename T>
+        [[nodiscard]] std::vector<const T*> findByNames(const std::vector<std::string_view>& names) const;
+
+        /** @copydoc findByNames(const std::vector<std::string_view>&) const */
+        template <typename T>
+        [[nodiscard]] std::vector<T*> findByNames(const std::vector<std::string_view>& names);
+
         /**
         * Returns a pointer to the first occurrence of an object with a given \p id regardless of its type.
         * To convert the object to a concrete type (e.g. LuaScript) use #rlogic::LogicObject::as<Type>() e.g.:
@@ -466,6 +480,97 @@ namespace rlogic
          */
         RLOGIC_API bool update();
 
+        /**
+        * Sets the number of threads used to execute #rlogic::LogicNode's during #update. By default (thread count 1)
+        * all nodes are executed one by one on the thread calling #update.
+        * With more threads, nodes are grouped into levels of nodes which do not depend on each other (neither via #link
+        * nor via #linkWeak) and the levels are executed one after another. Within a level, nodes which don't access ramses
+        * objects (#rlogic::AnimationNode, #rlogic::TimerNode, #rlogic::LuaInterface, #rlogic::LuaScript) are executed
+        * concurrently on a pool of worker threads, while all other nodes (all bindings, #rlogic::AnchorPoint,
+        * #rlogic::SkinBinding) are still executed one by one on the thread calling #update. Scripts which share a Lua state
+        * are executed one after another, see #setLuaStateCount.
+        * Values are propagated over links only after all nodes of a level were executed, so the resulting
+        * values are always the same as when executing with a single thread.
+        * The only observable differences are the order of nodes in #rlogic::LogicEngineReport (nodes are listed level by level)
+        * and that in case of a runtime error also other nodes of the same level as the failing node might have been executed.
+        * Log messages (including the ones of rl_logInfo, rl_logWarn and rl_logError in scripts) can be issued from any of the
+        * update threads, they are passed to the log handler one at a time (see #rlogic::Logger::SetLogHandler).
+        * Note that synchronizing the threads has an overhead per level, using multiple threads is beneficial only for
+        * content with many independent nodes which are expensive to execute (e.g. animations with many channels).
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param threadCount number of threads (including the thread calling #update) to execute logic nodes with, must be at least 1
+        * @return true if thread count was set successfully, false otherwise. To get more detailed
+        * error information use #getErrors()
+        */
+        RLOGIC_API bool setUpdateThreadCount(size_t threadCount);
+
+        /**
+        * Sets the number of independent Lua states used to run #rlogic::LuaScript's. By default all scripts share a single Lua state
+        * and therefore can't be executed concurrently even if there are multiple update threads (see #setUpdateThreadCount).
+        * With more Lua states, scripts are distributed evenly among the states in the order they are created (or loaded),
+        * and scripts living in different states can be executed concurrently. #rlogic::LuaModule's are loaded into every
+        * Lua state which has a script using them, from their compiled byte code if available (feature level 02 and higher),
+        * so each additional state costs memory for the Lua runtime and the module instances.
+        * Scripts can't exchange data through module tables in any case (they are read-only), so the scripts' behavior
+        * does not depend on the number of Lua states.
+        * The Lua state count can only be changed while there are no Lua scripts or modules, it is kept
+        * when loading content using #loadFromFile, #loadFromFileDescriptor or #loadFromBuffer.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param luaStateCount number of Lua states to distribute scripts to, must be at least 1
+        * @return true if Lua state count was set successfully, false otherwise. To get more detailed
+        * error information use #getErrors()
+        */
+        RLOGIC_API bool setLuaStateCount(size_t luaStateCount);
+
+        /**
+        * Sets the number of threads used to load content using #loadFromFile, #loadFromFileDescriptor or #loadFromBuffer.
+        * By default (thread count 1) all objects are loaded one by one on the calling thread.
+        * With more threads, objects which don't depend on other objects (the data of #rlogic::LuaScript's including
+        * their properties, #rlogic::LuaInterface's and #rlogic::DataArray's) are loaded concurrently, and if there are multiple
+        * Lua states (see #setLuaStateCount) the scripts of different Lua states are loaded into their states concurrently.
+        * All other objects and links are still loaded one by one, so the loaded content and the reported errors
+        * are the same as when loading with a single thread. The threads are only used during loading.
+        * Loading with multiple threads is beneficial for content with many scripts or large data arrays.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param threadCount number of threads (including the thread which loads the content) to load content with, must be at least 1
+        * @return true if thread count was set successfully, false otherwise. To get more detailed
+        * error information use #getErrors()
+        */
+        RLOGIC_API bool setLoadThreadCount(size_t threadCount);
+
+        /**
+        * Enables or disables lazy loading of #rlogic::LuaScript's in #loadFromFile, #loadFromFileDescriptor and #loadFromBuffer
+        * (disabled by default). When enabled, the properties of the scripts are loaded right away, but the Lua code of a script is
+        * loaded into its Lua state only when the script is executed for the first time or when it is prewarmed
+        * using #prewarmLuaScripts. This reduces loading time and memory of the Lua states for content with scripts
+        * which are rarely executed.
+        * Unlike with regular loading, a lazily loaded script is not executed in the first #update after loading, its outputs keep
+        * the values loaded from file until its inputs change. Errors while loading the Lua code of a script during #update are
+        * reported as runtime errors of the script.
+        * The setting has no effect on content which was already loaded.
+        *
+        * @param enable true to load scripts lazily, false to load scripts right away
+        */
+        RLOGIC_API void enableLazyLuaScriptLoading(bool enable);
+
+        /**
+        * Loads the Lua code of lazily loaded #rlogic::LuaScript's (see #enableLazyLuaScriptLoading) into their Lua states,
+        * so that their first execution doesn't have to. Scripts which are loaded already are skipped.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param scripts scripts to load, all of them must be owned by this logic engine
+        * @return true if all scripts were loaded successfully, false otherwise. To get more detailed
+        * error information use #getErrors()
+        */
+        RLOGIC_API bool prewarmLuaScripts(const std::vector<LuaScript*>& scripts);
+
         /**
         * Enables collecting of statistics during call to #update which can be obtained using #getLastUpdateReport.
         * Once enabled every subsequent call to #update will be instructed to collect various statistical data
@@ -616,12 +721,22 @@ namespace rlogic
          * (using #link or #linkWeak).
          *
          * Note that the returned container will not be modified (even if new links are created or unlinked in #LogicEngine)
-         * until #getPropertyLinks is called again.
+         * until #getPropertyLinks is called again. Links are maintained on every link change, calling #getPropertyLinks
+         * repeatedly without links being changed in between is cheap and returns the same container.
          *
          * @return all existing links between properties of logic nodes.
          */
         [[nodiscard]] RLOGIC_API const std::vector<PropertyLink>& getPropertyLinks() const;
 
+        /**
+         * Returns a number which changes whenever a link between properties is created or removed (using #link, #linkWeak,
+         * #unlink or by destroying a #rlogic::LogicNode which was linked). Compare it with a previously obtained value
+         * to cheaply detect if links need to be retrieved again using #getPropertyLinks.
+         *
+         * @return generation of the links between properties of logic nodes.
+         */
+        [[nodiscard]] RLOGIC_API uint64_t getPropertyLinksGeneration() const;
+
         /**
          * Returns the list of all errors which occurred during the last API call to a #LogicEngine method
          * or any other method of its subclasses (scripts, bindings etc). Note that errors get wiped by all
@@ -665,6 +780,19 @@ namespace rlogic
         */
         RLOGIC_API bool destroy(LogicObject& object);
 
+        /**
+        * Destroys multiple instances of #rlogic::LogicObject created by this #LogicEngine. Either all of the objects are
+        * destroyed, or none of them (e.g. if any of them is used by an object which is not in \p objects). Objects which
+        * depend on each other can be destroyed in one call in any order, e.g. an #rlogic::AnimationNode together with the
+        * #rlogic::DataArray instances used in its channels. See #destroy(LogicObject&) for all other effects of destroying an object.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param objects the object instances to destroy, each object can be provided only once
+        * @return true if all objects destroyed, false otherwise (nothing is destroyed then). Call #getErrors() for error details upon failure.
+        */
+        RLOGIC_API bool destroy(const std::vector<LogicObject*>& objects);
+
         /**
          * Writes the whole #LogicEngine and all of its objects to a binary file with the given filename. The RAMSES scene
          * potentially referenced by #rlogic::RamsesBinding objects is not saved - that is left to the application.
@@ -693,6 +821,39 @@ namespace rlogic
          */
         RLOGIC_API bool saveToFile(std::string_view filename, const SaveFileConfig& config = {});
 
+        /**
+         * Saves the whole LogicEngine data to the given file descriptor. This method is equivalent to #saveToFile(),
+         * the data is written at the current position of the file descriptor. The file descriptor can also refer
+         * to a pipe or a socket, e.g. to pass the data directly to a compressor without storing it in a file first.
+         *
+         * The file descriptor must be opened for write access. It stays open after this call.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param fd Open and writable file descriptor.
+         * @param config optional configuration object with exporter and asset metadata info, see #rlogic::SaveFileConfig for details
+         * @return true if saving was successful, false otherwise. To get more detailed
+         * error information use #getErrors()
+         */
+        RLOGIC_API bool saveToFileDescriptor(int fd, const SaveFileConfig& config = {});
+
+        /**
+         * Saves the whole LogicEngine data to the given memory buffer. This method is equivalent to #saveToFile(),
+         * the buffer holds the same data as the saved file and can be loaded using #loadFromBuffer. Previous
+         * content of the buffer is replaced.
+         *
+         * Note: The data is copied to the buffer after all of it has been serialized, i.e. the memory for the data is needed
+         * twice for a short time. Use #saveToFile or #saveToFileDescriptor to save large content with lower peak memory.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param buffer memory buffer to which the data is saved, it is resized to the size of the data
+         * @param config optional configuration object with exporter and asset metadata info, see #rlogic::SaveFileConfig for details
+         * @return true if saving was successful, false otherwise. To get more detailed
+         * error information use #getErrors()
+         */
+        RLOGIC_API bool saveToBuffer(std::vector<char>& buffer, const SaveFileConfig& config = {});
+
         /**
          * Loads the whole LogicEngine data from the given file. See also #saveToFile().
          * After loading, the previous state of the #LogicEngine will be overwritten with the
@@ -890,6 +1051,32 @@ namespace rlogic
         return findLogicObjectInternal<T>(name);
     }
 
+    template <typename T>
+    std::vector<const T*> LogicEngine::findByNames(const std::vector<std::string_view>& names) const
+    {
+        StaticTypeCheck<T>();
+        std::vector<const T*> objects;
+        objects.reserve(names.size());
+        for (const auto name : names)
+        {
+            objects.push_back(findLogicObjectInternal<T>(name));
+        }
+        return objects;
+    }
+
+    template <typename T>
+    std::vector<T*> LogicEngine::findByNames(const std::vector<std::string_view>& names)
+    {
+        StaticTypeCheck<T>();
+        std::vector<T*> objects;
+        objects.reserve(names.size());
+        for (const auto name : names)
+        {
+            objects.push_back(findLogicObjectInternal<T>(name));
+        }
+        return objects;
+    }
+
     template <typename T>
     DataArray* LogicEngine::createDataArray(const std::vector<T>& data, std::string_view name)
     {
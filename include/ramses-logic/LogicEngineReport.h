@@ -79,6 +79,23 @@ namespace rlogic
         */
         [[nodiscard]] RLOGIC_API size_t getTotalLinkActivations() const;
 
+        /**
+        * Obtain the number of logic nodes which had to be visited during update. Only nodes which are dirty
+        * or become dirty during update (due to activated links) are visited, so with few changes per update this
+        * is typically much lower than #getTotalNodesCount. When updating with multiple threads
+        * (see #rlogic::LogicEngine::setUpdateThreadCount) every node is visited.
+        *
+        * @return the number of logic nodes visited during update
+        */
+        [[nodiscard]] RLOGIC_API size_t getVisitedNodesCount() const;
+
+        /**
+        * Obtain the number of all logic nodes at the time of update.
+        *
+        * @return the number of all logic nodes
+        */
+        [[nodiscard]] RLOGIC_API size_t getTotalNodesCount() const;
+
         /**
         * Default constructor of LogicEngineReport.
         */
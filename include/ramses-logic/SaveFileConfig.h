@@ -10,6 +10,7 @@
 
 #include "ramses-logic/APIExport.h"
 #include "ramses-logic/ELuaSavingMode.h"
+#include "ramses-logic/EDataArrayCompression.h"
 
 #include <string>
 #include <memory>
@@ -76,6 +77,15 @@ namespace rlogic
         */
         RLOGIC_API void setLuaSavingMode(ELuaSavingMode mode);
 
+        /**
+        * Sets how to store the data of #rlogic::DataArray instances, see #rlogic::EDataArrayCompression for the available options.
+        * Compressed data requires feature level #rlogic::EFeatureLevel_07 or higher, saving fails with an error
+        * if compression is requested with lower feature level.
+        *
+        * @param compression selected compression, default is #rlogic::EDataArrayCompression::None
+        */
+        RLOGIC_API void setDataArrayCompression(EDataArrayCompression compression);
+
         /**
          * Destructor of #SaveFileConfig
          */
@@ -16,6 +16,12 @@ struct floatArrBuilder;
 struct intArr;
 struct intArrBuilder;
 
+struct quantizedFloatArr;
+struct quantizedFloatArrBuilder;
+
+struct packedQuaternionArr;
+struct packedQuaternionArrBuilder;
+
 struct DataArray;
 struct DataArrayBuilder;
 
@@ -23,6 +29,10 @@ inline const flatbuffers::TypeTable *floatArrTypeTable();
 
 inline const flatbuffers::TypeTable *intArrTypeTable();
 
+inline const flatbuffers::TypeTable *quantizedFloatArrTypeTable();
+
+inline const flatbuffers::TypeTable *packedQuaternionArrTypeTable();
+
 inline const flatbuffers::TypeTable *DataArrayTypeTable();
 
 enum class EDataArrayType : uint8_t {
@@ -80,31 +90,37 @@ enum class ArrayUnion : uint8_t {
   NONE = 0,
   floatArr = 1,
   intArr = 2,
+  quantizedFloatArr = 3,
+  packedQuaternionArr = 4,
   MIN = NONE,
-  MAX = intArr
+  MAX = packedQuaternionArr
 };
 
-inline const ArrayUnion (&EnumValuesArrayUnion())[3] {
+inline const ArrayUnion (&EnumValuesArrayUnion())[5] {
   static const ArrayUnion values[] = {
     ArrayUnion::NONE,
     ArrayUnion::floatArr,
-    ArrayUnion::intArr
+    ArrayUnion::intArr,
+    ArrayUnion::quantizedFloatArr,
+    ArrayUnion::packedQuaternionArr
   };
   return values;
 }
 
 inline const char * const *EnumNamesArrayUnion() {
-  static const char * const names[4] = {
+  static const char * const names[6] = {
     "NONE",
     "floatArr",
     "intArr",
+    "quantizedFloatArr",
+    "packedQuaternionArr",
     nullptr
   };
   return names;
 }
 
 inline const char *EnumNameArrayUnion(ArrayUnion e) {
-  if (flatbuffers::IsOutRange(e, ArrayUnion::NONE, ArrayUnion::intArr)) return "";
+  if (flatbuffers::IsOutRange(e, ArrayUnion::NONE, ArrayUnion::packedQuaternionArr)) return "";
   const size_t index = static_cast<size_t>(e);
   return EnumNamesArrayUnion()[index];
 }
@@ -121,6 +137,14 @@ template<> struct ArrayUnionTraits<rlogic_serialization::intArr> {
   static const ArrayUnion enum_value = ArrayUnion::intArr;
 };
 
+template<> struct ArrayUnionTraits<rlogic_serialization::quantizedFloatArr> {
+  static const ArrayUnion enum_value = ArrayUnion::quantizedFloatArr;
+};
+
+template<> struct ArrayUnionTraits<rlogic_serialization::packedQuaternionArr> {
+  static const ArrayUnion enum_value = ArrayUnion::packedQuaternionArr;
+};
+
 bool VerifyArrayUnion(flatbuffers::Verifier &verifier, const void *obj, ArrayUnion type);
 bool VerifyArrayUnionVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
 
@@ -246,6 +270,156 @@ inline flatbuffers::Offset<intArr> CreateintArrDirect(
       data__);
 }
 
+struct quantizedFloatArr FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef quantizedFloatArrBuilder Builder;
+  struct Traits;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return quantizedFloatArrTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_DATA = 4,
+    VT_COMPONENTMIN = 6,
+    VT_COMPONENTMAX = 8
+  };
+  const flatbuffers::Vector<uint16_t> *data() const {
+    return GetPointer<const flatbuffers::Vector<uint16_t> *>(VT_DATA);
+  }
+  const flatbuffers::Vector<float> *componentMin() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_COMPONENTMIN);
+  }
+  const flatbuffers::Vector<float> *componentMax() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_COMPONENTMAX);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           VerifyOffset(verifier, VT_COMPONENTMIN) &&
+           verifier.VerifyVector(componentMin()) &&
+           VerifyOffset(verifier, VT_COMPONENTMAX) &&
+           verifier.VerifyVector(componentMax()) &&
+           verifier.EndTable();
+  }
+};
+
+struct quantizedFloatArrBuilder {
+  typedef quantizedFloatArr Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_data(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> data) {
+    fbb_.AddOffset(quantizedFloatArr::VT_DATA, data);
+  }
+  void add_componentMin(flatbuffers::Offset<flatbuffers::Vector<float>> componentMin) {
+    fbb_.AddOffset(quantizedFloatArr::VT_COMPONENTMIN, componentMin);
+  }
+  void add_componentMax(flatbuffers::Offset<flatbuffers::Vector<float>> componentMax) {
+    fbb_.AddOffset(quantizedFloatArr::VT_COMPONENTMAX, componentMax);
+  }
+  explicit quantizedFloatArrBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  quantizedFloatArrBuilder &operator=(const quantizedFloatArrBuilder &);
+  flatbuffers::Offset<quantizedFloatArr> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<quantizedFloatArr>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<quantizedFloatArr> CreatequantizedFloatArr(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint16_t>> data = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> componentMin = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> componentMax = 0) {
+  quantizedFloatArrBuilder builder_(_fbb);
+  builder_.add_componentMax(componentMax);
+  builder_.add_componentMin(componentMin);
+  builder_.add_data(data);
+  return builder_.Finish();
+}
+
+struct quantizedFloatArr::Traits {
+  using type = quantizedFloatArr;
+  static auto constexpr Create = CreatequantizedFloatArr;
+};
+
+inline flatbuffers::Offset<quantizedFloatArr> CreatequantizedFloatArrDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint16_t> *data = nullptr,
+    const std::vector<float> *componentMin = nullptr,
+    const std::vector<float> *componentMax = nullptr) {
+  auto data__ = data ? _fbb.CreateVector<uint16_t>(*data) : 0;
+  auto componentMin__ = componentMin ? _fbb.CreateVector<float>(*componentMin) : 0;
+  auto componentMax__ = componentMax ? _fbb.CreateVector<float>(*componentMax) : 0;
+  return rlogic_serialization::CreatequantizedFloatArr(
+      _fbb,
+      data__,
+      componentMin__,
+      componentMax__);
+}
+
+struct packedQuaternionArr FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef packedQuaternionArrBuilder Builder;
+  struct Traits;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return packedQuaternionArrTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_DATA = 4
+  };
+  const flatbuffers::Vector<uint16_t> *data() const {
+    return GetPointer<const flatbuffers::Vector<uint16_t> *>(VT_DATA);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct packedQuaternionArrBuilder {
+  typedef packedQuaternionArr Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_data(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> data) {
+    fbb_.AddOffset(packedQuaternionArr::VT_DATA, data);
+  }
+  explicit packedQuaternionArrBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  packedQuaternionArrBuilder &operator=(const packedQuaternionArrBuilder &);
+  flatbuffers::Offset<packedQuaternionArr> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<packedQuaternionArr>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<packedQuaternionArr> CreatepackedQuaternionArr(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint16_t>> data = 0) {
+  packedQuaternionArrBuilder builder_(_fbb);
+  builder_.add_data(data);
+  return builder_.Finish();
+}
+
+struct packedQuaternionArr::Traits {
+  using type = packedQuaternionArr;
+  static auto constexpr Create = CreatepackedQuaternionArr;
+};
+
+inline flatbuffers::Offset<packedQuaternionArr> CreatepackedQuaternionArrDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint16_t> *data = nullptr) {
+  auto data__ = data ? _fbb.CreateVector<uint16_t>(*data) : 0;
+  return rlogic_serialization::CreatepackedQuaternionArr(
+      _fbb,
+      data__);
+}
+
 struct DataArray FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef DataArrayBuilder Builder;
   struct Traits;
@@ -278,6 +452,12 @@ struct DataArray FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const rlogic_serialization::intArr *data_as_intArr() const {
     return data_type() == rlogic_serialization::ArrayUnion::intArr ? static_cast<const rlogic_serialization::intArr *>(data()) : nullptr;
   }
+  const rlogic_serialization::quantizedFloatArr *data_as_quantizedFloatArr() const {
+    return data_type() == rlogic_serialization::ArrayUnion::quantizedFloatArr ? static_cast<const rlogic_serialization::quantizedFloatArr *>(data()) : nullptr;
+  }
+  const rlogic_serialization::packedQuaternionArr *data_as_packedQuaternionArr() const {
+    return data_type() == rlogic_serialization::ArrayUnion::packedQuaternionArr ? static_cast<const rlogic_serialization::packedQuaternionArr *>(data()) : nullptr;
+  }
   uint32_t numElements() const {
     return GetField<uint32_t>(VT_NUMELEMENTS, 0);
   }
@@ -302,6 +482,14 @@ template<> inline const rlogic_serialization::intArr *DataArray::data_as<rlogic_
   return data_as_intArr();
 }
 
+template<> inline const rlogic_serialization::quantizedFloatArr *DataArray::data_as<rlogic_serialization::quantizedFloatArr>() const {
+  return data_as_quantizedFloatArr();
+}
+
+template<> inline const rlogic_serialization::packedQuaternionArr *DataArray::data_as<rlogic_serialization::packedQuaternionArr>() const {
+  return data_as_packedQuaternionArr();
+}
+
 struct DataArrayBuilder {
   typedef DataArray Table;
   flatbuffers::FlatBufferBuilder &fbb_;
@@ -367,6 +555,14 @@ inline bool VerifyArrayUnion(flatbuffers::Verifier &verifier, const void *obj, A
       auto ptr = reinterpret_cast<const rlogic_serialization::intArr *>(obj);
       return verifier.VerifyTable(ptr);
     }
+    case ArrayUnion::quantizedFloatArr: {
+      auto ptr = reinterpret_cast<const rlogic_serialization::quantizedFloatArr *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ArrayUnion::packedQuaternionArr: {
+      auto ptr = reinterpret_cast<const rlogic_serialization::packedQuaternionArr *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
     default: return true;
   }
 }
@@ -419,19 +615,25 @@ inline const flatbuffers::TypeTable *ArrayUnionTypeTable() {
   static const flatbuffers::TypeCode type_codes[] = {
     { flatbuffers::ET_SEQUENCE, 0, -1 },
     { flatbuffers::ET_SEQUENCE, 0, 0 },
-    { flatbuffers::ET_SEQUENCE, 0, 1 }
+    { flatbuffers::ET_SEQUENCE, 0, 1 },
+    { flatbuffers::ET_SEQUENCE, 0, 2 },
+    { flatbuffers::ET_SEQUENCE, 0, 3 }
   };
   static const flatbuffers::TypeFunction type_refs[] = {
     rlogic_serialization::floatArrTypeTable,
-    rlogic_serialization::intArrTypeTable
+    rlogic_serialization::intArrTypeTable,
+    rlogic_serialization::quantizedFloatArrTypeTable,
+    rlogic_serialization::packedQuaternionArrTypeTable
   };
   static const char * const names[] = {
     "NONE",
     "floatArr",
-    "intArr"
+    "intArr",
+    "quantizedFloatArr",
+    "packedQuaternionArr"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_UNION, 3, type_codes, type_refs, nullptr, names
+    flatbuffers::ST_UNION, 5, type_codes, type_refs, nullptr, names
   };
   return &tt;
 }
@@ -462,6 +664,36 @@ inline const flatbuffers::TypeTable *intArrTypeTable() {
   return &tt;
 }
 
+inline const flatbuffers::TypeTable *quantizedFloatArrTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_USHORT, 1, -1 },
+    { flatbuffers::ET_FLOAT, 1, -1 },
+    { flatbuffers::ET_FLOAT, 1, -1 }
+  };
+  static const char * const names[] = {
+    "data",
+    "componentMin",
+    "componentMax"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 3, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *packedQuaternionArrTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_USHORT, 1, -1 }
+  };
+  static const char * const names[] = {
+    "data"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 1, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
 inline const flatbuffers::TypeTable *DataArrayTypeTable() {
   static const flatbuffers::TypeCode type_codes[] = {
     { flatbuffers::ET_SEQUENCE, 0, 0 },
@@ -24,7 +24,9 @@ struct Link FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_SOURCEPROPERTY = 4,
     VT_TARGETPROPERTY = 6,
-    VT_ISWEAK = 8
+    VT_ISWEAK = 8,
+    VT_SOURCEPROPERTYINDEX = 10,
+    VT_TARGETPROPERTYINDEX = 12
   };
   const rlogic_serialization::Property *sourceProperty() const {
     return GetPointer<const rlogic_serialization::Property *>(VT_SOURCEPROPERTY);
@@ -35,6 +37,12 @@ struct Link FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   bool isWeak() const {
     return GetField<uint8_t>(VT_ISWEAK, 0) != 0;
   }
+  uint32_t sourcePropertyIndex() const {
+    return GetField<uint32_t>(VT_SOURCEPROPERTYINDEX, 0);
+  }
+  uint32_t targetPropertyIndex() const {
+    return GetField<uint32_t>(VT_TARGETPROPERTYINDEX, 0);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_SOURCEPROPERTY) &&
@@ -42,6 +50,8 @@ struct Link FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_TARGETPROPERTY) &&
            verifier.VerifyTable(targetProperty()) &&
            VerifyField<uint8_t>(verifier, VT_ISWEAK) &&
+           VerifyField<uint32_t>(verifier, VT_SOURCEPROPERTYINDEX) &&
+           VerifyField<uint32_t>(verifier, VT_TARGETPROPERTYINDEX) &&
            verifier.EndTable();
   }
 };
@@ -59,6 +69,12 @@ struct LinkBuilder {
   void add_isWeak(bool isWeak) {
     fbb_.AddElement<uint8_t>(Link::VT_ISWEAK, static_cast<uint8_t>(isWeak), 0);
   }
+  void add_sourcePropertyIndex(uint32_t sourcePropertyIndex) {
+    fbb_.AddElement<uint32_t>(Link::VT_SOURCEPROPERTYINDEX, sourcePropertyIndex, 0);
+  }
+  void add_targetPropertyIndex(uint32_t targetPropertyIndex) {
+    fbb_.AddElement<uint32_t>(Link::VT_TARGETPROPERTYINDEX, targetPropertyIndex, 0);
+  }
   explicit LinkBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -75,8 +91,12 @@ inline flatbuffers::Offset<Link> CreateLink(
     flatbuffers::FlatBufferBuilder &_fbb,
     flatbuffers::Offset<rlogic_serialization::Property> sourceProperty = 0,
     flatbuffers::Offset<rlogic_serialization::Property> targetProperty = 0,
-    bool isWeak = false) {
+    bool isWeak = false,
+    uint32_t sourcePropertyIndex = 0,
+    uint32_t targetPropertyIndex = 0) {
   LinkBuilder builder_(_fbb);
+  builder_.add_targetPropertyIndex(targetPropertyIndex);
+  builder_.add_sourcePropertyIndex(sourcePropertyIndex);
   builder_.add_targetProperty(targetProperty);
   builder_.add_sourceProperty(sourceProperty);
   builder_.add_isWeak(isWeak);
@@ -92,7 +112,9 @@ inline const flatbuffers::TypeTable *LinkTypeTable() {
   static const flatbuffers::TypeCode type_codes[] = {
     { flatbuffers::ET_SEQUENCE, 0, 0 },
     { flatbuffers::ET_SEQUENCE, 0, 0 },
-    { flatbuffers::ET_BOOL, 0, -1 }
+    { flatbuffers::ET_BOOL, 0, -1 },
+    { flatbuffers::ET_UINT, 0, -1 },
+    { flatbuffers::ET_UINT, 0, -1 }
   };
   static const flatbuffers::TypeFunction type_refs[] = {
     rlogic_serialization::PropertyTypeTable
@@ -100,10 +122,12 @@ inline const flatbuffers::TypeTable *LinkTypeTable() {
   static const char * const names[] = {
     "sourceProperty",
     "targetProperty",
-    "isWeak"
+    "isWeak",
+    "sourcePropertyIndex",
+    "targetPropertyIndex"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_TABLE, 3, type_codes, type_refs, nullptr, names
+    flatbuffers::ST_TABLE, 5, type_codes, type_refs, nullptr, names
   };
   return &tt;
 }
@@ -31,6 +31,9 @@ struct bool_s;
 struct string_s;
 struct string_sBuilder;
 
+struct PropertyTreeType;
+struct PropertyTreeTypeBuilder;
+
 struct Property;
 struct PropertyBuilder;
 
@@ -56,6 +59,8 @@ inline const flatbuffers::TypeTable *bool_sTypeTable();
 
 inline const flatbuffers::TypeTable *string_sTypeTable();
 
+inline const flatbuffers::TypeTable *PropertyTreeTypeTypeTable();
+
 inline const flatbuffers::TypeTable *PropertyTypeTable();
 
 enum class EPropertyRootType : uint8_t {
@@ -91,6 +96,69 @@ inline const char *EnumNameEPropertyRootType(EPropertyRootType e) {
   return EnumNamesEPropertyRootType()[index];
 }
 
+enum class EPropertyTreeNodeType : uint8_t {
+  Float = 0,
+  Vec2f = 1,
+  Vec3f = 2,
+  Vec4f = 3,
+  Int32 = 4,
+  Int64 = 5,
+  Vec2i = 6,
+  Vec3i = 7,
+  Vec4i = 8,
+  String = 9,
+  Bool = 10,
+  Struct = 11,
+  Array = 12,
+  MIN = Float,
+  MAX = Array
+};
+
+inline const EPropertyTreeNodeType (&EnumValuesEPropertyTreeNodeType())[13] {
+  static const EPropertyTreeNodeType values[] = {
+    EPropertyTreeNodeType::Float,
+    EPropertyTreeNodeType::Vec2f,
+    EPropertyTreeNodeType::Vec3f,
+    EPropertyTreeNodeType::Vec4f,
+    EPropertyTreeNodeType::Int32,
+    EPropertyTreeNodeType::Int64,
+    EPropertyTreeNodeType::Vec2i,
+    EPropertyTreeNodeType::Vec3i,
+    EPropertyTreeNodeType::Vec4i,
+    EPropertyTreeNodeType::String,
+    EPropertyTreeNodeType::Bool,
+    EPropertyTreeNodeType::Struct,
+    EPropertyTreeNodeType::Array
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesEPropertyTreeNodeType() {
+  static const char * const names[14] = {
+    "Float",
+    "Vec2f",
+    "Vec3f",
+    "Vec4f",
+    "Int32",
+    "Int64",
+    "Vec2i",
+    "Vec3i",
+    "Vec4i",
+    "String",
+    "Bool",
+    "Struct",
+    "Array",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameEPropertyTreeNodeType(EPropertyTreeNodeType e) {
+  if (flatbuffers::IsOutRange(e, EPropertyTreeNodeType::Float, EPropertyTreeNodeType::Array)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesEPropertyTreeNodeType()[index];
+}
+
 enum class PropertyValue : uint8_t {
   NONE = 0,
   float_s = 1,
@@ -523,6 +591,96 @@ inline flatbuffers::Offset<string_s> Createstring_sDirect(
       v__);
 }
 
+struct PropertyTreeType FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef PropertyTreeTypeBuilder Builder;
+  struct Traits;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return PropertyTreeTypeTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAMES = 4,
+    VT_TYPES = 6,
+    VT_CHILDCOUNTS = 8
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *names() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_NAMES);
+  }
+  const flatbuffers::Vector<uint8_t> *types() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TYPES);
+  }
+  const flatbuffers::Vector<uint32_t> *childCounts() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_CHILDCOUNTS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAMES) &&
+           verifier.VerifyVector(names()) &&
+           verifier.VerifyVectorOfStrings(names()) &&
+           VerifyOffset(verifier, VT_TYPES) &&
+           verifier.VerifyVector(types()) &&
+           VerifyOffset(verifier, VT_CHILDCOUNTS) &&
+           verifier.VerifyVector(childCounts()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PropertyTreeTypeBuilder {
+  typedef PropertyTreeType Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_names(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> names) {
+    fbb_.AddOffset(PropertyTreeType::VT_NAMES, names);
+  }
+  void add_types(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> types) {
+    fbb_.AddOffset(PropertyTreeType::VT_TYPES, types);
+  }
+  void add_childCounts(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> childCounts) {
+    fbb_.AddOffset(PropertyTreeType::VT_CHILDCOUNTS, childCounts);
+  }
+  explicit PropertyTreeTypeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  PropertyTreeTypeBuilder &operator=(const PropertyTreeTypeBuilder &);
+  flatbuffers::Offset<PropertyTreeType> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<PropertyTreeType>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<PropertyTreeType> CreatePropertyTreeType(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> names = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> types = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> childCounts = 0) {
+  PropertyTreeTypeBuilder builder_(_fbb);
+  builder_.add_childCounts(childCounts);
+  builder_.add_types(types);
+  builder_.add_names(names);
+  return builder_.Finish();
+}
+
+struct PropertyTreeType::Traits {
+  using type = PropertyTreeType;
+  static auto constexpr Create = CreatePropertyTreeType;
+};
+
+inline flatbuffers::Offset<PropertyTreeType> CreatePropertyTreeTypeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *names = nullptr,
+    const std::vector<uint8_t> *types = nullptr,
+    const std::vector<uint32_t> *childCounts = nullptr) {
+  auto names__ = names ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*names) : 0;
+  auto types__ = types ? _fbb.CreateVector<uint8_t>(*types) : 0;
+  auto childCounts__ = childCounts ? _fbb.CreateVector<uint32_t>(*childCounts) : 0;
+  return rlogic_serialization::CreatePropertyTreeType(
+      _fbb,
+      names__,
+      types__,
+      childCounts__);
+}
+
 struct Property FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef PropertyBuilder Builder;
   struct Traits;
@@ -534,7 +692,13 @@ struct Property FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_ROOTTYPE = 6,
     VT_CHILDREN = 8,
     VT_VALUE_TYPE = 10,
-    VT_VALUE = 12
+    VT_VALUE = 12,
+    VT_TREETYPE = 14,
+    VT_FLOATVALUES = 16,
+    VT_INT32VALUES = 18,
+    VT_INT64VALUES = 20,
+    VT_BOOLVALUES = 22,
+    VT_STRINGVALUES = 24
   };
   const flatbuffers::String *name() const {
     return GetPointer<const flatbuffers::String *>(VT_NAME);
@@ -585,6 +749,24 @@ struct Property FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const rlogic_serialization::bool_s *value_as_bool_s() const {
     return value_type() == rlogic_serialization::PropertyValue::bool_s ? static_cast<const rlogic_serialization::bool_s *>(value()) : nullptr;
   }
+  const rlogic_serialization::PropertyTreeType *treeType() const {
+    return GetPointer<const rlogic_serialization::PropertyTreeType *>(VT_TREETYPE);
+  }
+  const flatbuffers::Vector<float> *floatValues() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_FLOATVALUES);
+  }
+  const flatbuffers::Vector<int32_t> *int32Values() const {
+    return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_INT32VALUES);
+  }
+  const flatbuffers::Vector<int64_t> *int64Values() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_INT64VALUES);
+  }
+  const flatbuffers::Vector<uint8_t> *boolValues() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_BOOLVALUES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *stringValues() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_STRINGVALUES);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_NAME) &&
@@ -596,6 +778,19 @@ struct Property FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<uint8_t>(verifier, VT_VALUE_TYPE) &&
            VerifyOffset(verifier, VT_VALUE) &&
            VerifyPropertyValue(verifier, value(), value_type()) &&
+           VerifyOffset(verifier, VT_TREETYPE) &&
+           verifier.VerifyTable(treeType()) &&
+           VerifyOffset(verifier, VT_FLOATVALUES) &&
+           verifier.VerifyVector(floatValues()) &&
+           VerifyOffset(verifier, VT_INT32VALUES) &&
+           verifier.VerifyVector(int32Values()) &&
+           VerifyOffset(verifier, VT_INT64VALUES) &&
+           verifier.VerifyVector(int64Values()) &&
+           VerifyOffset(verifier, VT_BOOLVALUES) &&
+           verifier.VerifyVector(boolValues()) &&
+           VerifyOffset(verifier, VT_STRINGVALUES) &&
+           verifier.VerifyVector(stringValues()) &&
+           verifier.VerifyVectorOfStrings(stringValues()) &&
            verifier.EndTable();
   }
 };
@@ -663,6 +858,24 @@ struct PropertyBuilder {
   void add_value(flatbuffers::Offset<void> value) {
     fbb_.AddOffset(Property::VT_VALUE, value);
   }
+  void add_treeType(flatbuffers::Offset<rlogic_serialization::PropertyTreeType> treeType) {
+    fbb_.AddOffset(Property::VT_TREETYPE, treeType);
+  }
+  void add_floatValues(flatbuffers::Offset<flatbuffers::Vector<float>> floatValues) {
+    fbb_.AddOffset(Property::VT_FLOATVALUES, floatValues);
+  }
+  void add_int32Values(flatbuffers::Offset<flatbuffers::Vector<int32_t>> int32Values) {
+    fbb_.AddOffset(Property::VT_INT32VALUES, int32Values);
+  }
+  void add_int64Values(flatbuffers::Offset<flatbuffers::Vector<int64_t>> int64Values) {
+    fbb_.AddOffset(Property::VT_INT64VALUES, int64Values);
+  }
+  void add_boolValues(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> boolValues) {
+    fbb_.AddOffset(Property::VT_BOOLVALUES, boolValues);
+  }
+  void add_stringValues(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> stringValues) {
+    fbb_.AddOffset(Property::VT_STRINGVALUES, stringValues);
+  }
   explicit PropertyBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -681,8 +894,20 @@ inline flatbuffers::Offset<Property> CreateProperty(
     rlogic_serialization::EPropertyRootType rootType = rlogic_serialization::EPropertyRootType::Primitive,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Property>>> children = 0,
     rlogic_serialization::PropertyValue value_type = rlogic_serialization::PropertyValue::NONE,
-    flatbuffers::Offset<void> value = 0) {
+    flatbuffers::Offset<void> value = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTreeType> treeType = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> floatValues = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> int32Values = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> int64Values = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> boolValues = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> stringValues = 0) {
   PropertyBuilder builder_(_fbb);
+  builder_.add_stringValues(stringValues);
+  builder_.add_boolValues(boolValues);
+  builder_.add_int64Values(int64Values);
+  builder_.add_int32Values(int32Values);
+  builder_.add_floatValues(floatValues);
+  builder_.add_treeType(treeType);
   builder_.add_value(value);
   builder_.add_children(children);
   builder_.add_name(name);
@@ -702,16 +927,33 @@ inline flatbuffers::Offset<Property> CreatePropertyDirect(
     rlogic_serialization::EPropertyRootType rootType = rlogic_serialization::EPropertyRootType::Primitive,
     const std::vector<flatbuffers::Offset<rlogic_serialization::Property>> *children = nullptr,
     rlogic_serialization::PropertyValue value_type = rlogic_serialization::PropertyValue::NONE,
-    flatbuffers::Offset<void> value = 0) {
+    flatbuffers::Offset<void> value = 0,
+    flatbuffers::Offset<rlogic_serialization::PropertyTreeType> treeType = 0,
+    const std::vector<float> *floatValues = nullptr,
+    const std::vector<int32_t> *int32Values = nullptr,
+    const std::vector<int64_t> *int64Values = nullptr,
+    const std::vector<uint8_t> *boolValues = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *stringValues = nullptr) {
   auto name__ = name ? _fbb.CreateString(name) : 0;
   auto children__ = children ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::Property>>(*children) : 0;
+  auto floatValues__ = floatValues ? _fbb.CreateVector<float>(*floatValues) : 0;
+  auto int32Values__ = int32Values ? _fbb.CreateVector<int32_t>(*int32Values) : 0;
+  auto int64Values__ = int64Values ? _fbb.CreateVector<int64_t>(*int64Values) : 0;
+  auto boolValues__ = boolValues ? _fbb.CreateVector<uint8_t>(*boolValues) : 0;
+  auto stringValues__ = stringValues ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*stringValues) : 0;
   return rlogic_serialization::CreateProperty(
       _fbb,
       name__,
       rootType,
       children__,
       value_type,
-      value);
+      value,
+      treeType,
+      floatValues__,
+      int32Values__,
+      int64Values__,
+      boolValues__,
+      stringValues__);
 }
 
 inline bool VerifyPropertyValue(flatbuffers::Verifier &verifier, const void *obj, PropertyValue type) {
@@ -789,6 +1031,46 @@ inline const flatbuffers::TypeTable *EPropertyRootTypeTypeTable() {
   return &tt;
 }
 
+inline const flatbuffers::TypeTable *EPropertyTreeNodeTypeTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    rlogic_serialization::EPropertyTreeNodeTypeTypeTable
+  };
+  static const char * const names[] = {
+    "Float",
+    "Vec2f",
+    "Vec3f",
+    "Vec4f",
+    "Int32",
+    "Int64",
+    "Vec2i",
+    "Vec3i",
+    "Vec4i",
+    "String",
+    "Bool",
+    "Struct",
+    "Array"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_ENUM, 13, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
 inline const flatbuffers::TypeTable *PropertyValueTypeTable() {
   static const flatbuffers::TypeCode type_codes[] = {
     { flatbuffers::ET_SEQUENCE, 0, -1 },
@@ -1014,28 +1296,61 @@ inline const flatbuffers::TypeTable *string_sTypeTable() {
   return &tt;
 }
 
+inline const flatbuffers::TypeTable *PropertyTreeTypeTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 1, -1 },
+    { flatbuffers::ET_UCHAR, 1, 0 },
+    { flatbuffers::ET_UINT, 1, -1 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    rlogic_serialization::EPropertyTreeNodeTypeTypeTable
+  };
+  static const char * const names[] = {
+    "names",
+    "types",
+    "childCounts"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 3, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
 inline const flatbuffers::TypeTable *PropertyTypeTable() {
   static const flatbuffers::TypeCode type_codes[] = {
     { flatbuffers::ET_STRING, 0, -1 },
     { flatbuffers::ET_UCHAR, 0, 0 },
     { flatbuffers::ET_SEQUENCE, 1, 1 },
     { flatbuffers::ET_UTYPE, 0, 2 },
-    { flatbuffers::ET_SEQUENCE, 0, 2 }
+    { flatbuffers::ET_SEQUENCE, 0, 2 },
+    { flatbuffers::ET_SEQUENCE, 0, 3 },
+    { flatbuffers::ET_FLOAT, 1, -1 },
+    { flatbuffers::ET_INT, 1, -1 },
+    { flatbuffers::ET_LONG, 1, -1 },
+    { flatbuffers::ET_BOOL, 1, -1 },
+    { flatbuffers::ET_STRING, 1, -1 }
   };
   static const flatbuffers::TypeFunction type_refs[] = {
     rlogic_serialization::EPropertyRootTypeTypeTable,
     rlogic_serialization::PropertyTypeTable,
-    rlogic_serialization::PropertyValueTypeTable
+    rlogic_serialization::PropertyValueTypeTable,
+    rlogic_serialization::PropertyTreeTypeTypeTable
   };
   static const char * const names[] = {
     "name",
     "rootType",
     "children",
     "value_type",
-    "value"
+    "value",
+    "treeType",
+    "floatValues",
+    "int32Values",
+    "int64Values",
+    "boolValues",
+    "stringValues"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_TABLE, 5, type_codes, type_refs, nullptr, names
+    flatbuffers::ST_TABLE, 11, type_codes, type_refs, nullptr, names
   };
   return &tt;
 }
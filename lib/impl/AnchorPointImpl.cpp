@@ -46,10 +46,10 @@ namespace rlogic::internal
         const AnchorPointImpl& anchorPoint,
         flatbuffers::FlatBufferBuilder& builder,
         SerializationMap& serializationMap,
-        EFeatureLevel /*featureLevel*/)
+        EFeatureLevel featureLevel)
     {
         const auto fbLogicObject = LogicObjectImpl::Serialize(anchorPoint, builder);
-        const auto fbOutputs = PropertyImpl::Serialize(*anchorPoint.getOutputs()->m_impl, builder, serializationMap);
+        const auto fbOutputs = PropertyImpl::Serialize(*anchorPoint.getOutputs()->m_impl, builder, serializationMap, featureLevel);
         auto fbAnchorPoint = rlogic_serialization::CreateAnchorPoint(builder,
             fbLogicObject,
             anchorPoint.m_nodeBinding.getId(),
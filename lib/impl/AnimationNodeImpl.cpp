@@ -26,6 +26,7 @@ namespace rlogic::internal
         , m_hasChannelDataExposedViaProperties{ exposeDataAsProperties }
     {
         m_channelsWorkData.resize(m_channels.size());
+        m_channelsEvaluation.resize(m_channels.size());
         for (size_t i = 0u; i < m_channels.size(); ++i)
         {
             const auto& channel = m_channels[i];
@@ -38,8 +39,9 @@ namespace rlogic::internal
             // extract basic channel data to work containers, update logic operates with these containers instead of original channel data
             // (for timestamps and keyframes at least), it also makes it possible to modify this data in runtime while keeping original data constant
             assert(m_channels[i].timeStamps->getDataType() == EPropertyType::Float && m_channels[i].timeStamps->getNumElements() > 0);
-            m_channelsWorkData[i].timestamps = *m_channels[i].timeStamps->getData<float>();
-            m_channelsWorkData[i].keyframes = m_channels[i].keyframes->m_impl.getDataVariant();
+            m_channelsWorkData[i].timestamps = m_channels[i].timeStamps->getData<float>();
+            m_channelsWorkData[i].keyframes = &m_channels[i].keyframes->m_impl.getDataVariant();
+            m_channelsWorkData[i].cursor.reset(*m_channelsWorkData[i].timestamps);
 
             // overall duration equals longest channel in animation
             m_maxChannelDuration = std::max(m_maxChannelDuration, channel.timeStamps->getData<float>()->back());
@@ -109,6 +111,27 @@ namespace rlogic::internal
     }
 
     std::optional<LogicNodeRuntimeError> AnimationNodeImpl::update()
+    {
+        m_batchEvaluator.clear();
+        gatherChannels(m_batchEvaluator);
+        m_batchEvaluator.evaluate();
+        scatterChannels(m_batchEvaluator);
+
+        return std::nullopt;
+    }
+
+    bool AnimationNodeImpl::canUpdateConcurrently() const
+    {
+        // data arrays referenced by channels are immutable, everything else written in update is owned by this node
+        return true;
+    }
+
+    AnimationNodeImpl* AnimationNodeImpl::asAnimationNode()
+    {
+        return this;
+    }
+
+    void AnimationNodeImpl::gatherChannels(AnimationBatchEvaluator& evaluator)
     {
         // propagate data from properties if this animation node has channel data properties
         if (m_hasChannelDataExposedViaProperties)
@@ -118,100 +141,167 @@ namespace rlogic::internal
         const float localAnimationTime = progress * m_maxChannelDuration;
 
         for (size_t i = 0u; i < m_channels.size(); ++i)
-            updateChannel(i, localAnimationTime);
+            gatherChannel(i, localAnimationTime, evaluator);
+    }
 
-        return std::nullopt;
+    void AnimationNodeImpl::scatterChannels(const AnimationBatchEvaluator& evaluator)
+    {
+        for (size_t i = 0u; i < m_channels.size(); ++i)
+            scatterChannel(i, evaluator);
     }
 
-    void AnimationNodeImpl::updateChannel(size_t channelIdx, float localAnimationTime)
+    // Values which are interpolated per float component in batch, integer values need rounding and are interpolated separately
+    template <typename T>
+    constexpr bool IsFloatValue = std::is_same_v<T, float> || std::is_same_v<T, vec2f> || std::is_same_v<T, vec3f> || std::is_same_v<T, vec4f> || std::is_same_v<T, std::vector<float>>;
+
+    template <typename T>
+    static const float* GetFloatComponents(const T& value)
     {
-        const auto& channelWorkData = m_channelsWorkData[channelIdx];
+        if constexpr (std::is_same_v<T, float>)
+            return &value;
+        else
+            return value.data();
+    }
+
+    template <typename T>
+    static size_t GetFloatComponentCount(const T& value)
+    {
+        if constexpr (std::is_same_v<T, float>)
+            return 1u;
+        else
+            return value.size();
+    }
+
+    void AnimationNodeImpl::gatherChannel(size_t channelIdx, float localAnimationTime, AnimationBatchEvaluator& evaluator)
+    {
+        auto& channelWorkData = m_channelsWorkData[channelIdx];
         const auto& channel = m_channels[channelIdx];
-        const auto& timeStamps = channelWorkData.timestamps;
+        const auto& timeStamps = *channelWorkData.timestamps;
+        auto& channelEvaluation = m_channelsEvaluation[channelIdx];
 
         // find upper/lower timestamp neighbor of elapsed timestamp
-        auto tsUpperIt = std::upper_bound(timeStamps.cbegin(), timeStamps.cend(), localAnimationTime);
+        auto tsUpperIt = timeStamps.cbegin() + static_cast<std::ptrdiff_t>(channelWorkData.cursor.findUpperBound(timeStamps, localAnimationTime));
         const auto tsLowerIt = (tsUpperIt == timeStamps.cbegin() ? timeStamps.cbegin() : tsUpperIt - 1);
         tsUpperIt = (tsUpperIt == timeStamps.cend() ? tsUpperIt - 1 : tsUpperIt);
 
         // get index into corresponding keyframes
-        const auto lowerIdx = static_cast<size_t>(std::distance(timeStamps.cbegin(), tsLowerIt));
-        const auto upperIdx = static_cast<size_t>(std::distance(timeStamps.cbegin(), tsUpperIt));
-        assert(lowerIdx < channel.keyframes->getNumElements());
-        assert(upperIdx < channel.keyframes->getNumElements());
+        channelEvaluation.lowerIdx = static_cast<size_t>(std::distance(timeStamps.cbegin(), tsLowerIt));
+        channelEvaluation.upperIdx = static_cast<size_t>(std::distance(timeStamps.cbegin(), tsUpperIt));
+        assert(channelEvaluation.lowerIdx < channel.keyframes->getNumElements());
+        assert(channelEvaluation.upperIdx < channel.keyframes->getNumElements());
 
         // calculate interpolation ratio between the elapsed time and timestamp neighbors [0.0, 1.0] (0.0=lower, 1.0=upper)
         float interpRatio = 0.f;
-        float timeBetweenKeys = *tsUpperIt - *tsLowerIt;
+        const float timeBetweenKeys = *tsUpperIt - *tsLowerIt;
         if (tsUpperIt != tsLowerIt)
             interpRatio = (localAnimationTime - *tsLowerIt) / timeBetweenKeys;
         // no clamping needed mathematically but to avoid float precision issues
-        interpRatio = std::clamp(interpRatio, 0.f, 1.f);
-
-        using DataVariant = std::variant<
-            float,
-            vec2f,
-            vec3f,
-            vec4f,
-            int32_t,
-            vec2i,
-            vec3i,
-            vec4i,
-            std::vector<float>
-        >;
-        DataVariant interpolatedValue;
+        channelEvaluation.interpRatio = std::clamp(interpRatio, 0.f, 1.f);
+        channelEvaluation.timeBetweenKeys = timeBetweenKeys;
+
+        if (channel.interpolationType == EInterpolationType::Step)
+            return;
+
         std::visit([&](const auto& v) {
-            switch (channel.interpolationType)
-            {
-            case EInterpolationType::Step:
-                interpolatedValue = v[lowerIdx];
-                break;
-            case EInterpolationType::Linear:
-            case EInterpolationType::Linear_Quaternions:
-                interpolatedValue = interpolateKeyframes_linear(v[lowerIdx], v[upperIdx], interpRatio);
-                break;
-            case EInterpolationType::Cubic:
-            case EInterpolationType::Cubic_Quaternions:
+            using ValueType = std::remove_const_t<std::remove_reference_t<decltype(v.front())>>;
+            if constexpr (IsFloatValue<ValueType>)
             {
-                using ValueType = std::remove_const_t<std::remove_reference_t<decltype(v.front())>>;
-                const auto& tIn = *channel.tangentsIn->getData<ValueType>();
-                const auto& tOut = *channel.tangentsOut->getData<ValueType>();
-                interpolatedValue = interpolateKeyframes_cubic(v[lowerIdx], v[upperIdx], tOut[lowerIdx], tIn[upperIdx], interpRatio, timeBetweenKeys);
-                break;
-            }
+                const float* lowerVal = GetFloatComponents(v[channelEvaluation.lowerIdx]);
+                const float* upperVal = GetFloatComponents(v[channelEvaluation.upperIdx]);
+                const size_t componentCount = GetFloatComponentCount(v[channelEvaluation.lowerIdx]);
+                if (channel.interpolationType == EInterpolationType::Linear || channel.interpolationType == EInterpolationType::Linear_Quaternions)
+                {
+                    channelEvaluation.firstResultIdx = evaluator.getLinearCount();
+                    for (size_t i = 0u; i < componentCount; ++i)
+                        (void)evaluator.addLinear(lowerVal[i], upperVal[i], channelEvaluation.interpRatio);
+                }
+                else
+                {
+                    const float* lowerTangentOut = GetFloatComponents((*channel.tangentsOut->getData<ValueType>())[channelEvaluation.lowerIdx]);
+                    const float* upperTangentIn = GetFloatComponents((*channel.tangentsIn->getData<ValueType>())[channelEvaluation.upperIdx]);
+                    channelEvaluation.firstResultIdx = evaluator.getCubicCount();
+                    for (size_t i = 0u; i < componentCount; ++i)
+                        (void)evaluator.addCubic(lowerVal[i], upperVal[i], lowerTangentOut[i], upperTangentIn[i], channelEvaluation.interpRatio, timeBetweenKeys);
+                }
             }
-        }, channelWorkData.keyframes);
+        }, *channelWorkData.keyframes);
+    }
 
-        if (channel.interpolationType == EInterpolationType::Linear_Quaternions || channel.interpolationType == EInterpolationType::Cubic_Quaternions)
-        {
-            auto& asQuaternion = std::get<vec4f>(interpolatedValue);
-            const float normalizationFactor = 1 / std::sqrt(
-                asQuaternion[0] * asQuaternion[0] +
-                asQuaternion[1] * asQuaternion[1] +
-                asQuaternion[2] * asQuaternion[2] +
-                asQuaternion[3] * asQuaternion[3]);
-
-            asQuaternion[0] *= normalizationFactor;
-            asQuaternion[1] *= normalizationFactor;
-            asQuaternion[2] *= normalizationFactor;
-            asQuaternion[3] *= normalizationFactor;
-        }
+    void AnimationNodeImpl::scatterChannel(size_t channelIdx, const AnimationBatchEvaluator& evaluator)
+    {
+        const auto& channel = m_channels[channelIdx];
+        const auto& channelEvaluation = m_channelsEvaluation[channelIdx];
+        const bool isStep = (channel.interpolationType == EInterpolationType::Step);
+        const bool isLinear = (channel.interpolationType == EInterpolationType::Linear || channel.interpolationType == EInterpolationType::Linear_Quaternions);
+        const auto getBatchResult = [&evaluator, isLinear](size_t resultIdx) {
+            return isLinear ? evaluator.getLinearResult(resultIdx) : evaluator.getCubicResult(resultIdx);
+        };
 
         // 'progress' is at index 0, channel outputs are shifted by one
         auto outputValueProp = getOutputs()->getChild(channelIdx + EOutputIdx_ChannelsBegin);
-        std::visit([outputValueProp](const auto& v) {
-            using ValueType = std::remove_const_t<std::remove_reference_t<decltype(v)>>;
+        std::visit([&](const auto& v) {
+            using ValueType = std::remove_const_t<std::remove_reference_t<decltype(v.front())>>;
+            const ValueType& lowerVal = v[channelEvaluation.lowerIdx];
             if constexpr (std::is_same_v<ValueType, std::vector<float>>)
             {
-                // array data type requires each array element to be set to individual output property
-                for (size_t arrayIdx = 0u; arrayIdx < v.size(); ++arrayIdx)
-                    outputValueProp->getChild(arrayIdx)->m_impl->setValue(v[arrayIdx]);
+                // array elements are written in bulk straight from keyframe or batch results, no temporary array value
+                const size_t elementCount = lowerVal.size();
+                const float* arrayValues = lowerVal.data();
+                if (!isStep)
+                {
+                    arrayValues = (isLinear ? evaluator.getLinearResults(channelEvaluation.firstResultIdx, elementCount)
+                                            : evaluator.getCubicResults(channelEvaluation.firstResultIdx, elementCount));
+                }
+                outputValueProp->m_impl->setFloatArrayValues(arrayValues, elementCount);
             }
             else
             {
-                outputValueProp->m_impl->setValue(PropertyValue{ v });
+                // step interpolation uses lower keyframe value as is
+                ValueType interpolatedValue = lowerVal;
+                if (!isStep)
+                {
+                    if constexpr (std::is_same_v<ValueType, float>)
+                    {
+                        interpolatedValue = getBatchResult(channelEvaluation.firstResultIdx);
+                    }
+                    else if constexpr (IsFloatValue<ValueType>)
+                    {
+                        for (size_t i = 0u; i < interpolatedValue.size(); ++i)
+                            interpolatedValue[i] = getBatchResult(channelEvaluation.firstResultIdx + i);
+                    }
+                    else if (isLinear)
+                    {
+                        interpolatedValue = interpolateKeyframes_linear(lowerVal, v[channelEvaluation.upperIdx], channelEvaluation.interpRatio);
+                    }
+                    else
+                    {
+                        const auto& tIn = *channel.tangentsIn->getData<ValueType>();
+                        const auto& tOut = *channel.tangentsOut->getData<ValueType>();
+                        interpolatedValue = interpolateKeyframes_cubic(lowerVal, v[channelEvaluation.upperIdx], tOut[channelEvaluation.lowerIdx], tIn[channelEvaluation.upperIdx],
+                            channelEvaluation.interpRatio, channelEvaluation.timeBetweenKeys);
+                    }
+                }
+
+                if constexpr (std::is_same_v<ValueType, vec4f>)
+                {
+                    if (channel.interpolationType == EInterpolationType::Linear_Quaternions || channel.interpolationType == EInterpolationType::Cubic_Quaternions)
+                    {
+                        const float normalizationFactor = 1 / std::sqrt(
+                            interpolatedValue[0] * interpolatedValue[0] +
+                            interpolatedValue[1] * interpolatedValue[1] +
+                            interpolatedValue[2] * interpolatedValue[2] +
+                            interpolatedValue[3] * interpolatedValue[3]);
+
+                        interpolatedValue[0] *= normalizationFactor;
+                        interpolatedValue[1] *= normalizationFactor;
+                        interpolatedValue[2] *= normalizationFactor;
+                        interpolatedValue[3] *= normalizationFactor;
+                    }
+                }
+
+                outputValueProp->m_impl->setValue(PropertyValue{ interpolatedValue });
             }
-            }, interpolatedValue);
+        }, *m_channelsWorkData[channelIdx].keyframes);
     }
 
     template <typename T>
@@ -295,7 +385,8 @@ namespace rlogic::internal
     flatbuffers::Offset<rlogic_serialization::AnimationNode> AnimationNodeImpl::Serialize(
         const AnimationNodeImpl& animNode,
         flatbuffers::FlatBufferBuilder& builder,
-        SerializationMap& serializationMap)
+        SerializationMap& serializationMap,
+        EFeatureLevel featureLevel)
     {
         std::vector<flatbuffers::Offset<rlogic_serialization::Channel>> channelsFB;
         channelsFB.reserve(animNode.m_channels.size());
@@ -333,8 +424,8 @@ namespace rlogic::internal
         }
 
         const auto logicObject = LogicObjectImpl::Serialize(animNode, builder);
-        const auto inputPropertyObject = PropertyImpl::Serialize(*animNode.getInputs()->m_impl, builder, serializationMap);
-        const auto ouputPropertyObject = PropertyImpl::Serialize(*animNode.getOutputs()->m_impl, builder, serializationMap);
+        const auto inputPropertyObject = PropertyImpl::Serialize(*animNode.getInputs()->m_impl, builder, serializationMap, featureLevel);
+        const auto ouputPropertyObject = PropertyImpl::Serialize(*animNode.getOutputs()->m_impl, builder, serializationMap, featureLevel);
         return rlogic_serialization::CreateAnimationNode(
             builder,
             logicObject,
@@ -458,10 +549,10 @@ namespace rlogic::internal
             Property* keyframesProp = channelDataProp->getChild("keyframes");
             assert(timestampsProp && keyframesProp);
             const auto& channelData = m_channelsWorkData[channelIdx];
-            assert(timestampsProp->getChildCount() == channelData.timestamps.size());
+            assert(timestampsProp->getChildCount() == channelData.timestamps->size());
             assert(keyframesProp->getChildCount() == timestampsProp->getChildCount());
 
-            const auto& timestamps = channelData.timestamps;
+            const auto& timestamps = *channelData.timestamps;
             for (size_t i = 0u; i < timestamps.size(); ++i)
                 timestampsProp->getChild(i)->m_impl->setValue(timestamps[i]);
 
@@ -477,7 +568,7 @@ namespace rlogic::internal
                     for (size_t i = 0u; i < keyframes.size(); ++i)
                         keyframesProp->getChild(i)->m_impl->setValue(keyframes[i]);
                 }
-            }, channelData.keyframes);
+            }, *channelData.keyframes);
         }
     }
 
@@ -487,19 +578,32 @@ namespace rlogic::internal
         for (size_t ch = 0u; ch < channelsDataProp->getChildCount(); ++ch)
         {
             const auto channelDataProp = channelsDataProp->getChild(ch);
+            auto& workData = m_channelsWorkData[ch];
 
+            // copy data of channel (shared with data array) only when it gets modified for the first time
             const auto timestampsProp = channelDataProp->getChild(0u);
-            auto& timestamps = m_channelsWorkData[ch].timestamps;
-            assert(timestamps.size() == timestampsProp->getChildCount());
-            for (size_t i = 0u; i < timestamps.size(); ++i)
+            assert(workData.timestamps->size() == timestampsProp->getChildCount());
+            bool timestampsModified = false;
+            for (size_t i = 0u; i < workData.timestamps->size(); ++i)
             {
-                timestamps[i] = *timestampsProp->getChild(i)->get<float>();
-                m_maxChannelDuration = std::max(m_maxChannelDuration, timestamps[i]);
+                const float timestamp = *timestampsProp->getChild(i)->get<float>();
+                if (timestamp != (*workData.timestamps)[i])
+                {
+                    if (!workData.modifiedTimestamps)
+                    {
+                        workData.modifiedTimestamps = std::make_unique<std::vector<float>>(*workData.timestamps);
+                        workData.timestamps = workData.modifiedTimestamps.get();
+                    }
+                    (*workData.modifiedTimestamps)[i] = timestamp;
+                    timestampsModified = true;
+                }
+                m_maxChannelDuration = std::max(m_maxChannelDuration, timestamp);
             }
+            if (timestampsModified)
+                workData.cursor.reset(*workData.timestamps);
 
             const auto keyframesProp = channelDataProp->getChild(1u);
-            auto& keyframesVariant = m_channelsWorkData[ch].keyframes;
-            std::visit([&](auto& keyframes) {
+            std::visit([&](const auto& keyframes) {
                 using ValueType = std::remove_const_t<std::remove_reference_t<decltype(keyframes.front())>>;
                 // array data type requires each array element of each keyframe element to be read from individual input property
                 if constexpr (std::is_same_v<ValueType, std::vector<float>>)
@@ -509,11 +613,41 @@ namespace rlogic::internal
                 else
                 {
                     for (size_t i = 0u; i < keyframes.size(); ++i)
-                        keyframes[i] = *keyframesProp->getChild(i)->get<ValueType>();
+                    {
+                        const ValueType keyframe = *keyframesProp->getChild(i)->get<ValueType>();
+                        if (keyframe != std::get<std::vector<ValueType>>(*workData.keyframes)[i])
+                        {
+                            if (!workData.modifiedKeyframes)
+                            {
+                                workData.modifiedKeyframes = std::make_unique<DataArrayImpl::DataArrayVariant>(*workData.keyframes);
+                                workData.keyframes = workData.modifiedKeyframes.get();
+                            }
+                            std::get<std::vector<ValueType>>(*workData.modifiedKeyframes)[i] = keyframe;
+                        }
+                    }
                 }
-            }, keyframesVariant);
+            }, *workData.keyframes);
         }
 
         getOutputs()->getChild(EOutputIdx_Duration)->set(m_maxChannelDuration);
     }
+
+    size_t AnimationNodeImpl::getChannelDataMemoryUsage() const
+    {
+        size_t memoryUsage = m_channelsWorkData.capacity() * sizeof(ChannelWorkData) + m_channelsEvaluation.capacity() * sizeof(ChannelEvaluation);
+        for (const auto& workData : m_channelsWorkData)
+        {
+            if (workData.modifiedTimestamps)
+                memoryUsage += sizeof(std::vector<float>) + workData.modifiedTimestamps->capacity() * sizeof(float);
+            if (workData.modifiedKeyframes)
+            {
+                memoryUsage += sizeof(DataArrayImpl::DataArrayVariant);
+                std::visit([&memoryUsage](const auto& keyframes) {
+                    memoryUsage += keyframes.capacity() * sizeof(keyframes.front());
+                    // only single values can be modified, i.e. there are never float arrays (with their own memory) here
+                }, *workData.modifiedKeyframes);
+            }
+        }
+        return memoryUsage;
+    }
 }
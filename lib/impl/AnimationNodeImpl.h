@@ -9,9 +9,12 @@
 #pragma once
 
 #include "ramses-logic/AnimationTypes.h"
+#include "ramses-logic/EFeatureLevel.h"
 
 #include "impl/LogicNodeImpl.h"
 #include "impl/DataArrayImpl.h"
+#include "internals/AnimationBatchEvaluator.h"
+#include "internals/KeyframeCursor.h"
 #include <memory>
 
 namespace rlogic_serialization
@@ -39,12 +42,24 @@ namespace rlogic::internal
         [[nodiscard]] float getMaximumChannelDuration() const;
         [[nodiscard]] const AnimationChannels& getChannels() const;
 
+        // Memory of channel data owned by this node, data shared with the data arrays of channels is not included
+        [[nodiscard]] size_t getChannelDataMemoryUsage() const;
+
         std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool canUpdateConcurrently() const override;
+        [[nodiscard]] AnimationNodeImpl* asAnimationNode() override;
+
+        // update() split into steps, so that channels of many animation nodes can be interpolated in one batch
+        // (see LogicEngineImpl::updateNodesParallel). gatherChannels adds values to interpolate to the batch,
+        // scatterChannels writes results of the evaluated batch to outputs.
+        void gatherChannels(AnimationBatchEvaluator& evaluator);
+        void scatterChannels(const AnimationBatchEvaluator& evaluator);
 
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::AnimationNode> Serialize(
             const AnimationNodeImpl& animNode,
             flatbuffers::FlatBufferBuilder& builder,
-            SerializationMap& serializationMap);
+            SerializationMap& serializationMap,
+            EFeatureLevel featureLevel);
         [[nodiscard]] static std::unique_ptr<AnimationNodeImpl> Deserialize(
             const rlogic_serialization::AnimationNode& animNodeFB,
             ErrorReporting& errorReporting,
@@ -53,7 +68,8 @@ namespace rlogic::internal
         void createRootProperties() final;
 
     private:
-        void updateChannel(size_t channelIdx, float localAnimationTime);
+        void gatherChannel(size_t channelIdx, float localAnimationTime, AnimationBatchEvaluator& evaluator);
+        void scatterChannel(size_t channelIdx, const AnimationBatchEvaluator& evaluator);
 
         template <typename T>
         T interpolateKeyframes_linear(T lowerVal, T upperVal, float interpRatio);
@@ -66,14 +82,33 @@ namespace rlogic::internal
         // original channel data provided by user
         AnimationChannels m_channels;
 
-        // work data (extracted copy of subset of original data)
+        // work data (subset of original data), refers to data of channel's data arrays which are immutable and shared by all animation
+        // nodes using them. Data is copied only when modified through channel data properties (if exposed), work data then refers to the copy.
         struct ChannelWorkData
         {
-            std::vector<float> timestamps;
-            DataArrayImpl::DataArrayVariant keyframes;
+            const std::vector<float>* timestamps = nullptr;
+            const DataArrayImpl::DataArrayVariant* keyframes = nullptr;
+            std::unique_ptr<std::vector<float>> modifiedTimestamps;
+            std::unique_ptr<DataArrayImpl::DataArrayVariant> modifiedKeyframes;
+            // position within timestamps found in last update
+            KeyframeCursor cursor;
         };
         std::vector<ChannelWorkData> m_channelsWorkData;
 
+        // keyframes found for each channel by gatherChannels and where their interpolated components are in the batch
+        struct ChannelEvaluation
+        {
+            size_t lowerIdx = 0u;
+            size_t upperIdx = 0u;
+            float interpRatio = 0.f;
+            float timeBetweenKeys = 0.f;
+            // index of first component in linear or cubic batch (depending on interpolation type), unused if interpolated separately
+            size_t firstResultIdx = 0u;
+        };
+        std::vector<ChannelEvaluation> m_channelsEvaluation;
+        // used when updated on its own (update()), kept to avoid reallocs every update
+        AnimationBatchEvaluator m_batchEvaluator;
+
         float m_maxChannelDuration = 0.f;
 
         bool m_hasChannelDataExposedViaProperties = false;
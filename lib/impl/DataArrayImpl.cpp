@@ -10,8 +10,10 @@
 #include "generated/DataArrayGen.h"
 #include "flatbuffers/flatbuffers.h"
 #include "internals/ErrorReporting.h"
+#include "internals/KeyframeQuantization.h"
 #include "LoggerImpl.h"
 #include <cassert>
+#include <optional>
 
 namespace rlogic::internal
 {
@@ -66,63 +68,142 @@ namespace rlogic::internal
         return dataFlattened;
     }
 
-    flatbuffers::Offset<rlogic_serialization::DataArray> DataArrayImpl::Serialize(const DataArrayImpl& data, flatbuffers::FlatBufferBuilder& builder, SerializationMap& /*serializationMap*/, EFeatureLevel /*featureLevel*/)
+    struct CompressedData
     {
-        rlogic_serialization::ArrayUnion unionType = rlogic_serialization::ArrayUnion::NONE;
-        rlogic_serialization::EDataArrayType arrayType = rlogic_serialization::EDataArrayType::Float;
+        rlogic_serialization::EDataArrayType arrayType;
+        rlogic_serialization::ArrayUnion unionType;
         flatbuffers::Offset<void> dataOffset;
+    };
+
+    static std::optional<CompressedData> SerializeCompressed(const DataArrayImpl& data, flatbuffers::FlatBufferBuilder& builder, EDataArrayEncoding encoding)
+    {
+        if (encoding == EDataArrayEncoding::PackedQuaternions && data.getDataType() == EPropertyType::Vec4f)
+        {
+            const auto& quaternions = std::get<std::vector<vec4f>>(data.getDataVariant());
+            if (KeyframeQuantization::AreUnitQuaternions(quaternions))
+            {
+                const auto packedOffset = rlogic_serialization::CreatepackedQuaternionArr(builder, builder.CreateVector(KeyframeQuantization::PackQuaternions(quaternions)));
+                return CompressedData{ rlogic_serialization::EDataArrayType::Vec4f, rlogic_serialization::ArrayUnion::packedQuaternionArr, packedOffset.Union() };
+            }
+        }
 
-        switch (data.m_dataType)
+        rlogic_serialization::EDataArrayType arrayType = rlogic_serialization::EDataArrayType::Float;
+        std::vector<float> values;
+        size_t numComponents = 0u;
+        switch (data.getDataType())
         {
         case EPropertyType::Float:
-            unionType = rlogic_serialization::ArrayUnion::floatArr;
-            arrayType = rlogic_serialization::EDataArrayType::Float;
-            dataOffset = rlogic_serialization::CreatefloatArr(builder, builder.CreateVector(std::get<std::vector<float>>(data.m_data))).Union();
+            values = std::get<std::vector<float>>(data.getDataVariant());
+            numComponents = 1u;
             break;
         case EPropertyType::Vec2f:
-            unionType = rlogic_serialization::ArrayUnion::floatArr;
             arrayType = rlogic_serialization::EDataArrayType::Vec2f;
-            dataOffset = rlogic_serialization::CreatefloatArr(builder, builder.CreateVector(flattenArrayOfVec<vec2f, float>(data.m_data))).Union();
+            values = flattenArrayOfVec<vec2f, float>(data.getDataVariant());
+            numComponents = 2u;
             break;
         case EPropertyType::Vec3f:
-            unionType = rlogic_serialization::ArrayUnion::floatArr;
             arrayType = rlogic_serialization::EDataArrayType::Vec3f;
-            dataOffset = rlogic_serialization::CreatefloatArr(builder, builder.CreateVector(flattenArrayOfVec<vec3f, float>(data.m_data))).Union();
+            values = flattenArrayOfVec<vec3f, float>(data.getDataVariant());
+            numComponents = 3u;
             break;
         case EPropertyType::Vec4f:
-            unionType = rlogic_serialization::ArrayUnion::floatArr;
             arrayType = rlogic_serialization::EDataArrayType::Vec4f;
-            dataOffset = rlogic_serialization::CreatefloatArr(builder, builder.CreateVector(flattenArrayOfVec<vec4f, float>(data.m_data))).Union();
-            break;
-        case EPropertyType::Int32:
-            unionType = rlogic_serialization::ArrayUnion::intArr;
-            arrayType = rlogic_serialization::EDataArrayType::Int32;
-            dataOffset = rlogic_serialization::CreateintArr(builder, builder.CreateVector(std::get<std::vector<int32_t>>(data.m_data))).Union();
-            break;
-        case EPropertyType::Vec2i:
-            unionType = rlogic_serialization::ArrayUnion::intArr;
-            arrayType = rlogic_serialization::EDataArrayType::Vec2i;
-            dataOffset = rlogic_serialization::CreateintArr(builder, builder.CreateVector(flattenArrayOfVec<vec2i, int32_t>(data.m_data))).Union();
-            break;
-        case EPropertyType::Vec3i:
-            unionType = rlogic_serialization::ArrayUnion::intArr;
-            arrayType = rlogic_serialization::EDataArrayType::Vec3i;
-            dataOffset = rlogic_serialization::CreateintArr(builder, builder.CreateVector(flattenArrayOfVec<vec3i, int32_t>(data.m_data))).Union();
-            break;
-        case EPropertyType::Vec4i:
-            unionType = rlogic_serialization::ArrayUnion::intArr;
-            arrayType = rlogic_serialization::EDataArrayType::Vec4i;
-            dataOffset = rlogic_serialization::CreateintArr(builder, builder.CreateVector(flattenArrayOfVec<vec4i, int32_t>(data.m_data))).Union();
+            values = flattenArrayOfVec<vec4f, float>(data.getDataVariant());
+            numComponents = 4u;
             break;
         case EPropertyType::Array:
-            unionType = rlogic_serialization::ArrayUnion::floatArr;
             arrayType = rlogic_serialization::EDataArrayType::FloatArray;
-            dataOffset = rlogic_serialization::CreatefloatArr(builder, builder.CreateVector(flattenArrayOfVec<std::vector<float>, float>(data.m_data))).Union();
+            values = flattenArrayOfVec<std::vector<float>, float>(data.getDataVariant());
+            numComponents = getNumComponents(std::get<std::vector<std::vector<float>>>(data.getDataVariant()));
             break;
-        case EPropertyType::Bool:
         default:
-            assert(!"missing implementation");
-            break;
+            // integer values are always stored as they are
+            return std::nullopt;
+        }
+
+        if (numComponents == 0u)
+            return std::nullopt;
+        const auto quantized = KeyframeQuantization::QuantizeFloats(values, numComponents);
+        if (!quantized)
+            return std::nullopt;
+
+        const auto quantizedOffset = rlogic_serialization::CreatequantizedFloatArr(builder,
+            builder.CreateVector(quantized->values),
+            builder.CreateVector(quantized->componentMin),
+            builder.CreateVector(quantized->componentMax));
+        return CompressedData{ arrayType, rlogic_serialization::ArrayUnion::quantizedFloatArr, quantizedOffset.Union() };
+    }
+
+    flatbuffers::Offset<rlogic_serialization::DataArray> DataArrayImpl::Serialize(const DataArrayImpl& data, flatbuffers::FlatBufferBuilder& builder, SerializationMap& /*serializationMap*/, EFeatureLevel featureLevel, EDataArrayEncoding encoding)
+    {
+        rlogic_serialization::ArrayUnion unionType = rlogic_serialization::ArrayUnion::NONE;
+        rlogic_serialization::EDataArrayType arrayType = rlogic_serialization::EDataArrayType::Float;
+        flatbuffers::Offset<void> dataOffset;
+
+        // compressed encodings fall back to full precision for data which can't be compressed
+        assert(encoding == EDataArrayEncoding::Full || featureLevel >= EFeatureLevel_07);
+        (void)featureLevel;
+        const std::optional<CompressedData> compressedData = (encoding != EDataArrayEncoding::Full ? SerializeCompressed(data, builder, encoding) : std::nullopt);
+        if (compressedData)
+        {
+            unionType = compressedData->unionType;
+            arrayType = compressedData->arrayType;
+            dataOffset = compressedData->dataOffset;
+        }
+        else
+        {
+            switch (data.m_dataType)
+            {
+            case EPropertyType::Float:
+                unionType = rlogic_serialization::ArrayUnion::floatArr;
+                arrayType = rlogic_serialization::EDataArrayType::Float;
+                dataOffset = rlogic_serialization::CreatefloatArr(builder, builder.CreateVector(std::get<std::vector<float>>(data.m_data))).Union();
+                break;
+            case EPropertyType::Vec2f:
+                unionType = rlogic_serialization::ArrayUnion::floatArr;
+                arrayType = rlogic_serialization::EDataArrayType::Vec2f;
+                dataOffset = rlogic_serialization::CreatefloatArr(builder, builder.CreateVector(flattenArrayOfVec<vec2f, float>(data.m_data))).Union();
+                break;
+            case EPropertyType::Vec3f:
+                unionType = rlogic_serialization::ArrayUnion::floatArr;
+                arrayType = rlogic_serialization::EDataArrayType::Vec3f;
+                dataOffset = rlogic_serialization::CreatefloatArr(builder, builder.CreateVector(flattenArrayOfVec<vec3f, float>(data.m_data))).Union();
+                break;
+            case EPropertyType::Vec4f:
+                unionType = rlogic_serialization::ArrayUnion::floatArr;
+                arrayType = rlogic_serialization::EDataArrayType::Vec4f;
+                dataOffset = rlogic_serialization::CreatefloatArr(builder, builder.CreateVector(flattenArrayOfVec<vec4f, float>(data.m_data))).Union();
+                break;
+            case EPropertyType::Int32:
+                unionType = rlogic_serialization::ArrayUnion::intArr;
+                arrayType = rlogic_serialization::EDataArrayType::Int32;
+                dataOffset = rlogic_serialization::CreateintArr(builder, builder.CreateVector(std::get<std::vector<int32_t>>(data.m_data))).Union();
+                break;
+            case EPropertyType::Vec2i:
+                unionType = rlogic_serialization::ArrayUnion::intArr;
+                arrayType = rlogic_serialization::EDataArrayType::Vec2i;
+                dataOffset = rlogic_serialization::CreateintArr(builder, builder.CreateVector(flattenArrayOfVec<vec2i, int32_t>(data.m_data))).Union();
+                break;
+            case EPropertyType::Vec3i:
+                unionType = rlogic_serialization::ArrayUnion::intArr;
+                arrayType = rlogic_serialization::EDataArrayType::Vec3i;
+                dataOffset = rlogic_serialization::CreateintArr(builder, builder.CreateVector(flattenArrayOfVec<vec3i, int32_t>(data.m_data))).Union();
+                break;
+            case EPropertyType::Vec4i:
+                unionType = rlogic_serialization::ArrayUnion::intArr;
+                arrayType = rlogic_serialization::EDataArrayType::Vec4i;
+                dataOffset = rlogic_serialization::CreateintArr(builder, builder.CreateVector(flattenArrayOfVec<vec4i, int32_t>(data.m_data))).Union();
+                break;
+            case EPropertyType::Array:
+                unionType = rlogic_serialization::ArrayUnion::floatArr;
+                arrayType = rlogic_serialization::EDataArrayType::FloatArray;
+                dataOffset = rlogic_serialization::CreatefloatArr(builder, builder.CreateVector(flattenArrayOfVec<std::vector<float>, float>(data.m_data))).Union();
+                break;
+            case EPropertyType::Bool:
+            default:
+                assert(!"missing implementation");
+                break;
+            }
         }
 
         const auto logicObject = LogicObjectImpl::Serialize(data, builder);
@@ -157,9 +238,10 @@ namespace rlogic::internal
         return true;
     }
 
-    template <typename T, typename fbT>
-    std::vector<T> unflattenIntoArrayOfVec(const flatbuffers::Vector<fbT>& fbDataFlattened, uint32_t numComponents)
+    template <typename T, typename fbT, typename FlattenedT>
+    std::vector<T> unflattenIntoArrayOfVec(const FlattenedT& fbDataFlattened, uint32_t numComponents)
     {
+        static_assert(std::is_same_v<typename FlattenedT::value_type, fbT>, "wrong base type used");
         std::vector<T> dataVec;
         assert(fbDataFlattened.size() % numComponents == 0u); //checked in validation above
         dataVec.resize(fbDataFlattened.size() / numComponents);
@@ -203,6 +285,101 @@ namespace rlogic::internal
         }
     }
 
+    static std::unique_ptr<DataArrayImpl> DeserializeCompressed(const rlogic_serialization::DataArray& data, ErrorReporting& errorReporting, std::string_view name, uint64_t id)
+    {
+        std::vector<float> decodedValues;
+        uint32_t numComponents = 0u;
+        if (data.data_type() == rlogic_serialization::ArrayUnion::packedQuaternionArr)
+        {
+            if (data.type() != rlogic_serialization::EDataArrayType::Vec4f || !data.data_as_packedQuaternionArr()->data())
+            {
+                errorReporting.add("Fatal error during loading of DataArray from serialized data: unexpected data type!", nullptr, EErrorType::BinaryVersionMismatch);
+                return nullptr;
+            }
+            const auto& packed = *data.data_as_packedQuaternionArr()->data();
+            if (data.numElements() == 0u || packed.size() != static_cast<size_t>(data.numElements()) * KeyframeQuantization::PackedQuaternionSize)
+            {
+                errorReporting.add("Fatal error during loading of DataArray from serialized data: unexpected data size!", nullptr, EErrorType::BinaryVersionMismatch);
+                return nullptr;
+            }
+
+            numComponents = 4u;
+            decodedValues.reserve(static_cast<size_t>(data.numElements()) * numComponents);
+            for (flatbuffers::uoffset_t i = 0u; i < packed.size(); i += KeyframeQuantization::PackedQuaternionSize)
+            {
+                const vec4f quaternion = KeyframeQuantization::UnpackQuaternion(packed[i], packed[i + 1u], packed[i + 2u]);
+                decodedValues.insert(decodedValues.end(), quaternion.cbegin(), quaternion.cend());
+            }
+        }
+        else
+        {
+            const auto* quantized = data.data_as_quantizedFloatArr();
+            assert(quantized);
+            if (!quantized->data() || !quantized->componentMin() || !quantized->componentMax() || quantized->componentMin()->size() != quantized->componentMax()->size())
+            {
+                errorReporting.add("Fatal error during loading of DataArray from serialized data: unexpected data type!", nullptr, EErrorType::BinaryVersionMismatch);
+                return nullptr;
+            }
+
+            numComponents = quantized->componentMin()->size();
+            uint32_t expectedNumComponents = numComponents;
+            switch (data.type())
+            {
+            case rlogic_serialization::EDataArrayType::Float:
+                expectedNumComponents = 1u;
+                break;
+            case rlogic_serialization::EDataArrayType::Vec2f:
+                expectedNumComponents = 2u;
+                break;
+            case rlogic_serialization::EDataArrayType::Vec3f:
+                expectedNumComponents = 3u;
+                break;
+            case rlogic_serialization::EDataArrayType::Vec4f:
+                expectedNumComponents = 4u;
+                break;
+            case rlogic_serialization::EDataArrayType::FloatArray:
+                break;
+            default:
+                // integer data is never quantized
+                expectedNumComponents = 0u;
+                break;
+            }
+
+            const auto& quantizedValues = *quantized->data();
+            if (numComponents == 0u || numComponents != expectedNumComponents || data.numElements() == 0u || quantizedValues.size() != static_cast<size_t>(data.numElements()) * numComponents)
+            {
+                errorReporting.add("Fatal error during loading of DataArray from serialized data: unexpected data size!", nullptr, EErrorType::BinaryVersionMismatch);
+                return nullptr;
+            }
+
+            const auto& componentMin = *quantized->componentMin();
+            const auto& componentMax = *quantized->componentMax();
+            decodedValues.resize(quantizedValues.size());
+            for (flatbuffers::uoffset_t i = 0u; i < quantizedValues.size(); ++i)
+            {
+                const flatbuffers::uoffset_t component = i % numComponents;
+                decodedValues[i] = KeyframeQuantization::DequantizeFloat(quantizedValues[i], componentMin[component], componentMax[component]);
+            }
+        }
+
+        switch (data.type())
+        {
+        case rlogic_serialization::EDataArrayType::Float:
+            return std::make_unique<DataArrayImpl>(std::move(decodedValues), name, id);
+        case rlogic_serialization::EDataArrayType::Vec2f:
+            return std::make_unique<DataArrayImpl>(unflattenIntoArrayOfVec<vec2f, float>(decodedValues, numComponents), name, id);
+        case rlogic_serialization::EDataArrayType::Vec3f:
+            return std::make_unique<DataArrayImpl>(unflattenIntoArrayOfVec<vec3f, float>(decodedValues, numComponents), name, id);
+        case rlogic_serialization::EDataArrayType::Vec4f:
+            return std::make_unique<DataArrayImpl>(unflattenIntoArrayOfVec<vec4f, float>(decodedValues, numComponents), name, id);
+        case rlogic_serialization::EDataArrayType::FloatArray:
+            return std::make_unique<DataArrayImpl>(unflattenIntoArrayOfVec<std::vector<float>, float>(decodedValues, numComponents), name, id);
+        default:
+            assert(!"validated above");
+            return nullptr;
+        }
+    }
+
     std::unique_ptr<DataArrayImpl> DataArrayImpl::Deserialize(const rlogic_serialization::DataArray& data, ErrorReporting& errorReporting)
     {
         std::string name;
@@ -216,6 +393,15 @@ namespace rlogic::internal
         }
 
         std::unique_ptr<DataArrayImpl> deserialized;
+        if (data.data_type() == rlogic_serialization::ArrayUnion::quantizedFloatArr || data.data_type() == rlogic_serialization::ArrayUnion::packedQuaternionArr)
+        {
+            deserialized = DeserializeCompressed(data, errorReporting, name, id);
+            if (!deserialized)
+                return nullptr;
+            deserialized->setUserId(userIdHigh, userIdLow);
+            return deserialized;
+        }
+
         switch (data.type())
         {
         case rlogic_serialization::EDataArrayType::Float:
@@ -32,6 +32,17 @@ namespace rlogic::internal
     class ErrorReporting;
     class SerializationMap;
 
+    // How values of a DataArray are stored in serialized data, compressed encodings require feature level 07 or higher
+    // and fall back to full precision for data which can't be compressed
+    enum class EDataArrayEncoding
+    {
+        Full,
+        // float based values quantized to 16 bits per component
+        Quantized,
+        // unit quaternions (vec4f) packed into 48 bits, other data quantized
+        PackedQuaternions
+    };
+
     class DataArrayImpl : public LogicObjectImpl
     {
     public:
@@ -47,7 +58,8 @@ namespace rlogic::internal
             const DataArrayImpl& data,
             flatbuffers::FlatBufferBuilder& builder,
             SerializationMap& serializationMap,
-            EFeatureLevel featureLevel);
+            EFeatureLevel featureLevel,
+            EDataArrayEncoding encoding = EDataArrayEncoding::Full);
 
         [[nodiscard]] static std::unique_ptr<DataArrayImpl> Deserialize(
             const rlogic_serialization::DataArray& data,
@@ -17,6 +17,7 @@ namespace rlogic::internal
 
     void LoggerImpl::setLogHandler(Logger::LogHandlerFunc logHandlerFunc)
     {
+        std::lock_guard<std::mutex> lock(m_logMutex);
         m_logHandler = std::move(logHandlerFunc);
     }
 
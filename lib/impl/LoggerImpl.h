@@ -13,6 +13,8 @@
 
 #include "fmt/format.h"
 
+#include <mutex>
+
 #ifdef __ANDROID__
 #include <android/log.h>
 #else
@@ -97,6 +99,9 @@ namespace rlogic::internal
 
         Logger::LogHandlerFunc m_logHandler;
         bool                   m_defaultLogging = true;
+        // Nodes executed on worker threads (see LogicEngine::setUpdateThreadCount) log concurrently,
+        // messages are printed and passed to the log handler one at a time
+        std::mutex             m_logMutex;
 
         ELogMessageType m_logVerbosityLimit = ELogMessageType::Info;
 
@@ -117,6 +122,7 @@ namespace rlogic::internal
         }
 
         const std::string formattedMessage = fmt::format(fmtString, args...);
+        std::lock_guard<std::mutex> lock(m_logMutex);
         if (m_defaultLogging)
         {
             PrintLogMessage(messageType, formattedMessage);
@@ -64,34 +64,16 @@ namespace rlogic
         return m_impl->getSerializedSize<T>();
     }
 
-    template <typename T>
-    const T* findObject(const internal::ApiObjects& apiObjects, std::string_view name)
-    {
-        const auto& container = apiObjects.getApiObjectContainer<T>();
-        const auto it = std::find_if(container.cbegin(), container.cend(), [name](const auto& o) {
-            return o->getName() == name; });
-
-        return (it == container.cend() ? nullptr : *it);
-    }
-
     template <typename T>
     const T* LogicEngine::findLogicObjectInternal(std::string_view name) const
     {
-        auto& container = m_impl->getApiObjects().getApiObjectContainer<T>();
-        const auto it = std::find_if(container.begin(), container.end(), [name](const auto& o) {
-            return o->getName() == name; });
-
-        return (it == container.end() ? nullptr : *it);
+        return m_impl->getApiObjects().getApiObjectByName<T>(name);
     }
 
     template <typename T>
     T* LogicEngine::findLogicObjectInternal(std::string_view name)
     {
-        auto& container = m_impl->getApiObjects().getApiObjectContainer<T>();
-        const auto it = std::find_if(container.begin(), container.end(), [name](const auto& o) {
-            return o->getName() == name; });
-
-        return (it == container.end() ? nullptr : *it);
+        return m_impl->getApiObjects().getApiObjectByName<T>(name);
     }
 
     const LogicObject* LogicEngine::findLogicObjectById(uint64_t id) const
@@ -134,6 +116,11 @@ namespace rlogic
         return m_impl->destroy(object);
     }
 
+    bool LogicEngine::destroy(const std::vector<LogicObject*>& objects)
+    {
+        return m_impl->destroy(objects);
+    }
+
     RamsesAppearanceBinding* LogicEngine::createRamsesAppearanceBinding(ramses::Appearance& ramsesAppearance, std::string_view name)
     {
         return m_impl->createRamsesAppearanceBinding(ramsesAppearance, name);
@@ -211,6 +198,31 @@ namespace rlogic
         return m_impl->update();
     }
 
+    bool LogicEngine::setUpdateThreadCount(size_t threadCount)
+    {
+        return m_impl->setUpdateThreadCount(threadCount);
+    }
+
+    bool LogicEngine::setLuaStateCount(size_t luaStateCount)
+    {
+        return m_impl->setLuaStateCount(luaStateCount);
+    }
+
+    bool LogicEngine::setLoadThreadCount(size_t threadCount)
+    {
+        return m_impl->setLoadThreadCount(threadCount);
+    }
+
+    void LogicEngine::enableLazyLuaScriptLoading(bool enable)
+    {
+        m_impl->enableLazyLuaScriptLoading(enable);
+    }
+
+    bool LogicEngine::prewarmLuaScripts(const std::vector<LuaScript*>& scripts)
+    {
+        return m_impl->prewarmLuaScripts(scripts);
+    }
+
     void LogicEngine::enableUpdateReport(bool enable)
     {
         m_impl->enableUpdateReport(enable);
@@ -261,6 +273,16 @@ namespace rlogic
         return m_impl->saveToFile(filename, *config.m_impl);
     }
 
+    bool LogicEngine::saveToFileDescriptor(int fd, const SaveFileConfig& config)
+    {
+        return m_impl->saveToFileDescriptor(fd, *config.m_impl);
+    }
+
+    bool LogicEngine::saveToBuffer(std::vector<char>& buffer, const SaveFileConfig& config)
+    {
+        return m_impl->saveToBuffer(buffer, *config.m_impl);
+    }
+
     bool LogicEngine::link(const Property& sourceProperty, const Property& targetProperty)
     {
         return m_impl->link(sourceProperty, targetProperty);
@@ -291,6 +313,11 @@ namespace rlogic
         return m_impl->getApiObjects().getAllPropertyLinks();
     }
 
+    uint64_t LogicEngine::getPropertyLinksGeneration() const
+    {
+        return m_impl->getApiObjects().getPropertyLinksGeneration();
+    }
+
     template RLOGIC_API Collection<LogicObject>              LogicEngine::getLogicObjectsInternal<LogicObject>() const;
     template RLOGIC_API Collection<LuaScript>                LogicEngine::getLogicObjectsInternal<LuaScript>() const;
     template RLOGIC_API Collection<LuaModule>                LogicEngine::getLogicObjectsInternal<LuaModule>() const;
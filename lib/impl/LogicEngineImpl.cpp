@@ -32,6 +32,7 @@
 #include "impl/SaveFileConfigImpl.h"
 #include "impl/LogicEngineReportImpl.h"
 #include "impl/RamsesRenderGroupBindingElementsImpl.h"
+#include "impl/AnimationNodeImpl.h"
 
 #include "internals/FileUtils.h"
 #include "internals/TypeUtils.h"
@@ -52,6 +53,8 @@
 #include <string>
 #include <fstream>
 #include <streambuf>
+#include <chrono>
+#include <algorithm>
 
 namespace
 {
@@ -224,16 +227,14 @@ namespace rlogic::internal
 
         for (const auto nodeBinding : joints)
         {
-            const auto& nodeBindings = m_apiObjects->getApiObjectContainer<RamsesNodeBinding>();
-            if (std::find(nodeBindings.cbegin(), nodeBindings.cend(), nodeBinding) == nodeBindings.cend())
+            if (!m_apiObjects->contains(nodeBinding))
             {
                 m_errors.add(fmt::format("Failed to create SkinBinding '{}': one or more of the provided Ramses node bindings was not found in this logic instance.", name), nullptr, EErrorType::IllegalArgument);
                 return nullptr;
             }
         }
 
-        const auto& appearanceBindings = m_apiObjects->getApiObjectContainer<RamsesAppearanceBinding>();
-        if (std::find(appearanceBindings.cbegin(), appearanceBindings.cend(), &appearanceBinding) == appearanceBindings.cend())
+        if (!m_apiObjects->contains(&appearanceBinding))
         {
             m_errors.add(fmt::format("Failed to create SkinBinding '{}': provided Ramses appearance binding was not found in this logic instance.", name), nullptr, EErrorType::IllegalArgument);
             return nullptr;
@@ -302,10 +303,7 @@ namespace rlogic::internal
         m_errors.clear();
 
         auto containsDataArray = [this](const DataArray* da) {
-            const auto& dataArrays = m_apiObjects->getApiObjectContainer<DataArray>();
-            const auto it = std::find_if(dataArrays.cbegin(), dataArrays.cend(),
-                [da](const auto& d) { return d == da; });
-            return it != dataArrays.cend();
+            return m_apiObjects->contains(da);
         };
 
         if (config.getChannels().empty())
@@ -349,10 +347,7 @@ namespace rlogic::internal
             return nullptr;
         }
 
-        const auto& nodeBindings = m_apiObjects->getApiObjectContainer<RamsesNodeBinding>();
-        const auto& cameraBindings = m_apiObjects->getApiObjectContainer<RamsesCameraBinding>();
-        if (std::find(nodeBindings.cbegin(), nodeBindings.cend(), &nodeBinding) == nodeBindings.cend() ||
-            std::find(cameraBindings.cbegin(), cameraBindings.cend(), &cameraBinding) == cameraBindings.cend())
+        if (!m_apiObjects->contains(&nodeBinding) || !m_apiObjects->contains(&cameraBinding))
         {
             m_errors.add(fmt::format("Failed to create AnchorPoint '{}': provided Ramses node binding and/or camera binding were not found in this logic instance.", name), nullptr, EErrorType::IllegalArgument);
             return nullptr;
@@ -367,6 +362,12 @@ namespace rlogic::internal
         return m_apiObjects->destroy(object, m_errors);
     }
 
+    bool LogicEngineImpl::destroy(const std::vector<LogicObject*>& objects)
+    {
+        m_errors.clear();
+        return m_apiObjects->destroy(objects, m_errors);
+    }
+
     bool LogicEngineImpl::isLinked(const LogicNode& logicNode) const
     {
         return m_apiObjects->getLogicNodeDependencies().isLinked(logicNode.m_impl);
@@ -377,32 +378,17 @@ namespace rlogic::internal
         return m_featureLevel;
     }
 
-    size_t LogicEngineImpl::activateLinksRecursive(PropertyImpl& output)
+    size_t LogicEngineImpl::activateLinks(LogicNodeImpl& node)
     {
         size_t activatedLinks = 0u;
 
-        const auto childCount = output.getChildCount();
-        for (size_t i = 0; i < childCount; ++i)
+        for (const auto& link : node.getOutgoingLinks())
         {
-            PropertyImpl& child = *output.getChild(i)->m_impl;
-
-            if (TypeUtils::CanHaveChildren(child.getType()))
-            {
-                activatedLinks += activateLinksRecursive(child);
-            }
-            else
+            const bool valueChanged = link.target->copyValueFrom(*link.source);
+            if (valueChanged || link.target->getPropertySemantics() == EPropertySemantics::AnimationInput)
             {
-                const auto& outgoingLinks = child.getOutgoingLinks();
-                for (const auto& outLink : outgoingLinks)
-                {
-                    PropertyImpl* linkedProp = outLink.property;
-                    const bool valueChanged = linkedProp->setValue(child.getValue());
-                    if (valueChanged || linkedProp->getPropertySemantics() == EPropertySemantics::AnimationInput)
-                    {
-                        linkedProp->getLogicNode().setDirty(true);
-                        ++activatedLinks;
-                    }
-                }
+                link.target->getLogicNode().setDirty(true);
+                ++activatedLinks;
             }
         }
 
@@ -427,6 +413,7 @@ namespace rlogic::internal
         if (!sortedNodes)
         {
             m_errors.add("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling update()!", nullptr, EErrorType::ContentStateError);
+            logLinkCycle();
             return false;
         }
 
@@ -436,7 +423,14 @@ namespace rlogic::internal
         // force dirty all timer nodes, anchor points and skinbindings
         setNodeToBeAlwaysUpdatedDirty();
 
-        const bool success = updateNodes(*sortedNodes);
+        const bool success = (m_updateThreadPool ?
+            updateNodesParallel(m_apiObjects->getLogicNodeDependencies().getUpdateLevels()) :
+            updateNodes(*sortedNodes));
+
+        // parallel update checks dirtiness of every node itself and never processes the queue, drop the executed nodes
+        // so that the queue does not keep every node which was ever dirty
+        if (m_updateThreadPool)
+            m_apiObjects->getLogicNodeDependencies().getDirtyNodes().dropCleanNodes();
 
         if (m_statisticsEnabled || m_updateReportEnabled)
         {
@@ -449,44 +443,270 @@ namespace rlogic::internal
         return success;
     }
 
+    void LogicEngineImpl::logLinkCycle() const
+    {
+        const NodeVector& cycle = m_apiObjects->getLogicNodeDependencies().getNodesInCycle();
+        if (cycle.empty())
+            return;
+
+        std::string cycleDescription;
+        for (const LogicNodeImpl* node : cycle)
+            cycleDescription += fmt::format("'{}' -> ", node->getIdentificationString());
+        cycleDescription += fmt::format("'{}'", cycle.front()->getIdentificationString());
+
+        LOG_ERROR("Link cycle detected between logic nodes: {}", cycleDescription);
+    }
+
     bool LogicEngineImpl::updateNodes(const NodeVector& sortedNodes)
     {
-        for (LogicNodeImpl* nodeIter : sortedNodes)
+        if (!m_nodeDirtyMechanismEnabled)
         {
-            LogicNodeImpl& node = *nodeIter;
+            for (LogicNodeImpl* node : sortedNodes)
+            {
+                if (!node->isDirty() && m_updateReportEnabled)
+                    m_updateReport.nodeSkippedExecution(*node);
+
+                if (!updateNode(*node))
+                    return false;
+            }
+
+            if (m_statisticsEnabled || m_updateReportEnabled)
+                m_updateReport.nodesVisited(sortedNodes.size(), sortedNodes.size());
+
+            return true;
+        }
 
-            if (!node.isDirty())
+        // Visit only dirty nodes (and nodes which become dirty by link activation) in rank order
+        DirtyNodeQueue& dirtyNodes = m_apiObjects->getLogicNodeDependencies().getDirtyNodes();
+        dirtyNodes.startProcessing(sortedNodes);
+        bool success = true;
+        while (LogicNodeImpl* node = dirtyNodes.popNext())
+        {
+            if (!updateNode(*node))
             {
-                if (m_updateReportEnabled)
-                    m_updateReport.nodeSkippedExecution(node);
+                success = false;
+                break;
+            }
+        }
+        dirtyNodes.finishProcessing();
 
-                if(m_nodeDirtyMechanismEnabled)
-                    continue;
+        if (m_statisticsEnabled || m_updateReportEnabled)
+            m_updateReport.nodesVisited(dirtyNodes.getVisitedNodesCount(), sortedNodes.size());
+
+        if (m_updateReportEnabled)
+        {
+            // Nodes which were not visited are reported as skipped, up to the failed node in case of error.
+            // Executed nodes are ordered by rank, same as sorted nodes.
+            const auto& executedNodes = m_updateReport.getNodesExecuted();
+            auto executedNodeIt = executedNodes.cbegin();
+            for (LogicNodeImpl* node : sortedNodes)
+            {
+                if (executedNodeIt != executedNodes.cend() && executedNodeIt->first == node)
+                    ++executedNodeIt;
+                else if (executedNodeIt != executedNodes.cend() || success)
+                    m_updateReport.nodeSkippedExecution(*node);
+                else
+                    break;
             }
+        }
+
+        return success;
+    }
+
+    bool LogicEngineImpl::updateNode(LogicNodeImpl& node)
+    {
+        if (m_updateReportEnabled)
+            m_updateReport.nodeExecutionStarted(node);
+        if (m_statisticsEnabled)
+            m_statistics.nodeExecuted();
+
+        const std::optional<LogicNodeRuntimeError> potentialError = node.update();
+        if (potentialError)
+        {
+            m_errors.add(potentialError->message, m_apiObjects->getApiObject(node), EErrorType::RuntimeError);
+            return false;
+        }
+
+        const size_t activatedLinks = activateLinks(node);
+        if (m_statisticsEnabled || m_updateReportEnabled)
+            m_updateReport.linksActivated(activatedLinks);
+
+        if (m_updateReportEnabled)
+            m_updateReport.nodeExecutionFinished();
+
+        node.setDirty(false);
+
+        return true;
+    }
+
+    bool LogicEngineImpl::updateNodesParallel(const std::vector<NodeVector>& levels)
+    {
+        if (m_statisticsEnabled || m_updateReportEnabled)
+        {
+            size_t nodeCount = 0u;
+            for (const NodeVector& level : levels)
+                nodeCount += level.size();
+            // every node is checked for dirtiness
+            m_updateReport.nodesVisited(nodeCount, nodeCount);
+        }
 
+        const auto executeNode = [this](size_t nodeIdx) {
+            NodeUpdateResult& result = m_levelUpdateResults[nodeIdx];
             if (m_updateReportEnabled)
-                m_updateReport.nodeExecutionStarted(node);
-            if (m_statisticsEnabled)
-                m_statistics.nodeExecuted();
+            {
+                const auto executionStarted = std::chrono::steady_clock::now();
+                result.error = m_levelNodesToUpdate[nodeIdx]->update();
+                result.executionTime = std::chrono::duration_cast<UpdateReport::ReportTimeUnits>(std::chrono::steady_clock::now() - executionStarted);
+            }
+            else
+            {
+                result.error = m_levelNodesToUpdate[nodeIdx]->update();
+            }
+        };
+        const auto executeAnimationBatch = [this](size_t batchIdx) {
+            // animation nodes are split evenly between batches, keeping their order
+            const size_t firstNode = m_levelAnimationNodes.size() * batchIdx / m_levelAnimationBatchCount;
+            const size_t endNode = m_levelAnimationNodes.size() * (batchIdx + 1u) / m_levelAnimationBatchCount;
+            const auto executionStarted = std::chrono::steady_clock::now();
+
+            AnimationBatchEvaluator& evaluator = m_levelAnimationBatches[batchIdx];
+            evaluator.clear();
+            for (size_t i = firstNode; i < endNode; ++i)
+                m_levelAnimationNodes[i].second->gatherChannels(evaluator);
+            evaluator.evaluate();
+            for (size_t i = firstNode; i < endNode; ++i)
+                m_levelAnimationNodes[i].second->scatterChannels(evaluator);
 
-            const std::optional<LogicNodeRuntimeError> potentialError = node.update();
-            if (potentialError)
+            if (m_updateReportEnabled)
             {
-                m_errors.add(potentialError->message, m_apiObjects->getApiObject(node), EErrorType::RuntimeError);
-                return false;
+                // nodes of a batch are executed together, each is reported with equal share of the batch execution time
+                const auto executionTime = std::chrono::duration_cast<UpdateReport::ReportTimeUnits>(std::chrono::steady_clock::now() - executionStarted);
+                for (size_t i = firstNode; i < endNode; ++i)
+                    m_levelUpdateResults[m_levelAnimationNodes[i].first].executionTime = executionTime / static_cast<int64_t>(endNode - firstNode);
+            }
+        };
+        const ThreadPool::Task executeConcurrentTask = [this, &executeNode, &executeAnimationBatch](size_t taskIdx) {
+            if (taskIdx < m_levelConcurrentNodes.size())
+            {
+                executeNode(m_levelConcurrentNodes[taskIdx]);
+                return;
+            }
+            taskIdx -= m_levelConcurrentNodes.size();
+            if (taskIdx < m_levelLuaStateTasks.size())
+            {
+                for (const size_t nodeIdx : m_levelLuaStateNodes[m_levelLuaStateTasks[taskIdx]].second)
+                    executeNode(nodeIdx);
+                return;
+            }
+            executeAnimationBatch(taskIdx - m_levelLuaStateTasks.size());
+        };
+        const ThreadPool::CallerTask executeSerialNodes = [this, &executeNode]() {
+            for (const size_t nodeIdx : m_levelSerialNodes)
+                executeNode(nodeIdx);
+        };
+
+        for (const NodeVector& level : levels)
+        {
+            m_levelNodesToUpdate.clear();
+            m_levelConcurrentNodes.clear();
+            m_levelSerialNodes.clear();
+            m_levelLuaStateTasks.clear();
+            m_levelAnimationNodes.clear();
+            for (auto& luaStateNodes : m_levelLuaStateNodes)
+                luaStateNodes.second.clear();
+
+            // Nodes of a level don't depend on each other, i.e. their dirtiness is final at this point
+            for (LogicNodeImpl* node : level)
+            {
+                if (!node->isDirty())
+                {
+                    if (m_updateReportEnabled)
+                        m_updateReport.nodeSkippedExecution(*node);
+
+                    if (m_nodeDirtyMechanismEnabled)
+                        continue;
+                }
+
+                const size_t nodeIdx = m_levelNodesToUpdate.size();
+                m_levelNodesToUpdate.push_back(node);
+
+                if (!node->canUpdateConcurrently())
+                {
+                    m_levelSerialNodes.push_back(nodeIdx);
+                    continue;
+                }
+
+                if (auto* animationNode = node->asAnimationNode())
+                {
+                    m_levelAnimationNodes.emplace_back(nodeIdx, animationNode);
+                    continue;
+                }
+
+                const SolState* luaState = node->getUpdateLuaState();
+                if (luaState == nullptr)
+                {
+                    m_levelConcurrentNodes.push_back(nodeIdx);
+                    continue;
+                }
+
+                // there are only few Lua states, linear search is fine
+                auto luaStateIt = std::find_if(m_levelLuaStateNodes.begin(), m_levelLuaStateNodes.end(), [luaState](const auto& entry) { return entry.first == luaState; });
+                if (luaStateIt == m_levelLuaStateNodes.end())
+                    luaStateIt = m_levelLuaStateNodes.insert(luaStateIt, { luaState, {} });
+                if (luaStateIt->second.empty())
+                    m_levelLuaStateTasks.push_back(static_cast<size_t>(std::distance(m_levelLuaStateNodes.begin(), luaStateIt)));
+                luaStateIt->second.push_back(nodeIdx);
             }
+            m_levelUpdateResults.assign(m_levelNodesToUpdate.size(), NodeUpdateResult{});
 
-            Property* outputs = node.getOutputs();
-            if (outputs != nullptr)
+            // few animation nodes are not worth splitting, more batches than threads would only make batches smaller
+            m_levelAnimationBatchCount = std::min((m_levelAnimationNodes.size() + MinAnimationNodesPerBatch - 1u) / MinAnimationNodesPerBatch, m_updateThreadPool->getThreadCount());
+            if (m_levelAnimationBatches.size() < m_levelAnimationBatchCount)
+                m_levelAnimationBatches.resize(m_levelAnimationBatchCount);
+
+            // waking up the workers costs more than executing single task
+            const size_t concurrentTaskCount = m_levelConcurrentNodes.size() + m_levelLuaStateTasks.size() + m_levelAnimationBatchCount;
+            if (concurrentTaskCount > 1u)
             {
-                const size_t activatedLinks = activateLinksRecursive(*outputs->m_impl);
+                m_updateThreadPool->execute(concurrentTaskCount, executeConcurrentTask, executeSerialNodes);
+            }
+            else
+            {
+                executeSerialNodes();
+                for (size_t taskIdx = 0u; taskIdx < concurrentTaskCount; ++taskIdx)
+                    executeConcurrentTask(taskIdx);
+            }
 
-                if (m_statisticsEnabled || m_updateReportEnabled)
-                    m_updateReport.linksActivated(activatedLinks);
+            if (!finishLevelUpdate())
+                return false;
+        }
+
+        return true;
+    }
+
+    bool LogicEngineImpl::finishLevelUpdate()
+    {
+        // Same as what updateNodes does after executing a node. Done only after the whole level was executed and in rank order,
+        // this way links and dirtiness are handled exactly the same as when executing nodes one by one
+        for (size_t nodeIdx = 0u; nodeIdx < m_levelNodesToUpdate.size(); ++nodeIdx)
+        {
+            LogicNodeImpl& node = *m_levelNodesToUpdate[nodeIdx];
+            const NodeUpdateResult& result = m_levelUpdateResults[nodeIdx];
+
+            if (result.error)
+            {
+                m_errors.add(result.error->message, m_apiObjects->getApiObject(node), EErrorType::RuntimeError);
+                return false;
             }
 
             if (m_updateReportEnabled)
-                m_updateReport.nodeExecutionFinished();
+                m_updateReport.nodeExecuted(node, result.executionTime);
+            if (m_statisticsEnabled)
+                m_statistics.nodeExecuted();
+
+            const size_t activatedLinks = activateLinks(node);
+            if (m_statisticsEnabled || m_updateReportEnabled)
+                m_updateReport.linksActivated(activatedLinks);
 
             node.setDirty(false);
         }
@@ -538,15 +758,16 @@ namespace rlogic::internal
 
     bool LogicEngineImpl::loadFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification)
     {
-        std::optional<std::vector<char>> maybeBytesFromFile = FileUtils::LoadBinary(std::string(filename));
-        if (!maybeBytesFromFile)
+        // deserialize directly from the mapped file, the mapping is released when leaving this scope
+        const std::optional<MappedBinary> maybeMappedFile = FileUtils::MapBinary(std::string(filename));
+        if (!maybeMappedFile)
         {
             m_errors.add(fmt::format("Failed to load file '{}'", filename), nullptr, EErrorType::BinaryDataAccessError);
             return false;
         }
 
-        const size_t fileSize = (*maybeBytesFromFile).size();
-        return loadFromByteData((*maybeBytesFromFile).data(), fileSize, scene, enableMemoryVerification, fmt::format("file '{}' (size: {})", filename, fileSize));
+        const size_t fileSize = maybeMappedFile->size();
+        return loadFromByteData(maybeMappedFile->data(), fileSize, scene, enableMemoryVerification, fmt::format("file '{}' (size: {})", filename, fileSize));
     }
 
     bool LogicEngineImpl::loadFromFileDescriptor(int fd, size_t offset, size_t size, ramses::Scene* scene, bool enableMemoryVerification)
@@ -561,13 +782,13 @@ namespace rlogic::internal
             m_errors.add("Failed to load from file descriptor: size may not be 0", nullptr, EErrorType::BinaryDataAccessError);
             return false;
         }
-        std::optional<std::vector<char>> maybeBytesFromFile = FileUtils::LoadBinary(fd, offset, size);
-        if (!maybeBytesFromFile)
+        const std::optional<MappedBinary> maybeMappedFile = FileUtils::MapBinary(fd, offset, size);
+        if (!maybeMappedFile)
         {
             m_errors.add(fmt::format("Failed to load from file descriptor: fd: {} offset: {} size: {}", fd, offset, size), nullptr, EErrorType::BinaryDataAccessError);
             return false;
         }
-        return loadFromByteData((*maybeBytesFromFile).data(), size, scene, enableMemoryVerification, fmt::format("fd: {} (offset: {}, size: {})", fd, offset, size));
+        return loadFromByteData(maybeMappedFile->data(), size, scene, enableMemoryVerification, fmt::format("fd: {} (offset: {}, size: {})", fd, offset, size));
     }
 
     bool LogicEngineImpl::checkFileIdentifierBytes(const std::string& dataSourceDescription, const std::string& fileIdBytes)
@@ -701,13 +922,23 @@ namespace rlogic::internal
         if (scene != nullptr)
             ramsesResolver = std::make_unique<RamsesObjectResolver>(m_errors, *scene);
 
-        std::unique_ptr<ApiObjects> deserializedObjects = ApiObjects::Deserialize(*logicEngine->apiObjects(), ramsesResolver.get(), dataSourceDescription, m_errors, m_featureLevel);
+        std::unique_ptr<ThreadPool> loadThreadPool;
+        if (m_loadThreadCount > 1u)
+            loadThreadPool = std::make_unique<ThreadPool>(m_loadThreadCount);
+
+        std::unique_ptr<ApiObjects> deserializedObjects = ApiObjects::Deserialize(*logicEngine->apiObjects(), ramsesResolver.get(), dataSourceDescription, m_errors, m_featureLevel,
+            m_apiObjects->getLuaStateCount(), loadThreadPool.get(), &m_lastLoadTimings, m_lazyLuaScriptLoading);
 
         if (!deserializedObjects)
         {
             return false;
         }
 
+        LOG_INFO("Loaded logic engine content from '{}' using {} thread(s), time in microseconds: Lua modules {}, independent objects {}, Lua scripts {}, other objects {}, links {}",
+            dataSourceDescription, m_loadThreadCount,
+            m_lastLoadTimings.luaModules.count(), m_lastLoadTimings.independentObjects.count(), m_lastLoadTimings.luaScripts.count(),
+            m_lastLoadTimings.otherObjects.count(), m_lastLoadTimings.links.count());
+
         // No errors -> move data into member
         m_apiObjects = std::move(deserializedObjects);
 
@@ -716,14 +947,14 @@ namespace rlogic::internal
 
     bool LogicEngineImpl::GetFeatureLevelFromFile(std::string_view filename, EFeatureLevel& detectedFeatureLevel)
     {
-        std::optional<std::vector<char>> maybeBytesFromFile = FileUtils::LoadBinary(std::string(filename));
-        if (!maybeBytesFromFile)
+        const std::optional<MappedBinary> maybeMappedFile = FileUtils::MapBinary(std::string(filename));
+        if (!maybeMappedFile)
         {
             LOG_ERROR("Failed to load file '{}'", filename);
             return false;
         }
 
-        return GetFeatureLevelFromBuffer(filename, maybeBytesFromFile->data(), maybeBytesFromFile->size(), detectedFeatureLevel);
+        return GetFeatureLevelFromBuffer(filename, maybeMappedFile->data(), maybeMappedFile->size(), detectedFeatureLevel);
     }
 
     bool LogicEngineImpl::GetFeatureLevelFromBuffer(std::string_view logname, const void* buffer, size_t bufferSize, EFeatureLevel& detectedFeatureLevel)
@@ -755,6 +986,67 @@ namespace rlogic::internal
     }
 
     bool LogicEngineImpl::saveToFile(std::string_view filename, const SaveFileConfigImpl& config)
+    {
+        // builder allocates its buffer lazily, pre-sized buffer avoids repeated reallocations (and copies) of large files
+        flatbuffers::FlatBufferBuilder builder{ m_apiObjects->estimateTotalSerializedSize() };
+        if (!serializeForSaving(builder, config))
+        {
+            return false;
+        }
+
+        if (!FileUtils::SaveBinary(std::string(filename), builder.GetBufferPointer(), builder.GetSize()))
+        {
+            m_errors.add(fmt::format("Failed to save content to path '{}'!", filename), nullptr, EErrorType::BinaryDataAccessError);
+            return false;
+        }
+
+        LOG_INFO("Saved logic engine to file: '{}'.", filename);
+
+        return true;
+    }
+
+    bool LogicEngineImpl::saveToFileDescriptor(int fd, const SaveFileConfigImpl& config)
+    {
+        if (fd < 0)
+        {
+            m_errors.clear();
+            m_errors.add(fmt::format("Invalid file descriptor: {}", fd), nullptr, EErrorType::BinaryDataAccessError);
+            return false;
+        }
+
+        flatbuffers::FlatBufferBuilder builder{ m_apiObjects->estimateTotalSerializedSize() };
+        if (!serializeForSaving(builder, config))
+        {
+            return false;
+        }
+
+        if (!FileUtils::SaveBinary(fd, builder.GetBufferPointer(), builder.GetSize()))
+        {
+            m_errors.add(fmt::format("Failed to save content to file descriptor: {}", fd), nullptr, EErrorType::BinaryDataAccessError);
+            return false;
+        }
+
+        LOG_INFO("Saved logic engine to file descriptor: {}.", fd);
+
+        return true;
+    }
+
+    bool LogicEngineImpl::saveToBuffer(std::vector<char>& buffer, const SaveFileConfigImpl& config)
+    {
+        flatbuffers::FlatBufferBuilder builder{ m_apiObjects->estimateTotalSerializedSize() };
+        if (!serializeForSaving(builder, config))
+        {
+            return false;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) flatbuffers uses uint8_t, buffer uses char (same as loadFromBuffer)
+        const auto* data = reinterpret_cast<const char*>(builder.GetBufferPointer());
+        buffer.assign(data, data + builder.GetSize());
+
+        return true;
+    }
+
+    bool LogicEngineImpl::serializeForSaving(flatbuffers::FlatBufferBuilder& builder, const SaveFileConfigImpl& config)
     {
         m_errors.clear();
 
@@ -770,10 +1062,17 @@ namespace rlogic::internal
             return false;
         }
 
+        if (config.getDataArrayCompression() != EDataArrayCompression::None && m_featureLevel < EFeatureLevel_07)
+        {
+            m_errors.add(fmt::format("Can't save DataArrays compressed, feature level 07 or higher is required, feature level in this runtime set to 0{}.", m_featureLevel), nullptr, EErrorType::IllegalArgument);
+            return false;
+        }
+
         // Refuse save() if logic graph has loops
         if (!m_apiObjects->getLogicNodeDependencies().getTopologicallySortedNodes())
         {
             m_errors.add("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling saveToFile()!", nullptr, EErrorType::ContentStateError);
+            logLinkCycle();
             return false;
         }
 
@@ -805,7 +1104,6 @@ namespace rlogic::internal
             return false;
         }
 
-        flatbuffers::FlatBufferBuilder builder;
         ramses::RamsesVersion ramsesVersion = ramses::GetRamsesVersion();
 
         const auto ramsesVersionOffset = rlogic_serialization::CreateVersion(builder,
@@ -838,20 +1136,12 @@ namespace rlogic::internal
         const auto logicEngine = rlogic_serialization::CreateLogicEngine(builder,
             ramsesVersionOffset,
             ramsesLogicVersionOffset,
-            ApiObjects::Serialize(*m_apiObjects, builder, config.getLuaSavingMode()),
+            ApiObjects::Serialize(*m_apiObjects, builder, config.getLuaSavingMode(), config.getDataArrayCompression()),
             assetMetadataOffset,
             m_featureLevel);
 
         builder.Finish(logicEngine, getFileIdentifierMatchingFeatureLevel());
 
-        if (!FileUtils::SaveBinary(std::string(filename), builder.GetBufferPointer(), builder.GetSize()))
-        {
-            m_errors.add(fmt::format("Failed to save content to path '{}'!", filename), nullptr, EErrorType::BinaryDataAccessError);
-            return false;
-        }
-
-        LOG_INFO("Saved logic engine to file: '{}'.", filename);
-
         return true;
     }
 
@@ -894,6 +1184,80 @@ namespace rlogic::internal
         return *m_apiObjects;
     }
 
+    bool LogicEngineImpl::setUpdateThreadCount(size_t threadCount)
+    {
+        m_errors.clear();
+        if (threadCount == 0u)
+        {
+            m_errors.add("Failed to set update thread count: at least 1 thread is required.", nullptr, EErrorType::IllegalArgument);
+            return false;
+        }
+
+        if (threadCount == 1u)
+            m_updateThreadPool.reset();
+        else if (!m_updateThreadPool || m_updateThreadPool->getThreadCount() != threadCount)
+            m_updateThreadPool = std::make_unique<ThreadPool>(threadCount);
+
+        return true;
+    }
+
+    bool LogicEngineImpl::setLuaStateCount(size_t luaStateCount)
+    {
+        m_errors.clear();
+        return m_apiObjects->setLuaStateCount(luaStateCount, m_errors);
+    }
+
+    bool LogicEngineImpl::setLoadThreadCount(size_t threadCount)
+    {
+        m_errors.clear();
+        if (threadCount == 0u)
+        {
+            m_errors.add("Failed to set load thread count: at least 1 thread is required.", nullptr, EErrorType::IllegalArgument);
+            return false;
+        }
+
+        m_loadThreadCount = threadCount;
+        return true;
+    }
+
+    void LogicEngineImpl::enableLazyLuaScriptLoading(bool enable)
+    {
+        m_lazyLuaScriptLoading = enable;
+    }
+
+    bool LogicEngineImpl::prewarmLuaScripts(const std::vector<LuaScript*>& scripts)
+    {
+        m_errors.clear();
+
+        for (const LuaScript* script : scripts)
+        {
+            if (script == nullptr)
+            {
+                m_errors.add("Failed to prewarm Lua scripts: null script provided!", nullptr, EErrorType::IllegalArgument);
+                return false;
+            }
+
+            if (!m_apiObjects->contains(script))
+            {
+                m_errors.add(fmt::format("Failed to prewarm Lua scripts: can't find script '{}' in logic engine!", script->getName()), script, EErrorType::IllegalArgument);
+                return false;
+            }
+        }
+
+        for (LuaScript* script : scripts)
+        {
+            if (!script->m_script.instantiate(m_errors))
+                return false;
+        }
+
+        return true;
+    }
+
+    const DeserializationTimings& LogicEngineImpl::getLastLoadTimings() const
+    {
+        return m_lastLoadTimings;
+    }
+
     void LogicEngineImpl::disableTrackingDirtyNodes()
     {
         m_nodeDirtyMechanismEnabled = false;
@@ -13,12 +13,15 @@
 #include "ramses-logic/AnimationTypes.h"
 #include "ramses-logic/LogicEngineReport.h"
 #include "ramses-logic/DataTypes.h"
+#include "impl/LogicNodeImpl.h"
 #include "internals/ApiObjects.h"
 #include "internals/LogicNodeDependencies.h"
 #include "internals/ErrorReporting.h"
 #include "internals/ValidationResults.h"
 #include "internals/UpdateReport.h"
 #include "internals/LogicNodeUpdateStatistics.h"
+#include "internals/ThreadPool.h"
+#include "internals/AnimationBatchEvaluator.h"
 
 #include "ramses-framework-api/RamsesFrameworkTypes.h"
 
@@ -26,6 +29,8 @@
 #include <vector>
 #include <string>
 #include <string_view>
+#include <optional>
+#include <utility>
 
 namespace ramses
 {
@@ -75,6 +80,7 @@ namespace rlogic::internal
     class SaveFileConfigImpl;
     class LogicNodeImpl;
     class RamsesBindingImpl;
+    class AnimationNodeImpl;
     class ApiObjects;
 
     class LogicEngineImpl
@@ -116,8 +122,14 @@ namespace rlogic::internal
         AnchorPoint* createAnchorPoint(RamsesNodeBinding& nodeBinding, RamsesCameraBinding& cameraBinding, std::string_view name);
 
         bool destroy(LogicObject& object);
+        bool destroy(const std::vector<LogicObject*>& objects);
 
         bool update();
+        bool setUpdateThreadCount(size_t threadCount);
+        bool setLuaStateCount(size_t luaStateCount);
+        bool setLoadThreadCount(size_t threadCount);
+        void enableLazyLuaScriptLoading(bool enable);
+        bool prewarmLuaScripts(const std::vector<LuaScript*>& scripts);
 
         [[nodiscard]] const std::vector<ErrorData>& getErrors() const;
         const std::vector<WarningData>& validate() const;
@@ -126,6 +138,8 @@ namespace rlogic::internal
         bool loadFromFileDescriptor(int fd, size_t offset, size_t size, ramses::Scene* scene, bool enableMemoryVerification);
         bool loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification);
         bool saveToFile(std::string_view filename, const SaveFileConfigImpl& config);
+        bool saveToFileDescriptor(int fd, const SaveFileConfigImpl& config);
+        bool saveToBuffer(std::vector<char>& buffer, const SaveFileConfigImpl& config);
         [[nodiscard]] static bool GetFeatureLevelFromFile(std::string_view filename, EFeatureLevel& detectedFeatureLevel);
         [[nodiscard]] static bool GetFeatureLevelFromBuffer(std::string_view logname, const void* buffer, size_t bufferSize, EFeatureLevel& detectedFeatureLevel);
 
@@ -142,6 +156,9 @@ namespace rlogic::internal
         // for benchmarking purposes only
         void disableTrackingDirtyNodes();
 
+        // for benchmarking purposes only
+        [[nodiscard]] const DeserializationTimings& getLastLoadTimings() const;
+
         void enableUpdateReport(bool enable);
         [[nodiscard]] LogicEngineReport getLastUpdateReport() const;
 
@@ -154,18 +171,24 @@ namespace rlogic::internal
         [[nodiscard]] size_t getSerializedSize() const;
 
     private:
-        size_t activateLinksRecursive(PropertyImpl& output);
+        size_t activateLinks(LogicNodeImpl& node);
         void setNodeToBeAlwaysUpdatedDirty();
 
         static bool CheckRamsesVersionFromFile(const rlogic_serialization::Version& ramsesVersion);
 
         static void LogAssetMetadata(const rlogic_serialization::Metadata& assetMetadata);
 
-        [[nodiscard]] bool updateNodes(const NodeVector& nodes);
+        [[nodiscard]] bool updateNodes(const NodeVector& sortedNodes);
+        [[nodiscard]] bool updateNode(LogicNodeImpl& node);
+        [[nodiscard]] bool updateNodesParallel(const std::vector<NodeVector>& levels);
+        [[nodiscard]] bool finishLevelUpdate();
+        void logLinkCycle() const;
 
         [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription);
         [[nodiscard]] bool checkFileIdentifierBytes(const std::string& dataSourceDescription, const std::string& fileIdBytes);
         [[nodiscard]] const char* getFileIdentifierMatchingFeatureLevel() const;
+        // Checks whether content can be saved and serializes it into builder, which is then written by the save* methods
+        [[nodiscard]] bool serializeForSaving(flatbuffers::FlatBufferBuilder& builder, const SaveFileConfigImpl& config);
 
         std::unique_ptr<ApiObjects> m_apiObjects;
         ErrorReporting m_errors;
@@ -177,6 +200,31 @@ namespace rlogic::internal
         UpdateReport m_updateReport;
         LogicNodeUpdateStatistics m_statistics;
 
+        // Parallel update is used only if set up with more than 1 thread
+        std::unique_ptr<ThreadPool> m_updateThreadPool;
+        // Threads for loading are created only while loading
+        size_t m_loadThreadCount = 1u;
+        bool m_lazyLuaScriptLoading = false;
+        DeserializationTimings m_lastLoadTimings;
+        struct NodeUpdateResult
+        {
+            std::optional<LogicNodeRuntimeError> error;
+            UpdateReport::ReportTimeUnits executionTime{ 0 };
+        };
+        // Scratch data for updating single level in parallel update, kept as members to avoid reallocs every update
+        NodeVector m_levelNodesToUpdate;
+        std::vector<size_t> m_levelConcurrentNodes;
+        std::vector<size_t> m_levelSerialNodes;
+        // Concurrent nodes sharing a Lua state are executed one after another within single task
+        std::vector<std::pair<const SolState*, std::vector<size_t>>> m_levelLuaStateNodes;
+        std::vector<size_t> m_levelLuaStateTasks;
+        // Animation nodes are not executed one by one, their channels are interpolated in batches (one batch per task)
+        static constexpr size_t MinAnimationNodesPerBatch = 32u;
+        std::vector<std::pair<size_t, AnimationNodeImpl*>> m_levelAnimationNodes;
+        std::vector<AnimationBatchEvaluator> m_levelAnimationBatches;
+        size_t m_levelAnimationBatchCount = 0u;
+        std::vector<NodeUpdateResult> m_levelUpdateResults;
+
         EFeatureLevel m_featureLevel;
     };
 
@@ -50,4 +50,14 @@ namespace rlogic
         return m_impl->getTotalLinkActivations();
     }
 
+    size_t LogicEngineReport::getVisitedNodesCount() const
+    {
+        return m_impl->getVisitedNodesCount();
+    }
+
+    size_t LogicEngineReport::getTotalNodesCount() const
+    {
+        return m_impl->getTotalNodesCount();
+    }
+
 }
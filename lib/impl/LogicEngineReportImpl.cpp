@@ -17,6 +17,8 @@ namespace rlogic::internal
         : m_totalUpdateExecutionTime{ reportData.getSectionExecutionTime(UpdateReport::ETimingSection::TotalUpdate) }
         , m_topologySortExecutionTime{ reportData.getSectionExecutionTime(UpdateReport::ETimingSection::TopologySort) }
         , m_activatedLinks{ reportData.getLinkActivations() }
+        , m_visitedNodes{ reportData.getVisitedNodesCount() }
+        , m_totalNodes{ reportData.getTotalNodesCount() }
     {
         m_nodesExecuted.reserve(reportData.getNodesExecuted().size());
         for (const auto& n : reportData.getNodesExecuted())
@@ -52,4 +54,14 @@ namespace rlogic::internal
         return m_activatedLinks;
     }
 
+    size_t LogicEngineReportImpl::getVisitedNodesCount() const
+    {
+        return m_visitedNodes;
+    }
+
+    size_t LogicEngineReportImpl::getTotalNodesCount() const
+    {
+        return m_totalNodes;
+    }
+
 }
@@ -29,6 +29,8 @@ namespace rlogic::internal
         [[nodiscard]] std::chrono::microseconds getTopologySortExecutionTime() const;
         [[nodiscard]] std::chrono::microseconds getTotalUpdateExecutionTime() const;
         [[nodiscard]] size_t getTotalLinkActivations() const;
+        [[nodiscard]] size_t getVisitedNodesCount() const;
+        [[nodiscard]] size_t getTotalNodesCount() const;
 
     private:
         LogicNodesTimed m_nodesExecuted;
@@ -36,5 +38,7 @@ namespace rlogic::internal
         UpdateReport::ReportTimeUnits m_totalUpdateExecutionTime{ 0 };
         UpdateReport::ReportTimeUnits m_topologySortExecutionTime{ 0 };
         size_t m_activatedLinks = 0u;
+        size_t m_visitedNodes = 0u;
+        size_t m_totalNodes = 0u;
     };
 }
@@ -11,6 +11,8 @@
 #include "ramses-logic/Property.h"
 
 #include "impl/PropertyImpl.h"
+#include "internals/DirtyNodeQueue.h"
+#include "internals/TypeUtils.h"
 
 namespace rlogic::internal
 {
@@ -43,6 +45,8 @@ namespace rlogic::internal
 
     void LogicNodeImpl::setDirty(bool dirty)
     {
+        if (dirty && !m_dirty && m_dirtyNodeQueue != nullptr)
+            m_dirtyNodeQueue->push(*this);
         m_dirty = dirty;
     }
 
@@ -51,6 +55,78 @@ namespace rlogic::internal
         return m_dirty;
     }
 
+    bool LogicNodeImpl::canUpdateConcurrently() const
+    {
+        return false;
+    }
+
+    void LogicNodeImpl::setDirtyNodeQueue(DirtyNodeQueue* dirtyNodeQueue)
+    {
+        m_dirtyNodeQueue = dirtyNodeQueue;
+    }
+
+    const SolState* LogicNodeImpl::getUpdateLuaState() const
+    {
+        return nullptr;
+    }
+
+    AnimationNodeImpl* LogicNodeImpl::asAnimationNode()
+    {
+        return nullptr;
+    }
+
+    void LogicNodeImpl::setGraphIndex(size_t index)
+    {
+        m_graphIndex = index;
+    }
+
+    size_t LogicNodeImpl::getGraphIndex() const
+    {
+        return m_graphIndex;
+    }
+
+    const std::vector<LogicNodeImpl::OutgoingLink>& LogicNodeImpl::getOutgoingLinks()
+    {
+        if (m_outgoingLinksDirty)
+        {
+            m_outgoingLinks.clear();
+            const Property* outputs = getOutputs();
+            if (outputs != nullptr)
+            {
+                collectOutgoingLinks(*outputs->m_impl);
+            }
+            m_outgoingLinksDirty = false;
+        }
+
+        return m_outgoingLinks;
+    }
+
+    void LogicNodeImpl::setOutgoingLinksDirty()
+    {
+        m_outgoingLinksDirty = true;
+    }
+
+    void LogicNodeImpl::collectOutgoingLinks(const PropertyImpl& output)
+    {
+        const auto childCount = output.getChildCount();
+        for (size_t i = 0; i < childCount; ++i)
+        {
+            const PropertyImpl& child = *output.getChild(i)->m_impl;
+
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                collectOutgoingLinks(child);
+            }
+            else
+            {
+                for (const auto& outLink : child.getOutgoingLinks())
+                {
+                    m_outgoingLinks.push_back({ &child, outLink.property });
+                }
+            }
+        }
+    }
+
     void LogicNodeImpl::setRootProperties(std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput)
     {
         m_inputs = std::move(rootInput);
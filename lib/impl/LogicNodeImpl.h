@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include <limits>
 
 namespace rlogic
 {
@@ -23,6 +24,11 @@ namespace rlogic
 
 namespace rlogic::internal
 {
+    class SolState;
+    class DirtyNodeQueue;
+    class PropertyImpl;
+    class AnimationNodeImpl;
+
     struct LogicNodeRuntimeError { std::string message; };
 
     class LogicNodeImpl : public LogicObjectImpl
@@ -42,9 +48,34 @@ namespace rlogic::internal
 
         virtual void createRootProperties() = 0;
         virtual std::optional<LogicNodeRuntimeError> update() = 0;
+        // True if update() accesses only data owned by this node or its Lua state (no ramses objects), then it can be executed
+        // concurrently with update() of other nodes (see LogicEngineImpl::updateNodesParallel)
+        [[nodiscard]] virtual bool canUpdateConcurrently() const;
+        // Lua state used by update() or nullptr, nodes using the same Lua state are never updated concurrently
+        [[nodiscard]] virtual const SolState* getUpdateLuaState() const;
+        // Non-null if this node is an animation node, its channels are then interpolated in batches with other animation nodes
+        [[nodiscard]] virtual AnimationNodeImpl* asAnimationNode();
 
         void setDirty(bool dirty);
         [[nodiscard]] bool isDirty() const;
+        // Queue which gets notified whenever this node becomes dirty, set by LogicNodeDependencies while node is part of it
+        void setDirtyNodeQueue(DirtyNodeQueue* dirtyNodeQueue);
+
+        // Dense index of this node in the DirectedAcyclicGraph it was added to, used as key into the graph's node data
+        static constexpr size_t InvalidGraphIndex = std::numeric_limits<size_t>::max();
+        void setGraphIndex(size_t index);
+        [[nodiscard]] size_t getGraphIndex() const;
+
+        // Flat list of all links going out of primitive properties in this node's outputs, ordered as a depth-first traversal
+        // of the outputs would visit them. Used to activate links after update() without traversing the whole output tree.
+        // Rebuilt lazily on next query after any link of this node's outputs was added or removed (see setOutgoingLinksDirty)
+        struct OutgoingLink
+        {
+            const PropertyImpl* source = nullptr;
+            PropertyImpl* target = nullptr;
+        };
+        [[nodiscard]] const std::vector<OutgoingLink>& getOutgoingLinks();
+        void setOutgoingLinksDirty();
 
     protected:
         void setRootProperties(std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput);
@@ -54,5 +85,11 @@ namespace rlogic::internal
         std::unique_ptr<Property> m_outputs;
         // Dirty after creation (every node gets executed at least once after creation)
         bool                      m_dirty = true;
+        size_t                    m_graphIndex = InvalidGraphIndex;
+        DirtyNodeQueue*           m_dirtyNodeQueue = nullptr;
+        std::vector<OutgoingLink> m_outgoingLinks;
+        bool                      m_outgoingLinksDirty = false;
+
+        void collectOutgoingLinks(const PropertyImpl& output);
     };
 }
@@ -10,6 +10,7 @@
 #include "ramses-logic/LuaInterface.h"
 #include "impl/LoggerImpl.h"
 #include "internals/ErrorReporting.h"
+#include "internals/LogicObjectNameIndex.h"
 #include "flatbuffers/flatbuffers.h"
 #include "generated/LogicObjectGen.h"
 
@@ -30,6 +31,11 @@ namespace rlogic::internal
 
     bool LogicObjectImpl::setName(std::string_view name)
     {
+        if (m_nameIndex != nullptr)
+        {
+            assert(m_logicObject != nullptr);
+            m_nameIndex->rename(*m_logicObject, m_name, name);
+        }
         m_name = name;
         return true;
     }
@@ -118,4 +124,9 @@ namespace rlogic::internal
         assert(m_logicObject != nullptr);
         return *m_logicObject;
     }
+
+    void LogicObjectImpl::setNameIndex(LogicObjectNameIndex* nameIndex)
+    {
+        m_nameIndex = nameIndex;
+    }
 }
@@ -29,6 +29,7 @@ namespace rlogic
 namespace rlogic::internal
 {
     class ErrorReporting;
+    class LogicObjectNameIndex;
 
     class LogicObjectImpl
     {
@@ -50,6 +51,9 @@ namespace rlogic::internal
         [[nodiscard]] const LogicObject& getLogicObject() const;
         [[nodiscard]] LogicObject& getLogicObject();
 
+        // Index which is informed about name changes, set while the object is registered in it
+        void setNameIndex(LogicObjectNameIndex* nameIndex);
+
     protected:
         static flatbuffers::Offset<rlogic_serialization::LogicObject> Serialize(const LogicObjectImpl& object, flatbuffers::FlatBufferBuilder& builder);
         static bool Deserialize(const rlogic_serialization::LogicObject* object,
@@ -64,5 +68,6 @@ namespace rlogic::internal
         uint64_t    m_id;
         std::pair<uint64_t, uint64_t> m_userId{ 0u, 0u };
         LogicObject* m_logicObject = nullptr;
+        LogicObjectNameIndex* m_nameIndex = nullptr;
     };
 }
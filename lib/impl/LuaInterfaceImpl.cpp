@@ -25,10 +25,10 @@ namespace rlogic::internal
         const LuaInterfaceImpl& luaInterface,
         flatbuffers::FlatBufferBuilder& builder,
         SerializationMap& serializationMap,
-        EFeatureLevel /*featureLevel*/)
+        EFeatureLevel featureLevel)
     {
         const auto logicObject = LogicObjectImpl::Serialize(luaInterface, builder);
-        const auto propertyObject = PropertyImpl::Serialize(*luaInterface.getInputs()->m_impl, builder, serializationMap);
+        const auto propertyObject = PropertyImpl::Serialize(*luaInterface.getInputs()->m_impl, builder, serializationMap, featureLevel);
         auto intf = rlogic_serialization::CreateLuaInterface(builder, logicObject, propertyObject);
         builder.Finish(intf);
 
@@ -103,6 +103,12 @@ namespace rlogic::internal
         return std::nullopt;
     }
 
+    bool LuaInterfaceImpl::canUpdateConcurrently() const
+    {
+        // update is no-op, no Lua code is involved
+        return true;
+    }
+
     void LuaInterfaceImpl::createRootProperties()
     {
         // unlike other logic objects, lua interface properties created outside of it (from script or deserialized)
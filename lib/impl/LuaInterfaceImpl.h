@@ -62,6 +62,7 @@ namespace rlogic::internal
             DeserializationMap& deserializationMap);
 
         std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool canUpdateConcurrently() const override;
         void createRootProperties() final;
 
         [[nodiscard]] std::vector<const Property*> collectUnlinkedProperties() const;
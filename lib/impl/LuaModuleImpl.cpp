@@ -20,6 +20,7 @@
 #include "internals/EnvironmentProtection.h"
 #include "internals/PropertyTypeExtractor.h"
 #include <fmt/format.h>
+#include <algorithm>
 
 namespace rlogic::internal
 {
@@ -28,6 +29,7 @@ namespace rlogic::internal
         , m_sourceCode{ std::move(module.source.sourceCode) }
         , m_byteCode{ std::move(module.source.byteCode) }
         , m_module{ std::move(module.moduleTable) }
+        , m_solState{ module.source.solState }
         , m_dependencies{ std::move(module.source.userModules) }
         , m_stdModules{ std::move(module.source.stdModules) }
         , m_hasDebugLogFunctions{ module.source.hasDebugLogFunctions }
@@ -35,9 +37,41 @@ namespace rlogic::internal
         assert(m_module != sol::lua_nil);
     }
 
-    const sol::table& LuaModuleImpl::getModule() const
+    const sol::table& LuaModuleImpl::getModule(const SolState& solState) const
     {
-        return m_module;
+        if (&solState == &m_solState.get())
+            return m_module;
+
+        const auto it = std::find_if(m_instances.cbegin(), m_instances.cend(), [&solState](const auto& instance) { return instance.first == &solState; });
+        assert(it != m_instances.cend());
+        return it->second;
+    }
+
+    bool LuaModuleImpl::instantiate(SolState& solState, EFeatureLevel featureLevel, ErrorReporting& errorReporting)
+    {
+        if (&solState == &m_solState.get() ||
+            std::any_of(m_instances.cbegin(), m_instances.cend(), [&solState](const auto& instance) { return instance.first == &solState; }))
+        {
+            return true;
+        }
+
+        for (const auto& dependency : m_dependencies)
+        {
+            if (!dependency.second->m_impl.instantiate(solState, featureLevel, errorReporting))
+                return false;
+        }
+
+        // Modules created with feature level 01 have no byte code and have to be compiled again
+        auto compiledModule = LuaCompilationUtils::CompileModuleOrImportPrecompiled(
+            solState, m_dependencies, m_stdModules, m_sourceCode, getName(), errorReporting, m_byteCode, featureLevel, m_hasDebugLogFunctions);
+        if (!compiledModule)
+        {
+            errorReporting.add(fmt::format("Failed to load LuaModule '{}' into another Lua state!", getName()), nullptr, EErrorType::LuaSyntaxError);
+            return false;
+        }
+
+        m_instances.emplace_back(&solState, std::move(compiledModule->moduleTable));
+        return true;
     }
 
     flatbuffers::Offset<rlogic_serialization::LuaModule> LuaModuleImpl::Serialize(
@@ -190,6 +224,11 @@ namespace rlogic::internal
         return m_dependencies;
     }
 
+    size_t LuaModuleImpl::getCodeSize() const
+    {
+        return m_sourceCode.size() + m_byteCode.size();
+    }
+
     bool LuaModuleImpl::hasDebugLogFunctions() const
     {
         return m_hasDebugLogFunctions;
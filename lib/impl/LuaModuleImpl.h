@@ -14,6 +14,9 @@
 #include "ramses-logic/EFeatureLevel.h"
 #include "ramses-logic/ELuaSavingMode.h"
 #include <string>
+#include <vector>
+#include <utility>
+#include <functional>
 
 namespace rlogic_serialization
 {
@@ -43,9 +46,15 @@ namespace rlogic::internal
     public:
         LuaModuleImpl(LuaCompiledModule module, std::string_view name, uint64_t id);
 
-        [[nodiscard]] const sol::table& getModule() const;
+        // Returns the module table instantiated in given Lua state, see instantiate()
+        [[nodiscard]] const sol::table& getModule(const SolState& solState) const;
+        // Makes the module (and its dependencies) available in another Lua state than the one it was compiled in,
+        // the module is loaded from its byte code if available, otherwise compiled from source again
+        [[nodiscard]] bool instantiate(SolState& solState, EFeatureLevel featureLevel, ErrorReporting& errorReporting);
         [[nodiscard]] const ModuleMapping& getDependencies() const;
         [[nodiscard]] bool hasDebugLogFunctions() const;
+        // Size of source and byte code kept by the module (in bytes)
+        [[nodiscard]] size_t getCodeSize() const;
 
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::LuaModule> Serialize(
             const LuaModuleImpl& module,
@@ -64,6 +73,9 @@ namespace rlogic::internal
         std::string m_sourceCode;
         sol::bytecode m_byteCode;
         sol::table m_module;
+        std::reference_wrapper<SolState> m_solState;
+        // Module tables loaded into other Lua states than m_solState
+        std::vector<std::pair<const SolState*, sol::table>> m_instances;
         ModuleMapping m_dependencies;
         StandardModules m_stdModules;
         bool m_hasDebugLogFunctions;
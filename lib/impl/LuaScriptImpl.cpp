@@ -33,11 +33,33 @@ namespace rlogic::internal
         , m_wrappedRootInput(*compiledScript.rootInput->m_impl)
         , m_wrappedRootOutput(*compiledScript.rootOutput->m_impl)
         , m_runFunction(std::move(compiledScript.runFunction))
+        , m_solState(compiledScript.source.solState)
         , m_modules(std::move(compiledScript.source.userModules))
         , m_stdModules(std::move(compiledScript.source.stdModules))
         , m_hasDebugLogFunctions{ compiledScript.source.hasDebugLogFunctions }
     {
         setRootProperties(std::move(compiledScript.rootInput), std::move(compiledScript.rootOutput));
+
+        // resolve struct field names once here instead of on every property access in run()
+        const sol::state_view solState(m_runFunction.lua_state());
+        m_wrappedRootInput.internFieldNames(solState);
+        m_wrappedRootOutput.internFieldNames(solState);
+    }
+
+    LuaScriptImpl::LuaScriptImpl(LuaScriptDeserializedData data, SolState& solState, EFeatureLevel featureLevel)
+        : LogicNodeImpl(data.name, data.id)
+        , m_source(std::move(data.sourceCode))
+        , m_byteCode(std::move(data.byteCode))
+        , m_wrappedRootInput(*data.inputs->m_impl)
+        , m_wrappedRootOutput(*data.outputs->m_impl)
+        , m_solState(solState)
+        , m_modules(std::move(data.userModules))
+        , m_stdModules(std::move(data.stdModules))
+        , m_hasDebugLogFunctions{ false }
+        , m_pendingInstantiation{ featureLevel }
+    {
+        setRootProperties(std::move(data.inputs), std::move(data.outputs));
+        setUserId(data.userIdHigh, data.userIdLow);
     }
 
     void LuaScriptImpl::createRootProperties()
@@ -49,7 +71,8 @@ namespace rlogic::internal
         const LuaScriptImpl& luaScript,
         flatbuffers::FlatBufferBuilder& builder,
         SerializationMap& serializationMap,
-        ELuaSavingMode luaSavingMode)
+        ELuaSavingMode luaSavingMode,
+        EFeatureLevel featureLevel)
     {
         // serialization with debug logs is forbidden
         assert(!luaScript.hasDebugLogFunctions());
@@ -74,8 +97,8 @@ namespace rlogic::internal
         const auto fbLogicObject = LogicObjectImpl::Serialize(luaScript, builder);
         const auto fbModulesVec = builder.CreateVector(userModules);
         const auto fbStdModulesVec = builder.CreateVector(stdModules);
-        const auto fbInputPropertyObject = PropertyImpl::Serialize(*luaScript.getInputs()->m_impl, builder, serializationMap);
-        const auto fbOuputPropertyObject = PropertyImpl::Serialize(*luaScript.getOutputs()->m_impl, builder, serializationMap);
+        const auto fbInputPropertyObject = PropertyImpl::Serialize(*luaScript.getInputs()->m_impl, builder, serializationMap, featureLevel);
+        const auto fbOuputPropertyObject = PropertyImpl::Serialize(*luaScript.getOutputs()->m_impl, builder, serializationMap, featureLevel);
 
         const bool hasSourceCode = !luaScript.m_source.empty();
         const bool hasByteCode = !luaScript.m_byteCode.empty();
@@ -123,14 +146,23 @@ namespace rlogic::internal
         DeserializationMap& deserializationMap,
         EFeatureLevel featureLevel)
     {
-        std::string name;
-        uint64_t id = 0u;
-        uint64_t userIdHigh = 0u;
-        uint64_t userIdLow = 0u;
-        if (!LogicObjectImpl::Deserialize(luaScript.base(), name, id, userIdHigh, userIdLow, errorReporting))
+        std::optional<LuaScriptDeserializedData> data = DeserializeData(luaScript, errorReporting, deserializationMap);
+        if (!data)
+            return nullptr;
+
+        return Instantiate(solState, std::move(*data), errorReporting, featureLevel);
+    }
+
+    std::optional<LuaScriptDeserializedData> LuaScriptImpl::DeserializeData(
+        const rlogic_serialization::LuaScript& luaScript,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap)
+    {
+        LuaScriptDeserializedData data;
+        if (!LogicObjectImpl::Deserialize(luaScript.base(), data.name, data.id, data.userIdHigh, data.userIdLow, errorReporting))
         {
             errorReporting.add("Fatal error during loading of LuaScript from serialized data: missing name and/or ID!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return std::nullopt;
         }
 
         const bool hasSourceCode = (luaScript.luaSourceCode() != nullptr && luaScript.luaSourceCode()->size() > 0);
@@ -138,120 +170,173 @@ namespace rlogic::internal
         if (!hasSourceCode && !hasBytecode)
         {
             errorReporting.add("Fatal error during loading of LuaScript from serialized data: has neither Lua source code nor bytecode!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return std::nullopt;
         }
 
         if (!luaScript.rootInput())
         {
             errorReporting.add("Fatal error during loading of LuaScript from serialized data: missing root input!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return std::nullopt;
         }
 
         std::unique_ptr<PropertyImpl> rootInput = PropertyImpl::Deserialize(*luaScript.rootInput(), EPropertySemantics::ScriptInput, errorReporting, deserializationMap);
         if (!rootInput)
         {
-            return nullptr;
+            return std::nullopt;
         }
 
         if (!luaScript.rootOutput())
         {
             errorReporting.add("Fatal error during loading of LuaScript from serialized data: missing root output!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return std::nullopt;
         }
 
         std::unique_ptr<PropertyImpl> rootOutput = PropertyImpl::Deserialize(*luaScript.rootOutput(), EPropertySemantics::ScriptOutput, errorReporting, deserializationMap);
         if (!rootOutput)
         {
-            return nullptr;
+            return std::nullopt;
         }
 
         if (rootInput->getType() != EPropertyType::Struct)
         {
             errorReporting.add("Fatal error during loading of LuaScript from serialized data: root input has unexpected type!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return std::nullopt;
         }
 
         if (rootOutput->getType() != EPropertyType::Struct)
         {
             errorReporting.add("Fatal error during loading of LuaScript from serialized data: root output has unexpected type!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return std::nullopt;
         }
 
         if (!luaScript.userModules())
         {
             errorReporting.add("Fatal error during loading of LuaScript from serialized data: missing user module dependencies!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return std::nullopt;
         }
-        ModuleMapping userModules;
-        userModules.reserve(luaScript.userModules()->size());
+        data.userModules.reserve(luaScript.userModules()->size());
         for (const auto* module : *luaScript.userModules())
         {
             if (!module->name())
             {
-                errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' module data: missing name!", name), nullptr, EErrorType::BinaryVersionMismatch);
-                return nullptr;
+                errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' module data: missing name!", data.name), nullptr, EErrorType::BinaryVersionMismatch);
+                return std::nullopt;
             }
             const auto* moduleUsed = deserializationMap.resolveLogicObject<LuaModuleImpl>(module->moduleId());
             if (!moduleUsed)
             {
-                errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' module data: could not resolve dependent module with id={}!", name, module->moduleId()), nullptr, EErrorType::BinaryVersionMismatch);
-                return nullptr;
+                errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' module data: could not resolve dependent module with id={}!", data.name, module->moduleId()), nullptr, EErrorType::BinaryVersionMismatch);
+                return std::nullopt;
             }
 
-            userModules.emplace(module->name()->str(), moduleUsed->getLogicObject().as<LuaModule>());
+            data.userModules.emplace(module->name()->str(), moduleUsed->getLogicObject().as<LuaModule>());
         }
 
         if (!luaScript.standardModules())
         {
             errorReporting.add("Fatal error during loading of LuaScript from serialized data: missing standard module dependencies!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return std::nullopt;
         }
-        StandardModules stdModules;
-        stdModules.reserve(luaScript.standardModules()->size());
+        data.stdModules.reserve(luaScript.standardModules()->size());
         for (const uint8_t stdModule : *luaScript.standardModules())
-            stdModules.push_back(static_cast<EStandardModule>(stdModule));
+            data.stdModules.push_back(static_cast<EStandardModule>(stdModule));
 
-        auto inputs = std::make_unique<Property>(std::move(rootInput));
-        auto outputs = std::make_unique<Property>(std::move(rootOutput));
+        data.inputs = std::make_unique<Property>(std::move(rootInput));
+        data.outputs = std::make_unique<Property>(std::move(rootOutput));
 
-        std::string sourceCode = (hasSourceCode ? luaScript.luaSourceCode()->str() : "");
-        sol::bytecode byteCode;
+        if (hasSourceCode)
+            data.sourceCode = luaScript.luaSourceCode()->str();
         if (hasBytecode)
         {
-            byteCode.reserve(luaScript.luaByteCode()->size());
-            std::transform(luaScript.luaByteCode()->cbegin(), luaScript.luaByteCode()->cend(), std::back_inserter(byteCode), [](uint8_t b) { return std::byte(b); });
+            data.byteCode.reserve(luaScript.luaByteCode()->size());
+            std::transform(luaScript.luaByteCode()->cbegin(), luaScript.luaByteCode()->cend(), std::back_inserter(data.byteCode), [](uint8_t b) { return std::byte(b); });
         }
 
+        return data;
+    }
+
+    std::unique_ptr<LuaScriptImpl> LuaScriptImpl::Instantiate(
+        SolState& solState,
+        LuaScriptDeserializedData&& data,
+        ErrorReporting& errorReporting,
+        EFeatureLevel featureLevel)
+    {
         auto compiledScript = LuaCompilationUtils::CompileScriptOrImportPrecompiled(
             solState,
-            userModules,
-            stdModules,
-            std::move(sourceCode),
-            name,
+            data.userModules,
+            data.stdModules,
+            std::move(data.sourceCode),
+            data.name,
             errorReporting,
-            std::move(byteCode),
-            std::move(inputs),
-            std::move(outputs),
+            std::move(data.byteCode),
+            std::move(data.inputs),
+            std::move(data.outputs),
             featureLevel,
             false);
 
         if (!compiledScript)
         {
-            errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' from serialized data!", name), nullptr, EErrorType::BinaryVersionMismatch);
+            errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' from serialized data!", data.name), nullptr, EErrorType::BinaryVersionMismatch);
             return nullptr;
         }
 
         auto deserialized = std::make_unique<LuaScriptImpl>(
             std::move(*compiledScript),
-            name, id);
+            data.name, data.id);
 
-        deserialized->setUserId(userIdHigh, userIdLow);
+        deserialized->setUserId(data.userIdHigh, data.userIdLow);
 
         return deserialized;
     }
 
+    bool LuaScriptImpl::instantiate(ErrorReporting& errorReporting)
+    {
+        if (!m_pendingInstantiation)
+            return true;
+
+        // source and byte code are kept by the script for saving
+        auto compiledScript = LuaCompilationUtils::ImportPrecompiledScriptWithoutProperties(
+            m_solState,
+            m_modules,
+            m_stdModules,
+            m_source,
+            getName(),
+            errorReporting,
+            m_byteCode,
+            *m_pendingInstantiation);
+
+        if (!compiledScript)
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}' from serialized data!", getName()), &getLogicObject(), EErrorType::BinaryVersionMismatch);
+            return false;
+        }
+
+        m_runFunction = std::move(compiledScript->runFunction);
+        // byte code is created if there was none or it could not be loaded (feature level 02 and higher)
+        m_byteCode = std::move(compiledScript->source.byteCode);
+        m_pendingInstantiation.reset();
+
+        const sol::state_view solState(m_runFunction.lua_state());
+        m_wrappedRootInput.internFieldNames(solState);
+        m_wrappedRootOutput.internFieldNames(solState);
+
+        return true;
+    }
+
+    bool LuaScriptImpl::isInstantiated() const
+    {
+        return !m_pendingInstantiation;
+    }
+
     std::optional<LogicNodeRuntimeError> LuaScriptImpl::update()
     {
+        if (m_pendingInstantiation)
+        {
+            ErrorReporting errorReporting;
+            if (!instantiate(errorReporting))
+                return LogicNodeRuntimeError{ errorReporting.getErrors().front().message };
+        }
+
         sol::protected_function_result result = m_runFunction(std::ref(m_wrappedRootInput), std::ref(m_wrappedRootOutput));
 
         if (!result.valid())
@@ -263,11 +348,27 @@ namespace rlogic::internal
         return std::nullopt;
     }
 
+    bool LuaScriptImpl::canUpdateConcurrently() const
+    {
+        // the script environment only refers to own properties, Lua state is guarded by getUpdateLuaState
+        return true;
+    }
+
+    const SolState* LuaScriptImpl::getUpdateLuaState() const
+    {
+        return &m_solState.get();
+    }
+
     const ModuleMapping& LuaScriptImpl::getModules() const
     {
         return m_modules;
     }
 
+    size_t LuaScriptImpl::getCodeSize() const
+    {
+        return m_source.size() + m_byteCode.size();
+    }
+
     bool LuaScriptImpl::hasDebugLogFunctions() const
     {
         return m_hasDebugLogFunctions;
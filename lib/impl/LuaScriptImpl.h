@@ -21,6 +21,8 @@
 
 #include <memory>
 #include <functional>
+#include <optional>
+#include <string>
 #include <string_view>
 
 namespace flatbuffers
@@ -46,10 +48,29 @@ namespace rlogic::internal
     class SolState;
     class SerializationMap;
 
+    // Script data which can be deserialized without a Lua state, i.e. concurrently with other scripts,
+    // see LuaScriptImpl::DeserializeData and LuaScriptImpl::Instantiate
+    struct LuaScriptDeserializedData
+    {
+        std::string name;
+        uint64_t id = 0u;
+        uint64_t userIdHigh = 0u;
+        uint64_t userIdLow = 0u;
+        std::string sourceCode;
+        sol::bytecode byteCode;
+        ModuleMapping userModules;
+        StandardModules stdModules;
+        std::unique_ptr<Property> inputs;
+        std::unique_ptr<Property> outputs;
+    };
+
     class LuaScriptImpl : public LogicNodeImpl
     {
     public:
         explicit LuaScriptImpl(LuaCompiledScript compiledScript, std::string_view name, uint64_t id);
+        // Creates script with properties restored from data, the script is loaded into given Lua state only
+        // when it is executed for the first time or when instantiate() is called
+        LuaScriptImpl(LuaScriptDeserializedData data, SolState& solState, EFeatureLevel featureLevel);
         ~LuaScriptImpl() noexcept override = default;
         LuaScriptImpl(const LuaScriptImpl & other) = delete;
         LuaScriptImpl& operator=(const LuaScriptImpl & other) = delete;
@@ -58,7 +79,8 @@ namespace rlogic::internal
             const LuaScriptImpl& luaScript,
             flatbuffers::FlatBufferBuilder& builder,
             SerializationMap& serializationMap,
-            ELuaSavingMode luaSavingMode);
+            ELuaSavingMode luaSavingMode,
+            EFeatureLevel featureLevel);
 
         [[nodiscard]] static std::unique_ptr<LuaScriptImpl> Deserialize(
             SolState& solState,
@@ -67,10 +89,31 @@ namespace rlogic::internal
             DeserializationMap& deserializationMap,
             EFeatureLevel featureLevel);
 
+        // First part of Deserialize, only reads flatbuffers data and does not touch any Lua state
+        [[nodiscard]] static std::optional<LuaScriptDeserializedData> DeserializeData(
+            const rlogic_serialization::LuaScript& luaScript,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap);
+
+        // Second part of Deserialize, loads the script into given Lua state
+        [[nodiscard]] static std::unique_ptr<LuaScriptImpl> Instantiate(
+            SolState& solState,
+            LuaScriptDeserializedData&& data,
+            ErrorReporting& errorReporting,
+            EFeatureLevel featureLevel);
+
+        // Loads lazily created script into its Lua state, does nothing if the script is loaded already
+        [[nodiscard]] bool instantiate(ErrorReporting& errorReporting);
+        [[nodiscard]] bool isInstantiated() const;
+
         std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool canUpdateConcurrently() const override;
+        [[nodiscard]] const SolState* getUpdateLuaState() const override;
 
         [[nodiscard]] const ModuleMapping& getModules() const;
         [[nodiscard]] bool hasDebugLogFunctions() const;
+        // Size of source and byte code kept by the script (in bytes)
+        [[nodiscard]] size_t getCodeSize() const;
 
         void createRootProperties() final;
 
@@ -80,8 +123,11 @@ namespace rlogic::internal
         WrappedLuaProperty      m_wrappedRootInput;
         WrappedLuaProperty      m_wrappedRootOutput;
         sol::protected_function m_runFunction;
+        std::reference_wrapper<SolState> m_solState;
         ModuleMapping           m_modules;
         StandardModules         m_stdModules;
         bool m_hasDebugLogFunctions;
+        // Feature level of the data of a script which is not loaded into its Lua state yet
+        std::optional<EFeatureLevel> m_pendingInstantiation;
     };
 }
@@ -24,89 +24,233 @@
 
 namespace rlogic::internal
 {
+    static EPropertyType GetValueType(const PropertyValue& value)
+    {
+        return std::visit([](const auto& typedValue) { return PropertyTypeToEnum<std::decay_t<decltype(typedValue)>>::TYPE; }, value);
+    }
+
+    template <typename T>
+    bool PropertyImpl::assignValue(T value)
+    {
+        assert(PropertyTypeToEnum<T>::TYPE == m_layout->getType());
+        T& storedValue = m_valueArena->get<T>(m_valueIndex);
+        if (storedValue == value)
+        {
+            return false;
+        }
+
+        storedValue = std::move(value);
+        return true;
+    }
+
     PropertyImpl::PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics)
-        : m_typeData(std::move(type.typeData))
+        : PropertyImpl(std::make_shared<const PropertyTypeLayout>(type), semantics)
+    {
+    }
+
+    PropertyImpl::PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics, PropertyValue initialValue)
+        : PropertyImpl(std::move(type), semantics)
+    {
+        assert(TypeUtils::IsPrimitiveType(m_layout->getType()) && "Don't use this constructor with non-primitive types!");
+        std::visit([this](auto& value) { assignValue(std::move(value)); }, initialValue);
+    }
+
+    PropertyImpl::PropertyImpl(std::shared_ptr<const PropertyTypeLayout> layout, EPropertySemantics semantics)
+        : m_sharedLayout(std::move(layout))
+        , m_layout(m_sharedLayout.get())
+        , m_ownedValueArena(std::make_unique<PropertyValueArena>(*m_layout))
+        , m_valueArena(m_ownedValueArena.get())
         , m_semantics(semantics)
     {
-        if (TypeUtils::IsPrimitiveType(m_typeData.type))
+        createValueOrChildren();
+    }
+
+    PropertyImpl::PropertyImpl(const PropertyTypeLayout& layout, EPropertySemantics semantics, PropertyValueArena& valueArena)
+        : m_layout(&layout)
+        , m_valueArena(&valueArena)
+        , m_semantics(semantics)
+    {
+        createValueOrChildren();
+    }
+
+    void PropertyImpl::createValueOrChildren()
+    {
+        if (TypeUtils::IsPrimitiveType(m_layout->getType()))
+        {
+            // values in arena are zero-initialized, no need to set default value
+            m_valueIndex = m_valueArena->allocate(m_layout->getType());
+        }
+        else
+        {
+            m_children.reserve(m_layout->getChildren().size());
+            for (const auto& childLayout : m_layout->getChildren())
+            {
+                m_children.emplace_back(std::make_unique<Property>(std::unique_ptr<PropertyImpl>(new PropertyImpl(childLayout, m_semantics, *m_valueArena))));
+            }
+        }
+    }
+
+    std::optional<size_t> PropertyImpl::findChildIndex(std::string_view name) const
+    {
+        return m_layout->findChildIndex(name);
+    }
+
+    PropertyImpl::~PropertyImpl() noexcept
+    {
+        // TODO Violin/Vaclav discuss if we want to handle this here
+        if (m_incomingLink.property != nullptr)
+        {
+            resetIncomingLink();
+        }
+
+        for (auto outgoingLink : m_outgoingLinks)
+        {
+            assert(outgoingLink.property->m_incomingLink.property == this);
+            outgoingLink.property->m_incomingLink = { nullptr, false };
+        }
+    }
+
+    flatbuffers::Offset<rlogic_serialization::Property> PropertyImpl::Serialize(const PropertyImpl& prop, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap, EFeatureLevel featureLevel)
+    {
+        auto result = (featureLevel >= EFeatureLevel_06 ? SerializeColumnar(prop, builder, serializationMap) : SerializeRecursive(prop, builder, serializationMap));
+        builder.Finish(result);
+        return result;
+    }
+
+    template <typename ImplT>
+    void PropertyImpl::CollectTreeInPreOrder(ImplT& prop, std::vector<ImplT*>& tree)
+    {
+        tree.push_back(&prop);
+        for (const auto& child : prop.m_children)
         {
-            switch (m_typeData.type)
+            CollectTreeInPreOrder<ImplT>(*child->m_impl, tree);
+        }
+    }
+
+    // Empty columns are not stored at all
+    template <typename T>
+    static flatbuffers::Offset<flatbuffers::Vector<T>> CreateColumn(flatbuffers::FlatBufferBuilder& builder, const std::vector<T>& values)
+    {
+        return values.empty() ? flatbuffers::Offset<flatbuffers::Vector<T>>() : builder.CreateVector(values);
+    }
+
+    flatbuffers::Offset<rlogic_serialization::Property> PropertyImpl::SerializeColumnar(
+        const PropertyImpl& prop,
+        flatbuffers::FlatBufferBuilder& builder,
+        SerializationMap& serializationMap)
+    {
+        assert(prop.m_sharedLayout && "Only root properties can be serialized with columnar encoding");
+
+        std::vector<const PropertyImpl*> tree;
+        CollectTreeInPreOrder(prop, tree);
+
+        std::vector<float> floatValues;
+        std::vector<int32_t> int32Values;
+        std::vector<int64_t> int64Values;
+        std::vector<uint8_t> boolValues;
+        std::vector<flatbuffers::Offset<flatbuffers::String>> stringValues;
+        for (const PropertyImpl* node : tree)
+        {
+            switch (node->m_layout->getType())
             {
             case EPropertyType::Float:
-                m_value = PropertyEnumToType<EPropertyType::Float>::TYPE{ 0.0f };
+                floatValues.push_back(node->getValueAs<float>());
                 break;
             case EPropertyType::Vec2f:
-                m_value = PropertyEnumToType<EPropertyType::Vec2f>::TYPE{ 0.0f, 0.0f };
+                floatValues.insert(floatValues.end(), node->getValueAs<vec2f>().cbegin(), node->getValueAs<vec2f>().cend());
                 break;
             case EPropertyType::Vec3f:
-                m_value = PropertyEnumToType<EPropertyType::Vec3f>::TYPE{ 0.0f, 0.0f, 0.0f };
+                floatValues.insert(floatValues.end(), node->getValueAs<vec3f>().cbegin(), node->getValueAs<vec3f>().cend());
                 break;
             case EPropertyType::Vec4f:
-                m_value = PropertyEnumToType<EPropertyType::Vec4f>::TYPE{ 0.0f, 0.0f, 0.0f, 0.0f };
+                floatValues.insert(floatValues.end(), node->getValueAs<vec4f>().cbegin(), node->getValueAs<vec4f>().cend());
                 break;
             case EPropertyType::Int32:
-                m_value = PropertyEnumToType<EPropertyType::Int32>::TYPE{ 0 };
-                break;
-            case EPropertyType::Int64:
-                m_value = PropertyEnumToType<EPropertyType::Int64>::TYPE{ 0 };
+                int32Values.push_back(node->getValueAs<int32_t>());
                 break;
             case EPropertyType::Vec2i:
-                m_value = PropertyEnumToType<EPropertyType::Vec2i>::TYPE{ 0, 0 };
+                int32Values.insert(int32Values.end(), node->getValueAs<vec2i>().cbegin(), node->getValueAs<vec2i>().cend());
                 break;
             case EPropertyType::Vec3i:
-                m_value = PropertyEnumToType<EPropertyType::Vec3i>::TYPE{ 0, 0, 0 };
+                int32Values.insert(int32Values.end(), node->getValueAs<vec3i>().cbegin(), node->getValueAs<vec3i>().cend());
                 break;
             case EPropertyType::Vec4i:
-                m_value = PropertyEnumToType<EPropertyType::Vec4i>::TYPE{ 0, 0, 0, 0 };
+                int32Values.insert(int32Values.end(), node->getValueAs<vec4i>().cbegin(), node->getValueAs<vec4i>().cend());
                 break;
-            case EPropertyType::String:
-                m_value = PropertyEnumToType<EPropertyType::String>::TYPE{};
+            case EPropertyType::Int64:
+                int64Values.push_back(node->getValueAs<int64_t>());
                 break;
             case EPropertyType::Bool:
-                m_value = PropertyEnumToType<EPropertyType::Bool>::TYPE{ false };
+                boolValues.push_back(static_cast<uint8_t>(node->getValueAs<bool>()));
+                break;
+            case EPropertyType::String:
+                stringValues.push_back(builder.CreateString(node->getValueAs<std::string>()));
                 break;
-            case EPropertyType::Array:
             case EPropertyType::Struct:
-                assert(false);
+            case EPropertyType::Array:
                 break;
             }
         }
-        else
+
+        // Names and types are stored once for all trees of the same type, e.g. inputs of all node bindings
+        const PropertyTypeLayout& layout = *prop.m_layout;
+        flatbuffers::Offset<rlogic_serialization::PropertyTreeType> treeType = serializationMap.resolvePropertyTreeTypeOffsetIfFound(layout);
+        if (treeType.IsNull())
         {
-            for (const auto& childType : type.children)
+            std::vector<flatbuffers::Offset<flatbuffers::String>> names;
+            std::vector<uint8_t> types;
+            std::vector<uint32_t> childCounts;
+            names.reserve(tree.size());
+            types.reserve(tree.size());
+            for (const PropertyImpl* node : tree)
             {
-                m_children.emplace_back(std::make_unique<Property>(std::make_unique<PropertyImpl>(childType, semantics)));
+                // same names are used in many different types (e.g. struct fields), store every name only once
+                names.push_back(builder.CreateSharedString(node->m_layout->getName()));
+                types.push_back(static_cast<uint8_t>(ConvertEPropertyTypeToTreeNodeType(node->m_layout->getType())));
+                if (!TypeUtils::IsPrimitiveType(node->m_layout->getType()))
+                {
+                    childCounts.push_back(static_cast<uint32_t>(node->m_children.size()));
+                }
             }
+
+            const auto fbNames = builder.CreateVector(names);
+            const auto fbTypes = builder.CreateVector(types);
+            const auto fbChildCounts = CreateColumn(builder, childCounts);
+            treeType = rlogic_serialization::CreatePropertyTreeType(builder, fbNames, fbTypes, fbChildCounts);
+            serializationMap.storePropertyTreeTypeOffset(layout, treeType);
         }
-    }
 
-    PropertyImpl::PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics, PropertyValue initialValue)
-        : PropertyImpl(std::move(type), semantics)
-    {
-        assert(TypeUtils::IsPrimitiveType(m_typeData.type) && "Don't use this constructor with non-primitive types!");
-        m_value = std::move(initialValue);
-    }
+        const auto fbFloatValues = CreateColumn(builder, floatValues);
+        const auto fbInt32Values = CreateColumn(builder, int32Values);
+        const auto fbInt64Values = CreateColumn(builder, int64Values);
+        const auto fbBoolValues = CreateColumn(builder, boolValues);
+        const auto fbStringValues = CreateColumn(builder, stringValues);
 
-    PropertyImpl::~PropertyImpl() noexcept
-    {
-        // TODO Violin/Vaclav discuss if we want to handle this here
-        if (m_incomingLink.property != nullptr)
-        {
-            resetIncomingLink();
-        }
+        auto propertyFB = rlogic_serialization::CreateProperty(builder,
+            0,
+            rlogic_serialization::EPropertyRootType::Primitive,
+            0,
+            rlogic_serialization::PropertyValue::NONE,
+            0,
+            treeType,
+            fbFloatValues,
+            fbInt32Values,
+            fbInt64Values,
+            fbBoolValues,
+            fbStringValues
+        );
 
-        for (auto outgoingLink : m_outgoingLinks)
+        // All properties of the tree refer to the same flatbuffers object, links use their index to tell them apart
+        for (size_t i = 0u; i < tree.size(); ++i)
         {
-            assert(outgoingLink.property->m_incomingLink.property == this);
-            outgoingLink.property->m_incomingLink = { nullptr, false };
+            serializationMap.storePropertyOffset(*tree[i], propertyFB);
+            if (i != 0u)
+            {
+                serializationMap.storePropertyIndex(*tree[i], static_cast<uint32_t>(i));
+            }
         }
-    }
 
-    flatbuffers::Offset<rlogic_serialization::Property> PropertyImpl::Serialize(const PropertyImpl& prop, flatbuffers::FlatBufferBuilder& builder, SerializationMap& serializationMap)
-    {
-        auto result = SerializeRecursive(prop, builder, serializationMap);
-        builder.Finish(result);
-        return result;
+        return propertyFB;
     }
 
     flatbuffers::Offset<rlogic_serialization::Property> PropertyImpl::SerializeRecursive(
@@ -121,12 +265,12 @@ namespace rlogic::internal
             return SerializeRecursive(*child->m_impl, builder, serializationMap);
             });
 
-        // Assume primitive property, override only for structs/arrays based on m_typeData.type
+        // Assume primitive property, override only for structs/arrays based on the type of the property
         rlogic_serialization::EPropertyRootType propertyRootType = rlogic_serialization::EPropertyRootType::Primitive;
         rlogic_serialization::PropertyValue valueType = rlogic_serialization::PropertyValue::NONE;
         flatbuffers::Offset<void> valueOffset;
 
-        switch (prop.m_typeData.type)
+        switch (prop.m_layout->getType())
         {
         case EPropertyType::Bool:
         {
@@ -218,7 +362,7 @@ namespace rlogic::internal
             break;
         }
 
-        const auto fbName = builder.CreateString(prop.m_typeData.name);
+        const auto fbName = builder.CreateString(prop.m_layout->getName());
         const auto fbChildrenVec = builder.CreateVector(child_vector);
 
         auto propertyFB = rlogic_serialization::CreateProperty(builder,
@@ -239,12 +383,275 @@ namespace rlogic::internal
         EPropertySemantics semantics,
         ErrorReporting& errorReporting,
         DeserializationMap& deserializationMap)
+    {
+        if (prop.treeType())
+        {
+            if (deserializationMap.getFeatureLevel() < EFeatureLevel_06)
+            {
+                errorReporting.add("Fatal error during loading of Property from serialized data: tree type info is not supported by feature level of data!", nullptr, EErrorType::BinaryVersionMismatch);
+                return nullptr;
+            }
+            return DeserializeColumnar(prop, semantics, errorReporting, deserializationMap);
+        }
+
+        // Type of the whole hierarchy is loaded first, so that all values of the property tree can be allocated in one arena
+        // and property trees of the same type share their layout
+        std::optional<HierarchicalTypeData> type = DeserializeTypeRecursive(prop, errorReporting);
+        if (!type)
+        {
+            return nullptr;
+        }
+
+        std::unique_ptr<PropertyImpl> impl(new PropertyImpl(deserializationMap.getPropertyTypeLayout(*type), semantics));
+        if (!DeserializeValuesRecursive(prop, *impl, errorReporting, deserializationMap))
+        {
+            return nullptr;
+        }
+
+        return impl;
+    }
+
+    // Reads values of a tree stored with columnar encoding in pre-order, missing column is same as empty column
+    template <typename T>
+    class ColumnReader
+    {
+    public:
+        explicit ColumnReader(const flatbuffers::Vector<T>* column)
+            : m_column(column)
+            , m_size(column ? column->size() : 0u)
+        {
+        }
+
+        // Reads as many values as ValueT has components, fails if column has less values left
+        template <typename ValueT>
+        [[nodiscard]] std::optional<ValueT> read()
+        {
+            if constexpr (std::is_same_v<ValueT, std::string>)
+            {
+                if (m_cursor == m_size)
+                {
+                    return std::nullopt;
+                }
+                return m_column->Get(m_cursor++)->str();
+            }
+            else if constexpr (std::is_arithmetic_v<ValueT>)
+            {
+                if (m_cursor == m_size)
+                {
+                    return std::nullopt;
+                }
+                return static_cast<ValueT>(m_column->Get(m_cursor++));
+            }
+            else
+            {
+                ValueT value{};
+                if (m_size - m_cursor < value.size())
+                {
+                    return std::nullopt;
+                }
+                for (auto& component : value)
+                {
+                    component = m_column->Get(m_cursor++);
+                }
+                return value;
+            }
+        }
+
+        [[nodiscard]] bool isAtEnd() const
+        {
+            return m_cursor == m_size;
+        }
+
+    private:
+        const flatbuffers::Vector<T>* m_column;
+        flatbuffers::uoffset_t m_size;
+        flatbuffers::uoffset_t m_cursor = 0u;
+    };
+
+    std::unique_ptr<PropertyImpl> PropertyImpl::DeserializeColumnar(
+        const rlogic_serialization::Property& prop,
+        EPropertySemantics semantics,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap)
+    {
+        // Fast path for trees sharing their type with already loaded trees, no need to decode and compare types again
+        std::shared_ptr<const PropertyTypeLayout> layout = deserializationMap.findPropertyTreeTypeLayout(*prop.treeType());
+        if (!layout)
+        {
+            std::optional<HierarchicalTypeData> type = DeserializeTreeType(*prop.treeType(), errorReporting);
+            if (!type)
+            {
+                return nullptr;
+            }
+
+            layout = deserializationMap.getPropertyTypeLayout(*type);
+            deserializationMap.storePropertyTreeTypeLayout(*prop.treeType(), layout);
+        }
+
+        std::unique_ptr<PropertyImpl> impl(new PropertyImpl(std::move(layout), semantics));
+        std::vector<PropertyImpl*> tree;
+        CollectTreeInPreOrder(*impl, tree);
+
+        ColumnReader<float> floatValues(prop.floatValues());
+        ColumnReader<int32_t> int32Values(prop.int32Values());
+        ColumnReader<int64_t> int64Values(prop.int64Values());
+        ColumnReader<uint8_t> boolValues(prop.boolValues());
+        ColumnReader<flatbuffers::Offset<flatbuffers::String>> stringValues(prop.stringValues());
+
+        const auto assignNextValue = [](PropertyImpl& node, auto value) {
+            if (!value)
+            {
+                return false;
+            }
+            node.assignValue(std::move(*value));
+            return true;
+        };
+
+        bool valuesFound = true;
+        for (PropertyImpl* node : tree)
+        {
+            switch (node->m_layout->getType())
+            {
+            case EPropertyType::Float:
+                valuesFound = assignNextValue(*node, floatValues.read<float>());
+                break;
+            case EPropertyType::Vec2f:
+                valuesFound = assignNextValue(*node, floatValues.read<vec2f>());
+                break;
+            case EPropertyType::Vec3f:
+                valuesFound = assignNextValue(*node, floatValues.read<vec3f>());
+                break;
+            case EPropertyType::Vec4f:
+                valuesFound = assignNextValue(*node, floatValues.read<vec4f>());
+                break;
+            case EPropertyType::Int32:
+                valuesFound = assignNextValue(*node, int32Values.read<int32_t>());
+                break;
+            case EPropertyType::Vec2i:
+                valuesFound = assignNextValue(*node, int32Values.read<vec2i>());
+                break;
+            case EPropertyType::Vec3i:
+                valuesFound = assignNextValue(*node, int32Values.read<vec3i>());
+                break;
+            case EPropertyType::Vec4i:
+                valuesFound = assignNextValue(*node, int32Values.read<vec4i>());
+                break;
+            case EPropertyType::Int64:
+                valuesFound = assignNextValue(*node, int64Values.read<int64_t>());
+                break;
+            case EPropertyType::Bool:
+                valuesFound = assignNextValue(*node, boolValues.read<bool>());
+                break;
+            case EPropertyType::String:
+                valuesFound = assignNextValue(*node, stringValues.read<std::string>());
+                break;
+            case EPropertyType::Struct:
+            case EPropertyType::Array:
+                break;
+            }
+
+            if (!valuesFound)
+            {
+                break;
+            }
+        }
+
+        if (!valuesFound || !floatValues.isAtEnd() || !int32Values.isAtEnd() || !int64Values.isAtEnd() || !boolValues.isAtEnd() || !stringValues.isAtEnd())
+        {
+            errorReporting.add("Fatal error during loading of Property from serialized data: number of values does not match property types!", nullptr, EErrorType::BinaryVersionMismatch);
+            return nullptr;
+        }
+
+        deserializationMap.storePropertyImpl(prop, *impl);
+        deserializationMap.storePropertyTree(prop, std::move(tree));
+
+        return impl;
+    }
+
+    // Nesting of a tree type is not limited by the flatbuffers verifier (unlike recursively encoded properties of feature levels
+    // below 06, which can't be nested deeper than the 64 tables accepted by the verifier), corrupt data could overflow the stack
+    constexpr size_t MaxTreeTypeDepth = 64u;
+
+    // Decodes node at nodeIndex including all its children (which follow it in pre-order), fails if tree type is inconsistent
+    static std::optional<HierarchicalTypeData> DeserializeTreeTypeNode(
+        const rlogic_serialization::PropertyTreeType& treeType,
+        flatbuffers::uoffset_t& nodeIndex,
+        flatbuffers::uoffset_t& childCountIndex,
+        size_t depth)
+    {
+        const auto& types = *treeType.types();
+        if (nodeIndex >= types.size() || depth >= MaxTreeTypeDepth)
+        {
+            return std::nullopt;
+        }
+
+        const std::optional<EPropertyType> type = ConvertTreeNodeTypeToEPropertyType(static_cast<rlogic_serialization::EPropertyTreeNodeType>(types.Get(nodeIndex)));
+        if (!type)
+        {
+            return std::nullopt;
+        }
+
+        HierarchicalTypeData typeData = MakeType(treeType.names()->Get(nodeIndex)->str(), *type);
+        ++nodeIndex;
+
+        if (!TypeUtils::IsPrimitiveType(*type))
+        {
+            if (!treeType.childCounts() || childCountIndex >= treeType.childCounts()->size())
+            {
+                return std::nullopt;
+            }
+
+            const uint32_t childCount = treeType.childCounts()->Get(childCountIndex++);
+            // every child needs a node of its own, don't trust corrupted counts when reserving memory
+            if (childCount > types.size() - nodeIndex)
+            {
+                return std::nullopt;
+            }
+
+            typeData.children.reserve(childCount);
+            for (uint32_t i = 0u; i < childCount; ++i)
+            {
+                std::optional<HierarchicalTypeData> childType = DeserializeTreeTypeNode(treeType, nodeIndex, childCountIndex, depth + 1u);
+                if (!childType)
+                {
+                    return std::nullopt;
+                }
+                typeData.children.emplace_back(std::move(*childType));
+            }
+        }
+
+        return typeData;
+    }
+
+    std::optional<HierarchicalTypeData> PropertyImpl::DeserializeTreeType(const rlogic_serialization::PropertyTreeType& treeType, ErrorReporting& errorReporting)
+    {
+        if (!treeType.names() || !treeType.types() || treeType.names()->size() != treeType.types()->size())
+        {
+            errorReporting.add("Fatal error during loading of Property from serialized data: missing tree type info!", nullptr, EErrorType::BinaryVersionMismatch);
+            return std::nullopt;
+        }
+
+        flatbuffers::uoffset_t nodeIndex = 0u;
+        flatbuffers::uoffset_t childCountIndex = 0u;
+        std::optional<HierarchicalTypeData> type = DeserializeTreeTypeNode(treeType, nodeIndex, childCountIndex, 0u);
+
+        const flatbuffers::uoffset_t childCountsSize = (treeType.childCounts() ? treeType.childCounts()->size() : 0u);
+        if (!type || nodeIndex != treeType.types()->size() || childCountIndex != childCountsSize)
+        {
+            errorReporting.add("Fatal error during loading of Property from serialized data: corrupt tree type info!", nullptr, EErrorType::BinaryVersionMismatch);
+            return std::nullopt;
+        }
+
+        return type;
+    }
+
+    std::optional<HierarchicalTypeData> PropertyImpl::DeserializeTypeRecursive(const rlogic_serialization::Property& prop, ErrorReporting& errorReporting)
     {
         // TODO Violin we can make name optional - e.g. array fields don't need a name, no need to serialize empty strings
         if (!prop.name())
         {
             errorReporting.add("Fatal error during loading of Property from serialized data: missing name!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return std::nullopt;
         }
 
         const std::optional convertedType = ConvertSerializationTypeToEPropertyType(prop.rootType(), prop.value_type());
@@ -252,12 +659,53 @@ namespace rlogic::internal
         if (!convertedType)
         {
             errorReporting.add("Fatal error during loading of Property from serialized data: invalid type!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return std::nullopt;
         }
 
-        std::unique_ptr<PropertyImpl> impl(new PropertyImpl(MakeType(std::string(prop.name()->string_view()), *convertedType), semantics));
+        HierarchicalTypeData type = MakeType(std::string(prop.name()->string_view()), *convertedType);
+
+        if (prop.rootType() != rlogic_serialization::EPropertyRootType::Primitive)
+        {
+            // Invalid types are handled above
+            assert (prop.rootType() == rlogic_serialization::EPropertyRootType::Struct || prop.rootType() == rlogic_serialization::EPropertyRootType::Array);
 
-        // If primitive: set value; otherwise load children
+            if (!prop.children())
+            {
+                errorReporting.add("Fatal error during loading of Property from serialized data: complex type has no child type info!", nullptr, EErrorType::BinaryVersionMismatch);
+                return std::nullopt;
+            }
+
+            type.children.reserve(prop.children()->size());
+            for (const auto* child : *prop.children())
+            {
+                if (!child)
+                {
+                    // TODO Violin find ways to unit-test this case
+                    errorReporting.add("Fatal error during loading of Property from serialized data: corrupt child data!", nullptr, EErrorType::BinaryVersionMismatch);
+                    return std::nullopt;
+                }
+
+                std::optional<HierarchicalTypeData> childType = DeserializeTypeRecursive(*child, errorReporting);
+
+                if (!childType)
+                {
+                    return std::nullopt;
+                }
+
+                type.children.emplace_back(std::move(*childType));
+            }
+        }
+
+        return type;
+    }
+
+    bool PropertyImpl::DeserializeValuesRecursive(
+        const rlogic_serialization::Property& prop,
+        PropertyImpl& impl,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap)
+    {
+        // If primitive: set value; otherwise load values of children (structure was validated in DeserializeTypeRecursive)
         if (prop.rootType() == rlogic_serialization::EPropertyRootType::Primitive)
         {
             // TODO Violin investigate possibilities to unit-test enum mismatches (and perhaps collapse
@@ -268,9 +716,9 @@ namespace rlogic::internal
                 if (!prop.value_as_float_s())
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value = prop.value_as_float_s()->v();
+                impl.assignValue(prop.value_as_float_s()->v());
                 break;
             case rlogic_serialization::PropertyValue::vec2f_s:
             {
@@ -278,9 +726,9 @@ namespace rlogic::internal
                 if (!vec2fValue)
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value         = vec2f{vec2fValue->x(), vec2fValue->y()};
+                impl.assignValue(vec2f{vec2fValue->x(), vec2fValue->y()});
                 break;
             }
             case rlogic_serialization::PropertyValue::vec3f_s:
@@ -289,9 +737,9 @@ namespace rlogic::internal
                 if (!vec3fValue)
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value         = vec3f{vec3fValue->x(), vec3fValue->y(), vec3fValue->z()};
+                impl.assignValue(vec3f{vec3fValue->x(), vec3fValue->y(), vec3fValue->z()});
                 break;
             }
             case rlogic_serialization::PropertyValue::vec4f_s:
@@ -300,26 +748,26 @@ namespace rlogic::internal
                 if (!vec4fValue)
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value         = vec4f{vec4fValue->x(), vec4fValue->y(), vec4fValue->z(), vec4fValue->w()};
+                impl.assignValue(vec4f{vec4fValue->x(), vec4fValue->y(), vec4fValue->z(), vec4fValue->w()});
                 break;
             }
             case rlogic_serialization::PropertyValue::int32_s:
                 if (!prop.value_as_int32_s())
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value = prop.value_as_int32_s()->v();
+                impl.assignValue(prop.value_as_int32_s()->v());
                 break;
             case rlogic_serialization::PropertyValue::int64_s:
                 if (!prop.value_as_int64_s())
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value = prop.value_as_int64_s()->v();
+                impl.assignValue(prop.value_as_int64_s()->v());
                 break;
             case rlogic_serialization::PropertyValue::vec2i_s:
             {
@@ -327,9 +775,9 @@ namespace rlogic::internal
                 if (!vec2iValue)
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value         = vec2i{vec2iValue->x(), vec2iValue->y()};
+                impl.assignValue(vec2i{vec2iValue->x(), vec2iValue->y()});
                 break;
             }
             case rlogic_serialization::PropertyValue::vec3i_s:
@@ -338,9 +786,9 @@ namespace rlogic::internal
                 if (!vec3iValue)
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value         = vec3i{vec3iValue->x(), vec3iValue->y(), vec3iValue->z()};
+                impl.assignValue(vec3i{vec3iValue->x(), vec3iValue->y(), vec3iValue->z()});
                 break;
             }
             case rlogic_serialization::PropertyValue::vec4i_s:
@@ -349,67 +797,48 @@ namespace rlogic::internal
                 if (!vec4iValue)
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value         = vec4i{vec4iValue->x(), vec4iValue->y(), vec4iValue->z(), vec4iValue->w()};
+                impl.assignValue(vec4i{vec4iValue->x(), vec4iValue->y(), vec4iValue->z(), vec4iValue->w()});
                 break;
             }
             case rlogic_serialization::PropertyValue::string_s:
                 if (!prop.value_as_string_s())
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value = prop.value_as_string_s()->v()->str();
+                impl.assignValue(prop.value_as_string_s()->v()->str());
                 break;
             case rlogic_serialization::PropertyValue::bool_s:
                 if (!prop.value_as_bool_s())
                 {
                     errorReporting.add("Fatal error during loading of Property from serialized data: invalid union!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
+                    return false;
                 }
-                impl->m_value = prop.value_as_bool_s()->v();
+                impl.assignValue(prop.value_as_bool_s()->v());
                 break;
             case rlogic_serialization::PropertyValue::NONE:
             default:
                 assert(false && "Should never reach this line - invalid types should be handled in ConvertSerializationTypeToEPropertyType above");
-                return nullptr;
+                return false;
             }
         }
         else
         {
-            // Invalid types are handled above
-            assert (prop.rootType() == rlogic_serialization::EPropertyRootType::Struct || prop.rootType() == rlogic_serialization::EPropertyRootType::Array);
-
-            if (!prop.children())
+            assert(prop.children() && prop.children()->size() == impl.m_children.size());
+            for (size_t i = 0; i < impl.m_children.size(); ++i)
             {
-                errorReporting.add("Fatal error during loading of Property from serialized data: complex type has no child type info!", nullptr, EErrorType::BinaryVersionMismatch);
-                return nullptr;
-            }
-
-            for (const auto* child : *prop.children())
-            {
-                if (!child)
-                {
-                    // TODO Violin find ways to unit-test this case
-                    errorReporting.add("Fatal error during loading of Property from serialized data: corrupt child data!", nullptr, EErrorType::BinaryVersionMismatch);
-                    return nullptr;
-                }
-
-                std::unique_ptr<PropertyImpl> deserializedChild = PropertyImpl::Deserialize(*child, semantics, errorReporting, deserializationMap);
-
-                if (!deserializedChild)
+                if (!DeserializeValuesRecursive(*prop.children()->Get(static_cast<flatbuffers::uoffset_t>(i)), *impl.m_children[i]->m_impl, errorReporting, deserializationMap))
                 {
-                    return nullptr;
+                    return false;
                 }
-
-                impl->m_children.emplace_back(std::make_unique<Property>(std::move(deserializedChild)));
             }
         }
 
-        deserializationMap.storePropertyImpl(prop, *impl);
+        deserializationMap.storePropertyImpl(prop, impl);
 
-        return impl;
+        return true;
     }
 
     size_t PropertyImpl::getChildCount() const
@@ -419,12 +848,17 @@ namespace rlogic::internal
 
     EPropertyType PropertyImpl::getType() const
     {
-        return m_typeData.type;
+        return m_layout->getType();
     }
 
     std::string_view PropertyImpl::getName() const
     {
-        return m_typeData.name;
+        return m_layout->getName();
+    }
+
+    const PropertyTypeLayout& PropertyImpl::getLayout() const
+    {
+        return *m_layout;
     }
 
     Property* PropertyImpl::getChild(size_t index)
@@ -434,7 +868,7 @@ namespace rlogic::internal
             return m_children[index].get();
         }
 
-        LOG_ERROR("No child property with index '{}' found in '{}'", index, m_typeData.name);
+        LOG_ERROR("No child property with index '{}' found in '{}'", index, m_layout->getName());
         return nullptr;
     }
 
@@ -445,7 +879,7 @@ namespace rlogic::internal
             return m_children[index].get();
         }
 
-        LOG_ERROR("No child property with index '{}' found in '{}'", index, m_typeData.name);
+        LOG_ERROR("No child property with index '{}' found in '{}'", index, m_layout->getName());
         return nullptr;
     }
 
@@ -457,22 +891,18 @@ namespace rlogic::internal
 
     const Property* PropertyImpl::getChild(std::string_view name) const
     {
-        auto it = std::find_if(m_children.begin(), m_children.end(), [&name](const std::vector<std::unique_ptr<Property>>::value_type& property) {
-            return property->getName() == name;
-        });
-        if (it != m_children.end())
+        const std::optional<size_t> childIndex = findChildIndex(name);
+        if (childIndex)
         {
-            return it->get();
+            return m_children[*childIndex].get();
         }
-        LOG_ERROR("No child property with name '{}' found in '{}'", name, m_typeData.name);
+        LOG_ERROR("No child property with name '{}' found in '{}'", name, m_layout->getName());
         return nullptr;
     }
 
     bool PropertyImpl::hasChild(std::string_view name) const
     {
-        return m_children.end() != std::find_if(m_children.begin(), m_children.end(), [&name](const std::vector<std::unique_ptr<Property>>::value_type& property) {
-            return property->getName() == name;
-            });
+        return findChildIndex(name).has_value();
     }
 
     std::vector<const Property*> PropertyImpl::collectLeafChildren() const
@@ -504,13 +934,12 @@ namespace rlogic::internal
 
     template <typename T> std::optional<T> PropertyImpl::getValue_PublicApi() const
     {
-        if (PropertyTypeToEnum<T>::TYPE == m_typeData.type)
+        if (PropertyTypeToEnum<T>::TYPE == m_layout->getType())
         {
-            assert(std::holds_alternative<T>(m_value));
-            return std::get<T>(m_value);
+            return getValueAs<T>();
         }
         LOG_ERROR("Invalid type '{}' when accessing property '{}', correct type is '{}'",
-            GetLuaPrimitiveTypeName(PropertyTypeToEnum<T>::TYPE), m_typeData.name, GetLuaPrimitiveTypeName(m_typeData.type));
+            GetLuaPrimitiveTypeName(PropertyTypeToEnum<T>::TYPE), m_layout->getName(), GetLuaPrimitiveTypeName(m_layout->getType()));
         return std::nullopt;
     }
 
@@ -530,25 +959,25 @@ namespace rlogic::internal
     {
         if (m_semantics == EPropertySemantics::ScriptOutput)
         {
-            LOG_ERROR("Cannot set property '{}' which is an output.", m_typeData.name);
+            LOG_ERROR("Cannot set property '{}' which is an output.", m_layout->getName());
             return false;
         }
 
         if (m_incomingLink.property != nullptr)
         {
-            LOG_ERROR("Property '{}' is currently linked (to property '{}'). Unlink it first before setting its value!", m_typeData.name, m_incomingLink.property->getName());
+            LOG_ERROR("Property '{}' is currently linked (to property '{}'). Unlink it first before setting its value!", m_layout->getName(), m_incomingLink.property->getName());
             return false;
         }
 
-        if (!TypeUtils::IsPrimitiveType(m_typeData.type))
+        if (!TypeUtils::IsPrimitiveType(m_layout->getType()))
         {
-            LOG_ERROR("Property '{}' is not a primitive type, can't set its value directly!", m_typeData.name);
+            LOG_ERROR("Property '{}' is not a primitive type, can't set its value directly!", m_layout->getName());
             return false;
         }
 
-        if (value.index() != m_value.index())
+        if (GetValueType(value) != m_layout->getType())
         {
-            LOG_ERROR("Invalid type when setting property '{}', correct type is '{}'", m_typeData.name, GetLuaPrimitiveTypeName(m_typeData.type));
+            LOG_ERROR("Invalid type when setting property '{}', correct type is '{}'", m_layout->getName(), GetLuaPrimitiveTypeName(m_layout->getType()));
             return false;
         }
 
@@ -562,7 +991,7 @@ namespace rlogic::internal
             if (int64Value > maxIntegerAsDouble || int64Value < -maxIntegerAsDouble)
             {
                 LOG_ERROR("Invalid value when setting property '{}', Lua cannot handle full range of 64-bit integer, trying to set '{}' which is out of this range!",
-                    m_typeData.name, int64Value);
+                    m_layout->getName(), int64Value);
                 return false;
             }
         }
@@ -595,17 +1024,52 @@ namespace rlogic::internal
 
     bool PropertyImpl::setValue(PropertyValue value)
     {
-        assert(m_value.index() == value.index());
-        assert(TypeUtils::IsPrimitiveType(m_typeData.type));
+        assert(GetValueType(value) == m_layout->getType());
+        assert(TypeUtils::IsPrimitiveType(m_layout->getType()));
 
         if (m_semantics == EPropertySemantics::BindingInput)
         {
             m_bindingInputHasNewValue = true;
         }
 
-        const bool valueChanged = (m_value != value);
+        return std::visit([this](auto& typedValue) { return assignValue(std::move(typedValue)); }, value);
+    }
+
+    bool PropertyImpl::copyValueFrom(const PropertyImpl& other)
+    {
+        assert(other.m_layout->getType() == m_layout->getType());
+        assert(TypeUtils::IsPrimitiveType(m_layout->getType()));
+
+        if (m_semantics == EPropertySemantics::BindingInput)
+        {
+            m_bindingInputHasNewValue = true;
+        }
+
+        return VisitPrimitiveType(m_layout->getType(), [this, &other](auto typeTag) {
+            using T = typename decltype(typeTag)::type;
+            return assignValue<T>(other.getValueAs<T>());
+        });
+    }
+
+    bool PropertyImpl::setFloatArrayValues(const float* values, size_t count)
+    {
+        assert(m_layout->getType() == EPropertyType::Array);
+        assert(count == m_children.size());
 
-        m_value = std::move(value);
+        bool valueChanged = false;
+        for (size_t i = 0u; i < count; ++i)
+        {
+            PropertyImpl& element = *m_children[i]->m_impl;
+            assert(element.m_layout->getType() == EPropertyType::Float);
+            if (element.m_semantics == EPropertySemantics::BindingInput)
+            {
+                element.m_bindingInputHasNewValue = true;
+            }
+            if (element.assignValue(values[i]))
+            {
+                valueChanged = true;
+            }
+        }
 
         return valueChanged;
     }
@@ -665,9 +1129,31 @@ namespace rlogic::internal
         return m_semantics;
     }
 
-    const PropertyValue& PropertyImpl::getValue() const
+    PropertyValue PropertyImpl::getValue() const
     {
-        return m_value;
+        assert(TypeUtils::IsPrimitiveType(m_layout->getType()));
+        return VisitPrimitiveType(m_layout->getType(), [this](auto typeTag) {
+            using T = typename decltype(typeTag)::type;
+            return PropertyValue{ std::in_place_type<T>, getValueAs<T>() };
+        });
+    }
+
+    size_t PropertyImpl::getMemoryUsage() const
+    {
+        size_t memoryUsage = sizeof(Property) + sizeof(PropertyImpl) + m_children.capacity() * sizeof(PropertyList::value_type);
+        if (m_ownedValueArena)
+        {
+            memoryUsage += m_ownedValueArena->getMemoryUsage();
+        }
+        if (m_sharedLayout)
+        {
+            memoryUsage += m_sharedLayout->getMemoryUsage() / static_cast<size_t>(m_sharedLayout.use_count());
+        }
+        for (const auto& child : m_children)
+        {
+            memoryUsage += child->m_impl->getMemoryUsage();
+        }
+        return memoryUsage;
     }
 
     bool PropertyImpl::isLinked() const
@@ -707,6 +1193,7 @@ namespace rlogic::internal
 
         output.m_outgoingLinks.push_back({ this, isWeakLink });
         m_incomingLink = { &output, isWeakLink };
+        output.setLogicNodeOutgoingLinksDirty();
     }
 
     void PropertyImpl::resetIncomingLink()
@@ -716,9 +1203,19 @@ namespace rlogic::internal
         auto linkIter = std::find_if(srcPropertyLinks.begin(), srcPropertyLinks.end(), [this](const auto& p) { return p.property == this; });
         assert(linkIter != srcPropertyLinks.end());
         srcPropertyLinks.erase(linkIter);
+        m_incomingLink.property->setLogicNodeOutgoingLinksDirty();
         m_incomingLink = { nullptr, false };
     }
 
+    void PropertyImpl::setLogicNodeOutgoingLinksDirty()
+    {
+        // properties created standalone (only in tests) have no logic node
+        if (m_logicNode != nullptr)
+        {
+            m_logicNode->setOutgoingLinksDirty();
+        }
+    }
+
     void PropertyImpl::initializeBindingInputValue(PropertyValue value)
     {
         setValue(std::move(value));
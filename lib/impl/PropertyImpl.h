@@ -9,10 +9,13 @@
 #pragma once
 
 #include "ramses-logic/EPropertyType.h"
+#include "ramses-logic/EFeatureLevel.h"
 #include "internals/EPropertySemantics.h"
 #include "internals/SerializationMap.h"
 #include "internals/DeserializationMap.h"
 #include "internals/TypeData.h"
+#include "internals/PropertyValueArena.h"
+#include "internals/PropertyTypeLayout.h"
 
 #include <cassert>
 #include <string>
@@ -29,6 +32,7 @@ namespace rlogic
 namespace rlogic_serialization
 {
     struct Property;
+    struct PropertyTreeType;
 }
 
 namespace flatbuffers
@@ -50,11 +54,16 @@ namespace rlogic::internal
     public:
         PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics);
         PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics, PropertyValue initialValue);
+        // Property tree refers to given layout, which can be shared with other property trees of the same type
+        PropertyImpl(std::shared_ptr<const PropertyTypeLayout> layout, EPropertySemantics semantics);
 
+        // Feature level 06 and higher stores whole tree (of a root property) in one flatbuffers object with columnar encoding
+        // of values, lower feature levels store every property of the tree as separate object
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::Property> Serialize(
             const PropertyImpl& prop,
             flatbuffers::FlatBufferBuilder& builder,
-            SerializationMap& serializationMap);
+            SerializationMap& serializationMap,
+            EFeatureLevel featureLevel);
 
         [[nodiscard]] static std::unique_ptr<PropertyImpl> Deserialize(
             const rlogic_serialization::Property& prop,
@@ -73,6 +82,7 @@ namespace rlogic::internal
         [[nodiscard]] size_t getChildCount() const;
         [[nodiscard]] EPropertyType getType() const;
         [[nodiscard]] std::string_view getName() const;
+        [[nodiscard]] const PropertyTypeLayout& getLayout() const;
 
         [[nodiscard]] bool bindingInputHasNewValue() const;
         [[nodiscard]] bool checkForBindingInputNewValueAndReset();
@@ -91,6 +101,8 @@ namespace rlogic::internal
         [[nodiscard]] Property* getChild(std::string_view name);
         [[nodiscard]] const Property* getChild(std::string_view name) const;
         [[nodiscard]] bool hasChild(std::string_view name) const;
+        // Index of the child with given name, uses hashed name index for structs (no string comparison with every field)
+        [[nodiscard]] std::optional<size_t> findChildIndex(std::string_view name) const;
 
         [[nodiscard]] std::vector<const Property*> collectLeafChildren() const;
 
@@ -101,18 +113,28 @@ namespace rlogic::internal
 
         // Generic setter. Can optionally skip dirty-check
         bool setValue(PropertyValue value);
+        // Same as setValue(other.getValue()), without going through PropertyValue, used when activating links
+        bool copyValueFrom(const PropertyImpl& other);
+        // Sets all elements of an array of floats at once from contiguous values (e.g. interpolated morph weights),
+        // returns true if any element changed. Count must match the array size.
+        bool setFloatArrayValues(const float* values, size_t count);
         // Special setter for binding value init
         void initializeBindingInputValue(PropertyValue value);
 
-        // Generic getter for use in other non-template code
-        [[nodiscard]] const PropertyValue& getValue() const;
-        // std::get wrapper for use in template code
+        // Generic getter for use in other non-template code, copies the value out of the value arena
+        [[nodiscard]] PropertyValue getValue() const;
+        // Typed access to the value in the value arena, for use in template code
         template <typename T>
         [[nodiscard]] const T& getValueAs() const
         {
-            return std::get<T>(m_value);
+            assert(PropertyTypeToEnum<T>::TYPE == m_layout->getType());
+            return m_valueArena->get<T>(m_valueIndex);
         }
 
+        // Memory occupied by this property and its children, including the value arena if owned by this property
+        // and the share of the type layout owned by this property (layout size divided by number of its owners)
+        [[nodiscard]] size_t getMemoryUsage() const;
+
         void setPropertyInstance(Property& property);
         [[nodiscard]] Property& getPropertyInstance();
         [[nodiscard]] const Property& getPropertyInstance() const;
@@ -135,9 +157,24 @@ namespace rlogic::internal
         void resetIncomingLink();
 
     private:
-        TypeData        m_typeData;
+        // Used for children, which keep their values in the arena of the root property
+        PropertyImpl(const PropertyTypeLayout& layout, EPropertySemantics semantics, PropertyValueArena& valueArena);
+        void createValueOrChildren();
+
+        template <typename T>
+        bool assignValue(T value);
+
+        void setLogicNodeOutgoingLinksDirty();
+
+        // Names and types of the whole tree are shared with other trees of the same type, owned by the root
+        std::shared_ptr<const PropertyTypeLayout> m_sharedLayout;
+        const PropertyTypeLayout* m_layout = nullptr;
         PropertyList    m_children;
-        PropertyValue   m_value;
+
+        // Values of primitive properties are stored in an arena shared by the whole property tree, owned by the root
+        std::unique_ptr<PropertyValueArena> m_ownedValueArena;
+        PropertyValueArena* m_valueArena = nullptr;
+        uint32_t m_valueIndex = 0u;
 
         Link m_incomingLink;
         std::vector<Link> m_outgoingLinks;
@@ -152,5 +189,33 @@ namespace rlogic::internal
             const PropertyImpl& prop,
             flatbuffers::FlatBufferBuilder& builder,
             SerializationMap& serializationMap);
+
+        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::Property> SerializeColumnar(
+            const PropertyImpl& prop,
+            flatbuffers::FlatBufferBuilder& builder,
+            SerializationMap& serializationMap);
+
+        [[nodiscard]] static std::unique_ptr<PropertyImpl> DeserializeColumnar(
+            const rlogic_serialization::Property& prop,
+            EPropertySemantics semantics,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap);
+
+        [[nodiscard]] static std::optional<HierarchicalTypeData> DeserializeTreeType(
+            const rlogic_serialization::PropertyTreeType& treeType,
+            ErrorReporting& errorReporting);
+
+        template <typename ImplT>
+        static void CollectTreeInPreOrder(ImplT& prop, std::vector<ImplT*>& tree);
+
+        [[nodiscard]] static std::optional<HierarchicalTypeData> DeserializeTypeRecursive(
+            const rlogic_serialization::Property& prop,
+            ErrorReporting& errorReporting);
+
+        [[nodiscard]] static bool DeserializeValuesRecursive(
+            const rlogic_serialization::Property& prop,
+            PropertyImpl& impl,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap);
     };
 }
@@ -88,12 +88,12 @@ namespace rlogic::internal
         const RamsesAppearanceBindingImpl& binding,
         flatbuffers::FlatBufferBuilder& builder,
         SerializationMap& serializationMap,
-        EFeatureLevel /*featureLevel*/)
+        EFeatureLevel featureLevel)
     {
         auto ramsesReference = RamsesBindingImpl::SerializeRamsesReference(binding.m_ramsesAppearance, builder);
 
         const auto logicObject = LogicObjectImpl::Serialize(binding, builder);
-        const auto propertyObject = PropertyImpl::Serialize(*binding.getInputs()->m_impl, builder, serializationMap);
+        const auto propertyObject = PropertyImpl::Serialize(*binding.getInputs()->m_impl, builder, serializationMap, featureLevel);
         auto ramsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
             logicObject,
             ramsesReference,
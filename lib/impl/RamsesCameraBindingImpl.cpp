@@ -80,12 +80,12 @@ namespace rlogic::internal
         const RamsesCameraBindingImpl& cameraBinding,
         flatbuffers::FlatBufferBuilder& builder,
         SerializationMap& serializationMap,
-        EFeatureLevel /*featureLevel*/)
+        EFeatureLevel featureLevel)
     {
         auto ramsesReference = RamsesBindingImpl::SerializeRamsesReference(cameraBinding.m_ramsesCamera, builder);
 
         const auto logicObject = LogicObjectImpl::Serialize(cameraBinding, builder);
-        const auto propertyObject = PropertyImpl::Serialize(*cameraBinding.getInputs()->m_impl, builder, serializationMap);
+        const auto propertyObject = PropertyImpl::Serialize(*cameraBinding.getInputs()->m_impl, builder, serializationMap, featureLevel);
         auto ramsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
             logicObject,
             ramsesReference,
@@ -43,11 +43,11 @@ namespace rlogic::internal
         const RamsesMeshNodeBindingImpl& meshNodeBinding,
         flatbuffers::FlatBufferBuilder& builder,
         SerializationMap& serializationMap,
-        EFeatureLevel /*featureLevel*/)
+        EFeatureLevel featureLevel)
     {
         const auto logicObject = LogicObjectImpl::Serialize(meshNodeBinding, builder);
         const auto fbRamsesRef = RamsesBindingImpl::SerializeRamsesReference(meshNodeBinding.m_ramsesMeshNode, builder);
-        const auto propertyObject = PropertyImpl::Serialize(*meshNodeBinding.getInputs()->m_impl, builder, serializationMap);
+        const auto propertyObject = PropertyImpl::Serialize(*meshNodeBinding.getInputs()->m_impl, builder, serializationMap, featureLevel);
         auto fbRamsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
             logicObject,
             fbRamsesRef,
@@ -53,12 +53,12 @@ namespace rlogic::internal
         const RamsesNodeBindingImpl& nodeBinding,
         flatbuffers::FlatBufferBuilder& builder,
         SerializationMap& serializationMap,
-        EFeatureLevel /*featureLevel*/)
+        EFeatureLevel featureLevel)
     {
         auto ramsesReference = RamsesBindingImpl::SerializeRamsesReference(nodeBinding.m_ramsesNode, builder);
 
         const auto logicObject = LogicObjectImpl::Serialize(nodeBinding, builder);
-        const auto propertyObject = PropertyImpl::Serialize(*nodeBinding.getInputs()->m_impl, builder, serializationMap);
+        const auto propertyObject = PropertyImpl::Serialize(*nodeBinding.getInputs()->m_impl, builder, serializationMap, featureLevel);
         auto ramsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
             logicObject,
             ramsesReference,
@@ -49,11 +49,11 @@ namespace rlogic::internal
         const RamsesRenderGroupBindingImpl& renderGroupBinding,
         flatbuffers::FlatBufferBuilder& builder,
         SerializationMap& serializationMap,
-        EFeatureLevel /*featureLevel*/)
+        EFeatureLevel featureLevel)
     {
         const auto logicObject = LogicObjectImpl::Serialize(renderGroupBinding, builder);
         const auto fbRamsesRef = RamsesBindingImpl::SerializeRamsesReference(renderGroupBinding.m_ramsesRenderGroup, builder);
-        const auto propertyObject = PropertyImpl::Serialize(*renderGroupBinding.getInputs()->m_impl, builder, serializationMap);
+        const auto propertyObject = PropertyImpl::Serialize(*renderGroupBinding.getInputs()->m_impl, builder, serializationMap, featureLevel);
         auto fbRamsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
             logicObject,
             fbRamsesRef,
@@ -47,11 +47,11 @@ namespace rlogic::internal
         const RamsesRenderPassBindingImpl& renderPassBinding,
         flatbuffers::FlatBufferBuilder& builder,
         SerializationMap& serializationMap,
-        EFeatureLevel /*featureLevel*/)
+        EFeatureLevel featureLevel)
     {
         const auto logicObject = LogicObjectImpl::Serialize(renderPassBinding, builder);
         const auto fbRamsesRef = RamsesBindingImpl::SerializeRamsesReference(renderPassBinding.m_ramsesRenderPass, builder);
-        const auto propertyObject = PropertyImpl::Serialize(*renderPassBinding.getInputs()->m_impl, builder, serializationMap);
+        const auto propertyObject = PropertyImpl::Serialize(*renderPassBinding.getInputs()->m_impl, builder, serializationMap, featureLevel);
         auto fbRamsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
             logicObject,
             fbRamsesRef,
@@ -52,4 +52,9 @@ namespace rlogic
     {
         m_impl->setLuaSavingMode(mode);
     }
+
+    void SaveFileConfig::setDataArrayCompression(EDataArrayCompression compression)
+    {
+        m_impl->setDataArrayCompression(compression);
+    }
 }
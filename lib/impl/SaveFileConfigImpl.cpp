@@ -72,4 +72,14 @@ namespace rlogic::internal
     {
         return m_luaSavingMode;
     }
+
+    void SaveFileConfigImpl::setDataArrayCompression(EDataArrayCompression compression)
+    {
+        m_dataArrayCompression = compression;
+    }
+
+    EDataArrayCompression SaveFileConfigImpl::getDataArrayCompression() const
+    {
+        return m_dataArrayCompression;
+    }
 }
@@ -11,6 +11,7 @@
 #include <string>
 #include <string_view>
 #include "ramses-logic/ELuaSavingMode.h"
+#include "ramses-logic/EDataArrayCompression.h"
 
 namespace rlogic
 {
@@ -26,6 +27,7 @@ namespace rlogic::internal
         void setExporterVersion(uint32_t major, uint32_t minor, uint32_t patch, uint32_t fileFormatVersion);
         void setValidationEnabled(bool validationEnabled);
         void setLuaSavingMode(ELuaSavingMode mode);
+        void setDataArrayCompression(EDataArrayCompression compression);
 
         [[nodiscard]] const std::string& getMetadataString() const;
         [[nodiscard]] uint32_t getExporterMajorVersion() const;
@@ -34,6 +36,7 @@ namespace rlogic::internal
         [[nodiscard]] uint32_t getExporterFileFormatVersion() const;
         [[nodiscard]] bool getValidationEnabled() const;
         [[nodiscard]] ELuaSavingMode getLuaSavingMode() const;
+        [[nodiscard]] EDataArrayCompression getDataArrayCompression() const;
 
     private:
         std::string m_metadata;
@@ -43,5 +46,6 @@ namespace rlogic::internal
         uint32_t m_exporterFileFormatVersion = 0u;
         bool m_validationEnabled = true;
         ELuaSavingMode m_luaSavingMode = ELuaSavingMode::SourceAndByteCode;
+        EDataArrayCompression m_dataArrayCompression = EDataArrayCompression::None;
     };
 }
@@ -55,11 +55,16 @@ namespace rlogic::internal
         return std::nullopt;
     }
 
+    bool TimerNodeImpl::canUpdateConcurrently() const
+    {
+        return true;
+    }
+
     flatbuffers::Offset<rlogic_serialization::TimerNode> TimerNodeImpl::Serialize(
         const TimerNodeImpl& timerNode,
         flatbuffers::FlatBufferBuilder& builder,
         SerializationMap& serializationMap,
-        EFeatureLevel /*featureLevel*/)
+        EFeatureLevel featureLevel)
     {
         // Timer nodes require special serialization logic. We don't want to store system time
         // in the files (this makes their content undeterministic). Instead, we write zeroes, and
@@ -73,8 +78,8 @@ namespace rlogic::internal
 
         // 3. Serialize
         const auto logicObject = LogicObjectImpl::Serialize(timerNode, builder);
-        const auto inputPropertyObject = PropertyImpl::Serialize(*timerNode.getInputs()->m_impl, builder, serializationMap);
-        const auto outputPropertyObject = PropertyImpl::Serialize(*timerNode.getOutputs()->m_impl, builder, serializationMap);
+        const auto inputPropertyObject = PropertyImpl::Serialize(*timerNode.getInputs()->m_impl, builder, serializationMap, featureLevel);
+        const auto outputPropertyObject = PropertyImpl::Serialize(*timerNode.getOutputs()->m_impl, builder, serializationMap, featureLevel);
         auto timerNodeOffset = rlogic_serialization::CreateTimerNode(
             builder,
             logicObject,
@@ -0,0 +1,186 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/AnimationBatchEvaluator.h"
+
+#include <cassert>
+
+#if defined(__AVX__)
+#define RLOGIC_ANIMATION_BATCH_AVX
+#include <immintrin.h>
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RLOGIC_ANIMATION_BATCH_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace rlogic::internal
+{
+    static float InterpolateLinearScalar(float lower, float upper, float ratio)
+    {
+        return lower + ratio * (upper - lower);
+    }
+
+    static float InterpolateCubicScalar(float p0, float p1, float m0, float m1, float t)
+    {
+        const float t2 = t * t;
+        const float t3 = t2 * t;
+        return (2.f*t3 - 3.f*t2 + 1.f) * p0 + (t3 - 2.f*t2 + t) * m0 + (-2.f*t3 + 3.f*t2) * p1 + (t3 - t2) * m1;
+    }
+
+    size_t AnimationBatchEvaluator::addLinear(float lowerVal, float upperVal, float interpRatio)
+    {
+        m_linearLower.push_back(lowerVal);
+        m_linearUpper.push_back(upperVal);
+        m_linearRatio.push_back(interpRatio);
+        return m_linearLower.size() - 1u;
+    }
+
+    size_t AnimationBatchEvaluator::addCubic(float lowerVal, float upperVal, float lowerTangentOut, float upperTangentIn, float interpRatio, float timeBetweenKeys)
+    {
+        m_cubicP0.push_back(lowerVal);
+        m_cubicP1.push_back(upperVal);
+        m_cubicM0.push_back(timeBetweenKeys * lowerTangentOut);
+        m_cubicM1.push_back(timeBetweenKeys * upperTangentIn);
+        m_cubicRatio.push_back(interpRatio);
+        return m_cubicP0.size() - 1u;
+    }
+
+    void AnimationBatchEvaluator::evaluate()
+    {
+        m_linearResult.resize(m_linearLower.size());
+        InterpolateLinear(m_linearLower.data(), m_linearUpper.data(), m_linearRatio.data(), m_linearResult.data(), m_linearLower.size());
+
+        m_cubicResult.resize(m_cubicP0.size());
+        InterpolateCubic(m_cubicP0.data(), m_cubicP1.data(), m_cubicM0.data(), m_cubicM1.data(), m_cubicRatio.data(), m_cubicResult.data(), m_cubicP0.size());
+    }
+
+    float AnimationBatchEvaluator::getLinearResult(size_t resultIdx) const
+    {
+        assert(resultIdx < m_linearResult.size());
+        return m_linearResult[resultIdx];
+    }
+
+    float AnimationBatchEvaluator::getCubicResult(size_t resultIdx) const
+    {
+        assert(resultIdx < m_cubicResult.size());
+        return m_cubicResult[resultIdx];
+    }
+
+    const float* AnimationBatchEvaluator::getLinearResults(size_t firstResultIdx, size_t count) const
+    {
+        assert(firstResultIdx + count <= m_linearResult.size());
+        (void)count;
+        return m_linearResult.data() + firstResultIdx;
+    }
+
+    const float* AnimationBatchEvaluator::getCubicResults(size_t firstResultIdx, size_t count) const
+    {
+        assert(firstResultIdx + count <= m_cubicResult.size());
+        (void)count;
+        return m_cubicResult.data() + firstResultIdx;
+    }
+
+    size_t AnimationBatchEvaluator::getLinearCount() const
+    {
+        return m_linearLower.size();
+    }
+
+    size_t AnimationBatchEvaluator::getCubicCount() const
+    {
+        return m_cubicP0.size();
+    }
+
+    void AnimationBatchEvaluator::clear()
+    {
+        m_linearLower.clear();
+        m_linearUpper.clear();
+        m_linearRatio.clear();
+        m_linearResult.clear();
+
+        m_cubicP0.clear();
+        m_cubicP1.clear();
+        m_cubicM0.clear();
+        m_cubicM1.clear();
+        m_cubicRatio.clear();
+        m_cubicResult.clear();
+    }
+
+    void AnimationBatchEvaluator::InterpolateLinear(const float* lower, const float* upper, const float* ratio, float* result, size_t count)
+    {
+        size_t i = 0u;
+#if defined(RLOGIC_ANIMATION_BATCH_AVX)
+        for (; i + 8u <= count; i += 8u)
+        {
+            const __m256 lowerVal = _mm256_loadu_ps(lower + i);
+            const __m256 upperVal = _mm256_loadu_ps(upper + i);
+            const __m256 interpRatio = _mm256_loadu_ps(ratio + i);
+            _mm256_storeu_ps(result + i, _mm256_add_ps(lowerVal, _mm256_mul_ps(interpRatio, _mm256_sub_ps(upperVal, lowerVal))));
+        }
+#elif defined(RLOGIC_ANIMATION_BATCH_SSE)
+        for (; i + 4u <= count; i += 4u)
+        {
+            const __m128 lowerVal = _mm_loadu_ps(lower + i);
+            const __m128 upperVal = _mm_loadu_ps(upper + i);
+            const __m128 interpRatio = _mm_loadu_ps(ratio + i);
+            _mm_storeu_ps(result + i, _mm_add_ps(lowerVal, _mm_mul_ps(interpRatio, _mm_sub_ps(upperVal, lowerVal))));
+        }
+#endif
+        // remainder which does not fill whole SIMD register
+        for (; i < count; ++i)
+            result[i] = InterpolateLinearScalar(lower[i], upper[i], ratio[i]);
+    }
+
+    void AnimationBatchEvaluator::InterpolateCubic(const float* p0, const float* p1, const float* m0, const float* m1, const float* ratio, float* result, size_t count)
+    {
+        size_t i = 0u;
+#if defined(RLOGIC_ANIMATION_BATCH_AVX)
+        const __m256 one = _mm256_set1_ps(1.f);
+        const __m256 two = _mm256_set1_ps(2.f);
+        const __m256 three = _mm256_set1_ps(3.f);
+        for (; i + 8u <= count; i += 8u)
+        {
+            const __m256 t = _mm256_loadu_ps(ratio + i);
+            const __m256 t2 = _mm256_mul_ps(t, t);
+            const __m256 t3 = _mm256_mul_ps(t2, t);
+            // same terms and order of operations as InterpolateCubicScalar
+            const __m256 h00 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(two, t3), _mm256_mul_ps(three, t2)), one);
+            const __m256 h10 = _mm256_add_ps(_mm256_sub_ps(t3, _mm256_mul_ps(two, t2)), t);
+            const __m256 h01 = _mm256_sub_ps(_mm256_mul_ps(three, t2), _mm256_mul_ps(two, t3));
+            const __m256 h11 = _mm256_sub_ps(t3, t2);
+            __m256 val = _mm256_mul_ps(h00, _mm256_loadu_ps(p0 + i));
+            val = _mm256_add_ps(val, _mm256_mul_ps(h10, _mm256_loadu_ps(m0 + i)));
+            val = _mm256_add_ps(val, _mm256_mul_ps(h01, _mm256_loadu_ps(p1 + i)));
+            val = _mm256_add_ps(val, _mm256_mul_ps(h11, _mm256_loadu_ps(m1 + i)));
+            _mm256_storeu_ps(result + i, val);
+        }
+#elif defined(RLOGIC_ANIMATION_BATCH_SSE)
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 two = _mm_set1_ps(2.f);
+        const __m128 three = _mm_set1_ps(3.f);
+        for (; i + 4u <= count; i += 4u)
+        {
+            const __m128 t = _mm_loadu_ps(ratio + i);
+            const __m128 t2 = _mm_mul_ps(t, t);
+            const __m128 t3 = _mm_mul_ps(t2, t);
+            // same terms and order of operations as InterpolateCubicScalar
+            const __m128 h00 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(two, t3), _mm_mul_ps(three, t2)), one);
+            const __m128 h10 = _mm_add_ps(_mm_sub_ps(t3, _mm_mul_ps(two, t2)), t);
+            const __m128 h01 = _mm_sub_ps(_mm_mul_ps(three, t2), _mm_mul_ps(two, t3));
+            const __m128 h11 = _mm_sub_ps(t3, t2);
+            __m128 val = _mm_mul_ps(h00, _mm_loadu_ps(p0 + i));
+            val = _mm_add_ps(val, _mm_mul_ps(h10, _mm_loadu_ps(m0 + i)));
+            val = _mm_add_ps(val, _mm_mul_ps(h01, _mm_loadu_ps(p1 + i)));
+            val = _mm_add_ps(val, _mm_mul_ps(h11, _mm_loadu_ps(m1 + i)));
+            _mm_storeu_ps(result + i, val);
+        }
+#endif
+        // remainder which does not fill whole SIMD register
+        for (; i < count; ++i)
+            result[i] = InterpolateCubicScalar(p0[i], p1[i], m0[i], m1[i], ratio[i]);
+    }
+}
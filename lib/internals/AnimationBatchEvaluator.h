@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace rlogic::internal
+{
+    // Interpolates float components of keyframe values of many animation channels in one pass.
+    // Components are added one by one together with their own interpolation ratio and stored as structure of arrays
+    // (one array per operand), evaluate() then interpolates several components at once using SIMD instructions
+    // (AVX or SSE, depending on what the library is compiled for, scalar code otherwise).
+    // Linear and cubic interpolation are separate batches, result index returned when adding a component refers to its batch.
+    class AnimationBatchEvaluator
+    {
+    public:
+        size_t addLinear(float lowerVal, float upperVal, float interpRatio);
+        // Same as AnimationNodeImpl::interpolateKeyframes_cubic, tangents are scaled by time between keyframes
+        size_t addCubic(float lowerVal, float upperVal, float lowerTangentOut, float upperTangentIn, float interpRatio, float timeBetweenKeys);
+
+        void evaluate();
+
+        // Valid after evaluate() until next clear()
+        [[nodiscard]] float getLinearResult(size_t resultIdx) const;
+        [[nodiscard]] float getCubicResult(size_t resultIdx) const;
+        // Results of components added one after another are contiguous, e.g. all elements of a float array keyframe
+        [[nodiscard]] const float* getLinearResults(size_t firstResultIdx, size_t count) const;
+        [[nodiscard]] const float* getCubicResults(size_t firstResultIdx, size_t count) const;
+
+        [[nodiscard]] size_t getLinearCount() const;
+        [[nodiscard]] size_t getCubicCount() const;
+
+        // Removes all components but keeps allocated memory, so that evaluating batches of similar size does not allocate
+        void clear();
+
+        // result[i] = lower[i] + ratio[i] * (upper[i] - lower[i])
+        static void InterpolateLinear(const float* lower, const float* upper, const float* ratio, float* result, size_t count);
+        // GLTF v2 Appendix C (cubic spline), tangents m0/m1 already scaled by time between keyframes
+        static void InterpolateCubic(const float* p0, const float* p1, const float* m0, const float* m1, const float* ratio, float* result, size_t count);
+
+    private:
+        std::vector<float> m_linearLower;
+        std::vector<float> m_linearUpper;
+        std::vector<float> m_linearRatio;
+        std::vector<float> m_linearResult;
+
+        std::vector<float> m_cubicP0;
+        std::vector<float> m_cubicP1;
+        std::vector<float> m_cubicM0;
+        std::vector<float> m_cubicM1;
+        std::vector<float> m_cubicRatio;
+        std::vector<float> m_cubicResult;
+    };
+}
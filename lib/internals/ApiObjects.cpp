@@ -8,6 +8,7 @@
 
 #include "internals/ApiObjects.h"
 #include "internals/ErrorReporting.h"
+#include "internals/ThreadPool.h"
 
 #include "ramses-logic-build-config.h"
 
@@ -66,10 +67,135 @@
 #include "fmt/format.h"
 #include "TypeUtils.h"
 #include "ValidationResults.h"
-#include <deque>
+#include <algorithm>
+#include <unordered_map>
+#include <functional>
 
 namespace rlogic::internal
 {
+    namespace
+    {
+        // Deserializes objects which don't depend on each other (except on Lua modules) in chunks, concurrently
+        // if a thread pool is provided. Every chunk has its own error reporting and deserialization map, a chunk stops
+        // at its first failed object. Errors are reported only once the caller processes the failed object in original
+        // order, i.e. the same errors are reported as with sequential deserialization.
+        class ChunkedDeserialization
+        {
+        public:
+            using DeserializeObject = std::function<bool(size_t objectIdx, ErrorReporting& errorReporting, DeserializationMap& deserializationMap)>;
+
+            explicit ChunkedDeserialization(ThreadPool* threadPool)
+                : m_threadPool{ threadPool }
+            {
+            }
+
+            // Returns handle of the object type to be used with reportErrors()
+            size_t addObjects(size_t objectCount, DeserializeObject deserializeObject)
+            {
+                // several chunks per thread to balance objects of different size
+                const size_t maxChunkCount = (m_threadPool ? m_threadPool->getThreadCount() * 4u : 1u);
+                const size_t chunkSize = std::max<size_t>((objectCount + maxChunkCount - 1u) / maxChunkCount, 1u);
+
+                const size_t objectType = m_objectTypes.size();
+                m_objectTypes.push_back({ std::move(deserializeObject), m_chunks.size(), chunkSize });
+                for (size_t begin = 0u; begin < objectCount; begin += chunkSize)
+                    m_chunks.push_back({ objectType, begin, std::min(begin + chunkSize, objectCount), {}, {} });
+
+                return objectType;
+            }
+
+            // Collected mappings are moved to deserializationMap, it must already contain all Lua modules
+            void execute(DeserializationMap& deserializationMap)
+            {
+                if (m_threadPool == nullptr || m_chunks.size() < 2u)
+                {
+                    for (auto& chunk : m_chunks)
+                        deserializeChunk(chunk, deserializationMap);
+                    return;
+                }
+
+                for (auto& chunk : m_chunks)
+                    chunk.deserializationMap = deserializationMap;
+
+                m_threadPool->execute(m_chunks.size(), [this](size_t chunkIdx) {
+                    Chunk& chunk = m_chunks[chunkIdx];
+                    deserializeChunk(chunk, chunk.deserializationMap);
+                }, []() {});
+
+                for (auto& chunk : m_chunks)
+                    deserializationMap.merge(std::move(chunk.deserializationMap));
+            }
+
+            void reportErrors(size_t objectType, size_t objectIdx, ErrorReporting& errorReporting) const
+            {
+                const ObjectType& type = m_objectTypes[objectType];
+                for (const auto& error : m_chunks[type.firstChunk + objectIdx / type.chunkSize].errors.getErrors())
+                    errorReporting.add(error.message, error.object, error.type);
+            }
+
+        private:
+            struct ObjectType
+            {
+                DeserializeObject deserializeObject;
+                size_t firstChunk;
+                size_t chunkSize;
+            };
+
+            struct Chunk
+            {
+                size_t objectType;
+                size_t begin;
+                size_t end;
+                ErrorReporting errors;
+                DeserializationMap deserializationMap;
+            };
+
+            void deserializeChunk(Chunk& chunk, DeserializationMap& deserializationMap) const
+            {
+                const DeserializeObject& deserializeObject = m_objectTypes[chunk.objectType].deserializeObject;
+                for (size_t objectIdx = chunk.begin; objectIdx < chunk.end; ++objectIdx)
+                {
+                    if (!deserializeObject(objectIdx, chunk.errors, deserializationMap))
+                        return;
+                }
+            }
+
+            ThreadPool* m_threadPool;
+            std::vector<ObjectType> m_objectTypes;
+            std::vector<Chunk> m_chunks;
+        };
+
+        // Picks encoding of every data array by how animation nodes use it. Timestamps are always stored with full precision
+        // (quantized timestamps could change order of keyframes or break uniform sampling), keyframes of quaternion channels are packed
+        // if not used in another way. Data arrays not used by any animation node are not in the result and are stored with full precision.
+        std::unordered_map<const DataArray*, EDataArrayEncoding> DetermineDataArrayEncodings(const std::vector<AnimationNode*>& animationNodes)
+        {
+            std::unordered_map<const DataArray*, EDataArrayEncoding> encodings;
+            const auto useAs = [&encodings](const DataArray* dataArray, EDataArrayEncoding encoding) {
+                if (!dataArray)
+                    return;
+                const auto it = encodings.emplace(dataArray, encoding).first;
+                // full precision takes precedence over quantization, which takes precedence over packed quaternions
+                if (encoding == EDataArrayEncoding::Full || (encoding == EDataArrayEncoding::Quantized && it->second == EDataArrayEncoding::PackedQuaternions))
+                    it->second = encoding;
+            };
+
+            for (const auto* animNode : animationNodes)
+            {
+                for (const auto& channel : animNode->m_animationNodeImpl.getChannels())
+                {
+                    const bool isQuaternionChannel = (channel.interpolationType == EInterpolationType::Linear_Quaternions || channel.interpolationType == EInterpolationType::Cubic_Quaternions);
+                    useAs(channel.timeStamps, EDataArrayEncoding::Full);
+                    useAs(channel.keyframes, isQuaternionChannel ? EDataArrayEncoding::PackedQuaternions : EDataArrayEncoding::Quantized);
+                    useAs(channel.tangentsIn, EDataArrayEncoding::Quantized);
+                    useAs(channel.tangentsOut, EDataArrayEncoding::Quantized);
+                }
+            }
+
+            return encodings;
+        }
+    }
+
     ApiObjects::ApiObjects(EFeatureLevel featureLevel)
         : m_featureLevel{ featureLevel }
     {
@@ -77,6 +203,45 @@ namespace rlogic::internal
 
     ApiObjects::~ApiObjects() noexcept = default;
 
+    bool ApiObjects::setLuaStateCount(size_t luaStateCount, ErrorReporting& errorReporting)
+    {
+        if (luaStateCount == 0u)
+        {
+            errorReporting.add("Failed to set Lua state count: at least 1 Lua state is required.", nullptr, EErrorType::IllegalArgument);
+            return false;
+        }
+
+        // scripts and module instances are bound to the Lua state they were created in
+        if (!m_scripts.empty() || !m_luaModules.empty())
+        {
+            errorReporting.add("Failed to set Lua state count: can only be changed before any Lua script or module is created.", nullptr, EErrorType::IllegalArgument);
+            return false;
+        }
+
+        m_additionalSolStates.resize(luaStateCount - 1u);
+        for (auto& solState : m_additionalSolStates)
+        {
+            if (!solState)
+                solState = std::make_unique<SolState>();
+        }
+        m_nextScriptSolState = 0u;
+
+        return true;
+    }
+
+    size_t ApiObjects::getLuaStateCount() const
+    {
+        return m_additionalSolStates.size() + 1u;
+    }
+
+    SolState& ApiObjects::getSolStateForNextScript()
+    {
+        const size_t solStateIdx = m_nextScriptSolState;
+        m_nextScriptSolState = (m_nextScriptSolState + 1u) % getLuaStateCount();
+
+        return (solStateIdx == 0u ? *m_solState : *m_additionalSolStates[solStateIdx - 1u]);
+    }
+
     bool ApiObjects::checkLuaModules(const ModuleMapping& moduleMapping, ErrorReporting& errorReporting)
     {
         for (const auto& module : moduleMapping)
@@ -102,23 +267,22 @@ namespace rlogic::internal
         if (!checkLuaModules(modules, errorReporting))
             return nullptr;
 
-        std::optional<LuaCompiledScript> compiledScript = LuaCompilationUtils::CompileScriptOrImportPrecompiled(
-            *m_solState,
+        std::optional<LuaCompiledScript> compiledScript = LuaCompilationUtils::CompileScriptWithCache(
+            getSolStateForNextScript(),
             modules,
             config.getStandardModules(),
             std::string{ source },
             scriptName,
             errorReporting,
-            {}, {}, {},
             m_featureLevel,
-            config.hasDebugLogFunctionsEnabled());
+            config.hasDebugLogFunctionsEnabled(),
+            m_luaCompilationCache);
 
         if (!compiledScript)
             return nullptr;
 
         std::unique_ptr<LuaScript> up = std::make_unique<LuaScript>(std::make_unique<LuaScriptImpl>(std::move(*compiledScript), scriptName, getNextLogicObjectId()));
         LuaScript* script = up.get();
-        m_scripts.push_back(script);
         registerLogicObject(std::move(up));
         script->m_impl.createRootProperties();
 
@@ -154,7 +318,6 @@ namespace rlogic::internal
 
         std::unique_ptr<LuaInterface> up = std::make_unique<LuaInterface>(std::make_unique<LuaInterfaceImpl>(std::move(*compiledInterface), interfaceName, getNextLogicObjectId()));
         LuaInterface* intf = up.get();
-        m_interfaces.push_back(intf);
         registerLogicObject(std::move(up));
         return intf;
     }
@@ -169,23 +332,22 @@ namespace rlogic::internal
         if (!checkLuaModules(modules, errorReporting))
             return nullptr;
 
-        std::optional<LuaCompiledModule> compiledModule = LuaCompilationUtils::CompileModuleOrImportPrecompiled(
+        std::optional<LuaCompiledModule> compiledModule = LuaCompilationUtils::CompileModuleWithCache(
             *m_solState,
             modules,
             config.getStandardModules(),
             std::string{source},
             moduleName,
             errorReporting,
-            {},
             m_featureLevel,
-            config.hasDebugLogFunctionsEnabled());
+            config.hasDebugLogFunctionsEnabled(),
+            m_luaCompilationCache);
 
         if (!compiledModule)
             return nullptr;
 
         std::unique_ptr<LuaModule> up = std::make_unique<LuaModule>(std::make_unique<LuaModuleImpl>(std::move(*compiledModule), moduleName, getNextLogicObjectId()));
         LuaModule* luaModule = up.get();
-        m_luaModules.push_back(luaModule);
         registerLogicObject(std::move(up));
 
         return luaModule;
@@ -195,7 +357,6 @@ namespace rlogic::internal
     {
         std::unique_ptr<RamsesNodeBinding> up = std::make_unique<RamsesNodeBinding>(std::make_unique<RamsesNodeBindingImpl>(ramsesNode, rotationType, name, getNextLogicObjectId(), m_featureLevel));
         RamsesNodeBinding* binding = up.get();
-        m_ramsesNodeBindings.push_back(binding);
         registerLogicObject(std::move(up));
         binding->m_impl.createRootProperties();
 
@@ -206,7 +367,6 @@ namespace rlogic::internal
     {
         std::unique_ptr<RamsesAppearanceBinding> up = std::make_unique<RamsesAppearanceBinding>(std::make_unique<RamsesAppearanceBindingImpl>(ramsesAppearance, name, getNextLogicObjectId()));
         RamsesAppearanceBinding* binding = up.get();
-        m_ramsesAppearanceBindings.push_back(binding);
         registerLogicObject(std::move(up));
         binding->m_impl.createRootProperties();
 
@@ -217,7 +377,6 @@ namespace rlogic::internal
     {
         std::unique_ptr<RamsesCameraBinding> up = std::make_unique<RamsesCameraBinding>(std::make_unique<RamsesCameraBindingImpl>(ramsesCamera, withFrustumPlanes, name, getNextLogicObjectId()));
         RamsesCameraBinding* binding = up.get();
-        m_ramsesCameraBindings.push_back(binding);
         registerLogicObject(std::move(up));
         binding->m_impl.createRootProperties();
 
@@ -229,7 +388,6 @@ namespace rlogic::internal
         assert(m_featureLevel >= EFeatureLevel_02);
         std::unique_ptr<RamsesRenderPassBinding> up = std::make_unique<RamsesRenderPassBinding>(std::make_unique<RamsesRenderPassBindingImpl>(ramsesRenderPass, name, getNextLogicObjectId()));
         RamsesRenderPassBinding* binding = up.get();
-        m_ramsesRenderPassBindings.push_back(binding);
         registerLogicObject(std::move(up));
         binding->m_impl.createRootProperties();
 
@@ -241,7 +399,6 @@ namespace rlogic::internal
         assert(m_featureLevel >= EFeatureLevel_03);
         std::unique_ptr<RamsesRenderGroupBinding> up = std::make_unique<RamsesRenderGroupBinding>(std::make_unique<RamsesRenderGroupBindingImpl>(ramsesRenderGroup, *elements.m_impl, name, getNextLogicObjectId()));
         RamsesRenderGroupBinding* binding = up.get();
-        m_ramsesRenderGroupBindings.push_back(binding);
         registerLogicObject(std::move(up));
         binding->m_impl.createRootProperties();
 
@@ -253,7 +410,6 @@ namespace rlogic::internal
         assert(m_featureLevel >= EFeatureLevel_05);
         auto up = std::make_unique<RamsesMeshNodeBinding>(std::make_unique<RamsesMeshNodeBindingImpl>(ramsesMeshNode, name, getNextLogicObjectId()));
         RamsesMeshNodeBinding* binding = up.get();
-        m_ramsesMeshNodeBindings.push_back(binding);
         registerLogicObject(std::move(up));
         binding->m_impl.createRootProperties();
 
@@ -270,7 +426,6 @@ namespace rlogic::internal
         assert(m_featureLevel >= EFeatureLevel_04);
         std::unique_ptr<SkinBinding> up = std::make_unique<SkinBinding>(std::make_unique<SkinBindingImpl>(std::move(joints), inverseBindMatrices, appearanceBinding, jointMatInput, name, getNextLogicObjectId()));
         SkinBinding* binding = up.get();
-        m_skinBindings.push_back(binding);
         registerLogicObject(std::move(up));
         binding->m_impl.createRootProperties();
 
@@ -286,7 +441,6 @@ namespace rlogic::internal
         auto impl = std::make_unique<DataArrayImpl>(std::move(dataCopy), name, getNextLogicObjectId());
         std::unique_ptr<DataArray> up = std::make_unique<DataArray>(std::move(impl));
         DataArray* dataArray = up.get();
-        m_dataArrays.push_back(dataArray);
         registerLogicObject(std::move(up));
         return dataArray;
     }
@@ -296,7 +450,6 @@ namespace rlogic::internal
         std::unique_ptr<AnimationNode> up = std::make_unique<AnimationNode>(
             std::make_unique<AnimationNodeImpl>(config.getChannels(), config.getExposingOfChannelDataAsProperties(), name, getNextLogicObjectId()));
         AnimationNode* animation = up.get();
-        m_animationNodes.push_back(animation);
         registerLogicObject(std::move(up));
         animation->m_impl.createRootProperties();
 
@@ -307,7 +460,6 @@ namespace rlogic::internal
     {
         std::unique_ptr<TimerNode> up = std::make_unique<TimerNode>(std::make_unique<TimerNodeImpl>(name, getNextLogicObjectId()));
         TimerNode* timer = up.get();
-        m_timerNodes.push_back(timer);
         registerLogicObject(std::move(up));
         timer->m_impl.createRootProperties();
 
@@ -319,7 +471,6 @@ namespace rlogic::internal
         assert(m_featureLevel >= EFeatureLevel_02);
         std::unique_ptr<AnchorPoint> up = std::make_unique<AnchorPoint>(std::make_unique<AnchorPointImpl>(nodeBinding, cameraBinding, name, getNextLogicObjectId()));
         AnchorPoint* anchor = up.get();
-        m_anchorPoints.push_back(anchor);
         registerLogicObject(std::move(up));
         anchor->m_impl.createRootProperties();
 
@@ -408,166 +559,278 @@ namespace rlogic::internal
         return false;
     }
 
+    // Calls visitor for every logic object which given object refers to and which therefore can't be destroyed before it
+    template <typename Visitor>
+    static void VisitUsedObjects(const LogicObject& object, Visitor&& visitor)
+    {
+        if (const auto* animNode = dynamic_cast<const AnimationNode*>(&object))
+        {
+            for (const auto& channel : animNode->getChannels())
+            {
+                visitor(channel.timeStamps);
+                visitor(channel.keyframes);
+                if (channel.tangentsIn)
+                    visitor(channel.tangentsIn);
+                if (channel.tangentsOut)
+                    visitor(channel.tangentsOut);
+            }
+        }
+        else if (const auto* script = dynamic_cast<const LuaScript*>(&object))
+        {
+            for (const auto& module : script->m_script.getModules())
+                visitor(module.second);
+        }
+        else if (const auto* anchor = dynamic_cast<const AnchorPoint*>(&object))
+        {
+            visitor(&anchor->m_anchorPointImpl.getRamsesNodeBinding().getLogicObject());
+            visitor(&anchor->m_anchorPointImpl.getRamsesCameraBinding().getLogicObject());
+        }
+        else if (const auto* skin = dynamic_cast<const SkinBinding*>(&object))
+        {
+            for (const auto* joint : skin->m_skinBinding.getJoints())
+                visitor(&joint->getLogicObject());
+            visitor(&skin->m_skinBinding.getAppearanceBinding().getLogicObject());
+        }
+    }
+
+    bool ApiObjects::destroy(const std::vector<LogicObject*>& objects, ErrorReporting& errorReporting)
+    {
+        // validate whole batch first, nothing is destroyed if any object can't be destroyed
+        std::unordered_map<const LogicObject*, size_t> useCountsInBatch;
+        useCountsInBatch.reserve(objects.size());
+        for (const LogicObject* object : objects)
+        {
+            if (object == nullptr)
+            {
+                errorReporting.add("Failed to destroy objects: null object provided!", nullptr, EErrorType::IllegalArgument);
+                return false;
+            }
+            if (!contains(object))
+            {
+                errorReporting.add("Failed to destroy objects: can't find object in logic engine!", object, EErrorType::IllegalArgument);
+                return false;
+            }
+            if (!useCountsInBatch.emplace(object, 0u).second)
+            {
+                errorReporting.add(fmt::format("Failed to destroy objects: object '{}' provided more than once!", object->getName()), object, EErrorType::IllegalArgument);
+                return false;
+            }
+        }
+
+        for (const LogicObject* object : objects)
+        {
+            VisitUsedObjects(*object, [&useCountsInBatch](const LogicObject* usedObject) {
+                const auto it = useCountsInBatch.find(usedObject);
+                if (it != useCountsInBatch.end())
+                    ++it->second;
+            });
+        }
+
+        for (LogicObject* object : objects)
+        {
+            const auto useCount = m_objectUseCounts.find(object);
+            if (useCount != m_objectUseCounts.end() && useCount->second != useCountsInBatch[object])
+            {
+                // used by an object which is not destroyed, search it only to report it
+                for (const LogicObject* user : m_logicObjects)
+                {
+                    if (useCountsInBatch.count(user) != 0u)
+                        continue;
+
+                    bool isUser = false;
+                    VisitUsedObjects(*user, [object, &isUser](const LogicObject* usedObject) { isUser = isUser || (usedObject == object); });
+                    if (isUser)
+                    {
+                        errorReporting.add(fmt::format("Failed to destroy objects: '{}' is used by '{}' which is not destroyed", object->getName(), user->getName()), object, EErrorType::IllegalArgument);
+                        return false;
+                    }
+                }
+                assert(false && "Object use counts out of sync!");
+                return false;
+            }
+        }
+
+        // objects which are not used by any other object go first, they release their references to the rest
+        std::vector<LogicObject*> orderedObjects = objects;
+        std::stable_partition(orderedObjects.begin(), orderedObjects.end(), [this](const LogicObject* object) { return !isUsedByOtherObjects(*object); });
+        for (LogicObject* object : orderedObjects)
+        {
+            if (!destroy(*object, errorReporting))
+                return false;
+        }
+
+        return true;
+    }
+
     bool ApiObjects::destroyInternal(DataArray& dataArray, ErrorReporting& errorReporting)
     {
-        const auto it = std::find(m_dataArrays.cbegin(), m_dataArrays.cend(), &dataArray);
-        if (it == m_dataArrays.cend())
+        if (!contains(&dataArray))
         {
             errorReporting.add("Can't find data array in logic engine!", &dataArray, EErrorType::IllegalArgument);
             return false;
         }
-        for (const auto& animNode : m_animationNodes)
+
+        // users are only searched to report them
+        if (isUsedByOtherObjects(dataArray))
         {
-            for (const auto& channel : animNode->getChannels())
+            for (const auto& animNode : m_animationNodes)
             {
-                if (channel.timeStamps == &dataArray ||
-                    channel.keyframes == &dataArray ||
-                    channel.tangentsIn == &dataArray ||
-                    channel.tangentsOut == &dataArray)
+                for (const auto& channel : animNode->getChannels())
                 {
-                    errorReporting.add(fmt::format("Failed to destroy data array '{}', it is used in animation node '{}' channel '{}'", dataArray.getName(), animNode->getName(), channel.name), &dataArray, EErrorType::IllegalArgument);
-                    return false;
+                    if (channel.timeStamps == &dataArray ||
+                        channel.keyframes == &dataArray ||
+                        channel.tangentsIn == &dataArray ||
+                        channel.tangentsOut == &dataArray)
+                    {
+                        errorReporting.add(fmt::format("Failed to destroy data array '{}', it is used in animation node '{}' channel '{}'", dataArray.getName(), animNode->getName(), channel.name), &dataArray, EErrorType::IllegalArgument);
+                        return false;
+                    }
                 }
             }
         }
+
         unregisterLogicObject(dataArray);
-        m_dataArrays.erase(it);
         return true;
     }
 
     bool ApiObjects::destroyInternal(LuaScript& luaScript, ErrorReporting& errorReporting)
     {
-        auto scriptIter = std::find(m_scripts.begin(), m_scripts.end(), &luaScript);
-        if (scriptIter == m_scripts.end())
+        if (!contains(&luaScript))
         {
             errorReporting.add("Can't find script in logic engine!", &luaScript, EErrorType::IllegalArgument);
             return false;
         }
 
         unregisterLogicObject(luaScript);
-        m_scripts.erase(scriptIter);
         return true;
     }
 
     bool ApiObjects::destroyInternal(LuaInterface& luaInterface, ErrorReporting& errorReporting)
     {
-        auto interfaceIter = std::find(m_interfaces.begin(), m_interfaces.end(), &luaInterface);
-        if (interfaceIter == m_interfaces.end())
+        if (!contains(&luaInterface))
         {
             errorReporting.add("Can't find interface in logic engine!", &luaInterface, EErrorType::IllegalArgument);
             return false;
         }
 
         unregisterLogicObject(luaInterface);
-        m_interfaces.erase(interfaceIter);
         return true;
     }
 
     bool ApiObjects::destroyInternal(LuaModule& luaModule, ErrorReporting& errorReporting)
     {
-        const auto it = std::find(m_luaModules.cbegin(), m_luaModules.cend(), &luaModule);
-        if (it == m_luaModules.cend())
+        if (!contains(&luaModule))
         {
             errorReporting.add("Can't find Lua module in logic engine!", &luaModule, EErrorType::IllegalArgument);
             return false;
         }
-        for (const auto& script : m_scripts)
+
+        // users are only searched to report them
+        if (isUsedByOtherObjects(luaModule))
         {
-            for (const auto& moduleInUse : script->m_script.getModules())
+            for (const auto& script : m_scripts)
             {
-                if (moduleInUse.second == &luaModule)
+                for (const auto& moduleInUse : script->m_script.getModules())
                 {
-                    errorReporting.add(fmt::format("Failed to destroy LuaModule '{}', it is used in LuaScript '{}'", luaModule.getName(), script->getName()), &luaModule, EErrorType::IllegalArgument);
-                    return false;
+                    if (moduleInUse.second == &luaModule)
+                    {
+                        errorReporting.add(fmt::format("Failed to destroy LuaModule '{}', it is used in LuaScript '{}'", luaModule.getName(), script->getName()), &luaModule, EErrorType::IllegalArgument);
+                        return false;
+                    }
                 }
             }
         }
 
         unregisterLogicObject(luaModule);
-        m_luaModules.erase(it);
         return true;
     }
 
     bool ApiObjects::destroyInternal(RamsesNodeBinding& ramsesNodeBinding, ErrorReporting& errorReporting)
     {
-        auto nodeIter = std::find(m_ramsesNodeBindings.begin(), m_ramsesNodeBindings.end(), &ramsesNodeBinding);
-        if (nodeIter == m_ramsesNodeBindings.end())
+        if (!contains(&ramsesNodeBinding))
         {
             errorReporting.add("Can't find RamsesNodeBinding in logic engine!", &ramsesNodeBinding, EErrorType::IllegalArgument);
             return false;
         }
 
-        for (const auto& anchor : m_anchorPoints)
+        // users are only searched to report them
+        if (isUsedByOtherObjects(ramsesNodeBinding))
         {
-            if (anchor->m_anchorPointImpl.getRamsesNodeBinding().getId() == ramsesNodeBinding.getId())
+            for (const auto& anchor : m_anchorPoints)
             {
-                errorReporting.add(fmt::format("Failed to destroy Ramses node binding '{}', it is used in anchor point '{}'", ramsesNodeBinding.getName(), anchor->getName()), &ramsesNodeBinding, EErrorType::Other);
-                return false;
+                if (anchor->m_anchorPointImpl.getRamsesNodeBinding().getId() == ramsesNodeBinding.getId())
+                {
+                    errorReporting.add(fmt::format("Failed to destroy Ramses node binding '{}', it is used in anchor point '{}'", ramsesNodeBinding.getName(), anchor->getName()), &ramsesNodeBinding, EErrorType::Other);
+                    return false;
+                }
             }
-        }
 
-        for (const auto& skin : m_skinBindings)
-        {
-            for (const auto node : skin->m_skinBinding.getJoints())
+            for (const auto& skin : m_skinBindings)
             {
-                if (node->getId() == ramsesNodeBinding.getId())
+                for (const auto node : skin->m_skinBinding.getJoints())
                 {
-                    errorReporting.add(fmt::format("Failed to destroy Ramses node binding '{}', it is used in skin binding '{}'", ramsesNodeBinding.getName(), skin->getName()), &ramsesNodeBinding, EErrorType::Other);
-                    return false;
+                    if (node->getId() == ramsesNodeBinding.getId())
+                    {
+                        errorReporting.add(fmt::format("Failed to destroy Ramses node binding '{}', it is used in skin binding '{}'", ramsesNodeBinding.getName(), skin->getName()), &ramsesNodeBinding, EErrorType::Other);
+                        return false;
+                    }
                 }
             }
         }
 
         unregisterLogicObject(ramsesNodeBinding);
-        m_ramsesNodeBindings.erase(nodeIter);
 
         return true;
     }
 
     bool ApiObjects::destroyInternal(RamsesAppearanceBinding& ramsesAppearanceBinding, ErrorReporting& errorReporting)
     {
-        auto appearanceIter = std::find(m_ramsesAppearanceBindings.begin(), m_ramsesAppearanceBindings.end(), &ramsesAppearanceBinding);
-        if (appearanceIter == m_ramsesAppearanceBindings.end())
+        if (!contains(&ramsesAppearanceBinding))
         {
             errorReporting.add("Can't find RamsesAppearanceBinding in logic engine!", &ramsesAppearanceBinding, EErrorType::IllegalArgument);
             return false;
         }
 
-        for (const auto& skin : m_skinBindings)
+        // users are only searched to report them
+        if (isUsedByOtherObjects(ramsesAppearanceBinding))
         {
-            if (skin->m_skinBinding.getAppearanceBinding().getId() == ramsesAppearanceBinding.getId())
+            for (const auto& skin : m_skinBindings)
             {
-                errorReporting.add(fmt::format("Failed to destroy Ramses appearance binding '{}', it is used in skin binding '{}'", ramsesAppearanceBinding.getName(), skin->getName()), &ramsesAppearanceBinding, EErrorType::Other);
-                return false;
+                if (skin->m_skinBinding.getAppearanceBinding().getId() == ramsesAppearanceBinding.getId())
+                {
+                    errorReporting.add(fmt::format("Failed to destroy Ramses appearance binding '{}', it is used in skin binding '{}'", ramsesAppearanceBinding.getName(), skin->getName()), &ramsesAppearanceBinding, EErrorType::Other);
+                    return false;
+                }
             }
         }
 
         unregisterLogicObject(ramsesAppearanceBinding);
-        m_ramsesAppearanceBindings.erase(appearanceIter);
 
         return true;
     }
 
     bool ApiObjects::destroyInternal(RamsesCameraBinding& ramsesCameraBinding, ErrorReporting& errorReporting)
     {
-        auto cameraIter = std::find(m_ramsesCameraBindings.begin(), m_ramsesCameraBindings.end(), &ramsesCameraBinding);
-        if (cameraIter == m_ramsesCameraBindings.end())
+        if (!contains(&ramsesCameraBinding))
         {
             errorReporting.add("Can't find RamsesCameraBinding in logic engine!", &ramsesCameraBinding, EErrorType::IllegalArgument);
             return false;
         }
 
-        for (const auto& anchor : m_anchorPoints)
+        // users are only searched to report them
+        if (isUsedByOtherObjects(ramsesCameraBinding))
         {
-            if (anchor->m_anchorPointImpl.getRamsesCameraBinding().getId() == ramsesCameraBinding.getId())
+            for (const auto& anchor : m_anchorPoints)
             {
-                errorReporting.add(fmt::format("Failed to destroy Ramses camera binding '{}', it is used in anchor point '{}'", ramsesCameraBinding.getName(), anchor->getName()), &ramsesCameraBinding, EErrorType::Other);
-                return false;
+                if (anchor->m_anchorPointImpl.getRamsesCameraBinding().getId() == ramsesCameraBinding.getId())
+                {
+                    errorReporting.add(fmt::format("Failed to destroy Ramses camera binding '{}', it is used in anchor point '{}'", ramsesCameraBinding.getName(), anchor->getName()), &ramsesCameraBinding, EErrorType::Other);
+                    return false;
+                }
             }
         }
 
         unregisterLogicObject(ramsesCameraBinding);
-        m_ramsesCameraBindings.erase(cameraIter);
 
         return true;
     }
@@ -575,15 +838,13 @@ namespace rlogic::internal
     bool ApiObjects::destroyInternal(RamsesRenderPassBinding& ramsesRenderPassBinding, ErrorReporting& errorReporting)
     {
         assert(m_featureLevel >= EFeatureLevel_02);
-        auto bindingIter = std::find(m_ramsesRenderPassBindings.begin(), m_ramsesRenderPassBindings.end(), &ramsesRenderPassBinding);
-        if (bindingIter == m_ramsesRenderPassBindings.end())
+        if (!contains(&ramsesRenderPassBinding))
         {
             errorReporting.add("Can't find RamsesRenderPassBinding in logic engine!", &ramsesRenderPassBinding, EErrorType::IllegalArgument);
             return false;
         }
 
         unregisterLogicObject(ramsesRenderPassBinding);
-        m_ramsesRenderPassBindings.erase(bindingIter);
 
         return true;
     }
@@ -591,15 +852,13 @@ namespace rlogic::internal
     bool ApiObjects::destroyInternal(RamsesRenderGroupBinding& ramsesRenderGroupBinding, ErrorReporting& errorReporting)
     {
         assert(m_featureLevel >= EFeatureLevel_03);
-        auto bindingIter = std::find(m_ramsesRenderGroupBindings.begin(), m_ramsesRenderGroupBindings.end(), &ramsesRenderGroupBinding);
-        if (bindingIter == m_ramsesRenderGroupBindings.end())
+        if (!contains(&ramsesRenderGroupBinding))
         {
             errorReporting.add("Can't find RamsesRenderGroupBinding in logic engine!", &ramsesRenderGroupBinding, EErrorType::IllegalArgument);
             return false;
         }
 
         unregisterLogicObject(ramsesRenderGroupBinding);
-        m_ramsesRenderGroupBindings.erase(bindingIter);
 
         return true;
     }
@@ -607,15 +866,13 @@ namespace rlogic::internal
     bool ApiObjects::destroyInternal(RamsesMeshNodeBinding& ramsesMeshNodeBinding, ErrorReporting& errorReporting)
     {
         assert(m_featureLevel >= EFeatureLevel_05);
-        auto bindingIter = std::find(m_ramsesMeshNodeBindings.begin(), m_ramsesMeshNodeBindings.end(), &ramsesMeshNodeBinding);
-        if (bindingIter == m_ramsesMeshNodeBindings.end())
+        if (!contains(&ramsesMeshNodeBinding))
         {
             errorReporting.add("Can't find RamsesMeshNodeBinding in logic engine!", &ramsesMeshNodeBinding, EErrorType::IllegalArgument);
             return false;
         }
 
         unregisterLogicObject(ramsesMeshNodeBinding);
-        m_ramsesMeshNodeBindings.erase(bindingIter);
 
         return true;
     }
@@ -623,45 +880,39 @@ namespace rlogic::internal
     bool ApiObjects::destroyInternal(SkinBinding& skinBinding, ErrorReporting& errorReporting)
     {
         assert(m_featureLevel >= EFeatureLevel_04);
-        auto bindingIter = std::find(m_skinBindings.begin(), m_skinBindings.end(), &skinBinding);
-        if (bindingIter == m_skinBindings.end())
+        if (!contains(&skinBinding))
         {
             errorReporting.add("Can't find SkinBinding in logic engine!", &skinBinding, EErrorType::IllegalArgument);
             return false;
         }
 
         unregisterLogicObject(skinBinding);
-        m_skinBindings.erase(bindingIter);
 
         return true;
     }
 
     bool ApiObjects::destroyInternal(AnimationNode& node, ErrorReporting& errorReporting)
     {
-        auto nodeIt = std::find(m_animationNodes.begin(), m_animationNodes.end(), &node);
-        if (nodeIt == m_animationNodes.end())
+        if (!contains(&node))
         {
             errorReporting.add("Can't find AnimationNode in logic engine!", &node, EErrorType::IllegalArgument);
             return false;
         }
 
         unregisterLogicObject(node);
-        m_animationNodes.erase(nodeIt);
 
         return true;
     }
 
     bool ApiObjects::destroyInternal(TimerNode& node, ErrorReporting& errorReporting)
     {
-        auto nodeIt = std::find(m_timerNodes.begin(), m_timerNodes.end(), &node);
-        if (nodeIt == m_timerNodes.end())
+        if (!contains(&node))
         {
             errorReporting.add("Can't find TimerNode in logic engine!", &node, EErrorType::IllegalArgument);
             return false;
         }
 
         unregisterLogicObject(node);
-        m_timerNodes.erase(nodeIt);
 
         return true;
     }
@@ -669,8 +920,7 @@ namespace rlogic::internal
     bool ApiObjects::destroyInternal(AnchorPoint& node, ErrorReporting& errorReporting)
     {
         assert(m_featureLevel >= EFeatureLevel_02);
-        auto nodeIt = std::find(m_anchorPoints.begin(), m_anchorPoints.end(), &node);
-        if (nodeIt == m_anchorPoints.end())
+        if (!contains(&node))
         {
             errorReporting.add("Can't find AnchorPoint in logic engine!", &node, EErrorType::IllegalArgument);
             return false;
@@ -680,39 +930,103 @@ namespace rlogic::internal
         m_logicNodeDependencies.removeBindingDependency(node.m_anchorPointImpl.getRamsesCameraBinding(), node.m_impl);
 
         unregisterLogicObject(node);
-        m_anchorPoints.erase(nodeIt);
 
         return true;
     }
 
-    void ApiObjects::registerLogicObject(std::unique_ptr<LogicObject> obj)
+    template <typename T>
+    void ApiObjects::registerLogicObject(std::unique_ptr<T> obj)
     {
+        // LogicNode hides LogicObject::m_impl, access through base
+        LogicObject& logicObject = *obj;
+
+        ApiObjectContainer<T>& container = getApiObjectContainer<T>();
+        container.push_back(obj.get());
         m_logicObjects.push_back(obj.get());
-        obj->m_impl->setLogicObject(*obj);
+        logicObject.m_impl->setLogicObject(logicObject);
 
         auto logicNode = dynamic_cast<LogicNode*>(obj.get());
         if (logicNode)
             registerLogicNode(*logicNode);
 
-        m_logicObjectIdMapping.emplace(obj->getId(), obj.get());
-        m_objectsOwningContainer.push_back(move(obj));
+        m_logicObjectIdMapping.emplace(logicObject.getId(), obj.get());
+        m_logicObjectNameIndex.add(logicObject);
+        logicObject.m_impl->setNameIndex(&m_logicObjectNameIndex);
+        m_objectSlots.emplace(obj.get(), ObjectSlots{ m_logicObjects.size() - 1u, container.size() - 1u });
+        addUsedObjects(logicObject);
+        m_objectsOwningContainer.push_back(std::move(obj));
+    }
+
+    template <typename T>
+    void ApiObjects::removeFromContainer(ApiObjectContainer<T>& container, size_t index)
+    {
+        assert(index < container.size());
+        if (index + 1u != container.size())
+        {
+            container[index] = container.back();
+            m_objectSlots[container[index]].typedIndex = index;
+        }
+        container.pop_back();
     }
 
-    void ApiObjects::unregisterLogicObject(LogicObject& objToDelete)
+    template <typename T>
+    void ApiObjects::unregisterLogicObject(T& objToDelete)
     {
-        const auto findOwnedObj = std::find_if(m_objectsOwningContainer.cbegin(), m_objectsOwningContainer.cend(), [&](const auto& obj) { return obj.get() == &objToDelete; });
-        assert(findOwnedObj != m_objectsOwningContainer.cend() && "Can't find LogicObject in owned objects!");
+        LogicObject& logicObject = objToDelete;
 
-        const auto findLogicNode = std::find(m_logicObjects.cbegin(), m_logicObjects.cend(), &objToDelete);
-        assert(findLogicNode != m_logicObjects.cend() && "Can't find LogicObject in logic objects!");
+        const auto slotIt = m_objectSlots.find(&logicObject);
+        assert(slotIt != m_objectSlots.end() && "Can't find LogicObject in logic objects!");
+        const ObjectSlots slots = slotIt->second;
+        m_objectSlots.erase(slotIt);
+        assert(m_logicObjects[slots.index] == &logicObject);
+        assert(m_objectsOwningContainer[slots.index].get() == &logicObject);
 
-        auto logicNode = dynamic_cast<LogicNode*>(&objToDelete);
+        auto logicNode = dynamic_cast<LogicNode*>(&logicObject);
         if (logicNode)
             unregisterLogicNode(*logicNode);
 
-        m_logicObjectIdMapping.erase(objToDelete.getId());
-        m_objectsOwningContainer.erase(findOwnedObj);
-        m_logicObjects.erase(findLogicNode);
+        m_logicObjectIdMapping.erase(logicObject.getId());
+        m_logicObjectNameIndex.remove(logicObject);
+        logicObject.m_impl->setNameIndex(nullptr);
+        removeUsedObjects(logicObject);
+
+        removeFromContainer(getApiObjectContainer<T>(), slots.typedIndex);
+
+        // owning container is parallel to m_logicObjects, popping its last element deletes the object
+        const size_t lastIndex = m_logicObjects.size() - 1u;
+        if (slots.index != lastIndex)
+        {
+            m_logicObjects[slots.index] = m_logicObjects[lastIndex];
+            std::swap(m_objectsOwningContainer[slots.index], m_objectsOwningContainer[lastIndex]);
+            m_objectSlots[m_logicObjects[slots.index]].index = slots.index;
+        }
+        m_logicObjects.pop_back();
+        m_objectsOwningContainer.pop_back();
+    }
+
+    bool ApiObjects::contains(const LogicObject* object) const
+    {
+        return m_objectSlots.count(object) != 0u;
+    }
+
+    void ApiObjects::addUsedObjects(LogicObject& object)
+    {
+        VisitUsedObjects(object, [this](const LogicObject* usedObject) { ++m_objectUseCounts[usedObject]; });
+    }
+
+    void ApiObjects::removeUsedObjects(LogicObject& object)
+    {
+        VisitUsedObjects(object, [this](const LogicObject* usedObject) {
+            const auto it = m_objectUseCounts.find(usedObject);
+            assert(it != m_objectUseCounts.end());
+            if (--it->second == 0u)
+                m_objectUseCounts.erase(it);
+        });
+    }
+
+    bool ApiObjects::isUsedByOtherObjects(const LogicObject& object) const
+    {
+        return m_objectUseCounts.count(&object) != 0u;
     }
 
     bool ApiObjects::checkBindingsReferToSameRamsesScene(ErrorReporting& errorReporting) const
@@ -1023,7 +1337,7 @@ namespace rlogic::internal
         return m_reverseImplMapping;
     }
 
-    flatbuffers::Offset<rlogic_serialization::ApiObjects> ApiObjects::Serialize(const ApiObjects& apiObjects, flatbuffers::FlatBufferBuilder& builder, ELuaSavingMode luaSavingMode)
+    flatbuffers::Offset<rlogic_serialization::ApiObjects> ApiObjects::Serialize(const ApiObjects& apiObjects, flatbuffers::FlatBufferBuilder& builder, ELuaSavingMode luaSavingMode, EDataArrayCompression dataArrayCompression)
     {
         SerializationMap serializationMap;
 
@@ -1035,8 +1349,8 @@ namespace rlogic::internal
         std::vector<flatbuffers::Offset<rlogic_serialization::LuaScript>> luascripts;
         luascripts.reserve(apiObjects.m_scripts.size());
         std::transform(apiObjects.m_scripts.begin(), apiObjects.m_scripts.end(), std::back_inserter(luascripts),
-            [&builder, &serializationMap, luaSavingMode](const std::vector<LuaScript*>::value_type& it) {
-                return LuaScriptImpl::Serialize(it->m_script, builder, serializationMap, luaSavingMode);
+            [&builder, &serializationMap, luaSavingMode, featureLevel = apiObjects.m_featureLevel](const std::vector<LuaScript*>::value_type& it) {
+                return LuaScriptImpl::Serialize(it->m_script, builder, serializationMap, luaSavingMode, featureLevel);
             });
 
         std::vector<flatbuffers::Offset<rlogic_serialization::LuaInterface>> luaInterfaces;
@@ -1083,11 +1397,17 @@ namespace rlogic::internal
             });
         assert(apiObjects.m_featureLevel >= EFeatureLevel_02 || ramsesrenderpassbindings.empty());
 
+        assert(apiObjects.m_featureLevel >= EFeatureLevel_07 || dataArrayCompression == EDataArrayCompression::None);
+        const auto dataArrayEncodings = (dataArrayCompression == EDataArrayCompression::QuantizedKeyframes ?
+            DetermineDataArrayEncodings(apiObjects.m_animationNodes) : std::unordered_map<const DataArray*, EDataArrayEncoding>{});
+
         std::vector<flatbuffers::Offset<rlogic_serialization::DataArray>> dataArrays;
         dataArrays.reserve(apiObjects.m_dataArrays.size());
         for (const auto& da : apiObjects.m_dataArrays)
         {
-            dataArrays.push_back(DataArrayImpl::Serialize(da->m_impl, builder, serializationMap, apiObjects.m_featureLevel));
+            const auto encodingIt = dataArrayEncodings.find(da);
+            const EDataArrayEncoding encoding = (encodingIt != dataArrayEncodings.cend() ? encodingIt->second : EDataArrayEncoding::Full);
+            dataArrays.push_back(DataArrayImpl::Serialize(da->m_impl, builder, serializationMap, apiObjects.m_featureLevel, encoding));
             serializationMap.storeDataArray(da->getId(), dataArrays.back());
         }
 
@@ -1095,7 +1415,7 @@ namespace rlogic::internal
         std::vector<flatbuffers::Offset<rlogic_serialization::AnimationNode>> animationNodes;
         animationNodes.reserve(apiObjects.m_animationNodes.size());
         for (const auto& animNode : apiObjects.m_animationNodes)
-            animationNodes.push_back(AnimationNodeImpl::Serialize(animNode->m_animationNodeImpl, builder, serializationMap));
+            animationNodes.push_back(AnimationNodeImpl::Serialize(animNode->m_animationNodeImpl, builder, serializationMap, apiObjects.m_featureLevel));
 
         std::vector<flatbuffers::Offset<rlogic_serialization::TimerNode>> timerNodes;
         timerNodes.reserve(apiObjects.m_timerNodes.size());
@@ -1128,15 +1448,17 @@ namespace rlogic::internal
         assert(apiObjects.m_featureLevel >= EFeatureLevel_04 || skinBindings.empty());
 
         // links must go last due to dependency on serialized properties
-        const auto collectedLinks = apiObjects.collectPropertyLinks();
+        const auto& allLinks = apiObjects.m_logicNodeDependencies.getLinks();
         std::vector<flatbuffers::Offset<rlogic_serialization::Link>> links;
-        links.reserve(collectedLinks.size());
-        for (const auto& link : collectedLinks)
+        links.reserve(allLinks.size());
+        for (const auto& link : allLinks)
         {
             links.push_back(rlogic_serialization::CreateLink(builder,
                 serializationMap.resolvePropertyOffset(*link.source->m_impl),
                 serializationMap.resolvePropertyOffset(*link.target->m_impl),
-                link.isWeakLink));
+                link.isWeakLink,
+                serializationMap.resolvePropertyIndex(*link.source->m_impl),
+                serializationMap.resolvePropertyIndex(*link.target->m_impl)));
         }
 
         const auto fbModules = builder.CreateVector(luaModules);
@@ -1185,13 +1507,28 @@ namespace rlogic::internal
         const IRamsesObjectResolver* ramsesResolver,
         const std::string& dataSourceDescription,
         ErrorReporting& errorReporting,
-        EFeatureLevel featureLevel)
+        EFeatureLevel featureLevel,
+        size_t luaStateCount,
+        ThreadPool* threadPool,
+        DeserializationTimings* timings,
+        bool lazyLuaScripts)
     {
+        DeserializationTimings unusedTimings;
+        DeserializationTimings& phaseTimings = (timings ? *timings : unusedTimings);
+        auto phaseStart = std::chrono::steady_clock::now();
+        const auto finishPhase = [&phaseStart](std::chrono::microseconds& phaseDuration) {
+            const auto now = std::chrono::steady_clock::now();
+            phaseDuration = std::chrono::duration_cast<std::chrono::microseconds>(now - phaseStart);
+            phaseStart = now;
+        };
+
         // Collect data here, only return if no error occurred
         auto deserialized = std::make_unique<ApiObjects>(featureLevel);
+        if (!deserialized->setLuaStateCount(luaStateCount, errorReporting))
+            return nullptr;
 
         // Collect deserialized object mappings to resolve dependencies
-        DeserializationMap deserializationMap;
+        DeserializationMap deserializationMap{ featureLevel };
 
         if (!apiObjects.luaModules())
         {
@@ -1303,6 +1640,7 @@ namespace rlogic::internal
 
         deserialized->m_objectsOwningContainer.reserve(logicObjectsTotalSize);
         deserialized->m_logicObjects.reserve(logicObjectsTotalSize);
+        deserialized->m_objectSlots.reserve(logicObjectsTotalSize);
 
         const auto& luaModules = *apiObjects.luaModules();
         deserialized->m_luaModules.reserve(luaModules.size());
@@ -1314,51 +1652,123 @@ namespace rlogic::internal
 
             std::unique_ptr<LuaModule> up        = std::make_unique<LuaModule>(std::move(deserializedModule));
             LuaModule*                 luaModule = up.get();
-            deserialized->m_luaModules.push_back(luaModule);
             deserialized->registerLogicObject(std::move(up));
             deserializationMap.storeLogicObject(luaModule->getId(), deserialized->m_luaModules.back()->m_impl);
         }
 
+        finishPhase(phaseTimings.luaModules);
+
         const auto& luascripts = *apiObjects.luaScripts();
+        const auto& luaInterfaces = *apiObjects.luaInterfaces();
+        const auto& dataArrays = *apiObjects.dataArrays();
+
+        // Objects which need neither a Lua state nor Ramses objects are deserialized upfront (concurrently if thread pool is provided),
+        // they are registered in their original order below
+        std::vector<std::optional<LuaScriptDeserializedData>> scriptsData(luascripts.size());
+        std::vector<std::unique_ptr<LuaInterfaceImpl>> deserializedInterfaces(luaInterfaces.size());
+        std::vector<std::unique_ptr<DataArrayImpl>> deserializedDataArrays(dataArrays.size());
+
+        ChunkedDeserialization independentObjects(threadPool);
+        const size_t scriptObjects = independentObjects.addObjects(luascripts.size(),
+            [&luascripts, &scriptsData](size_t idx, ErrorReporting& chunkErrors, DeserializationMap& chunkDeserializationMap) {
+                // TODO Violin find ways to unit-test this case - also for other container types
+                // Ideas: see if verifier catches it; or: disable flatbuffer's internal asserts if possible
+                const auto* script = luascripts.Get(static_cast<flatbuffers::uoffset_t>(idx));
+                assert(script);
+                scriptsData[idx] = LuaScriptImpl::DeserializeData(*script, chunkErrors, chunkDeserializationMap);
+                return scriptsData[idx].has_value();
+            });
+        const size_t interfaceObjects = independentObjects.addObjects(luaInterfaces.size(),
+            [&luaInterfaces, &deserializedInterfaces](size_t idx, ErrorReporting& chunkErrors, DeserializationMap& chunkDeserializationMap) {
+                const auto* intf = luaInterfaces.Get(static_cast<flatbuffers::uoffset_t>(idx));
+                assert(intf);
+                deserializedInterfaces[idx] = LuaInterfaceImpl::Deserialize(*intf, chunkErrors, chunkDeserializationMap);
+                return deserializedInterfaces[idx] != nullptr;
+            });
+        const size_t dataArrayObjects = independentObjects.addObjects(dataArrays.size(),
+            [&dataArrays, &deserializedDataArrays](size_t idx, ErrorReporting& chunkErrors, DeserializationMap& /*chunkDeserializationMap*/) {
+                const auto* fbData = dataArrays.Get(static_cast<flatbuffers::uoffset_t>(idx));
+                assert(fbData);
+                deserializedDataArrays[idx] = DataArrayImpl::Deserialize(*fbData, chunkErrors);
+                return deserializedDataArrays[idx] != nullptr;
+            });
+        independentObjects.execute(deserializationMap);
+
+        finishPhase(phaseTimings.independentObjects);
+
+        // Lua state assignment must not depend on concurrent loading
+        std::vector<SolState*> scriptSolStates(luascripts.size());
+        for (auto& solState : scriptSolStates)
+            solState = &deserialized->getSolStateForNextScript();
+
+        // Scripts in different Lua states can be loaded concurrently, modules they use are loaded into those Lua states beforehand
+        // because module instances are shared by scripts. If this fails, scripts are loaded sequentially which reports proper errors.
+        std::vector<std::unique_ptr<LuaScriptImpl>> deserializedScripts(luascripts.size());
+        std::vector<ErrorReporting> luaStateErrors;
+        const size_t scriptLuaStateCount = deserialized->getLuaStateCount();
+        bool loadScriptsConcurrently = (!lazyLuaScripts && threadPool != nullptr && scriptLuaStateCount > 1u && luascripts.size() > 1u);
+        for (size_t scriptIdx = 0u; loadScriptsConcurrently && scriptIdx < scriptsData.size() && scriptsData[scriptIdx]; ++scriptIdx)
+            loadScriptsConcurrently = InstantiateModulesForScript(*scriptsData[scriptIdx], *scriptSolStates[scriptIdx], featureLevel);
+        if (loadScriptsConcurrently)
+        {
+            // scripts are assigned to Lua states in round robin fashion
+            luaStateErrors.resize(std::min<size_t>(scriptLuaStateCount, luascripts.size()));
+            threadPool->execute(luaStateErrors.size(), [&](size_t luaStateIdx) {
+                for (size_t scriptIdx = luaStateIdx; scriptIdx < scriptsData.size(); scriptIdx += scriptLuaStateCount)
+                {
+                    assert(scriptSolStates[scriptIdx] == scriptSolStates[luaStateIdx]);
+                    if (!scriptsData[scriptIdx])
+                        return;
+                    deserializedScripts[scriptIdx] = LuaScriptImpl::Instantiate(*scriptSolStates[scriptIdx], std::move(*scriptsData[scriptIdx]), luaStateErrors[luaStateIdx], featureLevel);
+                    if (!deserializedScripts[scriptIdx])
+                        return;
+                }
+            }, []() {});
+        }
+
         deserialized->m_scripts.reserve(luascripts.size());
-        for (const auto* script : luascripts)
+        for (size_t scriptIdx = 0u; scriptIdx < scriptsData.size(); ++scriptIdx)
         {
-            // TODO Violin find ways to unit-test this case - also for other container types
-            // Ideas: see if verifier catches it; or: disable flatbuffer's internal asserts if possible
-            assert (script);
-            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(*deserialized->m_solState, *script, errorReporting, deserializationMap, featureLevel);
+            if (!scriptsData[scriptIdx])
+            {
+                independentObjects.reportErrors(scriptObjects, scriptIdx, errorReporting);
+                return nullptr;
+            }
 
-            if (deserializedScript)
+            // modules are loaded right away also for lazily loaded scripts, so that scripts of different Lua states
+            // can be loaded concurrently during update
+            if (lazyLuaScripts && InstantiateModulesForScript(*scriptsData[scriptIdx], *scriptSolStates[scriptIdx], featureLevel))
             {
-                std::unique_ptr<LuaScript> up             = std::make_unique<LuaScript>(std::move(deserializedScript));
-                LuaScript*                 luascript = up.get();
-                deserialized->m_scripts.push_back(luascript);
-                deserialized->registerLogicObject(std::move(up));
+                deserializedScripts[scriptIdx] = std::make_unique<LuaScriptImpl>(std::move(*scriptsData[scriptIdx]), *scriptSolStates[scriptIdx], featureLevel);
             }
-            else
+            else if (!loadScriptsConcurrently)
             {
-                return nullptr;
+                deserializedScripts[scriptIdx] = LuaScriptImpl::Instantiate(*scriptSolStates[scriptIdx], std::move(*scriptsData[scriptIdx]), errorReporting, featureLevel);
             }
+            else if (!deserializedScripts[scriptIdx])
+            {
+                for (const auto& error : luaStateErrors[scriptIdx % scriptLuaStateCount].getErrors())
+                    errorReporting.add(error.message, error.object, error.type);
+            }
+
+            if (!deserializedScripts[scriptIdx])
+                return nullptr;
+
+            deserialized->registerLogicObject(std::make_unique<LuaScript>(std::move(deserializedScripts[scriptIdx])));
         }
 
-        const auto& luaInterfaces = *apiObjects.luaInterfaces();
+        finishPhase(phaseTimings.luaScripts);
+
         deserialized->m_interfaces.reserve(luaInterfaces.size());
-        for (const auto* intf : luaInterfaces)
+        for (size_t intfIdx = 0u; intfIdx < deserializedInterfaces.size(); ++intfIdx)
         {
-            assert(intf);
-            std::unique_ptr<LuaInterfaceImpl> deserializedInterface = LuaInterfaceImpl::Deserialize(*intf, errorReporting, deserializationMap);
-
-            if (deserializedInterface)
-            {
-                std::unique_ptr<LuaInterface> up = std::make_unique<LuaInterface>(std::move(deserializedInterface));
-                LuaInterface* luaInterface = up.get();
-                deserialized->m_interfaces.push_back(luaInterface);
-                deserialized->registerLogicObject(std::move(up));
-            }
-            else
+            if (!deserializedInterfaces[intfIdx])
             {
+                independentObjects.reportErrors(interfaceObjects, intfIdx, errorReporting);
                 return nullptr;
             }
+
+            deserialized->registerLogicObject(std::make_unique<LuaInterface>(std::move(deserializedInterfaces[intfIdx])));
         }
 
         if (apiObjects.nodeBindings()->size() != 0u ||
@@ -1387,7 +1797,6 @@ namespace rlogic::internal
             {
                 std::unique_ptr<RamsesNodeBinding> up = std::make_unique<RamsesNodeBinding>(std::move(deserializedBinding));
                 RamsesNodeBinding* nodeBinding = up.get();
-                deserialized->m_ramsesNodeBindings.push_back(nodeBinding);
                 deserialized->registerLogicObject(std::move(up));
                 deserializationMap.storeLogicObject(nodeBinding->getId(), nodeBinding->m_nodeBinding);
             }
@@ -1409,7 +1818,6 @@ namespace rlogic::internal
             {
                 std::unique_ptr<RamsesAppearanceBinding> up      = std::make_unique<RamsesAppearanceBinding>(std::move(deserializedBinding));
                 RamsesAppearanceBinding*                 appBinding = up.get();
-                deserialized->m_ramsesAppearanceBindings.push_back(appBinding);
                 deserialized->registerLogicObject(std::move(up));
                 deserializationMap.storeLogicObject(appBinding->getId(), appBinding->m_appearanceBinding);
             }
@@ -1431,7 +1839,6 @@ namespace rlogic::internal
             {
                 std::unique_ptr<RamsesCameraBinding> up      = std::make_unique<RamsesCameraBinding>(std::move(deserializedBinding));
                 RamsesCameraBinding*                 camBinding = up.get();
-                deserialized->m_ramsesCameraBindings.push_back(camBinding);
                 deserialized->registerLogicObject(std::move(up));
                 deserializationMap.storeLogicObject(camBinding->getId(), camBinding->m_cameraBinding);
             }
@@ -1454,8 +1861,6 @@ namespace rlogic::internal
                 if (deserializedBinding)
                 {
                     std::unique_ptr<RamsesRenderPassBinding> up = std::make_unique<RamsesRenderPassBinding>(std::move(deserializedBinding));
-                    RamsesRenderPassBinding* rpBinding = up.get();
-                    deserialized->m_ramsesRenderPassBindings.push_back(rpBinding);
                     deserialized->registerLogicObject(std::move(up));
                 }
                 else
@@ -1465,20 +1870,18 @@ namespace rlogic::internal
             }
         }
 
-        const auto& dataArrays = *apiObjects.dataArrays();
         deserialized->m_dataArrays.reserve(dataArrays.size());
-        for (const auto* fbData : dataArrays)
+        for (size_t dataArrayIdx = 0u; dataArrayIdx < deserializedDataArrays.size(); ++dataArrayIdx)
         {
-            assert(fbData);
-            auto deserializedDataArray = DataArrayImpl::Deserialize(*fbData, errorReporting);
-            if (!deserializedDataArray)
+            if (!deserializedDataArrays[dataArrayIdx])
+            {
+                independentObjects.reportErrors(dataArrayObjects, dataArrayIdx, errorReporting);
                 return nullptr;
+            }
 
-            std::unique_ptr<DataArray> up        = std::make_unique<DataArray>(std::move(deserializedDataArray));
-            DataArray*                 dataArray = up.get();
-            deserialized->m_dataArrays.push_back(dataArray);
+            std::unique_ptr<DataArray> up        = std::make_unique<DataArray>(std::move(deserializedDataArrays[dataArrayIdx]));
             deserialized->registerLogicObject(std::move(up));
-            deserializationMap.storeDataArray(*fbData, *deserialized->m_dataArrays.back());
+            deserializationMap.storeDataArray(*dataArrays.Get(static_cast<flatbuffers::uoffset_t>(dataArrayIdx)), *deserialized->m_dataArrays.back());
         }
 
         // animation nodes must go after data arrays because they need to resolve references
@@ -1492,8 +1895,6 @@ namespace rlogic::internal
                 return nullptr;
 
             std::unique_ptr<AnimationNode> up        = std::make_unique<AnimationNode>(std::move(deserializedAnimNode));
-            AnimationNode*                 animation = up.get();
-            deserialized->m_animationNodes.push_back(animation);
             deserialized->registerLogicObject(std::move(up));
         }
 
@@ -1507,7 +1908,6 @@ namespace rlogic::internal
                 return nullptr;
 
             auto up = std::make_unique<TimerNode>(std::move(deserializedTimer));
-            deserialized->m_timerNodes.push_back(up.get());
             deserialized->registerLogicObject(std::move(up));
         }
 
@@ -1525,8 +1925,6 @@ namespace rlogic::internal
                 if (deserializedAnchor)
                 {
                     auto up = std::make_unique<AnchorPoint>(std::move(deserializedAnchor));
-                    AnchorPoint* anchor = up.get();
-                    deserialized->m_anchorPoints.push_back(anchor);
                     deserialized->registerLogicObject(std::move(up));
                 }
                 else
@@ -1549,8 +1947,6 @@ namespace rlogic::internal
                 if (deserializedBinding)
                 {
                     std::unique_ptr<RamsesRenderGroupBinding> up = std::make_unique<RamsesRenderGroupBinding>(std::move(deserializedBinding));
-                    RamsesRenderGroupBinding* rgBinding = up.get();
-                    deserialized->m_ramsesRenderGroupBindings.push_back(rgBinding);
                     deserialized->registerLogicObject(std::move(up));
                 }
                 else
@@ -1573,8 +1969,6 @@ namespace rlogic::internal
                 if (deserializedBinding)
                 {
                     std::unique_ptr<SkinBinding> up = std::make_unique<SkinBinding>(std::move(deserializedBinding));
-                    SkinBinding* skinBinding = up.get();
-                    deserialized->m_skinBindings.push_back(skinBinding);
                     deserialized->registerLogicObject(std::move(up));
                 }
                 else
@@ -1597,8 +1991,6 @@ namespace rlogic::internal
                 if (deserializedBinding)
                 {
                     auto up = std::make_unique<RamsesMeshNodeBinding>(std::move(deserializedBinding));
-                    RamsesMeshNodeBinding* mnBinding = up.get();
-                    deserialized->m_ramsesMeshNodeBindings.push_back(mnBinding);
                     deserialized->registerLogicObject(std::move(up));
                 }
                 else
@@ -1608,6 +2000,8 @@ namespace rlogic::internal
             }
         }
 
+        finishPhase(phaseTimings.otherObjects);
+
         // links must go last due to dependency on deserialized properties
         const auto& links = *apiObjects.links();
         // TODO Violin move this code (serialization parts too) to LogicNodeDependencies
@@ -1627,12 +2021,18 @@ namespace rlogic::internal
                 return nullptr;
             }
 
-            const rlogic_serialization::Property* sourceProp = rLink->sourceProperty();
-            const rlogic_serialization::Property* targetProp = rLink->targetProperty();
+            // properties stored with columnar encoding are identified by the root property and their index in the tree
+            PropertyImpl* sourceProp = deserializationMap.resolvePropertyImpl(*rLink->sourceProperty(), rLink->sourcePropertyIndex());
+            PropertyImpl* targetProp = deserializationMap.resolvePropertyImpl(*rLink->targetProperty(), rLink->targetPropertyIndex());
+            if (!sourceProp || !targetProp)
+            {
+                errorReporting.add("Fatal error during loading from serialized data: link refers to unknown property!", nullptr, EErrorType::BinaryVersionMismatch);
+                return nullptr;
+            }
 
             const bool success = deserialized->m_logicNodeDependencies.link(
-                deserializationMap.resolvePropertyImpl(*sourceProp),
-                deserializationMap.resolvePropertyImpl(*targetProp),
+                *sourceProp,
+                *targetProp,
                 rLink->isWeak(),
                 errorReporting);
             // TODO Violin handle (and unit test!) this error properly. Consider these error cases:
@@ -1643,16 +2043,45 @@ namespace rlogic::internal
                 errorReporting.add(
                     fmt::format("Fatal error during loading from {}! Could not link property '{}' to property '{}'!",
                         dataSourceDescription,
-                        sourceProp->name()->string_view(),
-                        targetProp->name()->string_view()
+                        sourceProp->getName(),
+                        targetProp->getName()
                     ), nullptr, EErrorType::BinaryVersionMismatch);
                 return nullptr;
             }
         }
 
+        // Lazily loaded scripts keep the output values loaded from file until their inputs change, so that they are not
+        // executed (and loaded into their Lua state) in next update just because they were loaded
+        if (lazyLuaScripts)
+        {
+            for (LuaScript* script : deserialized->m_scripts)
+            {
+                if (!script->m_script.isInstantiated())
+                    script->m_script.setDirty(false);
+            }
+        }
+
+        finishPhase(phaseTimings.links);
+
         return deserialized;
     }
 
+    bool ApiObjects::InstantiateModulesForScript(
+        const LuaScriptDeserializedData& scriptData,
+        SolState& scriptSolState,
+        EFeatureLevel featureLevel)
+    {
+        // errors are reported when the script using the module is loaded
+        ErrorReporting moduleErrors;
+        for (const auto& module : scriptData.userModules)
+        {
+            if (!module.second->m_impl.instantiate(scriptSolState, featureLevel, moduleErrors))
+                return false;
+        }
+
+        return true;
+    }
+
     bool ApiObjects::bindingsDirty() const
     {
         return
@@ -1677,41 +2106,24 @@ namespace rlogic::internal
 
     const std::vector<PropertyLink>& ApiObjects::getAllPropertyLinks() const
     {
-        m_collectedLinks = collectPropertyLinks();
+        // links are maintained by LogicNodeDependencies, copy them only if they changed since last call
+        const uint64_t linksGeneration = m_logicNodeDependencies.getLinksGeneration();
+        if (m_collectedLinksGeneration != linksGeneration)
+        {
+            m_collectedLinks = m_logicNodeDependencies.getLinks();
+            m_collectedLinksGeneration = linksGeneration;
+        }
         return m_collectedLinks;
     }
 
-    std::vector<PropertyLink> ApiObjects::collectPropertyLinks() const
+    uint64_t ApiObjects::getPropertyLinksGeneration() const
     {
-        std::vector<PropertyLink> links;
-
-        std::deque<const Property*> propsStack;
-        for (const auto& obj : m_logicObjects)
-        {
-            const auto logicNode = obj->as<LogicNode>();
-            if (!logicNode)
-                continue;
-
-            propsStack.clear();
-            propsStack.push_back(logicNode->getInputs());
-            propsStack.push_back(logicNode->getOutputs());
-            while (!propsStack.empty())
-            {
-                const auto prop = propsStack.back();
-                propsStack.pop_back();
-                if (prop == nullptr)
-                    continue;
-
-                const auto incomingLink = prop->getIncomingLink();
-                if (incomingLink)
-                    links.push_back(*incomingLink);
-
-                for (size_t i = 0u; i < prop->getChildCount(); ++i)
-                    propsStack.push_back(prop->getChild(i));
-            }
-        }
+        return m_logicNodeDependencies.getLinksGeneration();
+    }
 
-        return links;
+    const LuaCompilationCache& ApiObjects::getLuaCompilationCache() const
+    {
+        return m_luaCompilationCache;
     }
 
     template DataArray* ApiObjects::createDataArray<float>(const std::vector<float>&, std::string_view);
@@ -14,16 +14,21 @@
 #include "ramses-logic/PropertyLink.h"
 #include "ramses-logic/DataTypes.h"
 #include "ramses-logic/ELuaSavingMode.h"
+#include "ramses-logic/EDataArrayCompression.h"
 
 #include "impl/LuaConfigImpl.h"
 
 #include "internals/LuaCompilationUtils.h"
 #include "internals/SolState.h"
+#include "internals/LuaCompilationCache.h"
 #include "internals/LogicNodeDependencies.h"
+#include "internals/LogicObjectNameIndex.h"
 
 #include <vector>
 #include <memory>
 #include <string_view>
+#include <optional>
+#include <chrono>
 
 namespace ramses
 {
@@ -73,6 +78,8 @@ namespace rlogic::internal
 {
     class SolState;
     class IRamsesObjectResolver;
+    class ThreadPool;
+    struct LuaScriptDeserializedData;
     class AnimationNodeConfigImpl;
     class ValidationResults;
     class SerializationMap;
@@ -84,6 +91,18 @@ namespace rlogic::internal
     using ApiObjectContainer = std::vector<T*>;
     using ApiObjectOwningContainer = std::vector<std::unique_ptr<LogicObject>>;
 
+    // Durations of the phases of ApiObjects::Deserialize
+    struct DeserializationTimings
+    {
+        std::chrono::microseconds luaModules{ 0 };
+        // Lua script data including property trees, interfaces and data arrays, deserialized concurrently if thread pool is used
+        std::chrono::microseconds independentObjects{ 0 };
+        // Loading of Lua scripts into Lua states, concurrently for each Lua state if thread pool is used
+        std::chrono::microseconds luaScripts{ 0 };
+        std::chrono::microseconds otherObjects{ 0 };
+        std::chrono::microseconds links{ 0 };
+    };
+
     class ApiObjects
     {
     public:
@@ -100,6 +119,9 @@ namespace rlogic::internal
         ApiObjects& operator=(const ApiObjects& other) = delete;
 
         [[nodiscard]] size_t getTotalSerializedSize() const;
+        // Cheap estimate of getTotalSerializedSize (nothing is serialized), rather too high than too low,
+        // used to allocate the serialization buffer only once when saving
+        [[nodiscard]] size_t estimateTotalSerializedSize() const;
 
         template<typename T>
         [[nodiscard]] size_t getSerializedSize() const;
@@ -108,13 +130,22 @@ namespace rlogic::internal
         static flatbuffers::Offset<rlogic_serialization::ApiObjects> Serialize(
             const ApiObjects& apiObjects,
             flatbuffers::FlatBufferBuilder& builder,
-            ELuaSavingMode luaSavingMode);
+            ELuaSavingMode luaSavingMode,
+            EDataArrayCompression dataArrayCompression = EDataArrayCompression::None);
         static std::unique_ptr<ApiObjects> Deserialize(
             const rlogic_serialization::ApiObjects& apiObjects,
             const IRamsesObjectResolver* ramsesResolver,
             const std::string& dataSourceDescription,
             ErrorReporting& errorReporting,
-            EFeatureLevel featureLevel);
+            EFeatureLevel featureLevel,
+            size_t luaStateCount = 1u,
+            ThreadPool* threadPool = nullptr,
+            DeserializationTimings* timings = nullptr,
+            bool lazyLuaScripts = false);
+
+        // Lua states which scripts are distributed to (see LogicEngine::setLuaStateCount)
+        bool setLuaStateCount(size_t luaStateCount, ErrorReporting& errorReporting);
+        [[nodiscard]] size_t getLuaStateCount() const;
 
         // Create/destroy API objects
         LuaScript* createLuaScript(
@@ -150,6 +181,12 @@ namespace rlogic::internal
         TimerNode* createTimerNode(std::string_view name);
         AnchorPoint* createAnchorPoint(RamsesNodeBindingImpl& nodeBinding, RamsesCameraBindingImpl& cameraBinding, std::string_view name);
         bool destroy(LogicObject& object, ErrorReporting& errorReporting);
+        // Destroys all given objects or none of them (if any of them can't be destroyed), objects using other objects
+        // of the batch are destroyed first
+        bool destroy(const std::vector<LogicObject*>& objects, ErrorReporting& errorReporting);
+
+        // True if object was created in (or loaded into) these ApiObjects and was not destroyed since, does not dereference the object
+        [[nodiscard]] bool contains(const LogicObject* object) const;
 
         // Invariance checks
         [[nodiscard]] bool checkBindingsReferToSameRamsesScene(ErrorReporting& errorReporting) const;
@@ -167,6 +204,12 @@ namespace rlogic::internal
 
         [[nodiscard]] LogicNode* getApiObject(LogicNodeImpl& impl) const;
         [[nodiscard]] LogicObject* getApiObjectById(uint64_t id) const;
+        // Returns first created (or loaded) object of type T with given name
+        template <typename T>
+        [[nodiscard]] T* getApiObjectByName(std::string_view name) const
+        {
+            return m_logicObjectNameIndex.find<T>(name);
+        }
 
         // Internally used
         [[nodiscard]] bool bindingsDirty() const;
@@ -177,14 +220,30 @@ namespace rlogic::internal
 
         [[nodiscard]] int getNumElementsInLuaStack() const;
 
+        // Snapshot of all links, only updated when links changed since previous call
         [[nodiscard]] const std::vector<PropertyLink>& getAllPropertyLinks() const;
+        [[nodiscard]] uint64_t getPropertyLinksGeneration() const;
+
+        // Compiled sources of created scripts and modules (not used when loading)
+        [[nodiscard]] const LuaCompilationCache& getLuaCompilationCache() const;
 
     private:
         // Handle internal data structures and mappings
         void registerLogicNode(LogicNode& logicNode);
         void unregisterLogicNode(LogicNode& logicNode);
-        void registerLogicObject(std::unique_ptr<LogicObject> obj);
-        void unregisterLogicObject(LogicObject& objToDelete);
+        // Adds object to container of its type T and to all mappings
+        template <typename T>
+        void registerLogicObject(std::unique_ptr<T> obj);
+        // Removes object from container of its type T and from all mappings, deletes the object
+        template <typename T>
+        void unregisterLogicObject(T& objToDelete);
+        template <typename T>
+        void removeFromContainer(ApiObjectContainer<T>& container, size_t index);
+
+        // Counts objects using other objects (e.g. data arrays used by animation nodes), used objects can't be destroyed
+        void addUsedObjects(LogicObject& object);
+        void removeUsedObjects(LogicObject& object);
+        [[nodiscard]] bool isUsedByOtherObjects(const LogicObject& object) const;
 
         bool checkLuaModules(
             const ModuleMapping& moduleMapping,
@@ -206,9 +265,21 @@ namespace rlogic::internal
         [[nodiscard]] bool destroyInternal(TimerNode& node, ErrorReporting& errorReporting);
         [[nodiscard]] bool destroyInternal(AnchorPoint& node, ErrorReporting& errorReporting);
 
-        std::vector<PropertyLink> collectPropertyLinks() const;
+        [[nodiscard]] SolState& getSolStateForNextScript();
+
+        // Loads modules used by deserialized script into the Lua state of the script
+        [[nodiscard]] static bool InstantiateModulesForScript(
+            const LuaScriptDeserializedData& scriptData,
+            SolState& scriptSolState,
+            EFeatureLevel featureLevel);
 
         std::unique_ptr<SolState> m_solState {std::make_unique<SolState>()};
+        // Further Lua states only used to run scripts, modules and interfaces always live in m_solState
+        // (modules are additionally instantiated in states of scripts using them). Declared before the objects
+        // so that they are destroyed after them
+        std::vector<std::unique_ptr<SolState>> m_additionalSolStates;
+        size_t m_nextScriptSolState = 0u;
+        LuaCompilationCache m_luaCompilationCache;
 
         ApiObjectContainer<LuaScript>                m_scripts;
         ApiObjectContainer<LuaInterface>             m_interfaces;
@@ -232,9 +303,22 @@ namespace rlogic::internal
 
         std::unordered_map<LogicNodeImpl*, LogicNode*> m_reverseImplMapping;
         std::unordered_map<uint64_t, LogicObject*>     m_logicObjectIdMapping;
+        LogicObjectNameIndex                           m_logicObjectNameIndex;
+
+        // Position of object in m_logicObjects (same as in m_objectsOwningContainer) and in the container of its type.
+        // Objects are removed from containers by moving the last object to their position, so that destroying
+        // an object does not depend on the number of objects (the order of objects in containers is not preserved)
+        struct ObjectSlots
+        {
+            size_t index = 0u;
+            size_t typedIndex = 0u;
+        };
+        std::unordered_map<const LogicObject*, ObjectSlots> m_objectSlots;
+        std::unordered_map<const LogicObject*, size_t>      m_objectUseCounts;
 
         // persistent storage for links to be given out via public API getPropertyLinks()
         mutable std::vector<PropertyLink> m_collectedLinks;
+        mutable uint64_t                  m_collectedLinksGeneration = 0u;
 
         EFeatureLevel m_featureLevel;
     };
@@ -16,6 +16,7 @@
 #include "ramses-logic/LuaInterface.h"
 #include "ramses-logic/LuaScript.h"
 #include "ramses-logic/LuaModule.h"
+#include "ramses-logic/Property.h"
 #include "ramses-logic/RamsesAppearanceBinding.h"
 #include "ramses-logic/RamsesCameraBinding.h"
 #include "ramses-logic/RamsesNodeBinding.h"
@@ -42,6 +43,9 @@
 #include "impl/SkinBindingImpl.h"
 #include "impl/TimerNodeImpl.h"
 
+#include <type_traits>
+#include <variant>
+
 namespace rlogic::internal
 {
     // Helper functions for getSerializedSize specializations
@@ -59,7 +63,7 @@ namespace rlogic::internal
 
     // Since the channels (DataArrays) of an animation are not stored within the Serialize method we need this in this specialization
     template<>
-    size_t calculateSerializedSize<AnimationNode, AnimationNodeImpl>(const ApiObjectContainer<AnimationNode>& container, EFeatureLevel /*featureLevel*/)
+    size_t calculateSerializedSize<AnimationNode, AnimationNodeImpl>(const ApiObjectContainer<AnimationNode>& container, EFeatureLevel featureLevel)
     {
         auto insertIds = [](const DataArray* data, std::unordered_set<uint64_t>& ids)
         {
@@ -85,19 +89,19 @@ namespace rlogic::internal
             {
                 serializationMap.storeDataArray(id, 0u);
             }
-            (void)AnimationNodeImpl::Serialize(element->m_animationNodeImpl, builder, serializationMap);
+            (void)AnimationNodeImpl::Serialize(element->m_animationNodeImpl, builder, serializationMap, featureLevel);
         }
         return static_cast<size_t>(builder.GetSize());
     }
 
     template<>
-    size_t calculateSerializedSize<LuaScript, LuaScriptImpl>(const ApiObjectContainer<LuaScript>& container, EFeatureLevel /*featureLevel*/)
+    size_t calculateSerializedSize<LuaScript, LuaScriptImpl>(const ApiObjectContainer<LuaScript>& container, EFeatureLevel featureLevel)
     {
         flatbuffers::FlatBufferBuilder builder{};
         SerializationMap serializationMap{};
         for (const auto& element : container)
         {
-            (void)LuaScriptImpl::Serialize(element->m_script, builder, serializationMap, ELuaSavingMode::ByteCodeOnly);
+            (void)LuaScriptImpl::Serialize(element->m_script, builder, serializationMap, ELuaSavingMode::ByteCodeOnly, featureLevel);
         }
         return static_cast<size_t>(builder.GetSize());
     }
@@ -121,6 +125,68 @@ namespace rlogic::internal
         return static_cast<size_t>(builder.GetSize());
     }
 
+    static size_t CountPropertiesInTree(const Property* property)
+    {
+        if (property == nullptr)
+        {
+            return 0u;
+        }
+
+        size_t count = 1u;
+        for (size_t i = 0u; i < property->getChildCount(); ++i)
+        {
+            count += CountPropertiesInTree(property->getChild(i));
+        }
+        return count;
+    }
+
+    size_t ApiObjects::estimateTotalSerializedSize() const
+    {
+        // Sizes of serialized objects (including names, ids and links) and properties are rough upper bounds,
+        // only data arrays and Lua code are taken into account exactly because they dominate large files
+        // base size covers empty object containers and also versions and metadata saved together with the objects
+        constexpr size_t BaseSizeEstimate = 1024u;
+        constexpr size_t ObjectSizeEstimate = 256u;
+        constexpr size_t PropertySizeEstimate = 64u;
+
+        size_t size = BaseSizeEstimate + m_logicObjects.size() * ObjectSizeEstimate;
+        for (const auto& [nodeImpl, node] : m_reverseImplMapping)
+        {
+            (void)node;
+            size += (CountPropertiesInTree(nodeImpl->getInputs()) + CountPropertiesInTree(nodeImpl->getOutputs())) * PropertySizeEstimate;
+        }
+
+        for (const auto* dataArray : m_dataArrays)
+        {
+            std::visit([&size](const auto& data) {
+                using ElementType = typename std::decay_t<decltype(data)>::value_type;
+                if constexpr (std::is_same_v<ElementType, std::vector<float>>)
+                {
+                    for (const auto& element : data)
+                    {
+                        size += element.size() * sizeof(float);
+                    }
+                }
+                else
+                {
+                    size += data.size() * sizeof(ElementType);
+                }
+            }, dataArray->m_impl.getDataVariant());
+        }
+
+        // source and byte code are both counted, regardless of the Lua saving mode
+        for (const auto* script : m_scripts)
+        {
+            size += script->m_script.getCodeSize();
+        }
+        for (const auto* module : m_luaModules)
+        {
+            size += module->m_impl.getCodeSize();
+        }
+
+        return size;
+    }
+
     template<>
     size_t ApiObjects::getSerializedSize<RamsesCameraBinding>() const
     {
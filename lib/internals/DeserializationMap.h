@@ -8,11 +8,18 @@
 
 #pragma once
 
+#include "ramses-logic/EFeatureLevel.h"
+#include "internals/PropertyTypeLayout.h"
+
+#include <algorithm>
+#include <cassert>
 #include <unordered_map>
+#include <vector>
 
 namespace rlogic_serialization
 {
     struct Property;
+    struct PropertyTreeType;
     struct DataArray;
 }
 
@@ -30,14 +37,42 @@ namespace rlogic::internal
     class DeserializationMap
     {
     public:
+        DeserializationMap() = default;
+        explicit DeserializationMap(EFeatureLevel featureLevel)
+            : m_featureLevel{ featureLevel }
+        {
+        }
+
+        // Feature level of the loaded data, decides which encodings are accepted
+        [[nodiscard]] EFeatureLevel getFeatureLevel() const
+        {
+            return m_featureLevel;
+        }
+
         void storePropertyImpl(const rlogic_serialization::Property& flatbufferObject, PropertyImpl& impl)
         {
             Store(&flatbufferObject, &impl, m_properties);
         }
 
-        PropertyImpl& resolvePropertyImpl(const rlogic_serialization::Property& flatbufferObject) const
+        // Columnar property encoding: whole tree is stored in one flatbuffers object, properties are listed in pre-order (root first)
+        void storePropertyTree(const rlogic_serialization::Property& flatbufferObject, std::vector<PropertyImpl*> properties)
         {
-            return *Get(&flatbufferObject, m_properties);
+            assert(m_propertyTrees.count(&flatbufferObject) == 0 && "one time store only");
+            m_propertyTrees.emplace(&flatbufferObject, std::move(properties));
+        }
+
+        // Resolves property of a tree stored with columnar encoding or (with index 0) a property stored on its own,
+        // fails gracefully (nullptr) for indices out of range which can come from corrupted but otherwise valid files
+        PropertyImpl* resolvePropertyImpl(const rlogic_serialization::Property& flatbufferObject, uint32_t index) const
+        {
+            const auto treeIt = m_propertyTrees.find(&flatbufferObject);
+            if (treeIt != m_propertyTrees.cend())
+            {
+                return (index < treeIt->second.size() ? treeIt->second[index] : nullptr);
+            }
+
+            const auto it = m_properties.find(&flatbufferObject);
+            return (index == 0u && it != m_properties.cend() ? it->second : nullptr);
         }
 
         void storeDataArray(const rlogic_serialization::DataArray& flatbufferObject, const DataArray& dataArray)
@@ -67,6 +102,39 @@ namespace rlogic::internal
             return nullptr;
         }
 
+        // Layouts are shared by all properties of the same type loaded with this map
+        std::shared_ptr<const PropertyTypeLayout> getPropertyTypeLayout(const HierarchicalTypeData& type)
+        {
+            return m_propertyTypeLayouts.getLayout(type);
+        }
+
+        // Layouts of serialized tree types (columnar property encoding), a tree type shared by many property trees is decoded only once
+        void storePropertyTreeTypeLayout(const rlogic_serialization::PropertyTreeType& flatbufferObject, std::shared_ptr<const PropertyTypeLayout> layout)
+        {
+            m_propertyTreeTypeLayouts.emplace(&flatbufferObject, std::move(layout));
+        }
+
+        [[nodiscard]] std::shared_ptr<const PropertyTypeLayout> findPropertyTreeTypeLayout(const rlogic_serialization::PropertyTreeType& flatbufferObject) const
+        {
+            const auto it = m_propertyTreeTypeLayouts.find(&flatbufferObject);
+            return (it != m_propertyTreeTypeLayouts.cend() ? it->second : nullptr);
+        }
+
+        // Takes over mappings stored in another map, e.g. in a map filled by another thread during concurrent
+        // deserialization. Logic objects, property type layouts and decoded tree types known to both maps are kept only once.
+        void merge(DeserializationMap&& other)
+        {
+            assert(std::none_of(other.m_properties.cbegin(), other.m_properties.cend(), [this](const auto& p) { return m_properties.count(p.first) != 0u; }));
+            assert(std::none_of(other.m_dataArrays.cbegin(), other.m_dataArrays.cend(), [this](const auto& d) { return m_dataArrays.count(d.first) != 0u; }));
+            assert(std::none_of(other.m_propertyTrees.cbegin(), other.m_propertyTrees.cend(), [this](const auto& t) { return m_propertyTrees.count(t.first) != 0u; }));
+            m_properties.merge(other.m_properties);
+            m_propertyTrees.merge(other.m_propertyTrees);
+            m_propertyTreeTypeLayouts.merge(other.m_propertyTreeTypeLayouts);
+            m_dataArrays.merge(other.m_dataArrays);
+            m_logicObjects.merge(other.m_logicObjects);
+            m_propertyTypeLayouts.merge(other.m_propertyTypeLayouts);
+        }
+
     private:
         template <typename Key, typename Value>
         static void Store(Key key, Value value, std::unordered_map<Key, Value>& container)
@@ -85,8 +153,12 @@ namespace rlogic::internal
         }
 
         std::unordered_map<const rlogic_serialization::Property*, PropertyImpl*> m_properties;
+        std::unordered_map<const rlogic_serialization::Property*, std::vector<PropertyImpl*>> m_propertyTrees;
+        std::unordered_map<const rlogic_serialization::PropertyTreeType*, std::shared_ptr<const PropertyTypeLayout>> m_propertyTreeTypeLayouts;
         std::unordered_map<const rlogic_serialization::DataArray*, const DataArray*> m_dataArrays;
         std::unordered_map<uint64_t, LogicObjectImpl*> m_logicObjects;
+        PropertyTypeLayoutRegistry m_propertyTypeLayouts;
+        EFeatureLevel m_featureLevel = EFeatureLevel_Latest;
     };
 
 }
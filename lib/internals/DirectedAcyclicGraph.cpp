@@ -8,9 +8,10 @@
 
 #include "internals/DirectedAcyclicGraph.h"
 
+#include "impl/LogicNodeImpl.h"
+
 #include <cassert>
 #include <algorithm>
-#include <unordered_set>
 #include <numeric>
 #include <iterator>
 
@@ -18,184 +19,456 @@ namespace rlogic::internal
 {
     void DirectedAcyclicGraph::addNode(Node& node)
     {
-        assert(m_nodeOutgoingEdges.count(&node) == 0);
-        assert(m_nodeIncomingEdges.count(&node) == 0);
-        m_nodeOutgoingEdges.insert({ &node, {} });
-        m_nodeIncomingEdges.insert({ &node, {} });
+        assert(!containsNode(node));
+
+        // avoid growing the order indefinitely when nodes are created and destroyed without ever querying the order
+        if (m_orderHoles > m_order.size() / 2)
+            compactOrder();
+
+        NodeIndex nodeIdx = m_nodes.size();
+        if (m_freeNodeIndices.empty())
+        {
+            m_nodes.emplace_back();
+        }
+        else
+        {
+            nodeIdx = m_freeNodeIndices.back();
+            m_freeNodeIndices.pop_back();
+        }
+
+        // a new node has no edges, so it can be placed anywhere - the end is cheapest
+        NodeData& nodeData = m_nodes[nodeIdx];
+        assert(nodeData.node == nullptr && nodeData.outgoingEdges.empty() && nodeData.incomingEdges.empty());
+        assert(nodeData.weakOutgoingEdges.empty() && nodeData.weakIncomingEdges.empty());
+        nodeData.node = &node;
+        nodeData.rank = m_order.size();
+        m_order.push_back(nodeIdx);
+        node.setGraphIndex(nodeIdx);
+        m_sortedNodesDirty = true;
+        m_updateLevelsDirty = true;
     }
 
     void DirectedAcyclicGraph::removeNode(Node& nodeToRemove)
     {
-        assert(m_nodeOutgoingEdges.count(&nodeToRemove) != 0);
-        assert(m_nodeIncomingEdges.count(&nodeToRemove) != 0);
+        const NodeIndex nodeIdx = getIndex(nodeToRemove);
+        NodeData& nodeData = m_nodes[nodeIdx];
 
         // remove node from all edge lists pointing to it from source nodes
-        const auto srcNodesIt = m_nodeIncomingEdges.find(&nodeToRemove);
-        for (const auto srcNode : srcNodesIt->second)
+        for (const auto srcNode : nodeData.incomingEdges)
         {
-            EdgeList& srcNodeOutgoingEdges = m_nodeOutgoingEdges.find(srcNode)->second;
+            EdgeList& srcNodeOutgoingEdges = m_nodes[srcNode].outgoingEdges;
             const auto it = std::remove_if(srcNodeOutgoingEdges.begin(), srcNodeOutgoingEdges.end(),
-                [&nodeToRemove](const auto& e) { return e.target == &nodeToRemove; });
+                [nodeIdx](const auto& e) { return e.target == nodeIdx; });
             srcNodeOutgoingEdges.erase(it, srcNodeOutgoingEdges.end());
         }
 
         // remove node from all edge lists pointing to it from its target nodes
-        const auto tgtNodesIt = m_nodeOutgoingEdges.find(&nodeToRemove);
-        for (const auto& tgtNode : tgtNodesIt->second)
+        for (const auto& tgtNode : nodeData.outgoingEdges)
         {
-            auto& tgtNodeEdges = m_nodeIncomingEdges.find(tgtNode.target)->second;
-            tgtNodeEdges.erase(std::find(tgtNodeEdges.begin(), tgtNodeEdges.end(), &nodeToRemove));
+            auto& tgtNodeEdges = m_nodes[tgtNode.target].incomingEdges;
+            tgtNodeEdges.erase(std::find(tgtNodeEdges.begin(), tgtNodeEdges.end(), nodeIdx));
         }
 
-        // remove node from both maps
-        m_nodeIncomingEdges.erase(srcNodesIt);
-        m_nodeOutgoingEdges.erase(&nodeToRemove);
+        for (const auto srcNode : nodeData.weakIncomingEdges)
+        {
+            EdgeList& srcNodeOutgoingEdges = m_nodes[srcNode].weakOutgoingEdges;
+            srcNodeOutgoingEdges.erase(FindEdgeToNode(srcNodeOutgoingEdges, nodeIdx));
+        }
+
+        for (const auto& tgtNode : nodeData.weakOutgoingEdges)
+        {
+            auto& tgtNodeEdges = m_nodes[tgtNode.target].weakIncomingEdges;
+            tgtNodeEdges.erase(std::find(tgtNodeEdges.begin(), tgtNodeEdges.end(), nodeIdx));
+        }
+
+        // Removing a node never breaks the order of the remaining nodes, only leave a hole in its place
+        assert(m_order[nodeData.rank] == nodeIdx);
+        m_order[nodeData.rank] = LogicNodeImpl::InvalidGraphIndex;
+        ++m_orderHoles;
+        m_sortedNodesDirty = true;
+        m_updateLevelsDirty = true;
+
+        nodeData.node = nullptr;
+        nodeData.outgoingEdges.clear();
+        nodeData.incomingEdges.clear();
+        nodeData.weakOutgoingEdges.clear();
+        nodeData.weakIncomingEdges.clear();
+        m_freeNodeIndices.push_back(nodeIdx);
+        nodeToRemove.setGraphIndex(LogicNodeImpl::InvalidGraphIndex);
     }
 
-    // This is a slightly exotic sorting algorithm for DAGs
-    // It works based on these general principles:
-    // - Traverse the DAG starting from the root nodes
-    // - Keep the nodes in a sparsely sorted queue (with more slots than actual nodes, and some empty slots)
-    // - Any time a new 'edge' is traversed, moves the 'target' node of the edge to the last position of the queue
-    // - If number of iterations exceeds N^2, there was a loop in the graph -> abort
-    // This is supposed to work fast, because the queue is never re-allocated or re-sorted, only grows incrementally, and
-    // we only need to run a second time and remove the 'empty slots' to get the final order.
-    std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes() const
+    bool DirectedAcyclicGraph::addEdge(Node& source, Node& target)
     {
-        const size_t totalNodeCount = m_nodeOutgoingEdges.size();
+        const NodeIndex sourceIdx = getIndex(source);
+        const NodeIndex targetIdx = getIndex(target);
+
+        NodeData& sourceData = m_nodes[sourceIdx];
+        NodeData& targetData = m_nodes[targetIdx];
+        if (!AddEdgeInstance(sourceData.outgoingEdges, targetData.incomingEdges, sourceIdx, targetIdx))
+            return false;
+        m_updateLevelsDirty = true;
+
+        // Once there is a cycle, there is no valid order to maintain - it will be re-computed from scratch when queried
+        if (!m_orderValid)
+            return true;
+
+        // Edge agrees with current order -> nothing to do (this is the common case when content is created in data flow order)
+        const size_t lowerBound = targetData.rank;
+        const size_t upperBound = sourceData.rank;
+        if (lowerBound < upperBound)
+        {
+            // Collect all nodes reachable from target which are ranked before source. If source itself is reachable, the
+            // new edge closed a cycle
+            if (!discoverForward(targetIdx, upperBound, sourceIdx))
+            {
+                m_orderValid = false;
+            }
+            else
+            {
+                // Collect all nodes from which source is reachable and which are ranked after target
+                discoverBackward(sourceIdx, lowerBound);
+                // Shift the two sets so that all backward discovered nodes precede the forward discovered ones,
+                // reusing only the ranks they occupied before
+                reorderDiscoveredNodes();
+            }
+            m_sortedNodesDirty = true;
+        }
+
+        return true;
+    }
+
+    void DirectedAcyclicGraph::removeEdge(Node& source, Node& target)
+    {
+        const NodeIndex sourceIdx = getIndex(source);
+        const NodeIndex targetIdx = getIndex(target);
+
+        RemoveEdgeInstance(m_nodes[sourceIdx].outgoingEdges, m_nodes[targetIdx].incomingEdges, sourceIdx, targetIdx);
+        m_updateLevelsDirty = true;
+        // removing an edge never invalidates a topological order
+    }
 
-        // This remembers temporarily the position of node N in 'nodeQueue' (see below)
-        // This index can change in different loops of the code below
-        std::unordered_map<const Node*, size_t> nodeIndexIntoQueue;
-        nodeIndexIntoQueue.reserve(totalNodeCount);
+    void DirectedAcyclicGraph::addWeakEdge(Node& source, Node& target)
+    {
+        const NodeIndex sourceIdx = getIndex(source);
+        const NodeIndex targetIdx = getIndex(target);
+        AddEdgeInstance(m_nodes[sourceIdx].weakOutgoingEdges, m_nodes[targetIdx].weakIncomingEdges, sourceIdx, targetIdx);
+        m_updateLevelsDirty = true;
+    }
 
-        // This is a queue of nodes which is:
-        // - partially sorted (at any given time during the loops, the first X entries are sorted, while the rest is not sorted yet)
-        // - sparse (some entries can be nullptr) - of nodes which were moved during the algorithm, see below
-        // - sorted at the end of the loop (by their topological rank)
-        // - starts with the root nodes (they are always at the beginning)
-        NodeVector sparseNodeQueue = collectRootNodes();
+    void DirectedAcyclicGraph::removeWeakEdge(Node& source, Node& target)
+    {
+        const NodeIndex sourceIdx = getIndex(source);
+        const NodeIndex targetIdx = getIndex(target);
+        RemoveEdgeInstance(m_nodes[sourceIdx].weakOutgoingEdges, m_nodes[targetIdx].weakIncomingEdges, sourceIdx, targetIdx);
+        m_updateLevelsDirty = true;
+    }
 
-        // Cycle condition - can't find root nodes among a non-empty set of nodes
-        if (sparseNodeQueue.empty() && !m_nodeOutgoingEdges.empty())
+    bool DirectedAcyclicGraph::AddEdgeInstance(EdgeList& sourceOutgoingEdges, NodeIndices& targetIncomingEdges, NodeIndex source, NodeIndex target)
+    {
+        auto edgeBetweenNodes = FindEdgeToNode(sourceOutgoingEdges, target);
+        if (edgeBetweenNodes != sourceOutgoingEdges.end())
+        {
+            edgeBetweenNodes->multiplicity++;
+            return false;
+        }
+
+        sourceOutgoingEdges.push_back({ target, 1u });
+        assert(std::find(targetIncomingEdges.cbegin(), targetIncomingEdges.cend(), source) == targetIncomingEdges.cend());
+        targetIncomingEdges.push_back(source);
+        return true;
+    }
+
+    void DirectedAcyclicGraph::RemoveEdgeInstance(EdgeList& sourceOutgoingEdges, NodeIndices& targetIncomingEdges, NodeIndex source, NodeIndex target)
+    {
+        auto outgoingEdge = FindEdgeToNode(sourceOutgoingEdges, target);
+        assert(outgoingEdge != sourceOutgoingEdges.end());
+        assert(outgoingEdge->multiplicity > 0u);
+        --outgoingEdge->multiplicity;
+        if (outgoingEdge->multiplicity == 0)
         {
-            return std::nullopt;
+            sourceOutgoingEdges.erase(outgoingEdge);
+            assert(std::find(targetIncomingEdges.cbegin(), targetIncomingEdges.cend(), source) != targetIncomingEdges.cend());
+            targetIncomingEdges.erase(std::find(targetIncomingEdges.begin(), targetIncomingEdges.end(), source));
         }
+    }
 
-        // sparseNodeQueue grows here all the time
-        // TODO Violin rework algorithm to not grow and loop over the same container
-        for (size_t i = 0; i < sparseNodeQueue.size(); ++i)
+    bool DirectedAcyclicGraph::discoverForward(NodeIndex start, size_t upperBound, NodeIndex cycleTarget)
+    {
+        m_forwardDiscovered.clear();
+        m_discoveryStack.clear();
+
+        m_discoveryStack.push_back(start);
+        m_nodes[start].visited = true;
+
+        bool foundCycle = false;
+        while (!m_discoveryStack.empty() && !foundCycle)
         {
-            if (i > totalNodeCount * totalNodeCount)
+            const NodeIndex node = m_discoveryStack.back();
+            m_discoveryStack.pop_back();
+            m_forwardDiscovered.push_back(node);
+
+            for (const auto& edge : m_nodes[node].outgoingEdges)
             {
-                // TODO Violin this is a primitive loop detection. Replace with a proper graph-based solution!
-                // The inner and the outer loop are bound by N(number of nodes), so exceeding that is a
-                // sufficient condition that there was a loop
-                return std::nullopt;
+                if (edge.target == cycleTarget)
+                {
+                    foundCycle = true;
+                    break;
+                }
+
+                NodeData& targetData = m_nodes[edge.target];
+                // nodes ranked after the upper bound are not affected by the new edge
+                if (!targetData.visited && targetData.rank < upperBound)
+                {
+                    targetData.visited = true;
+                    m_discoveryStack.push_back(edge.target);
+                }
             }
+        }
 
-            // Get the next node in the queue and process based on its outgoing edges
-            Node* nextNode = sparseNodeQueue[i];
-            // sparseNodeQueue has nullptr holes - skip those
-            if (nextNode != nullptr)
-            {
-                const EdgeList& nextNodeEdges = m_nodeOutgoingEdges.find(nextNode)->second;
+        // reset scratch flags, including nodes still on stack when aborted
+        for (const NodeIndex node : m_forwardDiscovered)
+            m_nodes[node].visited = false;
+        for (const NodeIndex node : m_discoveryStack)
+            m_nodes[node].visited = false;
+
+        return !foundCycle;
+    }
+
+    void DirectedAcyclicGraph::discoverBackward(NodeIndex start, size_t lowerBound)
+    {
+        m_backwardDiscovered.clear();
+        m_discoveryStack.clear();
+
+        m_discoveryStack.push_back(start);
+        m_nodes[start].visited = true;
 
-                // For each edge, put the 'target' node to the end of the queue (this order may be temporarily wrong,
-                // because we don't know if those nodes have also edges between them which would affect this order)
-                // What happens if it's wrong? see the if() inside the loop
-                for (const auto& outgoingEdge : nextNodeEdges)
+        while (!m_discoveryStack.empty())
+        {
+            const NodeIndex node = m_discoveryStack.back();
+            m_discoveryStack.pop_back();
+            m_backwardDiscovered.push_back(node);
+
+            for (const NodeIndex srcNode : m_nodes[node].incomingEdges)
+            {
+                NodeData& srcData = m_nodes[srcNode];
+                // nodes ranked before the lower bound are not affected by the new edge
+                if (!srcData.visited && srcData.rank > lowerBound)
                 {
-                    // Put the node at the end of the 'sparseNodeQueue' and remember the index
-                    Node* outgoingEdgeTarget = outgoingEdge.target;
-                    sparseNodeQueue.emplace_back(outgoingEdgeTarget);
-                    const size_t targetNodeIndex = sparseNodeQueue.size() - 1;
-
-                    const auto potentiallyAlreadyProcessedNode = nodeIndexIntoQueue.find(outgoingEdgeTarget);
-                    // target node not processed yet?
-                    if (potentiallyAlreadyProcessedNode == nodeIndexIntoQueue.end())
-                    {
-                        // => insert to processed queue, with current index from 'queue'
-                        nodeIndexIntoQueue.insert({ outgoingEdgeTarget, targetNodeIndex });
-                    }
-                    // target node processed already?
-                    else
-                    {
-                        // => move the node from its last computed index to the current one
-                        // (and set to nullptr on its last position so that it does not occur twice in the queue)
-                        // Why do we do this? Because it makes sure that any time there is a 'new edge' to a node,
-                        // it is moved to the last position in the queue, unless it has no 'incoming edges' (root node)
-                        // or it has exactly one incoming edge (and never needs to be re-sorted)
-                        sparseNodeQueue[potentiallyAlreadyProcessedNode->second] = nullptr;
-                        potentiallyAlreadyProcessedNode->second = targetNodeIndex;
-                    }
+                    srcData.visited = true;
+                    m_discoveryStack.push_back(srcNode);
                 }
             }
         }
 
-        // Some nodes are nullptr because of the special 'bubble sort' sorting method
-        sparseNodeQueue.erase(std::remove(sparseNodeQueue.begin(), sparseNodeQueue.end(), nullptr), sparseNodeQueue.end());
+        for (const NodeIndex node : m_backwardDiscovered)
+            m_nodes[node].visited = false;
+    }
 
-        return sparseNodeQueue;
+    void DirectedAcyclicGraph::reorderDiscoveredNodes()
+    {
+        const auto byRank = [this](NodeIndex n1, NodeIndex n2) { return m_nodes[n1].rank < m_nodes[n2].rank; };
+        // keeps relative order within each set, which is already topologically correct
+        std::sort(m_backwardDiscovered.begin(), m_backwardDiscovered.end(), byRank);
+        std::sort(m_forwardDiscovered.begin(), m_forwardDiscovered.end(), byRank);
+
+        m_discoveredRanks.clear();
+        for (const NodeIndex node : m_backwardDiscovered)
+            m_discoveredRanks.push_back(m_nodes[node].rank);
+        for (const NodeIndex node : m_forwardDiscovered)
+            m_discoveredRanks.push_back(m_nodes[node].rank);
+        std::sort(m_discoveredRanks.begin(), m_discoveredRanks.end());
+
+        size_t rankIdx = 0u;
+        const auto assignNextRank = [this, &rankIdx](NodeIndex node) {
+            const size_t rank = m_discoveredRanks[rankIdx++];
+            m_nodes[node].rank = rank;
+            m_order[rank] = node;
+        };
+        std::for_each(m_backwardDiscovered.cbegin(), m_backwardDiscovered.cend(), assignNextRank);
+        std::for_each(m_forwardDiscovered.cbegin(), m_forwardDiscovered.cend(), assignNextRank);
     }
 
-    bool DirectedAcyclicGraph::addEdge(Node& source, Node& target)
+    void DirectedAcyclicGraph::compactOrder()
+    {
+        if (m_orderHoles == 0u)
+            return;
+
+        m_order.erase(std::remove(m_order.begin(), m_order.end(), LogicNodeImpl::InvalidGraphIndex), m_order.end());
+        m_orderHoles = 0u;
+        for (size_t i = 0u; i < m_order.size(); ++i)
+            m_nodes[m_order[i]].rank = i;
+    }
+
+    // Kahn's algorithm, used only to recover from a cycle (i.e. when there is no previous valid order to adjust)
+    bool DirectedAcyclicGraph::sortFromScratch()
     {
-        assert(m_nodeOutgoingEdges.count(&source) != 0);
-        assert(m_nodeOutgoingEdges.count(&target) != 0);
-        assert(m_nodeIncomingEdges.count(&source) != 0);
-        assert(m_nodeIncomingEdges.count(&target) != 0);
+        compactOrder();
 
-        auto& nodeEdges = m_nodeOutgoingEdges.find(&source)->second;
-        auto edgeBetweenNodes = FindEdgeToNode(nodeEdges, target);
-        const bool isNewConnection = (edgeBetweenNodes == nodeEdges.end());
-        if (isNewConnection)
+        NodeIndices sortedNodes;
+        sortedNodes.reserve(m_order.size());
+
+        // visit nodes in their previous order so that the result is deterministic
+        for (const NodeIndex node : m_order)
         {
-            nodeEdges.push_back({ &target, 1u });
-            auto& tgtToSourcesList = m_nodeIncomingEdges.find(&target)->second;
-            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), &source) == tgtToSourcesList.cend());
-            tgtToSourcesList.push_back(&source);
+            NodeData& nodeData = m_nodes[node];
+            nodeData.pendingIncomingEdges = nodeData.incomingEdges.size();
+            if (nodeData.pendingIncomingEdges == 0u)
+                sortedNodes.push_back(node);
         }
-        else
+
+        for (size_t i = 0u; i < sortedNodes.size(); ++i)
         {
-            edgeBetweenNodes->multiplicity++;
+            for (const auto& edge : m_nodes[sortedNodes[i]].outgoingEdges)
+            {
+                NodeData& targetData = m_nodes[edge.target];
+                assert(targetData.pendingIncomingEdges > 0u);
+                if (--targetData.pendingIncomingEdges == 0u)
+                    sortedNodes.push_back(edge.target);
+            }
+        }
+
+        // nodes which were never released have incoming edges from a cycle
+        if (sortedNodes.size() != m_order.size())
+        {
+            collectCycle();
+            return false;
+        }
+
+        m_order = std::move(sortedNodes);
+        for (size_t i = 0u; i < m_order.size(); ++i)
+            m_nodes[m_order[i]].rank = i;
+        m_orderValid = true;
+        m_sortedNodesDirty = true;
+        m_updateLevelsDirty = true;
+
+        return true;
+    }
+
+    void DirectedAcyclicGraph::collectCycle()
+    {
+        const auto isUnreleased = [this](NodeIndex n) { return m_nodes[n].pendingIncomingEdges != 0u; };
+
+        // Every node which was not released by sortFromScratch() has at least one not released source node. So walking
+        // backwards along unreleased sources from any unreleased node must eventually revisit a node - that's the cycle
+        const auto nodeIt = std::find_if(m_order.cbegin(), m_order.cend(), isUnreleased);
+        assert(nodeIt != m_order.cend());
+
+        NodeIndices path;
+        NodeIndex node = *nodeIt;
+        while (!m_nodes[node].visited)
+        {
+            m_nodes[node].visited = true;
+            path.push_back(node);
+
+            const auto& sources = m_nodes[node].incomingEdges;
+            const auto srcIt = std::find_if(sources.cbegin(), sources.cend(), isUnreleased);
+            assert(srcIt != sources.cend());
+            node = *srcIt;
         }
 
-        return isNewConnection;
+        for (const NodeIndex n : path)
+            m_nodes[n].visited = false;
+
+        // path ends with the cycle (walked against edge direction), reverse it to follow the edges
+        const auto cycleStart = std::find(path.cbegin(), path.cend(), node);
+        m_cycle.clear();
+        std::transform(path.crbegin(), std::make_reverse_iterator(cycleStart), std::back_inserter(m_cycle), [this](NodeIndex n) { return m_nodes[n].node; });
     }
 
-    void DirectedAcyclicGraph::removeEdge(Node& source, Node& target)
+    const std::optional<NodeVector>& DirectedAcyclicGraph::getTopologicallySortedNodes()
     {
-        assert(m_nodeOutgoingEdges.count(&source) != 0);
-        assert(m_nodeOutgoingEdges.count(&target) != 0);
-        assert(m_nodeIncomingEdges.count(&source) != 0);
-        assert(m_nodeIncomingEdges.count(&target) != 0);
+        m_cycle.clear();
 
-        auto& srcNodeEdges = m_nodeOutgoingEdges.find(&source)->second;
-        auto outgoingEdge = FindEdgeToNode(srcNodeEdges, target);
-        assert(outgoingEdge != srcNodeEdges.end());
-        assert(outgoingEdge->multiplicity > 0u);
-        --outgoingEdge->multiplicity;
-        if (outgoingEdge->multiplicity == 0)
+        if (!m_orderValid && !sortFromScratch())
+        {
+            m_sortedNodes = std::nullopt;
+            // make sure the order is reported again once cycle is resolved
+            m_sortedNodesDirty = true;
+            return m_sortedNodes;
+        }
+
+        if (m_sortedNodesDirty)
+        {
+            compactOrder();
+            if (!m_sortedNodes)
+                m_sortedNodes.emplace();
+            m_sortedNodes->resize(m_order.size());
+            std::transform(m_order.cbegin(), m_order.cend(), m_sortedNodes->begin(), [this](NodeIndex n) { return m_nodes[n].node; });
+            m_sortedNodesDirty = false;
+        }
+
+        return m_sortedNodes;
+    }
+
+    const std::vector<NodeVector>& DirectedAcyclicGraph::getUpdateLevels()
+    {
+        assert(m_orderValid && !m_sortedNodesDirty && m_orderHoles == 0u);
+        if (m_updateLevelsDirty)
+        {
+            computeUpdateLevels();
+            m_updateLevelsDirty = false;
+        }
+
+        return m_updateLevels;
+    }
+
+    void DirectedAcyclicGraph::computeUpdateLevels()
+    {
+        // keep memory of the levels, they are likely to be of similar size as before
+        for (auto& level : m_updateLevels)
+            level.clear();
+        size_t levelCount = 0u;
+
+        // Visiting nodes in rank order guarantees that the level of every node ranked before the current one is known.
+        // A node has to be in a later level than any node it gets data from in the same update, i.e. sources of edges and
+        // sources of weak edges ranked before it (weak edge against the order propagates data only in the next update).
+        // A node which is the source of a weak edge against the order must not be in an earlier level than the target,
+        // otherwise the target would already receive the data in the current update.
+        for (const NodeIndex node : m_order)
         {
-            srcNodeEdges.erase(outgoingEdge);
-            auto& tgtToSourcesList = m_nodeIncomingEdges.find(&target)->second;
-            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), &source) != tgtToSourcesList.cend());
-            tgtToSourcesList.erase(std::find(tgtToSourcesList.begin(), tgtToSourcesList.end(), &source));
+            NodeData& nodeData = m_nodes[node];
+
+            size_t level = 0u;
+            for (const NodeIndex srcNode : nodeData.incomingEdges)
+            {
+                assert(m_nodes[srcNode].rank < nodeData.rank);
+                level = std::max(level, m_nodes[srcNode].level + 1u);
+            }
+            for (const NodeIndex srcNode : nodeData.weakIncomingEdges)
+            {
+                if (m_nodes[srcNode].rank < nodeData.rank)
+                    level = std::max(level, m_nodes[srcNode].level + 1u);
+            }
+            for (const auto& weakEdge : nodeData.weakOutgoingEdges)
+            {
+                if (m_nodes[weakEdge.target].rank < nodeData.rank)
+                    level = std::max(level, m_nodes[weakEdge.target].level);
+            }
+
+            nodeData.level = level;
+            if (level >= m_updateLevels.size())
+                m_updateLevels.resize(level + 1u);
+            m_updateLevels[level].push_back(nodeData.node);
+            levelCount = std::max(levelCount, level + 1u);
         }
+
+        m_updateLevels.resize(levelCount);
+    }
+
+    const NodeVector& DirectedAcyclicGraph::getCycle() const
+    {
+        return m_cycle;
     }
 
-    size_t DirectedAcyclicGraph::getInDegree(Node& node) const
+    size_t DirectedAcyclicGraph::getInDegree(const Node& node) const
     {
-        assert(m_nodeOutgoingEdges.count(&node) != 0);
-        assert(m_nodeIncomingEdges.count(&node) != 0);
+        const NodeIndex nodeIdx = getIndex(node);
 
         size_t edgeCount = 0u;
-        const auto srcNodesList = m_nodeIncomingEdges.find(&node)->second;
-        for (const auto srcNode : srcNodesList)
+        for (const auto srcNode : m_nodes[nodeIdx].incomingEdges)
         {
-            const EdgeList& srcNodeOutgoingEdges = m_nodeOutgoingEdges.find(srcNode)->second;
-            const auto edgeIt = FindEdgeToNode(srcNodeOutgoingEdges, node);
+            const EdgeList& srcNodeOutgoingEdges = m_nodes[srcNode].outgoingEdges;
+            const auto edgeIt = FindEdgeToNode(srcNodeOutgoingEdges, nodeIdx);
             assert(edgeIt != srcNodeOutgoingEdges.cend());
             edgeCount += edgeIt->multiplicity;
         }
@@ -203,42 +476,40 @@ namespace rlogic::internal
         return edgeCount;
     }
 
-    size_t DirectedAcyclicGraph::getOutDegree(Node& node) const
+    size_t DirectedAcyclicGraph::getOutDegree(const Node& node) const
     {
-        assert(containsNode(node));
-        const auto it = m_nodeOutgoingEdges.find(&node);
-        return std::accumulate(it->second.cbegin(), it->second.cend(), size_t(0u), [](size_t sum, const Edge& e) {
+        const auto& edges = m_nodes[getIndex(node)].outgoingEdges;
+        return std::accumulate(edges.cbegin(), edges.cend(), size_t(0u), [](size_t sum, const Edge& e) {
             return sum + e.multiplicity;
         });
     }
 
-    NodeVector DirectedAcyclicGraph::collectRootNodes() const
+    bool DirectedAcyclicGraph::containsNode(const Node& node) const
     {
-        NodeVector rootNodes;
-        // reserve to all nodes count because it will be used to store all sorted nodes later
-        rootNodes.reserve(m_nodeIncomingEdges.size());
-
-        for (const auto& nodeIngoingEdges : m_nodeIncomingEdges)
-        {
-            if (nodeIngoingEdges.second.empty())
-                rootNodes.push_back(nodeIngoingEdges.first);
-        }
+        // index alone is not enough, node could be part of another graph
+        const NodeIndex nodeIdx = node.getGraphIndex();
+        return nodeIdx < m_nodes.size() && m_nodes[nodeIdx].node == &node;
+    }
 
-        return rootNodes;
+    size_t DirectedAcyclicGraph::getRank(const Node& node) const
+    {
+        assert(m_orderValid && !m_sortedNodesDirty && m_orderHoles == 0u);
+        return m_nodes[getIndex(node)].rank;
     }
 
-    bool DirectedAcyclicGraph::containsNode(Node& node) const
+    DirectedAcyclicGraph::NodeIndex DirectedAcyclicGraph::getIndex(const Node& node) const
     {
-        return m_nodeOutgoingEdges.find(&node) != m_nodeOutgoingEdges.end();
+        assert(containsNode(node));
+        return node.getGraphIndex();
     }
 
-    DirectedAcyclicGraph::EdgeList::const_iterator DirectedAcyclicGraph::FindEdgeToNode(const EdgeList& vec, const Node& node)
+    DirectedAcyclicGraph::EdgeList::const_iterator DirectedAcyclicGraph::FindEdgeToNode(const EdgeList& vec, NodeIndex node)
     {
-        return std::find_if(vec.begin(), vec.end(), [&node](const auto& e) { return e.target == &node; });
+        return std::find_if(vec.begin(), vec.end(), [node](const auto& e) { return e.target == node; });
     }
 
-    DirectedAcyclicGraph::EdgeList::iterator DirectedAcyclicGraph::FindEdgeToNode(EdgeList& vec, const Node& node)
+    DirectedAcyclicGraph::EdgeList::iterator DirectedAcyclicGraph::FindEdgeToNode(EdgeList& vec, NodeIndex node)
     {
-        return std::find_if(vec.begin(), vec.end(), [&node](const auto& e) { return e.target == &node; });
+        return std::find_if(vec.begin(), vec.end(), [node](const auto& e) { return e.target == node; });
     }
 }
@@ -10,13 +10,12 @@
 
 #include <vector>
 #include <optional>
-#include <unordered_map>
 #include <cstdint>
 
 namespace rlogic::internal
 {
-    // We don't depend on any functionality of LogicNodeImpl here, just using the
-    // pointer as a unique identifier of the node
+    // The only functionality of LogicNodeImpl used here is its graph index (see LogicNodeImpl::getGraphIndex),
+    // which the graph assigns when a node is added
     class LogicNodeImpl;
 
     // TODO narrow down the scope of this typedef
@@ -30,8 +29,12 @@ namespace rlogic::internal
     // number of total links of node properties to other nodes' properties, i.e. if two nodes A and B have three connected
     // properties, and node A and C have two connected properties, then addEdge(A, B) will have been called 3 times,
     // addEdge(A, C) two times, and A will have outDegree=5.
-    // Topological sort result is cached because it's sensitive for performance (and is only
-    // executed once before update()
+    // The topological order is maintained incrementally (Pearce-Kelly dynamic topological sort): every node has a rank,
+    // and adding an edge which contradicts the current ranks only reorders the nodes between the ranks of the edge's source
+    // and target. Removing edges or nodes never invalidates the order. Only when an edge closes a cycle the order is dropped
+    // and recomputed from scratch on next query, which also collects the nodes forming the cycle for error reporting.
+    // Nodes are stored in a dense array indexed by the graph index assigned to each node in addNode, edges refer to
+    // nodes by that index, so no hashing is involved in any of the graph operations.
     class DirectedAcyclicGraph
     {
     public:
@@ -40,37 +43,102 @@ namespace rlogic::internal
 
         void addNode(Node& node);
         void removeNode(Node& node);
-        [[nodiscard]] bool containsNode(Node& node) const;
+        [[nodiscard]] bool containsNode(const Node& node) const;
 
         bool addEdge(Node& source, Node& target);
         void removeEdge(Node& source, Node& target);
 
-        [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes() const;
+        // Weak edges (see LogicEngine::linkWeak) do not influence the topological order and may form cycles,
+        // they are only considered when grouping nodes into update levels
+        void addWeakEdge(Node& source, Node& target);
+        void removeWeakEdge(Node& source, Node& target);
+
+        // Returns nullopt if there is a cycle in the graph
+        [[nodiscard]] const std::optional<NodeVector>& getTopologicallySortedNodes();
+        // Nodes forming a cycle (ordered along the edges) found by last call to getTopologicallySortedNodes, empty if there was none
+        [[nodiscard]] const NodeVector& getCycle() const;
+
+        // Groups the topologically sorted nodes into levels so that executing the levels one after another, and the nodes
+        // within a level in any order, yields the same result as executing the sorted nodes one by one (provided that
+        // links are activated only after all nodes of a level were executed). Nodes within a level are ordered by rank.
+        // Must be called only after getTopologicallySortedNodes succeeded.
+        [[nodiscard]] const std::vector<NodeVector>& getUpdateLevels();
+        // Position of node in the sorted nodes, must be called only after getTopologicallySortedNodes succeeded
+        [[nodiscard]] size_t getRank(const Node& node) const;
 
         // For testing only
-        [[nodiscard]] size_t getInDegree(Node& node) const;
-        [[nodiscard]] size_t getOutDegree(Node& node) const;
+        [[nodiscard]] size_t getInDegree(const Node& node) const;
+        [[nodiscard]] size_t getOutDegree(const Node& node) const;
 
     private:
+        using NodeIndex = size_t;
+        using NodeIndices = std::vector<NodeIndex>;
+
         struct Edge
         {
-            Node* target = nullptr;
+            NodeIndex target = 0u;
             size_t multiplicity = 0u;
         };
         using EdgeList = std::vector<Edge>;
 
-        NodeVector collectRootNodes() const;
+        struct NodeData
+        {
+            // nullptr if this slot is not used by any node (it was removed and is ready to be reused)
+            Node* node = nullptr;
+            // Edges from source node to target nodes (edge can have more than 1 instance represented by multiplicity)
+            EdgeList outgoingEdges;
+            // Reverse relation from target node to all its source nodes (here without keeping edge multiplicity count)
+            NodeIndices incomingEdges;
+            // Same as above for weak edges
+            EdgeList weakOutgoingEdges;
+            NodeIndices weakIncomingEdges;
+            // Position of the node in m_order
+            size_t rank = 0u;
+            // Index into m_updateLevels, valid only if levels are not dirty
+            size_t level = 0u;
+            // Scratch data used by the sorting algorithms, not valid outside of them
+            size_t pendingIncomingEdges = 0u;
+            bool visited = false;
+        };
+
+        [[nodiscard]] NodeIndex getIndex(const Node& node) const;
+
+        bool discoverForward(NodeIndex start, size_t upperBound, NodeIndex cycleTarget);
+        void discoverBackward(NodeIndex start, size_t lowerBound);
+        void reorderDiscoveredNodes();
+        void compactOrder();
+        bool sortFromScratch();
+        void collectCycle();
+        void computeUpdateLevels();
+
+        static bool AddEdgeInstance(EdgeList& sourceOutgoingEdges, NodeIndices& targetIncomingEdges, NodeIndex source, NodeIndex target);
+        static void RemoveEdgeInstance(EdgeList& sourceOutgoingEdges, NodeIndices& targetIncomingEdges, NodeIndex source, NodeIndex target);
+        static EdgeList::const_iterator FindEdgeToNode(const EdgeList& vec, NodeIndex node);
+        static EdgeList::iterator FindEdgeToNode(EdgeList& vec, NodeIndex node);
+
+        // Indexed by graph index of node, removed nodes leave unused slots which are reused by next added node
+        std::vector<NodeData> m_nodes;
+        NodeIndices m_freeNodeIndices;
+
+        // Node indices ordered by their rank, removed nodes leave holes (InvalidGraphIndex) until the order is compacted
+        NodeIndices m_order;
+        size_t m_orderHoles = 0u;
+        // False after an edge closed a cycle, m_order does not reflect edges then
+        bool m_orderValid = true;
 
-        static EdgeList::const_iterator FindEdgeToNode(const EdgeList& vec, const Node& node);
-        static EdgeList::iterator FindEdgeToNode(EdgeList& vec, const Node& node);
+        // Compacted m_order given out to users
+        std::optional<NodeVector> m_sortedNodes = NodeVector{};
+        bool m_sortedNodesDirty = false;
+        NodeVector m_cycle;
 
-        // Stores both nodes and their edges in one hashmap
-        // If a node has no outgoing links, the 'EdgeList' is empty
-        // Each entry in 'EdgeList' represents an edge to another node
+        // Levels are invalidated by any change in edges or order and recomputed on next query
+        std::vector<NodeVector> m_updateLevels;
+        bool m_updateLevelsDirty = true;
 
-        // Edges from source node to target nodes (edge can have more than 1 instance represented by multiplicity)
-        std::unordered_map<Node*, EdgeList> m_nodeOutgoingEdges;
-        // Reverse relation from target node to all its source nodes (here without keeping edge multiplicity count)
-        std::unordered_map<Node*, NodeVector> m_nodeIncomingEdges;
+        // Scratch containers for the incremental reordering, kept as members to reuse their memory
+        NodeIndices m_forwardDiscovered;
+        NodeIndices m_backwardDiscovered;
+        NodeIndices m_discoveryStack;
+        std::vector<size_t> m_discoveredRanks;
     };
 }
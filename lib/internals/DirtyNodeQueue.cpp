@@ -0,0 +1,161 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/DirtyNodeQueue.h"
+
+#include "impl/LogicNodeImpl.h"
+
+#include <array>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    constexpr size_t BitsPerWord = 64u;
+
+    // Index of lowest set bit (De Bruijn multiplication), word must not be 0
+    static size_t LowestSetBit(uint64_t word)
+    {
+        constexpr uint64_t DeBruijnSequence = 0x03f79d71b4cb0a89u;
+        constexpr std::array<uint8_t, 64u> DeBruijnIndex = {
+             0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+            62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+            63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+            46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+        };
+        assert(word != 0u);
+        return DeBruijnIndex[((word & (~word + 1u)) * DeBruijnSequence) >> 58u];
+    }
+
+    DirtyNodeQueue::DirtyNodeQueue(const DirectedAcyclicGraph& graph)
+        : m_graph{ graph }
+    {
+    }
+
+    void DirtyNodeQueue::push(LogicNodeImpl& node)
+    {
+        if (m_sortedNodes != nullptr)
+        {
+            const size_t rank = m_graph.getRank(node);
+            if (rank >= m_nextRank)
+            {
+                pushRank(rank);
+                return;
+            }
+        }
+
+        const size_t graphIndex = node.getGraphIndex();
+        if (graphIndex >= m_pendingSlots.size())
+            m_pendingSlots.resize(graphIndex + 1u, NotPending);
+        if (m_pendingSlots[graphIndex] == NotPending)
+        {
+            m_pendingSlots[graphIndex] = m_pendingNodes.size();
+            m_pendingNodes.push_back(&node);
+        }
+    }
+
+    void DirtyNodeQueue::remove(LogicNodeImpl& node)
+    {
+        assert(m_sortedNodes == nullptr);
+        const size_t graphIndex = node.getGraphIndex();
+        if (graphIndex < m_pendingSlots.size() && m_pendingSlots[graphIndex] != NotPending)
+        {
+            // pending nodes are unordered, move last one into the slot of the removed node
+            const size_t slot = m_pendingSlots[graphIndex];
+            assert(m_pendingNodes[slot] == &node);
+            LogicNodeImpl* lastNode = m_pendingNodes.back();
+            m_pendingNodes[slot] = lastNode;
+            m_pendingSlots[lastNode->getGraphIndex()] = slot;
+            m_pendingNodes.pop_back();
+            m_pendingSlots[graphIndex] = NotPending;
+        }
+    }
+
+    void DirtyNodeQueue::startProcessing(const NodeVector& sortedNodes)
+    {
+        assert(m_sortedNodes == nullptr);
+        m_sortedNodes = &sortedNodes;
+        m_rankBits.assign((sortedNodes.size() + BitsPerWord - 1u) / BitsPerWord, 0u);
+        m_nextRank = 0u;
+        m_visitedNodes = 0u;
+
+        for (LogicNodeImpl* node : m_pendingNodes)
+        {
+            m_pendingSlots[node->getGraphIndex()] = NotPending;
+            // node might have been executed in the meantime without this queue (e.g. by parallel update)
+            if (node->isDirty())
+                pushRank(m_graph.getRank(*node));
+        }
+        m_pendingNodes.clear();
+    }
+
+    LogicNodeImpl* DirtyNodeQueue::popNext()
+    {
+        assert(m_sortedNodes != nullptr);
+        // all ranks below m_nextRank were already popped, no need to mask them out
+        for (size_t wordIdx = m_nextRank / BitsPerWord; wordIdx < m_rankBits.size(); ++wordIdx)
+        {
+            uint64_t& word = m_rankBits[wordIdx];
+            if (word != 0u)
+            {
+                const size_t rank = wordIdx * BitsPerWord + LowestSetBit(word);
+                word &= word - 1u;
+                m_nextRank = rank + 1u;
+                ++m_visitedNodes;
+                return (*m_sortedNodes)[rank];
+            }
+        }
+
+        m_nextRank = m_sortedNodes->size();
+        return nullptr;
+    }
+
+    void DirtyNodeQueue::finishProcessing()
+    {
+        assert(m_sortedNodes != nullptr);
+        const NodeVector& sortedNodes = *m_sortedNodes;
+        // stop ordering nodes before collecting the left over ones
+        m_sortedNodes = nullptr;
+
+        for (size_t wordIdx = 0u; wordIdx < m_rankBits.size(); ++wordIdx)
+        {
+            for (uint64_t word = m_rankBits[wordIdx]; word != 0u; word &= word - 1u)
+                push(*sortedNodes[wordIdx * BitsPerWord + LowestSetBit(word)]);
+        }
+        m_rankBits.clear();
+    }
+
+    void DirtyNodeQueue::dropCleanNodes()
+    {
+        assert(m_sortedNodes == nullptr);
+        size_t keptNodes = 0u;
+        for (LogicNodeImpl* node : m_pendingNodes)
+        {
+            if (node->isDirty())
+            {
+                m_pendingSlots[node->getGraphIndex()] = keptNodes;
+                m_pendingNodes[keptNodes++] = node;
+            }
+            else
+            {
+                m_pendingSlots[node->getGraphIndex()] = NotPending;
+            }
+        }
+        m_pendingNodes.resize(keptNodes);
+    }
+
+    size_t DirtyNodeQueue::getVisitedNodesCount() const
+    {
+        return m_visitedNodes;
+    }
+
+    void DirtyNodeQueue::pushRank(size_t rank)
+    {
+        assert(rank < m_rankBits.size() * BitsPerWord);
+        m_rankBits[rank / BitsPerWord] |= (uint64_t{ 1u } << (rank % BitsPerWord));
+    }
+}
@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/DirectedAcyclicGraph.h"
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+namespace rlogic::internal
+{
+    // Keeps track of dirty logic nodes so that update only visits the nodes which need to be executed instead of checking
+    // dirtiness of every node. Nodes report becoming dirty themselves (see LogicNodeImpl::setDirty) and are collected unordered.
+    // When processing starts they are moved to a bucket queue keyed by topological rank, with one bit per rank because ranks are
+    // unique, which hands them out in rank order. A node dirtied during processing (by link activation) is added to the bucket queue
+    // if its rank was not passed yet, otherwise (target of a weak link) it stays pending until next processing.
+    class DirtyNodeQueue
+    {
+    public:
+        explicit DirtyNodeQueue(const DirectedAcyclicGraph& graph);
+
+        // Node must be contained in the graph
+        void push(LogicNodeImpl& node);
+        void remove(LogicNodeImpl& node);
+
+        // Must be called with the current topological order (see DirectedAcyclicGraph::getTopologicallySortedNodes)
+        // and no graph modifications are allowed until finishProcessing
+        void startProcessing(const NodeVector& sortedNodes);
+        // Returns dirty node with lowest rank or nullptr if there is none left
+        [[nodiscard]] LogicNodeImpl* popNext();
+        // Nodes not popped (e.g. because of an error during update) stay pending
+        void finishProcessing();
+
+        // Forgets pending nodes which are not dirty anymore (e.g. executed without this queue by parallel update)
+        void dropCleanNodes();
+
+        // Number of nodes handed out since last startProcessing
+        [[nodiscard]] size_t getVisitedNodesCount() const;
+
+    private:
+        void pushRank(size_t rank);
+
+        const DirectedAcyclicGraph& m_graph;
+
+        // Dirty nodes not yet ordered. Position of each node in m_pendingNodes indexed by graph index (NotPending if not there)
+        // to avoid duplicates and remove nodes in constant time
+        static constexpr size_t NotPending = std::numeric_limits<size_t>::max();
+        NodeVector m_pendingNodes;
+        std::vector<size_t> m_pendingSlots;
+
+        // Bucket queue, valid only during processing
+        const NodeVector* m_sortedNodes = nullptr;
+        std::vector<uint64_t> m_rankBits;
+        size_t m_nextRank = 0u;
+        size_t m_visitedNodes = 0u;
+    };
+}
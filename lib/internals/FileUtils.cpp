@@ -9,9 +9,121 @@
 #include "FileUtils.h"
 #include "StdFilesystemWrapper.h"
 #include <fstream>
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
 
 namespace rlogic::internal
 {
+#if !defined(_WIN32)
+    static std::optional<MappedBinary> MapFileRegion(int fd, size_t offset, size_t size)
+    {
+        // mapping must start at page boundary
+        const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t mappingOffset = offset - offset % pageSize;
+        const size_t mappingSize = size + (offset - mappingOffset);
+        void* mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(mappingOffset));
+        if (mapping == MAP_FAILED) // NOLINT(cppcoreguidelines-pro-type-cstyle-cast) system macro
+        {
+            return std::nullopt;
+        }
+        return MappedBinary(mapping, mappingSize, offset - mappingOffset, size);
+    }
+#endif
+
+    MappedBinary::MappedBinary(std::vector<char> bytes)
+        : m_dataSize(bytes.size())
+        , m_bytes(std::move(bytes))
+    {
+    }
+
+    MappedBinary::MappedBinary(void* mapping, size_t mappingSize, size_t dataOffset, size_t dataSize)
+        : m_mapping(mapping)
+        , m_mappingSize(mappingSize)
+        , m_dataOffset(dataOffset)
+        , m_dataSize(dataSize)
+    {
+        assert(dataOffset + dataSize <= mappingSize);
+    }
+
+    MappedBinary::~MappedBinary()
+    {
+        release();
+    }
+
+    MappedBinary::MappedBinary(MappedBinary&& other) noexcept
+        : m_mapping(other.m_mapping)
+        , m_mappingSize(other.m_mappingSize)
+        , m_dataOffset(other.m_dataOffset)
+        , m_dataSize(other.m_dataSize)
+        , m_bytes(std::move(other.m_bytes))
+    {
+        other.m_mapping = nullptr;
+        other.m_mappingSize = 0u;
+        other.m_dataOffset = 0u;
+        other.m_dataSize = 0u;
+    }
+
+    MappedBinary& MappedBinary::operator=(MappedBinary&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            m_mapping = other.m_mapping;
+            m_mappingSize = other.m_mappingSize;
+            m_dataOffset = other.m_dataOffset;
+            m_dataSize = other.m_dataSize;
+            m_bytes = std::move(other.m_bytes);
+            other.m_mapping = nullptr;
+            other.m_mappingSize = 0u;
+            other.m_dataOffset = 0u;
+            other.m_dataSize = 0u;
+        }
+        return *this;
+    }
+
+    const char* MappedBinary::data() const
+    {
+        if (m_mapping != nullptr)
+        {
+            return static_cast<const char*>(m_mapping) + m_dataOffset;
+        }
+        return m_bytes.data();
+    }
+
+    size_t MappedBinary::size() const
+    {
+        return m_dataSize;
+    }
+
+    bool MappedBinary::isMemoryMapped() const
+    {
+        return m_mapping != nullptr;
+    }
+
+    void MappedBinary::release()
+    {
+#if !defined(_WIN32)
+        if (m_mapping != nullptr)
+        {
+            munmap(m_mapping, m_mappingSize);
+        }
+#endif
+        m_mapping = nullptr;
+        m_mappingSize = 0u;
+        m_bytes.clear();
+    }
+
     bool FileUtils::SaveBinary(const std::string& filename, const void* binaryBuffer, size_t bufferLength)
     {
         std::ofstream fileStream(filename, std::ofstream::binary);
@@ -23,6 +135,35 @@ namespace rlogic::internal
         return !fileStream.bad();
     }
 
+    bool FileUtils::SaveBinary(int fd, const void* binaryBuffer, size_t bufferLength)
+    {
+        // large buffers are written in chunks, a single write call of the whole buffer is not guaranteed to write everything
+        constexpr size_t ChunkSize = 1024u * 1024u;
+        const auto* data = static_cast<const char*>(binaryBuffer);
+        size_t bytesLeft = bufferLength;
+        while (bytesLeft > 0u)
+        {
+            const size_t chunkSize = std::min(bytesLeft, ChunkSize);
+#if defined(_WIN32)
+            const auto bytesWritten = _write(fd, data, static_cast<unsigned int>(chunkSize));
+#else
+            const auto bytesWritten = ::write(fd, data, chunkSize);
+            if (bytesWritten < 0 && errno == EINTR)
+            {
+                continue;
+            }
+#endif
+            if (bytesWritten <= 0)
+            {
+                return false;
+            }
+            data += bytesWritten;
+            bytesLeft -= static_cast<size_t>(bytesWritten);
+        }
+
+        return true;
+    }
+
     std::optional<std::vector<char>> FileUtils::LoadBinary(const std::string& filename)
     {
         // ifstream does not prevent opening directories (and crashes in some cases), have to use filesystem to check
@@ -71,4 +212,68 @@ namespace rlogic::internal
         }
         return byteBuffer;
     }
+
+    std::optional<MappedBinary> FileUtils::MapBinary(const std::string& filename)
+    {
+#if !defined(_WIN32)
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) system call
+        const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd >= 0)
+        {
+            std::optional<MappedBinary> mappedFile;
+            struct stat fileStat {};
+            // directories, empty files etc. are handled by LoadBinary
+            if (fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode) && fileStat.st_size > 0)
+            {
+                mappedFile = MapFileRegion(fd, 0u, static_cast<size_t>(fileStat.st_size));
+            }
+            // mapping stays valid after closing the file
+            ::close(fd);
+            if (mappedFile)
+            {
+                return mappedFile;
+            }
+        }
+#endif
+
+        std::optional<std::vector<char>> bytesFromFile = LoadBinary(filename);
+        if (!bytesFromFile)
+        {
+            return std::nullopt;
+        }
+        return MappedBinary(std::move(*bytesFromFile));
+    }
+
+    std::optional<MappedBinary> FileUtils::MapBinary(int fd, size_t offset, size_t size)
+    {
+#if !defined(_WIN32)
+        struct stat fileStat {};
+        if (size > 0u && fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode))
+        {
+            const auto fileSize = static_cast<size_t>(fileStat.st_size);
+            // mapping beyond end of file would succeed, but accessing such memory would not
+            const bool isInFileRange = (offset < fileSize && size <= fileSize - offset);
+            std::optional<MappedBinary> mappedFile;
+            // data must be aligned as if it was loaded to heap memory (flatbuffers read scalars in place),
+            // otherwise it is copied
+            if (isInFileRange && offset % alignof(std::max_align_t) == 0u)
+            {
+                mappedFile = MapFileRegion(fd, offset, size);
+            }
+            if (mappedFile || !isInFileRange)
+            {
+                ::close(fd);
+                return mappedFile;
+            }
+        }
+#endif
+
+        // closes fd
+        std::optional<std::vector<char>> bytesFromFile = LoadBinary(fd, offset, size);
+        if (!bytesFromFile)
+        {
+            return std::nullopt;
+        }
+        return MappedBinary(std::move(*bytesFromFile));
+    }
 }
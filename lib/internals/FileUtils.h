@@ -14,11 +14,46 @@
 
 namespace rlogic::internal
 {
+    // Read-only view of (a part of) a file, which is memory mapped if the platform and the file allow it,
+    // otherwise the content is read into memory. The mapping is released when the object is destroyed.
+    class MappedBinary
+    {
+    public:
+        explicit MappedBinary(std::vector<char> bytes);
+        MappedBinary(void* mapping, size_t mappingSize, size_t dataOffset, size_t dataSize);
+        ~MappedBinary();
+
+        MappedBinary(MappedBinary&& other) noexcept;
+        MappedBinary& operator=(MappedBinary&& other) noexcept;
+        MappedBinary(const MappedBinary& other) = delete;
+        MappedBinary& operator=(const MappedBinary& other) = delete;
+
+        [[nodiscard]] const char* data() const;
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] bool isMemoryMapped() const;
+
+    private:
+        void release();
+
+        void* m_mapping = nullptr;
+        size_t m_mappingSize = 0u;
+        size_t m_dataOffset = 0u;
+        size_t m_dataSize = 0u;
+        std::vector<char> m_bytes;
+    };
+
     class FileUtils
     {
     public:
         static bool SaveBinary(const std::string& filename, const void* binaryBuffer, size_t bufferLength);
+        // Writes to the current position of the file descriptor in chunks (works also with pipes and sockets), fd stays open
+        static bool SaveBinary(int fd, const void* binaryBuffer, size_t bufferLength);
         static std::optional<std::vector<char>> LoadBinary(const std::string& filename);
         static std::optional<std::vector<char>> LoadBinary(int fd, size_t offset, size_t size);
+
+        // Same as LoadBinary, but the file content is memory mapped instead of copied where possible (falls back to LoadBinary otherwise)
+        static std::optional<MappedBinary> MapBinary(const std::string& filename);
+        // The file descriptor is closed after this call (same as with LoadBinary)
+        static std::optional<MappedBinary> MapBinary(int fd, size_t offset, size_t size);
     };
 }
@@ -0,0 +1,79 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/KeyframeCursor.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rlogic::internal
+{
+    // Timestamps of uniformly sampled channels can deviate from ideal grid by this fraction of the sample step
+    // (accumulated float errors of baked timestamps). Computed position is then off by at most one and gets corrected
+    // by checking the neighbouring segments.
+    static constexpr float UniformSamplingTolerance = 0.25f;
+
+    void KeyframeCursor::reset(const std::vector<float>& timestamps)
+    {
+        m_upperBound = 0u;
+        // NaN timestamps are not in ascending order either
+        m_isAscending = (std::adjacent_find(timestamps.cbegin(), timestamps.cend(), [](float t1, float t2) { return !(t1 < t2); }) == timestamps.cend());
+        m_isUniform = false;
+        if (!m_isAscending || timestamps.size() < 3u)
+            return;
+
+        const float sampleStep = (timestamps.back() - timestamps.front()) / static_cast<float>(timestamps.size() - 1u);
+        for (size_t i = 1u; i < timestamps.size(); ++i)
+        {
+            const float expectedTimestamp = timestamps.front() + static_cast<float>(i) * sampleStep;
+            if (std::abs(timestamps[i] - expectedTimestamp) > UniformSamplingTolerance * sampleStep)
+                return;
+        }
+
+        m_isUniform = true;
+        m_firstTimestamp = timestamps.front();
+        m_inverseSampleStep = 1.f / sampleStep;
+    }
+
+    size_t KeyframeCursor::findUpperBound(const std::vector<float>& timestamps, float time)
+    {
+        if (!m_isAscending)
+            return static_cast<size_t>(std::distance(timestamps.cbegin(), std::upper_bound(timestamps.cbegin(), timestamps.cend(), time)));
+
+        if (m_isUniform)
+        {
+            // first timestamp after the sample at or before time, clamped to valid range (also for NaN)
+            const float samplePosition = std::floor((time - m_firstTimestamp) * m_inverseSampleStep) + 1.f;
+            const float maxPosition = static_cast<float>(timestamps.size());
+            m_upperBound = (samplePosition > 0.f ? static_cast<size_t>(std::min(samplePosition, maxPosition)) : 0u);
+        }
+
+        if (IsUpperBound(timestamps, time, m_upperBound))
+            return m_upperBound;
+
+        // animation moved to neighbouring segment, in either direction
+        if (m_upperBound < timestamps.size() && IsUpperBound(timestamps, time, m_upperBound + 1u))
+            return ++m_upperBound;
+        if (m_upperBound > 0u && IsUpperBound(timestamps, time, m_upperBound - 1u))
+            return --m_upperBound;
+
+        m_upperBound = static_cast<size_t>(std::distance(timestamps.cbegin(), std::upper_bound(timestamps.cbegin(), timestamps.cend(), time)));
+        return m_upperBound;
+    }
+
+    bool KeyframeCursor::isUniformlySampled() const
+    {
+        return m_isUniform;
+    }
+
+    bool KeyframeCursor::IsUpperBound(const std::vector<float>& timestamps, float time, size_t idx)
+    {
+        // same conditions std::upper_bound uses, i.e. also NaN time is handled the same way
+        return (idx == 0u || !(time < timestamps[idx - 1u])) && (idx == timestamps.size() || time < timestamps[idx]);
+    }
+}
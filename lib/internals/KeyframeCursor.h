@@ -0,0 +1,41 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace rlogic::internal
+{
+    // Finds position of animation time within timestamps of a channel, with the same result as std::upper_bound.
+    // Remembers the position found last time, animation time usually moves by a small step between updates, so
+    // the remembered segment and its neighbours are checked first and binary search is needed only after a jump.
+    // Position in uniformly sampled timestamps (e.g. baked animations) is computed from the time directly.
+    class KeyframeCursor
+    {
+    public:
+        // Must be called whenever timestamps change, detects if they are uniformly sampled. Cursor is not used at all
+        // for timestamps which are not in ascending order (possible only when modified through properties).
+        void reset(const std::vector<float>& timestamps);
+
+        // Index of first timestamp greater than time (or timestamps.size() if there is none), same as std::upper_bound
+        [[nodiscard]] size_t findUpperBound(const std::vector<float>& timestamps, float time);
+
+        [[nodiscard]] bool isUniformlySampled() const;
+
+    private:
+        [[nodiscard]] static bool IsUpperBound(const std::vector<float>& timestamps, float time, size_t idx);
+
+        size_t m_upperBound = 0u;
+        bool m_isAscending = false;
+        bool m_isUniform = false;
+        float m_firstTimestamp = 0.f;
+        float m_inverseSampleStep = 0.f;
+    };
+}
@@ -0,0 +1,131 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/KeyframeQuantization.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace rlogic::internal
+{
+    // Three smallest components of unit quaternion are within [-1/sqrt(2), 1/sqrt(2)]
+    static constexpr float QuaternionComponentRange = 0.70710678118f;
+    static constexpr float MaxQuantizedQuaternionComponent = 32767.f;
+    // Allowed deviation of squared length of quaternion from 1
+    static constexpr float UnitQuaternionTolerance = 1e-3f;
+
+    std::optional<KeyframeQuantization::QuantizedFloats> KeyframeQuantization::QuantizeFloats(const std::vector<float>& flattenedValues, size_t componentCount)
+    {
+        assert(componentCount > 0u && flattenedValues.size() % componentCount == 0u);
+
+        QuantizedFloats result;
+        result.componentMin.assign(componentCount, 0.f);
+        result.componentMax.assign(componentCount, 0.f);
+        if (flattenedValues.empty())
+            return result;
+
+        std::copy(flattenedValues.cbegin(), flattenedValues.cbegin() + static_cast<std::ptrdiff_t>(componentCount), result.componentMin.begin());
+        std::copy(flattenedValues.cbegin(), flattenedValues.cbegin() + static_cast<std::ptrdiff_t>(componentCount), result.componentMax.begin());
+        for (size_t i = 0u; i < flattenedValues.size(); ++i)
+        {
+            const float value = flattenedValues[i];
+            if (!std::isfinite(value))
+                return std::nullopt;
+            const size_t component = i % componentCount;
+            result.componentMin[component] = std::min(result.componentMin[component], value);
+            result.componentMax[component] = std::max(result.componentMax[component], value);
+        }
+
+        for (size_t component = 0u; component < componentCount; ++component)
+        {
+            if (!std::isfinite(result.componentMax[component] - result.componentMin[component]))
+                return std::nullopt;
+        }
+
+        result.values.resize(flattenedValues.size());
+        for (size_t i = 0u; i < flattenedValues.size(); ++i)
+        {
+            const size_t component = i % componentCount;
+            const float range = result.componentMax[component] - result.componentMin[component];
+            const float normalized = (range > 0.f ? (flattenedValues[i] - result.componentMin[component]) / range : 0.f);
+            result.values[i] = static_cast<uint16_t>(std::lround(std::clamp(normalized, 0.f, 1.f) * MaxQuantizedFloat));
+        }
+
+        return result;
+    }
+
+    bool KeyframeQuantization::AreUnitQuaternions(const std::vector<vec4f>& quaternions)
+    {
+        return std::all_of(quaternions.cbegin(), quaternions.cend(), [](const vec4f& q) {
+            const float lengthSquared = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
+            // also false for NaN or infinite components
+            return std::abs(lengthSquared - 1.f) <= UnitQuaternionTolerance;
+        });
+    }
+
+    std::vector<uint16_t> KeyframeQuantization::PackQuaternions(const std::vector<vec4f>& quaternions)
+    {
+        assert(AreUnitQuaternions(quaternions));
+
+        std::vector<uint16_t> packed;
+        packed.reserve(quaternions.size() * PackedQuaternionSize);
+        for (const vec4f& q : quaternions)
+        {
+            const float length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            size_t largestIdx = 0u;
+            for (size_t i = 1u; i < 4u; ++i)
+            {
+                if (std::abs(q[i]) > std::abs(q[largestIdx]))
+                    largestIdx = i;
+            }
+
+            // 2 bits index of largest component, 1 bit its sign, 3 x 15 bits remaining components
+            uint64_t bits = largestIdx | (q[largestIdx] < 0.f ? 4u : 0u);
+            uint32_t shift = 3u;
+            for (size_t i = 0u; i < 4u; ++i)
+            {
+                if (i == largestIdx)
+                    continue;
+                const float normalized = (q[i] / length + QuaternionComponentRange) / (2.f * QuaternionComponentRange);
+                bits |= static_cast<uint64_t>(std::lround(std::clamp(normalized, 0.f, 1.f) * MaxQuantizedQuaternionComponent)) << shift;
+                shift += 15u;
+            }
+
+            packed.push_back(static_cast<uint16_t>(bits & 0xFFFFu));
+            packed.push_back(static_cast<uint16_t>((bits >> 16u) & 0xFFFFu));
+            packed.push_back(static_cast<uint16_t>((bits >> 32u) & 0xFFFFu));
+        }
+
+        return packed;
+    }
+
+    vec4f KeyframeQuantization::UnpackQuaternion(uint16_t packed0, uint16_t packed1, uint16_t packed2)
+    {
+        const uint64_t bits = static_cast<uint64_t>(packed0) | (static_cast<uint64_t>(packed1) << 16u) | (static_cast<uint64_t>(packed2) << 32u);
+        const size_t largestIdx = bits & 3u;
+        const bool largestIsNegative = (bits & 4u) != 0u;
+
+        vec4f q{};
+        float sumOfSquares = 0.f;
+        uint32_t shift = 3u;
+        for (size_t i = 0u; i < 4u; ++i)
+        {
+            if (i == largestIdx)
+                continue;
+            const float normalized = static_cast<float>((bits >> shift) & 0x7FFFu) / MaxQuantizedQuaternionComponent;
+            q[i] = normalized * (2.f * QuaternionComponentRange) - QuaternionComponentRange;
+            sumOfSquares += q[i] * q[i];
+            shift += 15u;
+        }
+
+        const float largest = std::sqrt(std::max(0.f, 1.f - sumOfSquares));
+        q[largestIdx] = (largestIsNegative ? -largest : largest);
+        return q;
+    }
+}
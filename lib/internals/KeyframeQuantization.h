@@ -0,0 +1,57 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/DataTypes.h"
+
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+namespace rlogic::internal
+{
+    // Lossy encodings of keyframe data used when saving DataArrays compressed (feature level 07 and higher).
+    // Values are decoded back to floats when loading, animation nodes then work with full precision data as usual.
+    class KeyframeQuantization
+    {
+    public:
+        struct QuantizedFloats
+        {
+            std::vector<uint16_t> values;
+            // range of every component over the whole array, e.g. x/y/z of vec3f keyframes
+            std::vector<float> componentMin;
+            std::vector<float> componentMax;
+        };
+
+        // Maps every component linearly from its range to 16 bits, error is at most half of (max - min) / 65535.
+        // Fails for values which are not finite or whose range can't be represented as float.
+        [[nodiscard]] static std::optional<QuantizedFloats> QuantizeFloats(const std::vector<float>& flattenedValues, size_t componentCount);
+
+        // Exact for the minimum and maximum of the range
+        [[nodiscard]] static float DequantizeFloat(uint16_t value, float componentMin, float componentMax)
+        {
+            const float t = static_cast<float>(value) / MaxQuantizedFloat;
+            return (1.f - t) * componentMin + t * componentMax;
+        }
+
+        // Unit quaternions are stored as their three smallest components (15 bits each), index and sign of the
+        // largest component, which is recomputed on load, in 48 bits (3 x uint16). Sign of the quaternion is preserved
+        // so that interpolation between keyframes goes the same way as before compression.
+        static constexpr size_t PackedQuaternionSize = 3u;
+
+        // True if all quaternions are finite and of unit length (within tolerance), only such can be packed
+        [[nodiscard]] static bool AreUnitQuaternions(const std::vector<vec4f>& quaternions);
+        [[nodiscard]] static std::vector<uint16_t> PackQuaternions(const std::vector<vec4f>& quaternions);
+        [[nodiscard]] static vec4f UnpackQuaternion(uint16_t packed0, uint16_t packed1, uint16_t packed2);
+
+    private:
+        static constexpr float MaxQuantizedFloat = 65535.f;
+    };
+}
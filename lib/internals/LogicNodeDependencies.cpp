@@ -27,22 +27,22 @@ namespace rlogic::internal
     {
         assert(!m_logicNodeDAG.containsNode(node));
         m_logicNodeDAG.addNode(node);
-        m_nodeTopologyChanged = true;
+        node.setDirtyNodeQueue(&m_dirtyNodes);
+        if (node.isDirty())
+            m_dirtyNodes.push(node);
     }
 
     void LogicNodeDependencies::removeNode(LogicNodeImpl& node)
     {
         assert(m_logicNodeDAG.containsNode(node));
+        // links themselves are removed by the properties of the node when it gets deleted
+        if (node.getInputs() != nullptr)
+            unregisterLinksRecursive(*node.getInputs()->m_impl);
+        if (node.getOutputs() != nullptr)
+            unregisterLinksRecursive(*node.getOutputs()->m_impl);
+        m_dirtyNodes.remove(node);
+        node.setDirtyNodeQueue(nullptr);
         m_logicNodeDAG.removeNode(node);
-
-        // Remove the node from the cache without reordering the rest (unless there is no cache yet)
-        // Removing nodes does not require topology update (we don't guarantee specific ordering when
-        // nodes are not related, we only guarantee relative ordering when nodes are linked)
-        if (m_cachedTopologicallySortedNodes)
-        {
-            NodeVector& cachedNodes = *m_cachedTopologicallySortedNodes;
-            cachedNodes.erase(std::remove(cachedNodes.begin(), cachedNodes.end(), &node), cachedNodes.end());
-        }
     }
 
     bool LogicNodeDependencies::isLinked(const LogicNodeImpl& logicNode) const
@@ -87,15 +87,25 @@ namespace rlogic::internal
         return false;
     }
 
+    DirtyNodeQueue& LogicNodeDependencies::getDirtyNodes()
+    {
+        return m_dirtyNodes;
+    }
+
     const std::optional<NodeVector>& LogicNodeDependencies::getTopologicallySortedNodes()
     {
-        if (m_nodeTopologyChanged)
-        {
-            m_cachedTopologicallySortedNodes = m_logicNodeDAG.getTopologicallySortedNodes();
-            m_nodeTopologyChanged = false;
-        }
+        // DAG maintains the order incrementally on every link change, no need to cache it here
+        return m_logicNodeDAG.getTopologicallySortedNodes();
+    }
 
-        return m_cachedTopologicallySortedNodes;
+    const NodeVector& LogicNodeDependencies::getNodesInCycle() const
+    {
+        return m_logicNodeDAG.getCycle();
+    }
+
+    const std::vector<NodeVector>& LogicNodeDependencies::getUpdateLevels()
+    {
+        return m_logicNodeDAG.getUpdateLevels();
     }
 
     bool LogicNodeDependencies::link(PropertyImpl& output, PropertyImpl& input, bool isWeakLink, ErrorReporting& errorReporting)
@@ -156,15 +166,12 @@ namespace rlogic::internal
         }
 
         input.setIncomingLink(output, isWeakLink);
+        registerLink(output, input, isWeakLink);
 
-        if (!isWeakLink)
-        {
-            const bool isNewEdge = m_logicNodeDAG.addEdge(output.getLogicNode(), input.getLogicNode());
-            if (isNewEdge)
-            {
-                m_nodeTopologyChanged = true;
-            }
-        }
+        if (isWeakLink)
+            m_logicNodeDAG.addWeakEdge(output.getLogicNode(), input.getLogicNode());
+        else
+            m_logicNodeDAG.addEdge(output.getLogicNode(), input.getLogicNode());
 
         // TODO Violin don't set anything dirty here, handle dirtiness purely in update()
         input.getLogicNode().setDirty(true);
@@ -194,26 +201,99 @@ namespace rlogic::internal
             return false;
         }
 
-        if (!input.getIncomingLink().isWeakLink)
-        {
-            auto& node = output.getLogicNode();
-            auto& targetNode = input.getLogicNode();
+        auto& node = output.getLogicNode();
+        auto& targetNode = input.getLogicNode();
+        if (input.getIncomingLink().isWeakLink)
+            m_logicNodeDAG.removeWeakEdge(node, targetNode);
+        else
             m_logicNodeDAG.removeEdge(node, targetNode);
-        }
 
         input.resetIncomingLink();
+        unregisterLink(input);
 
         return true;
     }
 
+    const std::vector<PropertyLink>& LogicNodeDependencies::getLinks() const
+    {
+        compactLinks();
+        return m_links;
+    }
+
+    uint64_t LogicNodeDependencies::getLinksGeneration() const
+    {
+        return m_linksGeneration;
+    }
+
+    void LogicNodeDependencies::registerLink(PropertyImpl& output, PropertyImpl& input, bool isWeakLink)
+    {
+        assert(m_linkIndices.count(&input) == 0u);
+        m_linkIndices.emplace(&input, m_links.size());
+        m_links.push_back(PropertyLink{ &output.getPropertyInstance(), &input.getPropertyInstance(), isWeakLink });
+        ++m_linksGeneration;
+    }
+
+    void LogicNodeDependencies::unregisterLink(const PropertyImpl& input)
+    {
+        const auto it = m_linkIndices.find(&input);
+        if (it == m_linkIndices.end())
+            return;
+
+        // clear the entry only, removing it here would shift all following links (or change their order)
+        m_links[it->second] = PropertyLink{};
+        m_linkIndices.erase(it);
+        ++m_unlinkedCount;
+        ++m_linksGeneration;
+
+        // keep memory bounded if links are not queried in between
+        if (m_unlinkedCount > m_links.size() / 2u)
+            compactLinks();
+    }
+
+    void LogicNodeDependencies::compactLinks() const
+    {
+        if (m_unlinkedCount == 0u)
+            return;
+
+        size_t newIndex = 0u;
+        for (const auto& link : m_links)
+        {
+            if (link.target == nullptr)
+                continue;
+            m_linkIndices[link.target->m_impl.get()] = newIndex;
+            m_links[newIndex] = link;
+            ++newIndex;
+        }
+        m_links.resize(newIndex);
+        m_unlinkedCount = 0u;
+    }
+
+    void LogicNodeDependencies::unregisterLinksRecursive(PropertyImpl& property)
+    {
+        if (TypeUtils::CanHaveChildren(property.getType()))
+        {
+            for (size_t i = 0; i < property.getChildCount(); ++i)
+                unregisterLinksRecursive(*property.getChild(i)->m_impl);
+            return;
+        }
+
+        // interface properties are both input and output
+        if (property.isInput() && property.hasIncomingLink())
+            unregisterLink(property);
+        if (property.isOutput())
+        {
+            for (const auto& link : property.getOutgoingLinks())
+                unregisterLink(*link.property);
+        }
+    }
+
     void LogicNodeDependencies::addBindingDependency(RamsesBindingImpl& binding, LogicNodeImpl& node)
     {
         assert(m_logicNodeDAG.containsNode(node));
         assert(m_logicNodeDAG.containsNode(binding));
         assert(&node != &binding);
 
-        if (m_logicNodeDAG.addEdge(binding, node))
-            m_nodeTopologyChanged = true;
+        m_logicNodeDAG.addEdge(binding, node);
     }
 
     void LogicNodeDependencies::removeBindingDependency(RamsesBindingImpl& binding, LogicNodeImpl& node)
@@ -9,8 +9,14 @@
 #pragma once
 
 #include "internals/DirectedAcyclicGraph.h"
+#include "internals/DirtyNodeQueue.h"
+
+#include "ramses-logic/PropertyLink.h"
 
 #include <unordered_set>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
 
 namespace rlogic::internal
 {
@@ -28,6 +34,13 @@ namespace rlogic::internal
     public:
         // The primary purpose of this class
         [[nodiscard]] const std::optional<NodeVector>& getTopologicallySortedNodes();
+        // Nodes forming a link cycle if getTopologicallySortedNodes failed
+        [[nodiscard]] const NodeVector& getNodesInCycle() const;
+        // Sorted nodes grouped into levels of nodes which can be updated concurrently, see DirectedAcyclicGraph::getUpdateLevels
+        [[nodiscard]] const std::vector<NodeVector>& getUpdateLevels();
+
+        // Dirty nodes ordered by rank, see DirtyNodeQueue
+        [[nodiscard]] DirtyNodeQueue& getDirtyNodes();
 
         // Nodes management
         void addNode(LogicNodeImpl& node);
@@ -38,17 +51,33 @@ namespace rlogic::internal
         bool unlink(PropertyImpl& output, PropertyImpl& input, ErrorReporting& errorReporting);
         [[nodiscard]] bool isLinked(const LogicNodeImpl& node) const;
 
+        // All links between properties of the nodes, kept up to date by link/unlink/removeNode.
+        // Links are in order of creation, removing a link keeps the order of the others.
+        [[nodiscard]] const std::vector<PropertyLink>& getLinks() const;
+        // Changes whenever a link is created or removed, allows to detect changes of links without comparing them
+        [[nodiscard]] uint64_t getLinksGeneration() const;
+
         // Dependency between binding and node, i.e. node depends on binding
         void addBindingDependency(RamsesBindingImpl& binding, LogicNodeImpl& node);
         void removeBindingDependency(RamsesBindingImpl& binding, LogicNodeImpl& node);
 
     private:
         DirectedAcyclicGraph m_logicNodeDAG;
+        DirtyNodeQueue m_dirtyNodes{ m_logicNodeDAG };
 
         [[nodiscard]] bool isLinked(PropertyImpl& input) const;
 
-        // Initial state: no nodes and no need to re-compute node topology
-        std::optional<NodeVector> m_cachedTopologicallySortedNodes = NodeVector{};
-        bool m_nodeTopologyChanged = false;
+        void registerLink(PropertyImpl& output, PropertyImpl& input, bool isWeakLink);
+        void unregisterLink(const PropertyImpl& input);
+        void unregisterLinksRecursive(PropertyImpl& property);
+        void compactLinks() const;
+
+        // links in order of their creation, unlinked entries are cleared (target is nullptr) and removed by compactLinks()
+        // so that order of remaining links is preserved
+        mutable std::vector<PropertyLink> m_links;
+        // index of link in m_links by its target (an input can have only one incoming link)
+        mutable std::unordered_map<const PropertyImpl*, size_t> m_linkIndices;
+        mutable size_t m_unlinkedCount = 0u;
+        uint64_t m_linksGeneration = 0u;
     };
 }
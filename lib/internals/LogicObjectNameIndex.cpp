@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LogicObjectNameIndex.h"
+
+#include <algorithm>
+#include <functional>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    void LogicObjectNameIndex::add(LogicObject& object)
+    {
+        insert({ m_nextRegistration++, &object }, object.getName());
+    }
+
+    void LogicObjectNameIndex::remove(LogicObject& object)
+    {
+        (void)extract(object, object.getName());
+    }
+
+    void LogicObjectNameIndex::rename(LogicObject& object, std::string_view oldName, std::string_view newName)
+    {
+        // keep registration of object, so that its position relative to other objects with same name does not depend on renaming
+        insert(extract(object, oldName), newName);
+    }
+
+    size_t LogicObjectNameIndex::HashName(std::string_view name)
+    {
+        return std::hash<std::string_view>{}(name);
+    }
+
+    void LogicObjectNameIndex::insert(Entry entry, std::string_view name)
+    {
+        Entries& entries = m_objectsByNameHash[HashName(name)];
+        const auto position = std::upper_bound(entries.begin(), entries.end(), entry.registration, [](uint64_t registration, const Entry& other) {
+            return registration < other.registration;
+        });
+        entries.insert(position, entry);
+    }
+
+    LogicObjectNameIndex::Entry LogicObjectNameIndex::extract(const LogicObject& object, std::string_view name)
+    {
+        const auto it = m_objectsByNameHash.find(HashName(name));
+        assert(it != m_objectsByNameHash.end() && "Object was not added to name index!");
+
+        Entries& entries = it->second;
+        const auto entryIt = std::find_if(entries.begin(), entries.end(), [&object](const Entry& entry) { return entry.object == &object; });
+        assert(entryIt != entries.end() && "Object was not added to name index!");
+        const Entry entry = *entryIt;
+
+        entries.erase(entryIt);
+        if (entries.empty())
+        {
+            m_objectsByNameHash.erase(it);
+        }
+        return entry;
+    }
+}
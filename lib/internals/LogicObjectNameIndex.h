@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/LogicObject.h"
+
+#include <unordered_map>
+#include <vector>
+#include <string_view>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    // Index of logic objects by their name, used to find objects by name without searching all objects.
+    // Objects are grouped by the hash of their name, so that lookup with std::string_view does not have to create
+    // a std::string. Objects with same name hash are kept in order of their registration, so that the first
+    // object found is always the first one created with that name (object containers don't keep that order once objects are destroyed).
+    // Renaming a registered object must be reported to the index (see LogicObjectImpl::setName).
+    class LogicObjectNameIndex
+    {
+    public:
+        void add(LogicObject& object);
+        void remove(LogicObject& object);
+        void rename(LogicObject& object, std::string_view oldName, std::string_view newName);
+
+        // Returns first registered object of type T with given name, nullptr if there is none
+        template <typename T>
+        [[nodiscard]] T* find(std::string_view name) const
+        {
+            const auto it = m_objectsByNameHash.find(HashName(name));
+            if (it == m_objectsByNameHash.cend())
+            {
+                return nullptr;
+            }
+
+            for (const auto& entry : it->second)
+            {
+                if (entry.object->getName() == name)
+                {
+                    T* typedObject = dynamic_cast<T*>(entry.object);
+                    if (typedObject)
+                    {
+                        return typedObject;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+    private:
+        struct Entry
+        {
+            uint64_t registration;
+            LogicObject* object;
+        };
+        using Entries = std::vector<Entry>;
+
+        [[nodiscard]] static size_t HashName(std::string_view name);
+        void insert(Entry entry, std::string_view name);
+        [[nodiscard]] Entry extract(const LogicObject& object, std::string_view name);
+
+        std::unordered_map<size_t, Entries> m_objectsByNameHash;
+        uint64_t m_nextRegistration = 0u;
+    };
+}
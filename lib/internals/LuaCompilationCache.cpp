@@ -0,0 +1,73 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LuaCompilationCache.h"
+
+#include <algorithm>
+#include <functional>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    bool LuaCompilationCache::Dependencies::operator==(const Dependencies& other) const
+    {
+        return stdModules == other.stdModules && userModules == other.userModules && chunkName == other.chunkName && debugLogFunctions == other.debugLogFunctions;
+    }
+
+    LuaCompilationCache::Dependencies LuaCompilationCache::MakeDependencies(
+        std::vector<EStandardModule> stdModules,
+        std::vector<std::pair<std::string, uint64_t>> userModules,
+        std::string chunkName,
+        bool debugLogFunctions)
+    {
+        // same modules configured in different order must result in same dependencies
+        std::sort(stdModules.begin(), stdModules.end());
+        stdModules.erase(std::unique(stdModules.begin(), stdModules.end()), stdModules.end());
+        std::sort(userModules.begin(), userModules.end());
+
+        return Dependencies{ std::move(stdModules), std::move(userModules), std::move(chunkName), debugLogFunctions };
+    }
+
+    const LuaCompilationCache::CompiledChunk* LuaCompilationCache::find(ELuaChunkType type, std::string_view source, const Dependencies& dependencies)
+    {
+        const Entry* entry = findEntry(type, source, dependencies);
+        if (entry == nullptr)
+        {
+            ++m_statistics.misses;
+            return nullptr;
+        }
+
+        ++m_statistics.hits;
+        return &entry->compiledChunk;
+    }
+
+    void LuaCompilationCache::add(ELuaChunkType type, std::string_view source, Dependencies dependencies, CompiledChunk compiledChunk)
+    {
+        assert(findEntry(type, source, dependencies) == nullptr);
+        m_entriesBySourceHash[std::hash<std::string_view>{}(source)].push_back(Entry{ type, std::string{ source }, std::move(dependencies), std::move(compiledChunk) });
+        ++m_statistics.entries;
+    }
+
+    const LuaCompilationCache::Statistics& LuaCompilationCache::getStatistics() const
+    {
+        return m_statistics;
+    }
+
+    LuaCompilationCache::Entry* LuaCompilationCache::findEntry(ELuaChunkType type, std::string_view source, const Dependencies& dependencies)
+    {
+        const auto it = m_entriesBySourceHash.find(std::hash<std::string_view>{}(source));
+        if (it == m_entriesBySourceHash.end())
+            return nullptr;
+
+        const auto entryIt = std::find_if(it->second.begin(), it->second.end(), [&](const Entry& entry) {
+            return entry.type == type && entry.source == source && entry.dependencies == dependencies;
+        });
+
+        return (entryIt != it->second.end() ? &*entryIt : nullptr);
+    }
+}
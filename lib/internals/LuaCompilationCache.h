@@ -0,0 +1,92 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/EStandardModule.h"
+#include "internals/PropertyTypeLayout.h"
+
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    enum class ELuaChunkType
+    {
+        Script,
+        Module,
+    };
+
+    // Results of compiling Lua sources (byte code and the interface of scripts), so that creating many scripts or modules
+    // from the same source compiles the source and executes the interface() function only once.
+    // Entries are grouped by the hash of their source and compared completely on lookup. Besides the source, the chunk has
+    // to use the same standard modules, the same user modules (module objects under the same names) and the same debug log
+    // functions, because the interface of a script can depend on them. Entries are never removed, the cache grows only with distinct sources.
+    class LuaCompilationCache
+    {
+    public:
+        struct Dependencies
+        {
+            // Sorted, see MakeDependencies
+            std::vector<EStandardModule> stdModules;
+            // Name under which user module is used and its id, sorted by name
+            std::vector<std::pair<std::string, uint64_t>> userModules;
+            // Name of chunk used in Lua stack traces (which is part of the byte code)
+            std::string chunkName;
+            // Whether rl_logInfo etc. are available in the environment interface() is executed in
+            bool debugLogFunctions = false;
+
+            bool operator==(const Dependencies& other) const;
+        };
+
+        struct CompiledChunk
+        {
+            std::string byteCode;
+            // Shared by all scripts created from the cached chunk, see PropertyTypeLayout
+            std::shared_ptr<const PropertyTypeLayout> inputsLayout;
+            std::shared_ptr<const PropertyTypeLayout> outputsLayout;
+        };
+
+        struct Statistics
+        {
+            size_t hits = 0u;
+            size_t misses = 0u;
+            size_t entries = 0u;
+        };
+
+        [[nodiscard]] static Dependencies MakeDependencies(
+            std::vector<EStandardModule> stdModules,
+            std::vector<std::pair<std::string, uint64_t>> userModules,
+            std::string chunkName,
+            bool debugLogFunctions);
+
+        // Counts a hit when compiled chunk is found, a miss otherwise. Returned chunk is valid until next add()
+        [[nodiscard]] const CompiledChunk* find(ELuaChunkType type, std::string_view source, const Dependencies& dependencies);
+        void add(ELuaChunkType type, std::string_view source, Dependencies dependencies, CompiledChunk compiledChunk);
+
+        [[nodiscard]] const Statistics& getStatistics() const;
+
+    private:
+        struct Entry
+        {
+            ELuaChunkType type;
+            std::string source;
+            Dependencies dependencies;
+            CompiledChunk compiledChunk;
+        };
+
+        [[nodiscard]] Entry* findEntry(ELuaChunkType type, std::string_view source, const Dependencies& dependencies);
+
+        std::unordered_map<size_t, std::vector<Entry>> m_entriesBySourceHash;
+        Statistics m_statistics;
+    };
+}
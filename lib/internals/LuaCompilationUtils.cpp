@@ -22,6 +22,9 @@
 #include "fmt/format.h"
 #include "SolHelper.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace rlogic::internal
 {
     std::optional<LuaCompiledScript> LuaCompilationUtils::CompileScriptOrImportPrecompiled(
@@ -37,6 +40,78 @@ namespace rlogic::internal
         EFeatureLevel featureLevel,
         bool enableDebugLogFunctions)
     {
+        return CompileScript(solState, userModules, stdModules, std::move(source), name, errorReporting, std::move(byteCodeFromPrecompiledScript),
+            std::move(inputsFromPrecompiledScript), std::move(outputsFromPrecompiledScript), featureLevel, enableDebugLogFunctions, true, nullptr);
+    }
+
+    std::optional<LuaCompiledScript> LuaCompilationUtils::CompileScriptWithCache(
+        SolState& solState,
+        const ModuleMapping& userModules,
+        const StandardModules& stdModules,
+        std::string source,
+        std::string_view name,
+        ErrorReporting& errorReporting,
+        EFeatureLevel featureLevel,
+        bool enableDebugLogFunctions,
+        LuaCompilationCache& cache)
+    {
+        LuaCompilationCache::Dependencies dependencies = GetCacheDependencies(userModules, stdModules, (featureLevel == EFeatureLevel_01 ? std::string(name) : ""), enableDebugLogFunctions);
+        const LuaCompilationCache::CompiledChunk* cachedScript = cache.find(ELuaChunkType::Script, source, dependencies);
+        if (cachedScript)
+        {
+            // main chunk and init() are executed for every script (they create the script's global data), interface() is not
+            assert(cachedScript->inputsLayout && cachedScript->outputsLayout);
+            auto inputs = std::make_unique<Property>(std::make_unique<PropertyImpl>(cachedScript->inputsLayout, EPropertySemantics::ScriptInput));
+            auto outputs = std::make_unique<Property>(std::make_unique<PropertyImpl>(cachedScript->outputsLayout, EPropertySemantics::ScriptOutput));
+            return CompileScript(solState, userModules, stdModules, std::move(source), name, errorReporting, ToByteCode(cachedScript->byteCode),
+                std::move(inputs), std::move(outputs), featureLevel, enableDebugLogFunctions, true, nullptr);
+        }
+
+        LuaCompilationCache::CompiledChunk compiledChunk;
+        std::optional<LuaCompiledScript> compiledScript = CompileScript(solState, userModules, stdModules, std::move(source), name, errorReporting, {},
+            nullptr, nullptr, featureLevel, enableDebugLogFunctions, true, &compiledChunk);
+        if (compiledScript)
+            cache.add(ELuaChunkType::Script, compiledScript->source.sourceCode, std::move(dependencies), std::move(compiledChunk));
+
+        return compiledScript;
+    }
+
+    std::optional<LuaCompiledScript> LuaCompilationUtils::ImportPrecompiledScriptWithoutProperties(
+        SolState& solState,
+        const ModuleMapping& userModules,
+        const StandardModules& stdModules,
+        std::string source,
+        std::string_view name,
+        ErrorReporting& errorReporting,
+        sol::bytecode byteCodeFromPrecompiledScript,
+        EFeatureLevel featureLevel)
+    {
+        return CompileScript(solState, userModules, stdModules, std::move(source), name, errorReporting, std::move(byteCodeFromPrecompiledScript),
+            nullptr, nullptr, featureLevel, false, false, nullptr);
+    }
+
+    std::optional<LuaCompiledScript> LuaCompilationUtils::CompileScript(
+        SolState& solState,
+        const ModuleMapping& userModules,
+        const StandardModules& stdModules,
+        std::string source,
+        std::string_view name,
+        ErrorReporting& errorReporting,
+        sol::bytecode byteCodeFromPrecompiledScript,
+        std::unique_ptr<Property> inputsFromPrecompiledScript,
+        std::unique_ptr<Property> outputsFromPrecompiledScript,
+        EFeatureLevel featureLevel,
+        bool enableDebugLogFunctions,
+        bool extractInterface,
+        LuaCompilationCache::CompiledChunk* chunkForCache)
+    {
+        // Script may be compiled in another Lua state than the modules it uses (see LogicEngine::setLuaStateCount)
+        for (const auto& module : userModules)
+        {
+            if (!module.second->m_impl.instantiate(solState, featureLevel, errorReporting))
+                return std::nullopt;
+        }
+
         sol::environment env = solState.createEnvironment(stdModules, userModules, enableDebugLogFunctions);
         sol::table internalEnv = EnvironmentProtection::GetProtectedEnvironmentTable(env);
 
@@ -139,7 +214,7 @@ namespace rlogic::internal
             resultInputs = std::move(inputsFromPrecompiledScript);
             resultOutputs = std::move(outputsFromPrecompiledScript);
         }
-        else
+        else if (extractInterface)
         {
             sol::protected_function intf = internalEnv["interface"];
             if (!intf.valid())
@@ -182,13 +257,26 @@ namespace rlogic::internal
             extractedInputsType.typeData.name = "";
             extractedOutputsType.typeData.name = "";
 
-            resultInputs = std::make_unique<Property>(std::make_unique<PropertyImpl>(extractedInputsType, EPropertySemantics::ScriptInput));
-            resultOutputs = std::make_unique<Property>(std::make_unique<PropertyImpl>(extractedOutputsType, EPropertySemantics::ScriptOutput));
+            auto inputsLayout = std::make_shared<const PropertyTypeLayout>(extractedInputsType);
+            auto outputsLayout = std::make_shared<const PropertyTypeLayout>(extractedOutputsType);
+            resultInputs = std::make_unique<Property>(std::make_unique<PropertyImpl>(inputsLayout, EPropertySemantics::ScriptInput));
+            resultOutputs = std::make_unique<Property>(std::make_unique<PropertyImpl>(outputsLayout, EPropertySemantics::ScriptOutput));
+
+            if (chunkForCache)
+            {
+                chunkForCache->inputsLayout = std::move(inputsLayout);
+                chunkForCache->outputsLayout = std::move(outputsLayout);
+            }
         }
 
+        if (byteCodeFromPrecompiledScript.empty() && (featureLevel >= EFeatureLevel_02 || chunkForCache))
+            byteCodeFromPrecompiledScript = mainFunction.dump();
+        if (chunkForCache)
+            chunkForCache->byteCode = std::string(byteCodeFromPrecompiledScript.as_string_view());
+
         sol::bytecode resultByteCode;
         if(featureLevel >= EFeatureLevel_02)
-            resultByteCode = (byteCodeFromPrecompiledScript.empty() ? mainFunction.dump() : std::move(byteCodeFromPrecompiledScript));
+            resultByteCode = std::move(byteCodeFromPrecompiledScript);
 
         EnvironmentProtection::SetEnvironmentProtectionLevel(env, EEnvProtectionFlag::RunFunction);
 
@@ -304,6 +392,50 @@ namespace rlogic::internal
         sol::bytecode byteCodeFromPrecompiledModule,
         EFeatureLevel featureLevel,
         bool enableDebugLogFunctions)
+    {
+        return CompileModule(solState, userModules, stdModules, std::move(source), name, errorReporting, std::move(byteCodeFromPrecompiledModule),
+            featureLevel, enableDebugLogFunctions, nullptr);
+    }
+
+    std::optional<LuaCompiledModule> LuaCompilationUtils::CompileModuleWithCache(
+        SolState& solState,
+        const ModuleMapping& userModules,
+        const StandardModules& stdModules,
+        std::string source,
+        std::string_view name,
+        ErrorReporting& errorReporting,
+        EFeatureLevel featureLevel,
+        bool enableDebugLogFunctions,
+        LuaCompilationCache& cache)
+    {
+        LuaCompilationCache::Dependencies dependencies = GetCacheDependencies(userModules, stdModules, (featureLevel == EFeatureLevel_01 ? std::string(name) : ""), enableDebugLogFunctions);
+        const LuaCompilationCache::CompiledChunk* cachedModule = cache.find(ELuaChunkType::Module, source, dependencies);
+        if (cachedModule)
+        {
+            return CompileModule(solState, userModules, stdModules, std::move(source), name, errorReporting, ToByteCode(cachedModule->byteCode),
+                featureLevel, enableDebugLogFunctions, nullptr);
+        }
+
+        LuaCompilationCache::CompiledChunk compiledChunk;
+        std::optional<LuaCompiledModule> compiledModule = CompileModule(solState, userModules, stdModules, std::move(source), name, errorReporting, {},
+            featureLevel, enableDebugLogFunctions, &compiledChunk);
+        if (compiledModule)
+            cache.add(ELuaChunkType::Module, compiledModule->source.sourceCode, std::move(dependencies), std::move(compiledChunk));
+
+        return compiledModule;
+    }
+
+    std::optional<LuaCompiledModule> LuaCompilationUtils::CompileModule(
+        SolState& solState,
+        const ModuleMapping& userModules,
+        const StandardModules& stdModules,
+        std::string source,
+        std::string_view name,
+        ErrorReporting& errorReporting,
+        sol::bytecode byteCodeFromPrecompiledModule,
+        EFeatureLevel featureLevel,
+        bool enableDebugLogFunctions,
+        LuaCompilationCache::CompiledChunk* chunkForCache)
     {
         sol::environment env = solState.createEnvironment(stdModules, userModules, enableDebugLogFunctions);
         sol::table internalEnv = EnvironmentProtection::GetProtectedEnvironmentTable(env);
@@ -377,10 +509,15 @@ namespace rlogic::internal
 
         sol::table moduleTable = resultObj;
 
+        if (byteCodeFromPrecompiledModule.empty() && (featureLevel >= EFeatureLevel_02 || chunkForCache))
+            byteCodeFromPrecompiledModule = mainFunction.dump();
+        if (chunkForCache)
+            chunkForCache->byteCode = std::string(byteCodeFromPrecompiledModule.as_string_view());
+
         //for serialization
         sol::bytecode resultByteCode;
         if(featureLevel >= EFeatureLevel_02)
-            resultByteCode = (byteCodeFromPrecompiledModule.empty() ? mainFunction.dump() : std::move(byteCodeFromPrecompiledModule));
+            resultByteCode = std::move(byteCodeFromPrecompiledModule);
 
         auto compiledModule = LuaCompiledModule{
             LuaCompiledSource{
@@ -436,6 +573,24 @@ namespace rlogic::internal
         return readOnlyTable;
     }
 
+    LuaCompilationCache::Dependencies LuaCompilationUtils::GetCacheDependencies(const ModuleMapping& userModules, const StandardModules& stdModules, std::string chunkName, bool debugLogFunctions)
+    {
+        std::vector<std::pair<std::string, uint64_t>> userModuleIds;
+        userModuleIds.reserve(userModules.size());
+        for (const auto& [moduleName, module] : userModules)
+            userModuleIds.emplace_back(moduleName, module->getId());
+
+        return LuaCompilationCache::MakeDependencies(stdModules, std::move(userModuleIds), std::move(chunkName), debugLogFunctions);
+    }
+
+    sol::bytecode LuaCompilationUtils::ToByteCode(std::string_view byteCode)
+    {
+        sol::bytecode result;
+        result.reserve(byteCode.size());
+        std::transform(byteCode.cbegin(), byteCode.cend(), std::back_inserter(result), [](char b) { return std::byte(b); });
+        return result;
+    }
+
     bool LuaCompilationUtils::CheckModuleName(std::string_view name)
     {
         if (name.empty())
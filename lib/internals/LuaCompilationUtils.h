@@ -10,6 +10,7 @@
 
 #include "impl/LuaConfigImpl.h"
 #include "internals/SolWrapper.h"
+#include "internals/LuaCompilationCache.h"
 
 #include "ramses-logic/EFeatureLevel.h"
 
@@ -78,6 +79,31 @@ namespace rlogic::internal
             EFeatureLevel featureLevel,
             bool enableDebugLogFunctions);
 
+        // Compiles script from source, reuses byte code and interface of a script compiled before from the same source
+        // with the same modules (see LuaCompilationCache)
+        [[nodiscard]] static std::optional<LuaCompiledScript> CompileScriptWithCache(
+            SolState& solState,
+            const ModuleMapping& userModules,
+            const StandardModules& stdModules,
+            std::string source,
+            std::string_view name,
+            ErrorReporting& errorReporting,
+            EFeatureLevel featureLevel,
+            bool enableDebugLogFunctions,
+            LuaCompilationCache& cache);
+
+        // Loads script whose interface properties already exist (see lazy loading in LuaScriptImpl),
+        // interface function is not executed and returned script has no properties
+        [[nodiscard]] static std::optional<LuaCompiledScript> ImportPrecompiledScriptWithoutProperties(
+            SolState& solState,
+            const ModuleMapping& userModules,
+            const StandardModules& stdModules,
+            std::string source,
+            std::string_view name,
+            ErrorReporting& errorReporting,
+            sol::bytecode byteCodeFromPrecompiledScript,
+            EFeatureLevel featureLevel);
+
         [[nodiscard]] static std::optional<LuaCompiledInterface> CompileInterface(
             SolState& solState,
             const ModuleMapping& userModules,
@@ -97,6 +123,18 @@ namespace rlogic::internal
             EFeatureLevel featureLevel,
             bool enableDebugLogFunctions);
 
+        // Compiles module from source, reuses byte code of a module compiled before from the same source with the same modules
+        [[nodiscard]] static std::optional<LuaCompiledModule> CompileModuleWithCache(
+            SolState& solState,
+            const ModuleMapping& userModules,
+            const StandardModules& stdModules,
+            std::string source,
+            std::string_view name,
+            ErrorReporting& errorReporting,
+            EFeatureLevel featureLevel,
+            bool enableDebugLogFunctions,
+            LuaCompilationCache& cache);
+
         [[nodiscard]] static bool CheckModuleName(std::string_view name);
 
         [[nodiscard]] static std::optional<std::vector<std::string>> ExtractModuleDependencies(
@@ -106,6 +144,40 @@ namespace rlogic::internal
         [[nodiscard]] static sol::table MakeTableReadOnly(SolState& solState, sol::table table);
 
     private:
+        [[nodiscard]] static std::optional<LuaCompiledScript> CompileScript(
+            SolState& solState,
+            const ModuleMapping& userModules,
+            const StandardModules& stdModules,
+            std::string source,
+            std::string_view name,
+            ErrorReporting& errorReporting,
+            sol::bytecode byteCodeFromPrecompiledScript,
+            std::unique_ptr<Property> inputsFromPrecompiledScript,
+            std::unique_ptr<Property> outputsFromPrecompiledScript,
+            EFeatureLevel featureLevel,
+            bool enableDebugLogFunctions,
+            bool extractInterface,
+            LuaCompilationCache::CompiledChunk* chunkForCache);
+
+        [[nodiscard]] static std::optional<LuaCompiledModule> CompileModule(
+            SolState& solState,
+            const ModuleMapping& userModules,
+            const StandardModules& stdModules,
+            std::string source,
+            std::string_view name,
+            ErrorReporting& errorReporting,
+            sol::bytecode byteCodeFromPrecompiledModule,
+            EFeatureLevel featureLevel,
+            bool enableDebugLogFunctions,
+            LuaCompilationCache::CompiledChunk* chunkForCache);
+
+        [[nodiscard]] static LuaCompilationCache::Dependencies GetCacheDependencies(
+            const ModuleMapping& userModules,
+            const StandardModules& stdModules,
+            std::string chunkName,
+            bool debugLogFunctions);
+        [[nodiscard]] static sol::bytecode ToByteCode(std::string_view byteCode);
+
         [[nodiscard]] static bool CrossCheckDeclaredAndProvidedModules(
             std::string_view source,
             const ModuleMapping& modules,
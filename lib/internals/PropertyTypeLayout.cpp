@@ -0,0 +1,199 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/PropertyTypeLayout.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+namespace rlogic::internal
+{
+    static constexpr uint32_t EmptyChildNameSlot = std::numeric_limits<uint32_t>::max();
+
+    static size_t CombineHash(size_t seed, size_t value)
+    {
+        return seed ^ (value + 0x9e3779b9u + (seed << 6u) + (seed >> 2u));
+    }
+
+    PropertyTypeLayout::PropertyTypeLayout(const HierarchicalTypeData& type)
+        : m_typeData(type.typeData)
+    {
+        // same as Hash(type), but reuses hashes of children instead of hashing every subtree again
+        m_hash = CombineHash(std::hash<std::string>{}(m_typeData.name), static_cast<size_t>(m_typeData.type));
+        m_children.reserve(type.children.size());
+        for (const auto& childType : type.children)
+        {
+            m_hash = CombineHash(m_hash, m_children.emplace_back(childType).getHash());
+        }
+
+        if (m_typeData.type == EPropertyType::Struct)
+        {
+            buildChildNameIndex();
+        }
+    }
+
+    void PropertyTypeLayout::buildChildNameIndex()
+    {
+        // keep at least half of the slots empty so that probe sequences stay short
+        size_t slotCount = 1u;
+        while (slotCount < 2u * m_children.size())
+        {
+            slotCount <<= 1u;
+        }
+        const size_t slotMask = slotCount - 1u;
+
+        m_childNameIndex.assign(slotCount, EmptyChildNameSlot);
+        for (size_t i = 0u; i < m_children.size(); ++i)
+        {
+            size_t slot = std::hash<std::string_view>{}(m_children[i].getName()) & slotMask;
+            while (m_childNameIndex[slot] != EmptyChildNameSlot)
+            {
+                slot = (slot + 1u) & slotMask;
+            }
+            m_childNameIndex[slot] = static_cast<uint32_t>(i);
+        }
+    }
+
+    const std::string& PropertyTypeLayout::getName() const
+    {
+        return m_typeData.name;
+    }
+
+    EPropertyType PropertyTypeLayout::getType() const
+    {
+        return m_typeData.type;
+    }
+
+    const std::vector<PropertyTypeLayout>& PropertyTypeLayout::getChildren() const
+    {
+        return m_children;
+    }
+
+    std::optional<size_t> PropertyTypeLayout::findChildIndex(std::string_view name) const
+    {
+        if (m_childNameIndex.empty())
+        {
+            // not a struct, arrays and primitives don't have (named) children
+            for (size_t i = 0u; i < m_children.size(); ++i)
+            {
+                if (m_children[i].getName() == name)
+                {
+                    return i;
+                }
+            }
+            return std::nullopt;
+        }
+
+        const size_t slotMask = m_childNameIndex.size() - 1u;
+        for (size_t slot = std::hash<std::string_view>{}(name) & slotMask; m_childNameIndex[slot] != EmptyChildNameSlot; slot = (slot + 1u) & slotMask)
+        {
+            const uint32_t childIndex = m_childNameIndex[slot];
+            if (m_children[childIndex].getName() == name)
+            {
+                return childIndex;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    bool PropertyTypeLayout::matches(const HierarchicalTypeData& type) const
+    {
+        if (m_typeData != type.typeData || m_children.size() != type.children.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0u; i < m_children.size(); ++i)
+        {
+            if (!m_children[i].matches(type.children[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool PropertyTypeLayout::operator==(const PropertyTypeLayout& other) const
+    {
+        return m_hash == other.m_hash
+            && m_typeData == other.m_typeData
+            && std::equal(m_children.cbegin(), m_children.cend(), other.m_children.cbegin(), other.m_children.cend());
+    }
+
+    size_t PropertyTypeLayout::getHash() const
+    {
+        return m_hash;
+    }
+
+    size_t PropertyTypeLayout::Hash(const HierarchicalTypeData& type)
+    {
+        size_t hash = CombineHash(std::hash<std::string>{}(type.typeData.name), static_cast<size_t>(type.typeData.type));
+        for (const auto& child : type.children)
+        {
+            hash = CombineHash(hash, Hash(child));
+        }
+        return hash;
+    }
+
+    size_t PropertyTypeLayout::getMemoryUsage() const
+    {
+        size_t memoryUsage = sizeof(PropertyTypeLayout) + m_childNameIndex.capacity() * sizeof(uint32_t);
+        // count only names which don't fit into the small string buffer
+        if (m_typeData.name.capacity() >= sizeof(std::string))
+        {
+            memoryUsage += m_typeData.name.capacity() + 1u;
+        }
+        for (const auto& child : m_children)
+        {
+            memoryUsage += child.getMemoryUsage();
+        }
+        // children are counted in place, only unused capacity is left
+        memoryUsage += (m_children.capacity() - m_children.size()) * sizeof(PropertyTypeLayout);
+        return memoryUsage;
+    }
+
+    std::shared_ptr<const PropertyTypeLayout> PropertyTypeLayoutRegistry::getLayout(const HierarchicalTypeData& type)
+    {
+        auto& layouts = m_layoutsByHash[PropertyTypeLayout::Hash(type)];
+        const auto it = std::find_if(layouts.cbegin(), layouts.cend(), [&type](const auto& layout) { return layout->matches(type); });
+        if (it != layouts.cend())
+        {
+            return *it;
+        }
+
+        ++m_layoutCount;
+        return layouts.emplace_back(std::make_shared<const PropertyTypeLayout>(type));
+    }
+
+    void PropertyTypeLayoutRegistry::merge(const PropertyTypeLayoutRegistry& other)
+    {
+        for (const auto& otherLayouts : other.m_layoutsByHash)
+        {
+            auto& layouts = m_layoutsByHash[otherLayouts.first];
+            for (const auto& otherLayout : otherLayouts.second)
+            {
+                const bool isKnown = std::any_of(layouts.cbegin(), layouts.cend(), [&otherLayout](const auto& layout) {
+                    return layout == otherLayout || *layout == *otherLayout;
+                });
+                if (!isKnown)
+                {
+                    layouts.push_back(otherLayout);
+                    ++m_layoutCount;
+                }
+            }
+        }
+    }
+
+    size_t PropertyTypeLayoutRegistry::getLayoutCount() const
+    {
+        return m_layoutCount;
+    }
+}
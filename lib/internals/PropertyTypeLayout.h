@@ -0,0 +1,83 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/TypeData.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    // Immutable description of a property tree (names, types and child layout of every property) without any values.
+    // Property trees of the same type (e.g. inputs of many scripts created from the same source) refer to one shared layout,
+    // every property only keeps its own value and links. Layout of a struct also holds the index to look up its fields by name.
+    class PropertyTypeLayout
+    {
+    public:
+        explicit PropertyTypeLayout(const HierarchicalTypeData& type);
+
+        // Not copy-able, properties refer to layouts (and their children) by pointer
+        PropertyTypeLayout(PropertyTypeLayout&& other) noexcept = default;
+        PropertyTypeLayout& operator=(PropertyTypeLayout&& other) noexcept = default;
+        PropertyTypeLayout(const PropertyTypeLayout& other) = delete;
+        PropertyTypeLayout& operator=(const PropertyTypeLayout& other) = delete;
+        ~PropertyTypeLayout() noexcept = default;
+
+        [[nodiscard]] const std::string& getName() const;
+        [[nodiscard]] EPropertyType getType() const;
+        [[nodiscard]] const std::vector<PropertyTypeLayout>& getChildren() const;
+
+        // Index of the child with given name, uses hashed name index for structs (no string comparison with every field)
+        [[nodiscard]] std::optional<size_t> findChildIndex(std::string_view name) const;
+
+        // Treats different ordering of child types as different types, same as HierarchicalTypeData
+        [[nodiscard]] bool matches(const HierarchicalTypeData& type) const;
+        [[nodiscard]] bool operator==(const PropertyTypeLayout& other) const;
+
+        // Hash of the whole hierarchy, equal for layouts created from equal types
+        [[nodiscard]] size_t getHash() const;
+        [[nodiscard]] static size_t Hash(const HierarchicalTypeData& type);
+
+        // Memory occupied by this layout and its children
+        [[nodiscard]] size_t getMemoryUsage() const;
+
+    private:
+        void buildChildNameIndex();
+
+        TypeData m_typeData;
+        std::vector<PropertyTypeLayout> m_children;
+        // Open addressing hash table (linear probing) of struct field names, holds child indices, built when struct is created
+        std::vector<uint32_t> m_childNameIndex;
+        size_t m_hash = 0u;
+    };
+
+    // Hands out one shared layout for every distinct type, so that property trees created from equal types share it.
+    // Layouts are kept alive by the registry and by all properties using them.
+    class PropertyTypeLayoutRegistry
+    {
+    public:
+        [[nodiscard]] std::shared_ptr<const PropertyTypeLayout> getLayout(const HierarchicalTypeData& type);
+
+        // Takes over layouts of another registry which are not known yet, e.g. from a registry filled by another thread
+        // during concurrent deserialization. Layouts known to both registries are kept only once.
+        void merge(const PropertyTypeLayoutRegistry& other);
+
+        [[nodiscard]] size_t getLayoutCount() const;
+
+    private:
+        std::unordered_map<size_t, std::vector<std::shared_ptr<const PropertyTypeLayout>>> m_layoutsByHash;
+        size_t m_layoutCount = 0u;
+    };
+}
@@ -0,0 +1,89 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/PropertyValueArena.h"
+
+namespace rlogic::internal
+{
+    PropertyValueArena::PropertyValueArena(const HierarchicalTypeData& type)
+    {
+        reserveRecursive(type);
+        allocatePools();
+    }
+
+    PropertyValueArena::PropertyValueArena(const PropertyTypeLayout& layout)
+    {
+        reserveRecursive(layout);
+        allocatePools();
+    }
+
+    void PropertyValueArena::allocatePools()
+    {
+        std::apply([](auto&... pools) {
+            const auto allocatePool = [](auto& pool) {
+                using ValueType = typename std::remove_reference_t<decltype(pool.values)>::element_type;
+                if (pool.capacity > 0u)
+                    pool.values = std::make_unique<ValueType[]>(pool.capacity); // NOLINT(modernize-avoid-c-arrays) see Pool
+            };
+            (allocatePool(pools), ...);
+        }, m_pools);
+    }
+
+    void PropertyValueArena::reserveRecursive(const HierarchicalTypeData& type)
+    {
+        if (type.typeData.type == EPropertyType::Struct || type.typeData.type == EPropertyType::Array)
+        {
+            for (const auto& child : type.children)
+                reserveRecursive(child);
+        }
+        else
+        {
+            reserve(type.typeData.type);
+        }
+    }
+
+    void PropertyValueArena::reserveRecursive(const PropertyTypeLayout& layout)
+    {
+        if (layout.getType() == EPropertyType::Struct || layout.getType() == EPropertyType::Array)
+        {
+            for (const auto& child : layout.getChildren())
+                reserveRecursive(child);
+        }
+        else
+        {
+            reserve(layout.getType());
+        }
+    }
+
+    void PropertyValueArena::reserve(EPropertyType type)
+    {
+        VisitPrimitiveType(type, [this](auto typeTag) {
+            using T = typename decltype(typeTag)::type;
+            ++std::get<Pool<T>>(m_pools).capacity;
+        });
+    }
+
+    uint32_t PropertyValueArena::allocate(EPropertyType type)
+    {
+        return VisitPrimitiveType(type, [this](auto typeTag) {
+            using T = typename decltype(typeTag)::type;
+            auto& pool = std::get<Pool<T>>(m_pools);
+            assert(pool.size < pool.capacity && "Arena was created for a different type!");
+            return pool.size++;
+        });
+    }
+
+    size_t PropertyValueArena::getMemoryUsage() const
+    {
+        size_t memoryUsage = sizeof(PropertyValueArena);
+        std::apply([&memoryUsage](const auto&... pools) {
+            ((memoryUsage += pools.capacity * sizeof(pools.values[0])), ...);
+        }, m_pools);
+        return memoryUsage;
+    }
+}
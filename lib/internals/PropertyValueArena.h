@@ -0,0 +1,126 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/EPropertyType.h"
+#include "internals/TypeData.h"
+#include "internals/PropertyTypeLayout.h"
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <cstdint>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    template <typename T>
+    struct ValueTypeTag
+    {
+        using type = T;
+    };
+
+    // Calls visitor with ValueTypeTag<T> where T is the C++ type used to store values of given primitive property type
+    template <typename Visitor>
+    decltype(auto) VisitPrimitiveType(EPropertyType type, Visitor&& visitor)
+    {
+        switch (type)
+        {
+        case EPropertyType::Float:
+            return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::Float>::TYPE>{});
+        case EPropertyType::Vec2f:
+            return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::Vec2f>::TYPE>{});
+        case EPropertyType::Vec3f:
+            return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::Vec3f>::TYPE>{});
+        case EPropertyType::Vec4f:
+            return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::Vec4f>::TYPE>{});
+        case EPropertyType::Int32:
+            return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::Int32>::TYPE>{});
+        case EPropertyType::Int64:
+            return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::Int64>::TYPE>{});
+        case EPropertyType::Vec2i:
+            return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::Vec2i>::TYPE>{});
+        case EPropertyType::Vec3i:
+            return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::Vec3i>::TYPE>{});
+        case EPropertyType::Vec4i:
+            return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::Vec4i>::TYPE>{});
+        case EPropertyType::String:
+            return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::String>::TYPE>{});
+        case EPropertyType::Bool:
+        case EPropertyType::Array:
+        case EPropertyType::Struct:
+            break;
+        }
+
+        assert(type == EPropertyType::Bool && "Only primitive types have values!");
+        return visitor(ValueTypeTag<PropertyEnumToType<EPropertyType::Bool>::TYPE>{});
+    }
+
+    // Storage for the values of all primitive properties of one property tree (e.g. all inputs of a logic node).
+    // Values are kept in contiguous pools, one per value type (structure of arrays), instead of a std::variant in every
+    // property, properties only refer to their value by index into the pool of their type. This keeps the values of a node
+    // close to each other in memory, and only string properties pay for the size of std::string.
+    // Pools are sized once from the type of the whole tree and never grow, references to values stay valid.
+    class PropertyValueArena
+    {
+    public:
+        // Reserves one value for every primitive property in the type hierarchy
+        explicit PropertyValueArena(const HierarchicalTypeData& type);
+        explicit PropertyValueArena(const PropertyTypeLayout& layout);
+
+        // Hands out next value of given primitive type, values are default-initialized (zero, false, empty string)
+        [[nodiscard]] uint32_t allocate(EPropertyType type);
+
+        template <typename T>
+        [[nodiscard]] T& get(uint32_t index)
+        {
+            auto& pool = std::get<Pool<T>>(m_pools);
+            assert(index < pool.size);
+            return pool.values[index];
+        }
+
+        template <typename T>
+        [[nodiscard]] const T& get(uint32_t index) const
+        {
+            const auto& pool = std::get<Pool<T>>(m_pools);
+            assert(index < pool.size);
+            return pool.values[index];
+        }
+
+        // Memory occupied by the pools (not including heap memory owned by strings)
+        [[nodiscard]] size_t getMemoryUsage() const;
+
+    private:
+        template <typename T>
+        struct Pool
+        {
+            std::unique_ptr<T[]> values; // NOLINT(modernize-avoid-c-arrays) fixed size, std::vector<bool> can't be used
+            uint32_t capacity = 0u;
+            uint32_t size = 0u;
+        };
+
+        void reserveRecursive(const HierarchicalTypeData& type);
+        void reserveRecursive(const PropertyTypeLayout& layout);
+        void reserve(EPropertyType type);
+        void allocatePools();
+
+        std::tuple<
+            Pool<int32_t>,
+            Pool<int64_t>,
+            Pool<float>,
+            Pool<bool>,
+            Pool<std::string>,
+            Pool<vec2f>,
+            Pool<vec3f>,
+            Pool<vec4f>,
+            Pool<vec2i>,
+            Pool<vec3i>,
+            Pool<vec4i>> m_pools;
+    };
+}
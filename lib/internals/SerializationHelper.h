@@ -13,6 +13,7 @@
 #include "generated/PropertyGen.h"
 
 #include <optional>
+#include <cassert>
 
 namespace rlogic::internal
 {
@@ -55,4 +56,73 @@ namespace rlogic::internal
         }
         return std::nullopt;
     }
+
+    static rlogic_serialization::EPropertyTreeNodeType ConvertEPropertyTypeToTreeNodeType(EPropertyType type)
+    {
+        switch (type)
+        {
+        case EPropertyType::Float:
+            return rlogic_serialization::EPropertyTreeNodeType::Float;
+        case EPropertyType::Vec2f:
+            return rlogic_serialization::EPropertyTreeNodeType::Vec2f;
+        case EPropertyType::Vec3f:
+            return rlogic_serialization::EPropertyTreeNodeType::Vec3f;
+        case EPropertyType::Vec4f:
+            return rlogic_serialization::EPropertyTreeNodeType::Vec4f;
+        case EPropertyType::Int32:
+            return rlogic_serialization::EPropertyTreeNodeType::Int32;
+        case EPropertyType::Int64:
+            return rlogic_serialization::EPropertyTreeNodeType::Int64;
+        case EPropertyType::Vec2i:
+            return rlogic_serialization::EPropertyTreeNodeType::Vec2i;
+        case EPropertyType::Vec3i:
+            return rlogic_serialization::EPropertyTreeNodeType::Vec3i;
+        case EPropertyType::Vec4i:
+            return rlogic_serialization::EPropertyTreeNodeType::Vec4i;
+        case EPropertyType::String:
+            return rlogic_serialization::EPropertyTreeNodeType::String;
+        case EPropertyType::Bool:
+            return rlogic_serialization::EPropertyTreeNodeType::Bool;
+        case EPropertyType::Struct:
+            return rlogic_serialization::EPropertyTreeNodeType::Struct;
+        case EPropertyType::Array:
+            return rlogic_serialization::EPropertyTreeNodeType::Array;
+        }
+        assert(false && "unreachable");
+        return rlogic_serialization::EPropertyTreeNodeType::Struct;
+    }
+
+    static std::optional<EPropertyType> ConvertTreeNodeTypeToEPropertyType(rlogic_serialization::EPropertyTreeNodeType nodeType)
+    {
+        switch (nodeType)
+        {
+        case rlogic_serialization::EPropertyTreeNodeType::Float:
+            return EPropertyType::Float;
+        case rlogic_serialization::EPropertyTreeNodeType::Vec2f:
+            return EPropertyType::Vec2f;
+        case rlogic_serialization::EPropertyTreeNodeType::Vec3f:
+            return EPropertyType::Vec3f;
+        case rlogic_serialization::EPropertyTreeNodeType::Vec4f:
+            return EPropertyType::Vec4f;
+        case rlogic_serialization::EPropertyTreeNodeType::Int32:
+            return EPropertyType::Int32;
+        case rlogic_serialization::EPropertyTreeNodeType::Int64:
+            return EPropertyType::Int64;
+        case rlogic_serialization::EPropertyTreeNodeType::Vec2i:
+            return EPropertyType::Vec2i;
+        case rlogic_serialization::EPropertyTreeNodeType::Vec3i:
+            return EPropertyType::Vec3i;
+        case rlogic_serialization::EPropertyTreeNodeType::Vec4i:
+            return EPropertyType::Vec4i;
+        case rlogic_serialization::EPropertyTreeNodeType::String:
+            return EPropertyType::String;
+        case rlogic_serialization::EPropertyTreeNodeType::Bool:
+            return EPropertyType::Bool;
+        case rlogic_serialization::EPropertyTreeNodeType::Struct:
+            return EPropertyType::Struct;
+        case rlogic_serialization::EPropertyTreeNodeType::Array:
+            return EPropertyType::Array;
+        }
+        return std::nullopt;
+    }
 }
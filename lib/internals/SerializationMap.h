@@ -10,8 +10,10 @@
 
 #include "generated/PropertyGen.h"
 #include "generated/DataArrayGen.h"
+#include "internals/PropertyTypeLayout.h"
 #include <unordered_map>
 #include <string_view>
+#include <vector>
 
 namespace rlogic::internal
 {
@@ -31,6 +33,41 @@ namespace rlogic::internal
             return Get(&prop, m_properties);
         }
 
+        // Used by columnar property encoding, where all properties of a tree are stored in one flatbuffers object
+        // and refer to it by their index in pre-order of the tree (root has index 0)
+        void storePropertyIndex(const PropertyImpl& prop, uint32_t index)
+        {
+            Store(&prop, index, m_propertyIndices);
+        }
+
+        [[nodiscard]] uint32_t resolvePropertyIndex(const PropertyImpl& prop) const
+        {
+            const auto it = m_propertyIndices.find(&prop);
+            return (it != m_propertyIndices.cend() ? it->second : 0u);
+        }
+
+        // Property trees of equal type (not only the same shared layout) store their names and types only once
+        void storePropertyTreeTypeOffset(const PropertyTypeLayout& layout, flatbuffers::Offset<rlogic_serialization::PropertyTreeType> offset)
+        {
+            m_propertyTreeTypeOffsets[layout.getHash()].emplace_back(&layout, offset);
+        }
+
+        [[nodiscard]] flatbuffers::Offset<rlogic_serialization::PropertyTreeType> resolvePropertyTreeTypeOffsetIfFound(const PropertyTypeLayout& layout) const
+        {
+            const auto it = m_propertyTreeTypeOffsets.find(layout.getHash());
+            if (it != m_propertyTreeTypeOffsets.cend())
+            {
+                for (const auto& treeType : it->second)
+                {
+                    if (treeType.first == &layout || *treeType.first == layout)
+                    {
+                        return treeType.second;
+                    }
+                }
+            }
+            return 0;
+        }
+
         void storeDataArray(uint64_t id, flatbuffers::Offset<rlogic_serialization::DataArray> offset)
         {
             Store(id, offset, m_dataArrays);
@@ -74,6 +111,8 @@ namespace rlogic::internal
         }
 
         std::unordered_map<const PropertyImpl*, flatbuffers::Offset<rlogic_serialization::Property>> m_properties;
+        std::unordered_map<const PropertyImpl*, uint32_t> m_propertyIndices;
+        std::unordered_map<size_t, std::vector<std::pair<const PropertyTypeLayout*, flatbuffers::Offset<rlogic_serialization::PropertyTreeType>>>> m_propertyTreeTypeOffsets;
         std::unordered_map<uint64_t, flatbuffers::Offset<rlogic_serialization::DataArray>> m_dataArrays;
         std::unordered_map<std::string, flatbuffers::Offset<flatbuffers::Vector<uint8_t>>> m_byteCodeOffsets;
     };
@@ -18,6 +18,7 @@
 #include "internals/EnvironmentProtection.h"
 
 #include <iostream>
+#include <algorithm>
 
 namespace rlogic::internal
 {
@@ -33,7 +34,20 @@ namespace rlogic::internal
 
     SolState::SolState()
     {
-        m_safeBaselibSymbols = {
+        // TODO Violin try to load standard modules on demand
+        for (auto solLib : SolLibs)
+        {
+            m_solState.open_libraries(solLib);
+        }
+
+        m_solState.set_exception_handler(&solExceptionHandler);
+
+        // TODO Violin only register wrappers to runtime environments, not in the global environment
+        WrappedLuaProperty::RegisterTypes(m_solState);
+
+        LuaCustomizations::RegisterTypes(m_solState);
+
+        const std::array<std::string_view, 19> safeBaselibSymbols = {
             "assert",
             "error",
             "ipairs",
@@ -56,19 +70,28 @@ namespace rlogic::internal
             "setmetatable",
             "getmetatable",
         };
+        m_safeBaselibSymbols.reserve(safeBaselibSymbols.size());
+        for (const auto& name : safeBaselibSymbols)
+            m_safeBaselibSymbols.emplace_back(name, m_solState.globals().raw_get<sol::object>(name));
 
-        // TODO Violin try to load standard modules on demand
-        for (auto solLib : SolLibs)
-        {
-            m_solState.open_libraries(solLib);
-        }
-
-        m_solState.set_exception_handler(&solExceptionHandler);
+        cacheStdModuleContents();
+    }
 
-        // TODO Violin only register wrappers to runtime environments, not in the global environment
-        WrappedLuaProperty::RegisterTypes(m_solState);
+    void SolState::cacheStdModuleContents()
+    {
+        for (size_t i = 0u; i < StdModules.size(); ++i)
+        {
+            const std::optional<std::string_view> moduleTableName = GetStdModuleName(StdModules[i]);
+            if (!moduleTableName)
+                continue;
 
-        LuaCustomizations::RegisterTypes(m_solState);
+            const sol::table& moduleAsTable = m_solState[*moduleTableName];
+            for (const auto& pair : moduleAsTable)
+            {
+                // first is the name of a function in module, second is the function
+                m_stdModuleContents[i].emplace_back(pair.first, pair.second);
+            }
+        }
     }
 
     sol::load_result SolState::loadScript(std::string_view source, std::string_view scriptName)
@@ -92,7 +115,7 @@ namespace rlogic::internal
         for (const auto& module : userModules)
         {
             assert(!SolState::IsReservedModuleName(module.first));
-            protectedEnv[module.first] = module.second->m_impl.getModule();
+            protectedEnv[module.first] = module.second->m_impl.getModule(*this);
         }
 
         // TODO Violin take a closer look at this, should not be needed
@@ -112,39 +135,31 @@ namespace rlogic::internal
 
     void SolState::mapStandardModules(const StandardModules& stdModules, sol::environment& env)
     {
-        // Copy base libraries' tables into environment to sandbox them, so that scripts cannot affect each other by modifying them
         for (const auto& stdModule : stdModules)
         {
             // The base module needs special handling because it's not in a named table
             if (stdModule == EStandardModule::Base)
             {
-
-                for (const auto& name : m_safeBaselibSymbols)
+                for (const auto& [name, symbol] : m_safeBaselibSymbols)
                 {
-                    env[name] = m_solState[name];
+                    env[name] = symbol;
                 }
-
             }
             else
             {
-                std::string_view moduleTableName = *GetStdModuleName(stdModule);
-                const sol::table& moduleAsTable = m_solState[moduleTableName];
-                copyTableIntoEnvironment(moduleAsTable, moduleTableName, env);
+                // Every environment gets its own plain table, so that scripts cannot affect each other by modifying it.
+                // Only the function values are shared, the table is created with its final size to avoid rehashing
+                const auto moduleIt = std::find(StdModules.cbegin(), StdModules.cend(), stdModule);
+                assert(moduleIt != StdModules.cend());
+                const auto& moduleContents = m_stdModuleContents[static_cast<size_t>(moduleIt - StdModules.cbegin())];
+                sol::table moduleTable = m_solState.create_table(0, static_cast<int>(moduleContents.size()));
+                for (const auto& [name, function] : moduleContents)
+                    moduleTable.raw_set(name, function);
+                env[*GetStdModuleName(stdModule)] = std::move(moduleTable);
             }
         }
     }
 
-    void SolState::copyTableIntoEnvironment(const sol::table& table, std::string_view name, sol::environment& env)
-    {
-        sol::table copy(m_solState, sol::create);
-        for (const auto& pair : table)
-        {
-            // first is the name of a function in module, second is the function
-            copy[pair.first] = pair.second;
-        }
-        env[name] = std::move(copy);
-    }
-
     std::optional<std::string_view> SolState::GetStdModuleName(rlogic::EStandardModule m)
     {
         switch (m)
@@ -189,4 +204,9 @@ namespace rlogic::internal
     {
         return lua_gettop(m_solState.lua_state());
     }
+
+    size_t SolState::getLuaMemoryUsage() const
+    {
+        return m_solState.memory_used();
+    }
 }
@@ -13,6 +13,8 @@
 
 #include <string_view>
 #include <utility>
+#include <array>
+#include <vector>
 
 namespace rlogic::internal
 {
@@ -52,19 +54,23 @@ namespace rlogic::internal
         sol::load_result loadScript(std::string_view source, std::string_view scriptName);
         sol::protected_function_result loadScriptByteCode(std::string_view byteCode, std::string_view scriptName, sol::environment& env);
         sol::environment createEnvironment(const StandardModules& stdModules, const ModuleMapping& userModules, bool exposeDebugLogFunctions);
-        void copyTableIntoEnvironment(const sol::table& table, std::string_view name, sol::environment& env);
         sol::table createTable();
 
         [[nodiscard]] int getNumElementsInLuaStack() const;
+        // Memory allocated by the Lua state (in bytes)
+        [[nodiscard]] size_t getLuaMemoryUsage() const;
 
         [[nodiscard]] static bool IsReservedModuleName(std::string_view name);
 
     private:
         sol::state m_solState;
-        // Cached to avoid unnecessary heap allocations
-        std::vector<std::string> m_safeBaselibSymbols;
+        // Resolved once, so that creating an environment does not have to look up each symbol in the global table
+        std::vector<std::pair<std::string, sol::object>> m_safeBaselibSymbols;
+        // Names and functions of each standard module, indexed by position in StdModules (empty for the base module)
+        std::array<std::vector<std::pair<sol::object, sol::object>>, StdModules.size()> m_stdModuleContents;
 
         void mapStandardModules(const StandardModules& stdModules, sol::environment& env);
+        void cacheStdModuleContents();
         [[nodiscard]] static std::optional<std::string_view> GetStdModuleName(rlogic::EStandardModule m);
     };
 }
@@ -0,0 +1,90 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/ThreadPool.h"
+
+#include <cassert>
+
+namespace rlogic::internal
+{
+    ThreadPool::ThreadPool(size_t threadCount)
+    {
+        assert(threadCount > 0u);
+        m_workers.reserve(threadCount - 1u);
+        for (size_t i = 1u; i < threadCount; ++i)
+            m_workers.emplace_back([this]() { workerLoop(); });
+    }
+
+    ThreadPool::~ThreadPool() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_shutdown = true;
+        }
+        m_workAvailable.notify_all();
+
+        for (auto& worker : m_workers)
+            worker.join();
+    }
+
+    size_t ThreadPool::getThreadCount() const
+    {
+        return m_workers.size() + 1u;
+    }
+
+    void ThreadPool::execute(size_t taskCount, const Task& task, const CallerTask& callerTask)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            assert(m_pendingWorkers == 0u);
+            m_task = &task;
+            m_taskCount = taskCount;
+            m_nextTask = 0u;
+            m_pendingWorkers = m_workers.size();
+            ++m_batch;
+        }
+        m_workAvailable.notify_all();
+
+        callerTask();
+        executeTasks(task, taskCount);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_workFinished.wait(lock, [this]() { return m_pendingWorkers == 0u; });
+        m_task = nullptr;
+    }
+
+    void ThreadPool::workerLoop()
+    {
+        uint64_t lastBatch = 0u;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;)
+        {
+            m_workAvailable.wait(lock, [this, lastBatch]() { return m_shutdown || m_batch != lastBatch; });
+            if (m_shutdown)
+                return;
+
+            lastBatch = m_batch;
+            const Task* task = m_task;
+            const size_t taskCount = m_taskCount;
+
+            lock.unlock();
+            executeTasks(*task, taskCount);
+            lock.lock();
+
+            assert(m_pendingWorkers > 0u);
+            if (--m_pendingWorkers == 0u)
+                m_workFinished.notify_one();
+        }
+    }
+
+    void ThreadPool::executeTasks(const Task& task, size_t taskCount)
+    {
+        for (size_t taskIdx = m_nextTask++; taskIdx < taskCount; taskIdx = m_nextTask++)
+            task(taskIdx);
+    }
+}
@@ -0,0 +1,65 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    // Fixed set of worker threads which execute batches of independent tasks. The thread calling execute() takes part
+    // in executing the tasks, i.e. a pool with thread count N starts only N-1 worker threads.
+    class ThreadPool
+    {
+    public:
+        using Task = std::function<void(size_t)>;
+        using CallerTask = std::function<void()>;
+
+        explicit ThreadPool(size_t threadCount);
+        ~ThreadPool() noexcept;
+
+        ThreadPool(const ThreadPool& other) = delete;
+        ThreadPool& operator=(const ThreadPool& other) = delete;
+        ThreadPool(ThreadPool&& other) = delete;
+        ThreadPool& operator=(ThreadPool&& other) = delete;
+
+        [[nodiscard]] size_t getThreadCount() const;
+
+        // Executes task(i) for every i in [0, taskCount) and blocks until all of them are finished.
+        // The calling thread first executes callerTask (work which must not leave the calling thread, e.g. ramses access of
+        // bindings, anchor points and skin bindings)
+        // concurrently with the workers, then helps with the remaining tasks.
+        void execute(size_t taskCount, const Task& task, const CallerTask& callerTask);
+
+    private:
+        void workerLoop();
+        void executeTasks(const Task& task, size_t taskCount);
+
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_mutex;
+        std::condition_variable m_workAvailable;
+        std::condition_variable m_workFinished;
+        // Incremented for every batch of tasks, workers wake up when it changes
+        uint64_t m_batch = 0u;
+        // Workers which did not finish current batch yet, execute() does not return before all workers finished
+        // so that no worker can touch a batch after it went out of scope
+        size_t m_pendingWorkers = 0u;
+        bool m_shutdown = false;
+
+        const Task* m_task = nullptr;
+        size_t m_taskCount = 0u;
+        std::atomic<size_t> m_nextTask {0u};
+    };
+}
@@ -41,6 +41,12 @@ namespace rlogic::internal
         m_nodeExecutionStarted.reset();
     }
 
+    void UpdateReport::nodeExecuted(LogicNodeImpl& node, ReportTimeUnits executionTime)
+    {
+        assert(!m_nodeExecutionStarted);
+        m_nodesExecuted.push_back({ &node, executionTime });
+    }
+
     void UpdateReport::nodeSkippedExecution(LogicNodeImpl& node)
     {
         m_nodesSkippedExecution.push_back(&node);
@@ -53,6 +59,8 @@ namespace rlogic::internal
         for (auto& s : m_sectionExecutionTime)
             s = ReportTimeUnits{ 0u };
         m_activatedLinks = 0u;
+        m_visitedNodes = 0u;
+        m_totalNodes = 0u;
 
         // clear also internals in case update/measure was interrupted due to error
         m_nodeExecutionStarted.reset();
@@ -80,4 +88,14 @@ namespace rlogic::internal
         return m_activatedLinks;
     }
 
+    size_t UpdateReport::getVisitedNodesCount() const
+    {
+        return m_visitedNodes;
+    }
+
+    size_t UpdateReport::getTotalNodesCount() const
+    {
+        return m_totalNodes;
+    }
+
 }
@@ -34,14 +34,19 @@ namespace rlogic::internal
         void sectionFinished(ETimingSection section);
         void nodeExecutionStarted(LogicNodeImpl& node);
         void nodeExecutionFinished();
+        // Alternative to nodeExecutionStarted/Finished for nodes which were timed elsewhere (e.g. executed on another thread)
+        void nodeExecuted(LogicNodeImpl& node, ReportTimeUnits executionTime);
         void nodeSkippedExecution(LogicNodeImpl& node);
         void linksActivated(size_t activatedLinks);
+        void nodesVisited(size_t visitedNodes, size_t totalNodes);
         void clear();
 
         [[nodiscard]] const LogicNodesTimed& getNodesExecuted() const;
         [[nodiscard]] const LogicNodes& getNodesSkippedExecution() const;
         [[nodiscard]] ReportTimeUnits getSectionExecutionTime(ETimingSection section) const;
         [[nodiscard]] size_t getLinkActivations() const;
+        [[nodiscard]] size_t getVisitedNodesCount() const;
+        [[nodiscard]] size_t getTotalNodesCount() const;
 
     private:
         using Clock = std::chrono::steady_clock;
@@ -51,6 +56,8 @@ namespace rlogic::internal
         LogicNodes m_nodesSkippedExecution;
         std::array<ReportTimeUnits, 2u> m_sectionExecutionTime = { ReportTimeUnits{ 0 } };
         size_t m_activatedLinks {0u};
+        size_t m_visitedNodes {0u};
+        size_t m_totalNodes {0u};
 
         std::optional<TimePoint> m_nodeExecutionStarted;
         std::array<std::optional<TimePoint>, 2u> m_sectionStarted;
@@ -60,4 +67,10 @@ namespace rlogic::internal
     {
         m_activatedLinks += activatedLinks;
     }
+
+    inline void UpdateReport::nodesVisited(size_t visitedNodes, size_t totalNodes)
+    {
+        m_visitedNodes = visitedNodes;
+        m_totalNodes = totalNodes;
+    }
 }
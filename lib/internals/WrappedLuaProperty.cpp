@@ -27,6 +27,12 @@ namespace rlogic::internal
         std::string fieldName;
     };
 
+    static size_t InternedKeyHash(const char* key)
+    {
+        // strings are allocated with at least 8 byte alignment, lowest bits carry no information
+        return std::hash<const char*>{}(key) >> 3u;
+    }
+
     WrappedLuaProperty::WrappedLuaProperty(PropertyImpl& propertyToWrap)
         : m_wrappedProperty(propertyToWrap)
     {
@@ -38,7 +44,7 @@ namespace rlogic::internal
         }
     }
 
-    sol::object WrappedLuaProperty::index(sol::this_state solState, const sol::object& index) const
+    sol::object WrappedLuaProperty::index(sol::this_state solState, sol::stack_object index) const
     {
         switch (m_wrappedProperty.get().getType())
         {
@@ -63,9 +69,17 @@ namespace rlogic::internal
             return extractVectorComponent<int32_t, 3>(solState, index);
         case EPropertyType::Vec4i:
             return extractVectorComponent<int32_t, 4>(solState, index);
-        case EPropertyType::Array:
         case EPropertyType::Struct:
-            return resolveChild(solState, resolvePropertyIndex(index));
+        {
+            const std::optional<size_t> childIndex = findChildByInternedKey(index);
+            if (childIndex)
+            {
+                return resolveChild(solState, *childIndex);
+            }
+            return resolveChild(solState, resolvePropertyIndex(sol::object(index)));
+        }
+        case EPropertyType::Array:
+            return resolveChild(solState, resolvePropertyIndex(sol::object(index)));
         }
 
         assert(false && "Missing type implementation!");
@@ -130,14 +144,15 @@ namespace rlogic::internal
         }
     }
 
-    void WrappedLuaProperty::newIndex(const sol::object& index, const sol::object& rhs)
+    void WrappedLuaProperty::newIndex(sol::stack_object index, const sol::object& rhs)
     {
         if (TypeUtils::IsPrimitiveVectorType(m_wrappedProperty.get().getType()))
         {
             sol_helper::throwSolException("Error while writing to '{}'. Can't assign individual components of vector types, must assign the whole vector!", m_wrappedProperty.get().getName());
         }
 
-        const size_t childIndex = resolvePropertyIndex(index);
+        const std::optional<size_t> internedChildIndex = findChildByInternedKey(index);
+        const size_t childIndex = (internedChildIndex ? *internedChildIndex : resolvePropertyIndex(sol::object(index)));
 
         if (m_wrappedProperty.get().getPropertySemantics() != EPropertySemantics::ScriptOutput)
         {
@@ -223,12 +238,10 @@ namespace rlogic::internal
                 sol_helper::throwSolException("Bad access to property '{}'! {}", m_wrappedProperty.get().getName(), structFieldName.getError());
             }
 
-            for (size_t i = 0; i < m_wrappedChildProperties.size(); ++i)
+            const std::optional<size_t> childIndex = m_wrappedProperty.get().findChildIndex(structFieldName.getData());
+            if (childIndex)
             {
-                if (m_wrappedChildProperties[i].m_wrappedProperty.get().getName() == structFieldName.getData())
-                {
-                    return i;
-                }
+                return *childIndex;
             }
 
             throw BadStructAccess(std::string(structFieldName.getData()), fmt::format("Tried to access undefined struct property '{}'", structFieldName.getData()));
@@ -274,7 +287,7 @@ namespace rlogic::internal
 
         if (TypeUtils::IsPrimitiveType(m_wrappedProperty.get().getType()))
         {
-            m_wrappedProperty.get().setValue(other.m_wrappedProperty.get().getValue());
+            m_wrappedProperty.get().copyValueFrom(other.m_wrappedProperty.get());
         }
         else
         {
@@ -519,6 +532,68 @@ namespace rlogic::internal
 
     }
 
+    void WrappedLuaProperty::internFieldNames(sol::state_view solState)
+    {
+        for (auto& child : m_wrappedChildProperties)
+        {
+            child.internFieldNames(solState);
+        }
+
+        if (m_wrappedProperty.get().getType() != EPropertyType::Struct || m_wrappedChildProperties.empty())
+        {
+            return;
+        }
+
+        // keep at least half of the slots empty so that probe sequences stay short
+        size_t slotCount = 1u;
+        while (slotCount < 2u * m_wrappedChildProperties.size())
+        {
+            slotCount <<= 1u;
+        }
+
+        m_internedFieldNames.assign(slotCount, {});
+        m_internedFieldNameAnchors.clear();
+        m_internedFieldNameAnchors.reserve(m_wrappedChildProperties.size());
+        lua_State* luaState = solState.lua_state();
+        for (size_t i = 0u; i < m_wrappedChildProperties.size(); ++i)
+        {
+            const std::string_view fieldName = m_wrappedChildProperties[i].m_wrappedProperty.get().getName();
+            m_internedFieldNameAnchors.push_back(sol::make_object(solState, fieldName));
+
+            m_internedFieldNameAnchors.back().push();
+            const char* key = lua_tostring(luaState, -1);
+            lua_pop(luaState, 1);
+
+            size_t slot = InternedKeyHash(key) & (slotCount - 1u);
+            while (m_internedFieldNames[slot].key != nullptr)
+            {
+                slot = (slot + 1u) & (slotCount - 1u);
+            }
+            m_internedFieldNames[slot] = { key, i };
+        }
+    }
+
+    std::optional<size_t> WrappedLuaProperty::findChildByInternedKey(const sol::stack_object& key) const
+    {
+        if (m_internedFieldNames.empty() || key.get_type() != sol::type::string)
+        {
+            return std::nullopt;
+        }
+
+        const char* keyData = lua_tostring(key.lua_state(), key.stack_index());
+        const size_t slotMask = m_internedFieldNames.size() - 1u;
+        for (size_t slot = InternedKeyHash(keyData) & slotMask; m_internedFieldNames[slot].key != nullptr; slot = (slot + 1u) & slotMask)
+        {
+            if (m_internedFieldNames[slot].key == keyData)
+            {
+                return m_internedFieldNames[slot].childIndex;
+            }
+        }
+
+        // not interned (e.g. long strings are not interned by Lua) or not a field
+        return std::nullopt;
+    }
+
     void WrappedLuaProperty::RegisterTypes(sol::state& state)
     {
         state.new_usertype<WrappedLuaProperty>("WrappedLuaProperty",
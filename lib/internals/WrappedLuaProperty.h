@@ -35,9 +35,9 @@ namespace rlogic::internal
 
         // Interface metamethods used by Lua
         // Called on 'obj.index = rhs'
-        void        newIndex(const sol::object& index, const sol::object& rhs);
+        void        newIndex(sol::stack_object index, const sol::object& rhs);
         // Called on 'X = obj.index'
-        [[nodiscard]] sol::object index(sol::this_state solState, const sol::object& index) const;
+        [[nodiscard]] sol::object index(sol::this_state solState, sol::stack_object index) const;
         // Called on '#obj'
         [[nodiscard]] size_t size() const;
         [[nodiscard]] sol::object resolveChild(sol::this_state solState, size_t childIndex) const;
@@ -46,6 +46,12 @@ namespace rlogic::internal
 
         [[nodiscard]] const PropertyImpl& getWrappedProperty() const;
 
+        // Creates the names of all struct fields (recursively) as Lua strings in given state, in which the wrapped property
+        // will be accessed. Lua interns (short) strings, so a string key used to access a field is the very same Lua string
+        // as the one created here if (and only if) it equals the field name, and the field can be found by comparing
+        // string pointers instead of hashing and comparing the name. Keys not found this way are resolved by name.
+        void internFieldNames(sol::state_view solState);
+
         // Register symbols for type extraction to sol state globally
         static void RegisterTypes(sol::state& state);
 
@@ -53,6 +59,18 @@ namespace rlogic::internal
         std::reference_wrapper<PropertyImpl> m_wrappedProperty;
         std::vector<WrappedLuaProperty> m_wrappedChildProperties;
 
+        // Open addressing hash table (linear probing) keyed by pointer to string data of the interned field names
+        struct InternedFieldName
+        {
+            const char* key = nullptr;
+            size_t childIndex = 0u;
+        };
+        std::vector<InternedFieldName> m_internedFieldNames;
+        // Keep the interned strings alive, otherwise another string could later be allocated at the same address
+        std::vector<sol::object> m_internedFieldNameAnchors;
+
+        [[nodiscard]] std::optional<size_t> findChildByInternedKey(const sol::stack_object& key) const;
+
         template <typename T, int N>
         [[nodiscard]] sol::object extractVectorComponent(sol::this_state solState, const sol::object& index) const;
         template <typename T, int N>
@@ -116,7 +116,7 @@ namespace rlogic::internal
                     m_nodeBinding.getId(),
                     m_cameraBinding.getId(),
                     0, // no inputs
-                    (issue == ESerializationIssue::MissingRootOutput ? 0 : PropertyImpl::Serialize(*outputsImpl, m_flatBufferBuilder, m_serializationMap)));
+                    (issue == ESerializationIssue::MissingRootOutput ? 0 : PropertyImpl::Serialize(*outputsImpl, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_01)));
                 m_flatBufferBuilder.Finish(fbAnchorPoint);
             }
 
@@ -14,7 +14,9 @@
 #include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/AnimationNodeConfig.h"
 #include "ramses-logic/Property.h"
+#include "ramses-logic/TimerNode.h"
 #include "impl/AnimationNodeImpl.h"
+#include "impl/TimerNodeImpl.h"
 #include "impl/DataArrayImpl.h"
 #include "impl/PropertyImpl.h"
 #include "internals/ErrorReporting.h"
@@ -142,6 +144,17 @@ namespace rlogic::internal
         EXPECT_EQ(channels, animNode->getChannels());
     }
 
+    TEST_P(AnAnimationNode, IsRecognizedAsAnimationNodeForBatchedUpdate)
+    {
+        const auto animNode = createAnimationNode({ AnimationChannel{ "channel", m_dataFloat, m_dataVec2 } });
+        ASSERT_NE(nullptr, animNode);
+        EXPECT_EQ(&animNode->m_animationNodeImpl, animNode->m_animationNodeImpl.asAnimationNode());
+
+        const auto timerNode = m_logicEngine.createTimerNode();
+        ASSERT_NE(nullptr, timerNode);
+        EXPECT_EQ(nullptr, timerNode->m_timerNodeImpl.asAnimationNode());
+    }
+
     TEST_P(AnAnimationNode, IsDestroyed)
     {
         const auto animNode = createAnimationNode({ { "channel", m_dataFloat, m_dataVec2 } }, "animNode");
@@ -724,6 +737,28 @@ namespace rlogic::internal
         EXPECT_NE(nullptr, m_logicEngine.createAnimationNode(config, "animNode"));
     }
 
+    TEST_P(AnAnimationNode, SharesChannelDataWithDataArraysInsteadOfCopying)
+    {
+        std::vector<float> timestamps(MaxArrayPropertySize);
+        std::iota(timestamps.begin(), timestamps.end(), 0.f);
+        const auto largeTimestamps = m_logicEngine.createDataArray(timestamps);
+        const auto largeKeyframes = m_logicEngine.createDataArray(std::vector<vec4f>(MaxArrayPropertySize, vec4f{ 1.f, 2.f, 3.f, 4.f }));
+        const auto smallTimestamps = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f });
+        const auto smallKeyframes = m_logicEngine.createDataArray(std::vector<vec4f>{ { 1.f, 2.f, 3.f, 4.f }, { 1.f, 2.f, 3.f, 4.f } });
+
+        const auto animNode1 = createAnimationNode({ { "channel", largeTimestamps, largeKeyframes, EInterpolationType::Linear } });
+        const auto animNode2 = createAnimationNode({ { "channel", largeTimestamps, largeKeyframes, EInterpolationType::Linear } });
+        const auto animNodeSmallData = createAnimationNode({ { "channel", smallTimestamps, smallKeyframes, EInterpolationType::Linear } });
+        EXPECT_TRUE(m_logicEngine.update());
+
+        // memory owned by node does not depend on size of channel data
+        EXPECT_EQ(animNodeSmallData->m_animationNodeImpl.getChannelDataMemoryUsage(), animNode1->m_animationNodeImpl.getChannelDataMemoryUsage());
+        EXPECT_EQ(animNodeSmallData->m_animationNodeImpl.getChannelDataMemoryUsage(), animNode2->m_animationNodeImpl.getChannelDataMemoryUsage());
+        EXPECT_LT(animNode1->m_animationNodeImpl.getChannelDataMemoryUsage(), MaxArrayPropertySize * sizeof(vec4f));
+
+        advanceAnimationAndExpectValues(*animNode1, 0.5f, vec4f{ 1.f, 2.f, 3.f, 4.f });
+    }
+
     class AnAnimationNode_SerializationLifecycle : public AnAnimationNode
     {
     protected:
@@ -810,8 +845,8 @@ namespace rlogic::internal
                         issue == ESerializationIssue::IdMissing ? 0 : 1u),
                     issue == ESerializationIssue::ChannelsMissing ? 0 : flatBufferBuilder.CreateVector(channelsFB),
                     issue == ESerializationIssue::PropertyChannelsDataInvalid,
-                    issue == ESerializationIssue::RootInMissing ? 0 : PropertyImpl::Serialize(*inputsImpl, flatBufferBuilder, serializationMap),
-                    issue == ESerializationIssue::RootOutMissing ? 0 : PropertyImpl::Serialize(*outputsImpl, flatBufferBuilder, serializationMap)
+                    issue == ESerializationIssue::RootInMissing ? 0 : PropertyImpl::Serialize(*inputsImpl, flatBufferBuilder, serializationMap, EFeatureLevel_01),
+                    issue == ESerializationIssue::RootOutMissing ? 0 : PropertyImpl::Serialize(*outputsImpl, flatBufferBuilder, serializationMap, EFeatureLevel_01)
                 );
 
                 flatBufferBuilder.Finish(animNodeFB);
@@ -12,6 +12,7 @@
 #include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/AnimationNodeConfig.h"
 #include "ramses-logic/Property.h"
+#include "impl/AnimationNodeImpl.h"
 #include "WithTempDirectory.h"
 #include <numeric>
 
@@ -235,6 +236,35 @@ namespace rlogic::internal
         EXPECT_THAT(*channels[0].keyframes->getData<float>(), ::testing::ElementsAre(0.f, 10.f, 20.f));
     }
 
+    TEST_F(AnAnimationNodeWithDataProperties, CopiesChannelDataOnlyWhenModifiedWithoutAffectingOtherNodesUsingSameData)
+    {
+        const auto animNode = createAnimationNodeWithDataProperties({ { "channel", m_dataFloat1, m_dataFloat2, EInterpolationType::Linear } });
+        const auto otherAnimNode = createAnimationNodeWithDataProperties({ { "channel", m_dataFloat1, m_dataFloat2, EInterpolationType::Linear } });
+        const size_t sharedDataMemoryUsage = animNode->m_animationNodeImpl.getChannelDataMemoryUsage();
+        EXPECT_EQ(sharedDataMemoryUsage, otherAnimNode->m_animationNodeImpl.getChannelDataMemoryUsage());
+
+        // setting same values as in data arrays does not copy
+        animNode->getInputs()->getChild("channelsData")->getChild("channel")->getChild("keyframes")->getChild(1u)->set(10.f);
+        advanceAnimationAndExpectValues(*animNode, 0.25f, 5.f);
+        EXPECT_EQ(sharedDataMemoryUsage, animNode->m_animationNodeImpl.getChannelDataMemoryUsage());
+
+        animNode->getInputs()->getChild("channelsData")->getChild("channel")->getChild("keyframes")->getChild(1u)->set(100.f);
+        advanceAnimationAndExpectValues(*animNode, 0.25f, 50.f);
+        EXPECT_LT(sharedDataMemoryUsage, animNode->m_animationNodeImpl.getChannelDataMemoryUsage());
+        const size_t keyframesCopiedMemoryUsage = animNode->m_animationNodeImpl.getChannelDataMemoryUsage();
+
+        animNode->getInputs()->getChild("channelsData")->getChild("channel")->getChild("timestamps")->getChild(2u)->set(4.f);
+        // duration extended to 4, i.e. at half way between timestamps 1 and 4
+        advanceAnimationAndExpectValues(*animNode, 0.625f, 60.f);
+        EXPECT_LT(keyframesCopiedMemoryUsage, animNode->m_animationNodeImpl.getChannelDataMemoryUsage());
+
+        // other node still uses original data
+        advanceAnimationAndExpectValues(*otherAnimNode, 0.25f, 5.f);
+        EXPECT_EQ(sharedDataMemoryUsage, otherAnimNode->m_animationNodeImpl.getChannelDataMemoryUsage());
+        EXPECT_THAT(*m_dataFloat1->getData<float>(), ::testing::ElementsAre(0.f, 1.f, 2.f));
+        EXPECT_THAT(*m_dataFloat2->getData<float>(), ::testing::ElementsAre(0.f, 10.f, 20.f));
+    }
+
     TEST_F(AnAnimationNodeWithDataProperties, CanBeSerializedAndDeserialized)
     {
         WithTempDirectory tempDir;
@@ -14,9 +14,12 @@
 #include "ramses-logic/DataArray.h"
 #include "impl/DataArrayImpl.h"
 #include "internals/ErrorReporting.h"
+#include "internals/SerializationMap.h"
 #include "generated/DataArrayGen.h"
 
 #include <fmt/format.h>
+#include <cmath>
+#include <limits>
 
 namespace rlogic::internal
 {
@@ -441,6 +444,131 @@ namespace rlogic::internal
         EXPECT_EQ("Fatal error during loading of DataArray from serialized data: unexpected data size!", this->m_errorReporting.getErrors().front().message);
     }
 
+    class ADataArray_CompressedSerialization : public ::testing::Test
+    {
+    protected:
+        template <typename T>
+        std::unique_ptr<DataArrayImpl> serializeAndDeserialize(const std::vector<T>& data, EDataArrayEncoding encoding)
+        {
+            const auto* dataArray = m_logicEngine.createDataArray(data, "dataArray");
+            flatbuffers::FlatBufferBuilder builder;
+            SerializationMap serializationMap;
+            builder.Finish(DataArrayImpl::Serialize(dataArray->m_impl, builder, serializationMap, EFeatureLevel_07, encoding));
+            const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::DataArray>(builder.GetBufferPointer());
+            m_serializedUnionType = serialized.data_type();
+            return DataArrayImpl::Deserialize(serialized, m_errorReporting);
+        }
+
+        std::unique_ptr<DataArrayImpl> deserializeQuantized(rlogic_serialization::EDataArrayType dataType, uint32_t numElements, const std::vector<uint16_t>& values, const std::vector<float>& componentRange)
+        {
+            flatbuffers::FlatBufferBuilder builder;
+            const auto dataOffset = rlogic_serialization::CreatequantizedFloatArr(builder, builder.CreateVector(values), builder.CreateVector(componentRange), builder.CreateVector(componentRange)).Union();
+            return deserialize(builder, dataType, rlogic_serialization::ArrayUnion::quantizedFloatArr, dataOffset, numElements);
+        }
+
+        std::unique_ptr<DataArrayImpl> deserializePackedQuaternions(rlogic_serialization::EDataArrayType dataType, uint32_t numElements, const std::vector<uint16_t>& values)
+        {
+            flatbuffers::FlatBufferBuilder builder;
+            const auto dataOffset = rlogic_serialization::CreatepackedQuaternionArr(builder, builder.CreateVector(values)).Union();
+            return deserialize(builder, dataType, rlogic_serialization::ArrayUnion::packedQuaternionArr, dataOffset, numElements);
+        }
+
+        std::unique_ptr<DataArrayImpl> deserialize(flatbuffers::FlatBufferBuilder& builder, rlogic_serialization::EDataArrayType dataType, rlogic_serialization::ArrayUnion unionType, flatbuffers::Offset<void> dataOffset, uint32_t numElements)
+        {
+            builder.Finish(rlogic_serialization::CreateDataArray(
+                builder,
+                rlogic_serialization::CreateLogicObject(builder, builder.CreateString("dataarray"), 1u),
+                dataType,
+                unionType,
+                dataOffset,
+                numElements));
+            const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::DataArray>(builder.GetBufferPointer());
+            return DataArrayImpl::Deserialize(serialized, m_errorReporting);
+        }
+
+        LogicEngine m_logicEngine{ EFeatureLevel_07 };
+        ErrorReporting m_errorReporting;
+        rlogic_serialization::ArrayUnion m_serializedUnionType = rlogic_serialization::ArrayUnion::NONE;
+    };
+
+    TEST_F(ADataArray_CompressedSerialization, QuantizesFloatBasedData)
+    {
+        const std::vector<vec2f> data{ { 0.f, 10.f }, { 1.f, -10.f }, { 0.3f, 2.f } };
+        const auto deserialized = serializeAndDeserialize(data, EDataArrayEncoding::Quantized);
+        ASSERT_TRUE(deserialized);
+        EXPECT_EQ(rlogic_serialization::ArrayUnion::quantizedFloatArr, m_serializedUnionType);
+        const auto& deserializedData = *deserialized->getData<vec2f>();
+        ASSERT_EQ(data.size(), deserializedData.size());
+        for (size_t i = 0u; i < data.size(); ++i)
+        {
+            EXPECT_NEAR(data[i][0], deserializedData[i][0], 1.f / 65535.f);
+            EXPECT_NEAR(data[i][1], deserializedData[i][1], 20.f / 65535.f);
+        }
+
+        const std::vector<std::vector<float>> morphWeights{ { 0.f, 0.5f, 1.f }, { 1.f, 0.25f, 0.f } };
+        const auto deserializedWeights = serializeAndDeserialize(morphWeights, EDataArrayEncoding::Quantized);
+        ASSERT_TRUE(deserializedWeights);
+        EXPECT_EQ(rlogic_serialization::ArrayUnion::quantizedFloatArr, m_serializedUnionType);
+        EXPECT_EQ(morphWeights, *deserializedWeights->getData<std::vector<float>>());
+    }
+
+    TEST_F(ADataArray_CompressedSerialization, PacksUnitQuaternions)
+    {
+        const std::vector<vec4f> data{ { 0.f, 0.f, 0.f, 1.f }, { 0.f, 0.6f, 0.f, -0.8f } };
+        const auto deserialized = serializeAndDeserialize(data, EDataArrayEncoding::PackedQuaternions);
+        ASSERT_TRUE(deserialized);
+        EXPECT_EQ(rlogic_serialization::ArrayUnion::packedQuaternionArr, m_serializedUnionType);
+        const auto& deserializedData = *deserialized->getData<vec4f>();
+        ASSERT_EQ(data.size(), deserializedData.size());
+        for (size_t i = 0u; i < data.size(); ++i)
+        {
+            for (size_t c = 0u; c < 4u; ++c)
+                EXPECT_NEAR(data[i][c], deserializedData[i][c], 1e-4f);
+        }
+    }
+
+    TEST_F(ADataArray_CompressedSerialization, FallsBackToOtherEncodingIfDataCantBeCompressed)
+    {
+        // not unit quaternions are quantized
+        EXPECT_TRUE(serializeAndDeserialize(std::vector<vec4f>{ { 0.f, 0.f, 0.f, 2.f } }, EDataArrayEncoding::PackedQuaternions));
+        EXPECT_EQ(rlogic_serialization::ArrayUnion::quantizedFloatArr, m_serializedUnionType);
+
+        const std::vector<float> notFinite{ 0.f, std::numeric_limits<float>::quiet_NaN() };
+        const auto deserialized = serializeAndDeserialize(notFinite, EDataArrayEncoding::Quantized);
+        ASSERT_TRUE(deserialized);
+        EXPECT_EQ(rlogic_serialization::ArrayUnion::floatArr, m_serializedUnionType);
+        EXPECT_TRUE(std::isnan(deserialized->getData<float>()->back()));
+
+        const std::vector<vec3i> ints{ { 1, 2, 3 } };
+        const auto deserializedInts = serializeAndDeserialize(ints, EDataArrayEncoding::Quantized);
+        ASSERT_TRUE(deserializedInts);
+        EXPECT_EQ(rlogic_serialization::ArrayUnion::intArr, m_serializedUnionType);
+        EXPECT_EQ(ints, *deserializedInts->getData<vec3i>());
+    }
+
+    TEST_F(ADataArray_CompressedSerialization, ReportsErrorWhenDeserializedWithCorruptedCompressedData)
+    {
+        // component count does not match type
+        EXPECT_FALSE(deserializeQuantized(rlogic_serialization::EDataArrayType::Vec3f, 1u, { 1u, 2u }, { 0.f, 1.f }));
+        // data size does not match element count
+        EXPECT_FALSE(deserializeQuantized(rlogic_serialization::EDataArrayType::Vec2f, 2u, { 1u, 2u }, { 0.f, 1.f }));
+        EXPECT_FALSE(deserializeQuantized(rlogic_serialization::EDataArrayType::FloatArray, 0u, {}, { 0.f, 1.f }));
+        // integer data can't be quantized
+        EXPECT_FALSE(deserializeQuantized(rlogic_serialization::EDataArrayType::Vec2i, 1u, { 1u, 2u }, { 0.f, 1.f }));
+        EXPECT_FALSE(deserializePackedQuaternions(rlogic_serialization::EDataArrayType::Vec4f, 2u, { 1u, 2u, 3u }));
+        ASSERT_EQ(5u, m_errorReporting.getErrors().size());
+        for (const auto& error : m_errorReporting.getErrors())
+            EXPECT_EQ("Fatal error during loading of DataArray from serialized data: unexpected data size!", error.message);
+        m_errorReporting.clear();
+
+        EXPECT_FALSE(deserializePackedQuaternions(rlogic_serialization::EDataArrayType::Vec3f, 1u, { 1u, 2u, 3u }));
+        ASSERT_EQ(1u, m_errorReporting.getErrors().size());
+        EXPECT_EQ("Fatal error during loading of DataArray from serialized data: unexpected data type!", m_errorReporting.getErrors()[0].message);
+
+        EXPECT_TRUE(deserializeQuantized(rlogic_serialization::EDataArrayType::FloatArray, 2u, { 1u, 2u, 3u, 4u }, { 0.f, 1.f }));
+        EXPECT_TRUE(deserializePackedQuaternions(rlogic_serialization::EDataArrayType::Vec4f, 1u, { 1u, 2u, 3u }));
+    }
+
     TEST(AnimationChannel, EqualityOperatorsTests)
     {
         LogicEngine engine;
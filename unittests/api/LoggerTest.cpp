@@ -15,6 +15,9 @@
 
 #include "LogTestUtils.h"
 
+#include <thread>
+#include <algorithm>
+
 namespace rlogic
 {
     // Test default state without fixture
@@ -99,4 +102,27 @@ namespace rlogic
 
         EXPECT_THAT(m_logTypes, ::testing::ElementsAre(ELogMessageType::Fatal, ELogMessageType::Error));
     }
+
+    TEST_F(ALogger, PassesMessagesFromMultipleThreadsToLogHandlerOneAtATime)
+    {
+        Logger::SetDefaultLogging(false);
+
+        // log handler of fixture is not thread-safe by itself, messages must be serialized by logger
+        std::vector<std::thread> threads;
+        for (size_t t = 0u; t < 4u; ++t)
+        {
+            threads.emplace_back([t]() {
+                for (size_t i = 0u; i < 100u; ++i)
+                    LOG_INFO("thread {} message {}", t, i);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        EXPECT_EQ(400u, m_logMessages.size());
+        EXPECT_EQ(1u, std::count(m_logMessages.cbegin(), m_logMessages.cend(), "thread 3 message 99"));
+
+        // Reset to not affect other tests
+        Logger::SetDefaultLogging(true);
+    }
 }
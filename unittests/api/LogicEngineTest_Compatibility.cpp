@@ -178,10 +178,14 @@ namespace rlogic::internal
             { EFeatureLevel_01, EFeatureLevel_03 },
             { EFeatureLevel_01, EFeatureLevel_04 },
             { EFeatureLevel_01, EFeatureLevel_05 },
+            { EFeatureLevel_01, EFeatureLevel_06 },
+            { EFeatureLevel_01, EFeatureLevel_07 },
             { EFeatureLevel_02, EFeatureLevel_01 },
             { EFeatureLevel_03, EFeatureLevel_01 },
             { EFeatureLevel_04, EFeatureLevel_01 },
-            { EFeatureLevel_05, EFeatureLevel_01 }
+            { EFeatureLevel_05, EFeatureLevel_01 },
+            { EFeatureLevel_06, EFeatureLevel_01 },
+            { EFeatureLevel_07, EFeatureLevel_01 }
         };
 
         for (const auto& comb : combinations)
@@ -464,12 +468,57 @@ namespace rlogic::internal
             EXPECT_FALSE(logicEngine.findByName<LogicObject>("meshnodebinding"));
         }
 
+        static void expectFeatureLevel07Content(const LogicEngine& logicEngine)
+        {
+            // stored compressed in file, timestamps always with full precision
+            const auto timestamps = logicEngine.findByName<DataArray>("compressedTimestamps");
+            ASSERT_TRUE(timestamps);
+            EXPECT_EQ((std::vector<float>{ 0.f, 0.5f, 1.f }), *timestamps->getData<float>());
+
+            const auto translations = logicEngine.findByName<DataArray>("compressedTranslations");
+            ASSERT_TRUE(translations);
+            const std::vector<vec3f> expectedTranslations{ { 0.f, 1.f, -2.f }, { 0.25f, 2.f, -1.f }, { 1.f, 3.f, 0.f } };
+            ASSERT_EQ(expectedTranslations.size(), translations->getNumElements());
+            for (size_t i = 0u; i < expectedTranslations.size(); ++i)
+            {
+                for (size_t c = 0u; c < 3u; ++c)
+                    EXPECT_NEAR(expectedTranslations[i][c], (*translations->getData<vec3f>())[i][c], 1e-4f);
+            }
+
+            const auto rotations = logicEngine.findByName<DataArray>("compressedRotations");
+            ASSERT_TRUE(rotations);
+            const std::vector<vec4f> expectedRotations{ { 0.f, 0.f, 0.f, 1.f }, { 0.f, 0.6f, 0.f, 0.8f }, { 0.f, 0.8f, 0.f, -0.6f } };
+            ASSERT_EQ(expectedRotations.size(), rotations->getNumElements());
+            for (size_t i = 0u; i < expectedRotations.size(); ++i)
+            {
+                for (size_t c = 0u; c < 4u; ++c)
+                    EXPECT_NEAR(expectedRotations[i][c], (*rotations->getData<vec4f>())[i][c], 1e-4f);
+            }
+
+            const auto animNode = logicEngine.findByName<AnimationNode>("animNodeCompressed");
+            ASSERT_TRUE(animNode);
+            EXPECT_NE(nullptr, animNode->getOutputs()->getChild("translation"));
+            EXPECT_NE(nullptr, animNode->getOutputs()->getChild("rotation"));
+        }
+
+        static void expectFeatureLevel07ContentNotPresent(const LogicEngine& logicEngine)
+        {
+            EXPECT_FALSE(logicEngine.findByName<LogicObject>("animNodeCompressed"));
+            EXPECT_FALSE(logicEngine.findByName<LogicObject>("compressedTimestamps"));
+        }
+
         static void checkContents(LogicEngine& logicEngine, ramses::Scene& scene)
         {
             // check for content expected to exist
             // higher feature level always contains content supported by lower level
             switch (logicEngine.getFeatureLevel())
             {
+            case EFeatureLevel_07:
+                expectFeatureLevel07Content(logicEngine);
+                [[fallthrough]];
+            case EFeatureLevel_06:
+                // feature level 06 changed only the encoding of properties in files, no new content
+                [[fallthrough]];
             case EFeatureLevel_05:
                 expectFeatureLevel05Content(logicEngine);
                 [[fallthrough]];
@@ -504,6 +553,10 @@ namespace rlogic::internal
                 expectFeatureLevel05ContentNotPresent(logicEngine);
                 [[fallthrough]];
             case EFeatureLevel_05:
+            case EFeatureLevel_06:
+                expectFeatureLevel07ContentNotPresent(logicEngine);
+                [[fallthrough]];
+            case EFeatureLevel_07:
                 break;
             }
         }
@@ -536,6 +589,10 @@ namespace rlogic::internal
                 return &m_ramses.loadSceneFromFile("res/unittests/testScene_04.ramses");
             case EFeatureLevel_05:
                 return &m_ramses.loadSceneFromFile("res/unittests/testScene_05.ramses");
+            case EFeatureLevel_06:
+                return &m_ramses.loadSceneFromFile("res/unittests/testScene_06.ramses");
+            case EFeatureLevel_07:
+                return &m_ramses.loadSceneFromFile("res/unittests/testScene_07.ramses");
             }
             return nullptr;
         }
@@ -170,6 +170,35 @@ namespace rlogic
         EXPECT_TRUE(m_logicEngine.destroy(*module));
     }
 
+    TEST_P(ALogicEngine_Factory, DestroysModuleTogetherWithScriptUsingIt)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(m_moduleSourceCode, {}, "mymodule");
+        ASSERT_NE(nullptr, module);
+
+        constexpr std::string_view valid_empty_script = R"(
+            modules("mymodule")
+            function interface(IN,OUT)
+            end
+            function run(IN,OUT)
+            end
+        )";
+        LuaScript* script1 = m_logicEngine.createLuaScript(valid_empty_script, CreateDeps({ { "mymodule", module } }), "script1");
+        LuaScript* script2 = m_logicEngine.createLuaScript(valid_empty_script, CreateDeps({ { "mymodule", module } }), "script2");
+        ASSERT_NE(nullptr, script1);
+        ASSERT_NE(nullptr, script2);
+
+        EXPECT_FALSE(m_logicEngine.destroy({ module, script1 }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(m_logicEngine.getErrors().front().message, "Failed to destroy objects: 'mymodule' is used by 'script2' which is not destroyed");
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("script1"));
+
+        EXPECT_TRUE(m_logicEngine.destroy({ module, script1, script2 }));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_FALSE(m_logicEngine.findByName<LuaModule>("mymodule"));
+        EXPECT_FALSE(m_logicEngine.findByName<LuaScript>("script1"));
+        EXPECT_FALSE(m_logicEngine.findByName<LuaScript>("script2"));
+    }
+
     TEST_P(ALogicEngine_Factory, ProducesErrorWhenCreatingLuaScriptUsingModuleFromAnotherLogicInstance)
     {
         LogicEngine other;
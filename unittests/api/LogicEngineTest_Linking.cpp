@@ -87,6 +87,33 @@ namespace rlogic
         ALogicEngine_Linking,
         rlogic::internal::GetFeatureLevelTestValues());
 
+    TEST_P(ALogicEngine_Linking, ProvidesLinksAndTheirGenerationWhichChangesOnlyWhenLinksChange)
+    {
+        const uint64_t initialGeneration = m_logicEngine.getPropertyLinksGeneration();
+        EXPECT_TRUE(m_logicEngine.getPropertyLinks().empty());
+
+        ASSERT_TRUE(m_logicEngine.link(m_sourceProperty, m_targetProperty));
+        const uint64_t linkedGeneration = m_logicEngine.getPropertyLinksGeneration();
+        EXPECT_NE(initialGeneration, linkedGeneration);
+
+        const std::vector<PropertyLink>& links = m_logicEngine.getPropertyLinks();
+        ASSERT_EQ(1u, links.size());
+        EXPECT_EQ(&m_sourceProperty, links[0].source);
+        EXPECT_EQ(&m_targetProperty, links[0].target);
+        EXPECT_FALSE(links[0].isWeakLink);
+
+        // no change without link changes, the returned container stays the same
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(linkedGeneration, m_logicEngine.getPropertyLinksGeneration());
+        EXPECT_EQ(&links, &m_logicEngine.getPropertyLinks());
+
+        // returned container is not modified until requested again
+        ASSERT_TRUE(m_logicEngine.destroy(m_targetScript));
+        EXPECT_NE(linkedGeneration, m_logicEngine.getPropertyLinksGeneration());
+        EXPECT_EQ(1u, links.size());
+        EXPECT_TRUE(m_logicEngine.getPropertyLinks().empty());
+    }
+
     TEST_P(ALogicEngine_Linking, ProducesErrorIfPropertiesWithMismatchedTypesAreLinked)
     {
         const char* errorString = "Types of source property 'outParam:{}' does not match target property 'inParam:{}'";
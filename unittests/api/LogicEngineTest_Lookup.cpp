@@ -24,6 +24,10 @@
 #include "impl/AnchorPointImpl.h"
 #include "impl/SkinBindingImpl.h"
 
+#include "WithTempDirectory.h"
+
+#include "fmt/format.h"
+
 namespace rlogic
 {
     class ALogicEngine_Lookup : public ALogicEngine
@@ -466,6 +470,97 @@ namespace rlogic
         EXPECT_EQ(nullptr, m_logicEngine.findByName<RamsesNodeBinding>("nodebindinY"));
     }
 
+    TEST_F(ALogicEngine_Lookup, FindsFirstCreatedObjectIfMultipleObjectsHaveSameName)
+    {
+        TimerNode* timer1 = m_logicEngine.createTimerNode("same");
+        DataArray* dataArray = m_logicEngine.createDataArray(std::vector<float>{ 1.f }, "same");
+        TimerNode* timer2 = m_logicEngine.createTimerNode("same");
+        TimerNode* timer3 = m_logicEngine.createTimerNode("other");
+
+        EXPECT_EQ(timer1, m_logicEngine.findByName<TimerNode>("same"));
+        EXPECT_EQ(timer1, m_logicEngine.findByName<LogicObject>("same"));
+        EXPECT_EQ(dataArray, m_logicEngine.findByName<DataArray>("same"));
+
+        // renaming keeps order of creation
+        timer3->setName("same");
+        EXPECT_EQ(timer1, m_logicEngine.findByName<TimerNode>("same"));
+        timer1->setName("other");
+        EXPECT_EQ(timer2, m_logicEngine.findByName<TimerNode>("same"));
+        EXPECT_EQ(dataArray, m_logicEngine.findByName<LogicObject>("same"));
+        timer1->setName("same");
+        EXPECT_EQ(timer1, m_logicEngine.findByName<TimerNode>("same"));
+
+        ASSERT_TRUE(m_logicEngine.destroy(*timer1));
+        EXPECT_EQ(dataArray, m_logicEngine.findByName<LogicObject>("same"));
+        EXPECT_EQ(timer2, m_logicEngine.findByName<TimerNode>("same"));
+        ASSERT_TRUE(m_logicEngine.destroy(*timer2));
+        EXPECT_EQ(timer3, m_logicEngine.findByName<TimerNode>("same"));
+        ASSERT_TRUE(m_logicEngine.destroy(*timer3));
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<TimerNode>("same"));
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<TimerNode>("other"));
+    }
+
+    TEST_F(ALogicEngine_Lookup, FindsSameObjectsByNameAsInCollection)
+    {
+        for (size_t i = 0u; i < 100u; ++i)
+        {
+            m_logicEngine.createTimerNode(fmt::format("timer{}", i % 7));
+        }
+
+        for (size_t i = 0u; i < 7u; ++i)
+        {
+            const std::string name = fmt::format("timer{}", i);
+            const auto collection = m_logicEngine.getCollection<TimerNode>();
+            const auto firstInCollection = std::find_if(collection.cbegin(), collection.cend(), [&name](const TimerNode* timer) { return timer->getName() == name; });
+            ASSERT_NE(collection.cend(), firstInCollection);
+            EXPECT_EQ(*firstInCollection, m_logicEngine.findByName<TimerNode>(name));
+        }
+    }
+
+    TEST_F(ALogicEngine_Lookup, FindsObjectsByNameAfterLoading)
+    {
+        WithTempDirectory tempDir;
+        {
+            LogicEngine logicEngine{ m_logicEngine.getFeatureLevel() };
+            logicEngine.createDataArray(std::vector<float>{ 1.f }, "same");
+            logicEngine.createTimerNode("same");
+            logicEngine.createTimerNode("timer");
+            logicEngine.createLuaScript(m_valid_empty_script, {}, "script");
+            ASSERT_TRUE(SaveToFileWithoutValidation(logicEngine, "lookup.rlogic"));
+        }
+
+        ASSERT_TRUE(m_logicEngine.loadFromFile("lookup.rlogic"));
+        EXPECT_NE(nullptr, m_logicEngine.findByName<DataArray>("same"));
+        EXPECT_NE(nullptr, m_logicEngine.findByName<TimerNode>("same"));
+        // loaded objects are ordered by type, first found is the same as in collection
+        const auto collection = m_logicEngine.getCollection<LogicObject>();
+        const auto firstInCollection = std::find_if(collection.cbegin(), collection.cend(), [](const LogicObject* obj) { return obj->getName() == "same"; });
+        ASSERT_NE(collection.cend(), firstInCollection);
+        EXPECT_EQ(*firstInCollection, m_logicEngine.findByName<LogicObject>("same"));
+        EXPECT_NE(nullptr, m_logicEngine.findByName<TimerNode>("timer"));
+        EXPECT_NE(nullptr, m_logicEngine.findByName<LuaScript>("script"));
+
+        m_logicEngine.findByName<TimerNode>("timer")->setName("renamed");
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<TimerNode>("timer"));
+        EXPECT_NE(nullptr, m_logicEngine.findByName<TimerNode>("renamed"));
+    }
+
+    TEST_F(ALogicEngine_Lookup, FindsMultipleObjectsByTheirNames)
+    {
+        const auto timer1 = m_logicEngine.createTimerNode("timer1");
+        const auto timer2 = m_logicEngine.createTimerNode("timer2");
+        const auto script = m_logicEngine.createLuaScript(m_valid_empty_script, {}, "script");
+
+        const std::vector<TimerNode*> timers = m_logicEngine.findByNames<TimerNode>({ "timer2", "script", "timer1", "unknown", "timer2" });
+        EXPECT_EQ(std::vector<TimerNode*>({ timer2, nullptr, timer1, nullptr, timer2 }), timers);
+
+        const LogicEngine& constLogicEngine = m_logicEngine;
+        const std::vector<const LogicObject*> objects = constLogicEngine.findByNames<LogicObject>({ "script", "timer1" });
+        EXPECT_EQ(std::vector<const LogicObject*>({ script, timer1 }), objects);
+
+        EXPECT_TRUE(m_logicEngine.findByNames<LuaScript>({}).empty());
+    }
+
     TEST_F(ALogicEngine_Lookup, GetHLObjectFromImpl)
     {
         const auto module = m_logicEngine.createLuaModule(m_moduleSourceCode, {}, "luaModule");
@@ -49,6 +49,8 @@
 
 #include <fstream>
 #include <deque>
+#include <cmath>
+#include <limits>
 
 namespace rlogic::internal
 {
@@ -174,6 +176,143 @@ namespace rlogic::internal
         EXPECT_THAT(errors[0].message, ::testing::HasSubstr("Can't save logic content for feature level in binary mode, binary Lua support was introduced with FeatureLevel_02!"));
     }
 
+    TEST(ALogicEngine_Serialization_FeatureLevel6, RefusesToSaveDataArraysCompressed)
+    {
+        LogicEngine logicEngineFl6(EFeatureLevel::EFeatureLevel_06);
+        SaveFileConfig config;
+        config.setDataArrayCompression(EDataArrayCompression::QuantizedKeyframes);
+        std::vector<char> buffer;
+        EXPECT_FALSE(logicEngineFl6.saveToBuffer(buffer, config));
+        const auto& errors = logicEngineFl6.getErrors();
+        ASSERT_EQ(1u, errors.size());
+        EXPECT_EQ(errors[0].message, "Can't save DataArrays compressed, feature level 07 or higher is required, feature level in this runtime set to 06.");
+    }
+
+    class ALogicEngine_Serialization_DataArrayCompression : public ::testing::Test
+    {
+    protected:
+        ALogicEngine_Serialization_DataArrayCompression()
+        {
+            std::vector<float> timestamps;
+            std::vector<vec3f> translations;
+            std::vector<vec4f> rotations;
+            std::vector<float> tangents;
+            for (size_t i = 0u; i < 200u; ++i)
+            {
+                const float t = static_cast<float>(i) * 0.0333f;
+                timestamps.push_back(t);
+                translations.push_back({ std::sin(t) * 100.f, t, -0.001f * t });
+                const float angle = 0.5f * t;
+                rotations.push_back({ 0.f, std::sin(angle) * 0.6f, std::sin(angle) * 0.8f, std::cos(angle) });
+                tangents.push_back(std::cos(t));
+            }
+
+            m_timestamps = m_logicEngine.createDataArray(timestamps, "timestamps");
+            m_translations = m_logicEngine.createDataArray(translations, "translations");
+            m_rotations = m_logicEngine.createDataArray(rotations, "rotations");
+            m_tangents = m_logicEngine.createDataArray(tangents, "tangents");
+            m_logicEngine.createDataArray(std::vector<float>{ 0.1f, 0.2f, 0.3f }, "unused");
+            m_logicEngine.createDataArray(std::vector<int32_t>{ 1, 2, 3 }, "ints");
+
+            AnimationNodeConfig config;
+            config.addChannel({ "translation", m_timestamps, m_translations, EInterpolationType::Linear });
+            config.addChannel({ "rotation", m_timestamps, m_rotations, EInterpolationType::Linear_Quaternions });
+            config.addChannel({ "cubic", m_timestamps, m_tangents, EInterpolationType::Cubic, m_tangents, m_tangents });
+            // timestamps used also as keyframes must stay exact
+            config.addChannel({ "time", m_timestamps, m_timestamps, EInterpolationType::Linear });
+            m_logicEngine.createAnimationNode(config, "animNode");
+        }
+
+        template <typename T>
+        const std::vector<T>& loadedData(std::string_view name)
+        {
+            const auto* dataArray = m_loadedLogicEngine.findByName<DataArray>(name);
+            EXPECT_NE(nullptr, dataArray);
+            return *dataArray->getData<T>();
+        }
+
+        LogicEngine m_logicEngine{ EFeatureLevel_07 };
+        LogicEngine m_loadedLogicEngine{ EFeatureLevel_07 };
+        DataArray* m_timestamps = nullptr;
+        DataArray* m_translations = nullptr;
+        DataArray* m_rotations = nullptr;
+        DataArray* m_tangents = nullptr;
+    };
+
+    TEST_F(ALogicEngine_Serialization_DataArrayCompression, StoresKeyframesCompressedAndOtherDataExactly)
+    {
+        std::vector<char> uncompressedBuffer;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(uncompressedBuffer));
+        SaveFileConfig config;
+        config.setDataArrayCompression(EDataArrayCompression::QuantizedKeyframes);
+        std::vector<char> compressedBuffer;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(compressedBuffer, config));
+        // 2 instead of 4 bytes per float component, 6 instead of 16 bytes per quaternion
+        EXPECT_LT(compressedBuffer.size() + 3000u, uncompressedBuffer.size());
+
+        ASSERT_TRUE(m_loadedLogicEngine.loadFromBuffer(compressedBuffer.data(), compressedBuffer.size()));
+
+        EXPECT_EQ(*m_timestamps->getData<float>(), loadedData<float>("timestamps"));
+        EXPECT_EQ((std::vector<float>{ 0.1f, 0.2f, 0.3f }), loadedData<float>("unused"));
+        EXPECT_EQ((std::vector<int32_t>{ 1, 2, 3 }), loadedData<int32_t>("ints"));
+
+        const auto& translations = *m_translations->getData<vec3f>();
+        const auto& loadedTranslations = loadedData<vec3f>("translations");
+        ASSERT_EQ(translations.size(), loadedTranslations.size());
+        for (size_t i = 0u; i < translations.size(); ++i)
+        {
+            // error is at most half of range of component divided by 65535
+            EXPECT_NEAR(translations[i][0], loadedTranslations[i][0], 200.f / 65535.f * 0.5f + 1e-5f);
+            EXPECT_NEAR(translations[i][1], loadedTranslations[i][1], 6.7f / 65535.f * 0.5f + 1e-6f);
+            EXPECT_NEAR(translations[i][2], loadedTranslations[i][2], 1e-6f);
+        }
+
+        const auto& rotations = *m_rotations->getData<vec4f>();
+        const auto& loadedRotations = loadedData<vec4f>("rotations");
+        ASSERT_EQ(rotations.size(), loadedRotations.size());
+        for (size_t i = 0u; i < rotations.size(); ++i)
+        {
+            for (size_t c = 0u; c < 4u; ++c)
+                EXPECT_NEAR(rotations[i][c], loadedRotations[i][c], 1e-4f);
+        }
+
+        const auto& tangents = *m_tangents->getData<float>();
+        const auto& loadedTangents = loadedData<float>("tangents");
+        ASSERT_EQ(tangents.size(), loadedTangents.size());
+        for (size_t i = 0u; i < tangents.size(); ++i)
+            EXPECT_NEAR(tangents[i], loadedTangents[i], 2.f / 65535.f * 0.5f + 1e-6f);
+
+        // animation works with decoded data as usual
+        auto* animNode = m_loadedLogicEngine.findByName<AnimationNode>("animNode");
+        ASSERT_NE(nullptr, animNode);
+        EXPECT_TRUE(animNode->getInputs()->getChild("progress")->set(0.5f));
+        EXPECT_TRUE(m_loadedLogicEngine.update());
+        EXPECT_NEAR(m_timestamps->getData<float>()->back() * 0.5f, *animNode->getOutputs()->getChild("time")->get<float>(), 1e-5f);
+    }
+
+    TEST_F(ALogicEngine_Serialization_DataArrayCompression, FallsBackToOtherEncodingForDataWhichCantBeCompressed)
+    {
+        // not normalized quaternions can't be packed, they are quantized instead (exact here, only minimum and maximum of range are used)
+        const std::vector<vec4f> notNormalized{ { 0.f, 0.f, 0.f, 2.f }, { 0.f, 0.f, 0.f, 4.f } };
+        // values which are not finite can't be quantized at all
+        const std::vector<float> notFinite{ 0.f, std::numeric_limits<float>::infinity() };
+        const auto* timestamps = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f }, "shortTimestamps");
+        AnimationNodeConfig config;
+        config.addChannel({ "rotation", timestamps, m_logicEngine.createDataArray(notNormalized, "notNormalized"), EInterpolationType::Linear_Quaternions });
+        config.addChannel({ "float", timestamps, m_logicEngine.createDataArray(notFinite, "notFinite"), EInterpolationType::Linear });
+        ASSERT_NE(nullptr, m_logicEngine.createAnimationNode(config, "otherAnimNode"));
+
+        SaveFileConfig saveConfig;
+        saveConfig.setDataArrayCompression(EDataArrayCompression::QuantizedKeyframes);
+        std::vector<char> buffer;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer, saveConfig));
+        ASSERT_TRUE(m_loadedLogicEngine.loadFromBuffer(buffer.data(), buffer.size()));
+
+        EXPECT_EQ(notNormalized, loadedData<vec4f>("notNormalized"));
+        EXPECT_EQ(notFinite, loadedData<float>("notFinite"));
+        EXPECT_EQ((std::vector<float>{ 0.f, 1.f }), loadedData<float>("shortTimestamps"));
+    }
+
     TEST_P(ALogicEngine_Serialization, ProducesErrorIfDeserilizedFromInvalidFile)
     {
         EXPECT_FALSE(m_logicEngine.loadFromFile("invalid"));
@@ -282,6 +421,92 @@ namespace rlogic::internal
             m_logicEngine.getErrors()[0].message);
     }
 
+    TEST_P(ALogicEngine_Serialization, SavesToFileDescriptorSameDataAsToFile)
+    {
+        const std::vector<char> bufferData = CreateTestBuffer();
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(bufferData.data(), bufferData.size()));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        const int fd = FileDescriptorHelper::CreateFileDescriptorBinary("LogicEngineFd.bin");
+        ASSERT_LT(0, fd);
+        EXPECT_TRUE(m_logicEngine.saveToFileDescriptor(fd));
+        FileDescriptorHelper::CloseFileDescriptor(fd);
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        ASSERT_TRUE(m_logicEngine.saveToFile("LogicEngine.bin"));
+        EXPECT_EQ(*FileUtils::LoadBinary("LogicEngine.bin"), *FileUtils::LoadBinary("LogicEngineFd.bin"));
+    }
+
+    TEST_P(ALogicEngine_Serialization, SavesToFileDescriptorAtCurrentPosition)
+    {
+        const std::vector<char> bufferData = CreateTestBuffer();
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(bufferData.data(), bufferData.size()));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        const std::string header(16u, 'x');
+        const int fd = FileDescriptorHelper::CreateFileDescriptorBinary("LogicEngine.bin");
+        ASSERT_LT(0, fd);
+        ASSERT_TRUE(FileUtils::SaveBinary(fd, header.data(), header.size()));
+        EXPECT_TRUE(m_logicEngine.saveToFileDescriptor(fd));
+        FileDescriptorHelper::CloseFileDescriptor(fd);
+
+        const int fdForLoading = FileDescriptorHelper::OpenFileDescriptorBinary("LogicEngine.bin");
+        ASSERT_LT(0, fdForLoading);
+        EXPECT_TRUE(m_logicEngine.loadFromFileDescriptor(fdForLoading, header.size(), bufferData.size()));
+        EXPECT_NE(nullptr, m_logicEngine.findByName<LuaScript>("luascript"));
+    }
+
+    TEST_P(ALogicEngine_Serialization, SaveToFileDescriptor_InvalidFileDescriptor)
+    {
+        EXPECT_FALSE(m_logicEngine.saveToFileDescriptor(-1));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Invalid file descriptor: -1", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_P(ALogicEngine_Serialization, SaveToFileDescriptor_NotWritableFileDescriptor)
+    {
+        SaveBufferToFile(CreateTestBuffer(), "LogicEngine.bin");
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary("LogicEngine.bin");
+        ASSERT_LT(0, fd);
+
+        EXPECT_FALSE(m_logicEngine.saveToFileDescriptor(fd));
+        FileDescriptorHelper::CloseFileDescriptor(fd);
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(fmt::format("Failed to save content to file descriptor: {}", fd), m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_P(ALogicEngine_Serialization, SavesToBufferSameDataAsToFile)
+    {
+        const std::vector<char> bufferData = CreateTestBuffer();
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(bufferData.data(), bufferData.size()));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        // previous content is replaced
+        std::vector<char> savedBuffer(10u, 'x');
+        EXPECT_TRUE(m_logicEngine.saveToBuffer(savedBuffer));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        ASSERT_TRUE(m_logicEngine.saveToFile("LogicEngine.bin"));
+        EXPECT_EQ(*FileUtils::LoadBinary("LogicEngine.bin"), savedBuffer);
+
+        LogicEngine loadedLogicEngine{ GetParam() };
+        EXPECT_TRUE(loadedLogicEngine.loadFromBuffer(savedBuffer.data(), savedBuffer.size()));
+        EXPECT_NE(nullptr, loadedLogicEngine.findByName<LuaScript>("luascript"));
+    }
+
+    TEST_P(ALogicEngine_Serialization, SaveToBufferFailsForSameReasonsAsSaveToFile)
+    {
+        RamsesNodeBinding* nodeBinding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "binding");
+        nodeBinding->getInputs()->getChild("visibility")->set<bool>(false);
+
+        std::vector<char> savedBuffer(10u, 'x');
+        EXPECT_FALSE(m_logicEngine.saveToBuffer(savedBuffer));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to saveToFile() because validation warnings were encountered! "
+            "Refer to the documentation of saveToFile() for details how to address these gracefully.", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(std::vector<char>(10u, 'x'), savedBuffer);
+    }
+
     TEST_P(ALogicEngine_Serialization, DeserializesFromMemoryBuffer)
     {
         const std::vector<char> bufferData = CreateTestBuffer();
@@ -940,6 +1165,224 @@ namespace rlogic::internal
         }
     }
 
+    TEST_P(ALogicEngine_Serialization, FailsToSetZeroLoadThreads)
+    {
+        EXPECT_FALSE(m_logicEngine.setLoadThreadCount(0u));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to set load thread count: at least 1 thread is required.", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_TRUE(m_logicEngine.setLoadThreadCount(1u));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+    }
+
+    TEST_P(ALogicEngine_Serialization, SharesPropertyLayoutOfLoadedObjectsWithSameInterface)
+    {
+        {
+            LogicEngine logicEngine{ GetParam() };
+            const std::string_view interfaceSrc = R"(
+                function interface(IN,OUT)
+                    IN.value = Type:Int32()
+                    IN.struct = { vec = Type:Vec3f() }
+                    OUT.value = Type:Int32()
+                end
+            )";
+            // different run functions, same interface
+            ASSERT_NE(nullptr, logicEngine.createLuaScript(fmt::format("{}\nfunction run(IN,OUT) OUT.value = IN.value end", interfaceSrc), {}, "script1"));
+            ASSERT_NE(nullptr, logicEngine.createLuaScript(fmt::format("{}\nfunction run(IN,OUT) OUT.value = -IN.value end", interfaceSrc), {}, "script2"));
+            ASSERT_TRUE(SaveToFileWithoutValidation(logicEngine, "LogicEngine.bin"));
+        }
+
+        ASSERT_TRUE(m_logicEngine.loadFromFile("LogicEngine.bin"));
+        auto* script1 = m_logicEngine.findByName<LuaScript>("script1");
+        auto* script2 = m_logicEngine.findByName<LuaScript>("script2");
+        ASSERT_TRUE(script1 && script2);
+
+        EXPECT_EQ(&script1->getInputs()->m_impl->getLayout(), &script2->getInputs()->m_impl->getLayout());
+        EXPECT_EQ(&script1->getOutputs()->m_impl->getLayout(), &script2->getOutputs()->m_impl->getLayout());
+
+        // values are not shared
+        EXPECT_TRUE(script1->getInputs()->getChild("value")->set<int32_t>(5));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(5, *script1->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(0, *script2->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_P(ALogicEngine_Serialization, LoadsSameContentWithMultipleThreads)
+    {
+        {
+            LogicEngine logicEngine{ GetParam() };
+            // enough objects so that every thread gets some to deserialize
+            LuaScript* previousScript = nullptr;
+            for (int i = 0; i < 100; ++i)
+            {
+                auto* script = logicEngine.createLuaScript(R"(
+                    function interface(IN,OUT)
+                        IN.value = Type:Int32()
+                        OUT.value = Type:Int32()
+                    end
+                    function run(IN,OUT)
+                        OUT.value = IN.value + 1
+                    end
+                )", {}, fmt::format("script{}", i));
+                ASSERT_NE(nullptr, script);
+                if (previousScript != nullptr)
+                {
+                    ASSERT_TRUE(logicEngine.link(*previousScript->getOutputs()->getChild("value"), *script->getInputs()->getChild("value")));
+                }
+                previousScript = script;
+
+                ASSERT_NE(nullptr, logicEngine.createDataArray(std::vector<float>{ float(i), float(i + 1) }, fmt::format("data{}", i)));
+            }
+
+            auto* intf = logicEngine.createLuaInterface(R"(
+                function interface(IN)
+                    IN.value = Type:Int32()
+                end
+            )", "intf");
+            ASSERT_NE(nullptr, intf);
+            ASSERT_TRUE(logicEngine.link(*intf->getOutputs()->getChild("value"), *logicEngine.findByName<LuaScript>("script0")->getInputs()->getChild("value")));
+
+            ASSERT_TRUE(SaveToFileWithoutValidation(logicEngine, "LogicEngine.bin"));
+        }
+
+        EXPECT_TRUE(m_logicEngine.setLuaStateCount(3u));
+        EXPECT_TRUE(m_logicEngine.setLoadThreadCount(4u));
+        ASSERT_TRUE(m_logicEngine.loadFromFile("LogicEngine.bin"));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_EQ(100u, m_logicEngine.getCollection<LuaScript>().size());
+        EXPECT_EQ(100u, m_logicEngine.getCollection<DataArray>().size());
+        for (int i = 0; i < 100; ++i)
+        {
+            const auto* dataArray = m_logicEngine.findByName<DataArray>(fmt::format("data{}", i));
+            ASSERT_NE(nullptr, dataArray);
+            EXPECT_EQ(std::vector<float>({ float(i), float(i + 1) }), *dataArray->getData<float>());
+        }
+        EXPECT_EQ(100u, m_logicEngine.getPropertyLinks().size());
+
+        m_logicEngine.findByName<LuaInterface>("intf")->getInputs()->getChild("value")->set(10);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(110, *m_logicEngine.findByName<LuaScript>("script99")->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    class ALogicEngine_LazyScriptLoading : public ALogicEngine_Serialization
+    {
+    protected:
+        void SetUp() override
+        {
+            LogicEngine logicEngine{ GetParam() };
+            const std::string_view scriptSource = R"(
+                function interface(IN,OUT)
+                    IN.value = Type:Int32()
+                    OUT.value = Type:Int32()
+                end
+                function run(IN,OUT)
+                    OUT.value = IN.value * 2
+                end
+            )";
+            auto* intf = logicEngine.createLuaInterface(R"(
+                function interface(IN)
+                    IN.value = Type:Int32()
+                end
+            )", "intf");
+            auto* linkedScript = logicEngine.createLuaScript(scriptSource, {}, "linkedScript");
+            auto* otherScript = logicEngine.createLuaScript(scriptSource, {}, "otherScript");
+            ASSERT_TRUE(intf && linkedScript && otherScript);
+            ASSERT_TRUE(logicEngine.link(*intf->getOutputs()->getChild("value"), *linkedScript->getInputs()->getChild("value")));
+            intf->getInputs()->getChild("value")->set(3);
+            otherScript->getInputs()->getChild("value")->set(5);
+            ASSERT_TRUE(logicEngine.update());
+            ASSERT_TRUE(SaveToFileWithoutValidation(logicEngine, "LogicEngine.bin"));
+
+            m_logicEngine.enableLazyLuaScriptLoading(true);
+            ASSERT_TRUE(m_logicEngine.loadFromFile("LogicEngine.bin"));
+            m_linkedScript = m_logicEngine.findByName<LuaScript>("linkedScript");
+            m_otherScript = m_logicEngine.findByName<LuaScript>("otherScript");
+            ASSERT_TRUE(m_linkedScript && m_otherScript);
+        }
+
+        LuaScript* m_linkedScript = nullptr;
+        LuaScript* m_otherScript = nullptr;
+    };
+
+    INSTANTIATE_TEST_SUITE_P(
+        ALogicEngine_LazyScriptLoadingTests,
+        ALogicEngine_LazyScriptLoading,
+        rlogic::internal::GetFeatureLevelTestValues());
+
+    TEST_P(ALogicEngine_LazyScriptLoading, LoadsScriptWhenItIsExecutedFirstTime)
+    {
+        EXPECT_FALSE(m_linkedScript->m_script.isInstantiated());
+        EXPECT_FALSE(m_otherScript->m_script.isInstantiated());
+        // outputs are loaded from file
+        EXPECT_EQ(6, *m_linkedScript->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(10, *m_otherScript->getOutputs()->getChild("value")->get<int32_t>());
+
+        // scripts are not executed only because they were loaded
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FALSE(m_linkedScript->m_script.isInstantiated());
+        EXPECT_FALSE(m_otherScript->m_script.isInstantiated());
+
+        m_logicEngine.findByName<LuaInterface>("intf")->getInputs()->getChild("value")->set(4);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_linkedScript->m_script.isInstantiated());
+        EXPECT_FALSE(m_otherScript->m_script.isInstantiated());
+        EXPECT_EQ(8, *m_linkedScript->getOutputs()->getChild("value")->get<int32_t>());
+
+        m_otherScript->getInputs()->getChild("value")->set(7);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_otherScript->m_script.isInstantiated());
+        EXPECT_EQ(14, *m_otherScript->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_P(ALogicEngine_LazyScriptLoading, PrewarmsScripts)
+    {
+        EXPECT_TRUE(m_logicEngine.prewarmLuaScripts({ m_otherScript }));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_FALSE(m_linkedScript->m_script.isInstantiated());
+        EXPECT_TRUE(m_otherScript->m_script.isInstantiated());
+
+        // scripts which are loaded already are skipped
+        EXPECT_TRUE(m_logicEngine.prewarmLuaScripts({ m_linkedScript, m_otherScript }));
+        EXPECT_TRUE(m_linkedScript->m_script.isInstantiated());
+
+        m_otherScript->getInputs()->getChild("value")->set(7);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(14, *m_otherScript->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_P(ALogicEngine_LazyScriptLoading, FailsToPrewarmInvalidScripts)
+    {
+        EXPECT_FALSE(m_logicEngine.prewarmLuaScripts({ m_otherScript, nullptr }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to prewarm Lua scripts: null script provided!", m_logicEngine.getErrors()[0].message);
+
+        LogicEngine otherLogicEngine{ GetParam() };
+        auto* scriptFromOtherEngine = otherLogicEngine.createLuaScript(m_valid_empty_script, {}, "foreign");
+        EXPECT_FALSE(m_logicEngine.prewarmLuaScripts({ m_otherScript, scriptFromOtherEngine }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to prewarm Lua scripts: can't find script 'foreign' in logic engine!", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(scriptFromOtherEngine, m_logicEngine.getErrors()[0].object);
+
+        // nothing is loaded if any script is invalid
+        EXPECT_FALSE(m_otherScript->m_script.isInstantiated());
+    }
+
+    TEST_P(ALogicEngine_LazyScriptLoading, SavesScriptsWhichWereNotLoaded)
+    {
+        ASSERT_TRUE(SaveToFileWithoutValidation(m_logicEngine, "LogicEngine2.bin"));
+
+        LogicEngine otherLogicEngine{ GetParam() };
+        ASSERT_TRUE(otherLogicEngine.loadFromFile("LogicEngine2.bin"));
+        auto* script = otherLogicEngine.findByName<LuaScript>("otherScript");
+        ASSERT_NE(nullptr, script);
+        EXPECT_TRUE(script->m_script.isInstantiated());
+
+        script->getInputs()->getChild("value")->set(7);
+        EXPECT_TRUE(otherLogicEngine.update());
+        EXPECT_EQ(14, *script->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
     TEST_P(ALogicEngine_Serialization, InternalLinkDataIsDeletedAfterDeserialization)
     {
         std::string_view scriptSource = R"(
@@ -1262,7 +1705,7 @@ namespace rlogic::internal
         {
             EXPECT_EQ(45, propsCount);
         }
-        else if (GetParam() <= EFeatureLevel_05)
+        else
         {
             EXPECT_EQ(50, propsCount);
         }
@@ -1312,7 +1755,7 @@ namespace rlogic::internal
         {
             EXPECT_EQ(45, propsCount);
         }
-        else if (GetParam() <= EFeatureLevel_05)
+        else
         {
             EXPECT_EQ(50, propsCount);
         }
@@ -15,6 +15,7 @@
 #include "ramses-logic/RamsesAppearanceBinding.h"
 #include "ramses-logic/RamsesNodeBinding.h"
 #include "ramses-logic/RamsesCameraBinding.h"
+#include "ramses-logic/AnimationNodeConfig.h"
 
 #include "ramses-logic/Property.h"
 
@@ -30,6 +31,8 @@
 
 #include "fmt/format.h"
 
+#include <cmath>
+
 namespace rlogic
 {
     class ALogicEngine_Update : public ALogicEngine
@@ -473,4 +476,267 @@ namespace rlogic
         EXPECT_EQ(sourceScript, executedNodes[0].first);
         EXPECT_EQ(targetScript, executedNodes[1].first);
     }
+
+    class ALogicEngine_ParallelUpdate : public ALogicEngine
+    {
+    protected:
+        struct Content
+        {
+            TimerNode* timer = nullptr;
+            Property* sum = nullptr;
+            std::vector<AnimationNode*> animations;
+        };
+
+        // timer -> progress script -> animations -> sum script -> node binding, plus weak link from sum back to progress script
+        static Content CreateContent(LogicEngine& logicEngine, ramses::Node& ramsesNode)
+        {
+            Content content;
+            content.timer = logicEngine.createTimerNode("timer");
+
+            const auto progressScript = logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.ticker = Type:Int64()
+                    IN.offset = Type:Float()
+                    OUT.progress = Type:Float()
+                end
+                function run(IN,OUT)
+                    OUT.progress = (IN.ticker % 1000) / 1000 + IN.offset / 1000
+                end
+            )", {}, "progress");
+
+            const auto sumScript = logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.values = Type:Array(8, Type:Float())
+                    OUT.sum = Type:Float()
+                end
+                function run(IN,OUT)
+                    local sum = 0
+                    for i = 1,8 do
+                        sum = sum + IN.values[i]
+                    end
+                    OUT.sum = sum
+                end
+            )", {}, "sum");
+
+            const auto timeStamps = logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f }, "timestamps");
+            for (size_t i = 0u; i < 8u; ++i)
+            {
+                const auto keyframes = logicEngine.createDataArray(std::vector<float>{ 0.f, 10.f * static_cast<float>(i + 1u) }, "keyframes");
+                AnimationNodeConfig config;
+                EXPECT_TRUE(config.addChannel({ "channel", timeStamps, keyframes, EInterpolationType::Linear }));
+                const auto animation = logicEngine.createAnimationNode(config, "animation");
+                content.animations.push_back(animation);
+
+                EXPECT_TRUE(logicEngine.link(*progressScript->getOutputs()->getChild("progress"), *animation->getInputs()->getChild("progress")));
+                EXPECT_TRUE(logicEngine.link(*animation->getOutputs()->getChild("channel"), *sumScript->getInputs()->getChild("values")->getChild(i)));
+            }
+
+            const auto nodeBinding = logicEngine.createRamsesNodeBinding(ramsesNode, ERotationType::Euler_XYZ, "binding");
+            EXPECT_TRUE(logicEngine.link(*content.timer->getOutputs()->getChild("ticker_us"), *progressScript->getInputs()->getChild("ticker")));
+            EXPECT_TRUE(logicEngine.link(*sumScript->getOutputs()->getChild("sum"), *nodeBinding->getInputs()->getChild("scaling")->getChild(0u)));
+            EXPECT_TRUE(logicEngine.linkWeak(*sumScript->getOutputs()->getChild("sum"), *progressScript->getInputs()->getChild("offset")));
+
+            content.sum = sumScript->getOutputs()->getChild("sum");
+            return content;
+        }
+    };
+
+    TEST_F(ALogicEngine_ParallelUpdate, FailsToSetZeroUpdateThreads)
+    {
+        EXPECT_FALSE(m_logicEngine.setUpdateThreadCount(0u));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to set update thread count: at least 1 thread is required.", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_TRUE(m_logicEngine.setUpdateThreadCount(1u));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, ProducesSameValuesAsSingleThreadedUpdate)
+    {
+        LogicEngine otherLogicEngine;
+        ramses::Node* otherNode = m_scene->createNode();
+
+        const Content singleThreaded = CreateContent(m_logicEngine, *m_node);
+        const Content multiThreaded = CreateContent(otherLogicEngine, *otherNode);
+        EXPECT_TRUE(otherLogicEngine.setUpdateThreadCount(4u));
+
+        for (int64_t ticker = 1; ticker < 2000; ticker += 97)
+        {
+            singleThreaded.timer->getInputs()->getChild("ticker_us")->set(ticker);
+            multiThreaded.timer->getInputs()->getChild("ticker_us")->set(ticker);
+            ASSERT_TRUE(m_logicEngine.update());
+            ASSERT_TRUE(otherLogicEngine.update());
+
+            EXPECT_EQ(*singleThreaded.sum->get<float>(), *multiThreaded.sum->get<float>());
+            for (size_t i = 0u; i < singleThreaded.animations.size(); ++i)
+            {
+                EXPECT_EQ(*singleThreaded.animations[i]->getOutputs()->getChild("channel")->get<float>(),
+                    *multiThreaded.animations[i]->getOutputs()->getChild("channel")->get<float>());
+            }
+
+            vec3f scaling;
+            vec3f otherScaling;
+            m_node->getScaling(scaling[0], scaling[1], scaling[2]);
+            otherNode->getScaling(otherScaling[0], otherScaling[1], otherScaling[2]);
+            EXPECT_EQ(scaling, otherScaling);
+        }
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, ProducesSameValuesWithMultipleLuaStates)
+    {
+        LogicEngine otherLogicEngine;
+        ramses::Node* otherNode = m_scene->createNode();
+
+        EXPECT_TRUE(otherLogicEngine.setLuaStateCount(2u));
+        const Content singleThreaded = CreateContent(m_logicEngine, *m_node);
+        const Content multiThreaded = CreateContent(otherLogicEngine, *otherNode);
+        EXPECT_TRUE(otherLogicEngine.setUpdateThreadCount(4u));
+
+        for (int64_t ticker = 1; ticker < 2000; ticker += 97)
+        {
+            singleThreaded.timer->getInputs()->getChild("ticker_us")->set(ticker);
+            multiThreaded.timer->getInputs()->getChild("ticker_us")->set(ticker);
+            ASSERT_TRUE(m_logicEngine.update());
+            ASSERT_TRUE(otherLogicEngine.update());
+
+            EXPECT_EQ(*singleThreaded.sum->get<float>(), *multiThreaded.sum->get<float>());
+            for (size_t i = 0u; i < singleThreaded.animations.size(); ++i)
+            {
+                EXPECT_EQ(*singleThreaded.animations[i]->getOutputs()->getChild("channel")->get<float>(),
+                    *multiThreaded.animations[i]->getOutputs()->getChild("channel")->get<float>());
+            }
+
+            vec3f scaling;
+            vec3f otherScaling;
+            m_node->getScaling(scaling[0], scaling[1], scaling[2]);
+            otherNode->getScaling(otherScaling[0], otherScaling[1], otherScaling[2]);
+            EXPECT_EQ(scaling, otherScaling);
+        }
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, InterpolatesAnimationNodesInBatchesWithSameValuesAsSingleThreadedUpdate)
+    {
+        // enough animation nodes to be split into several batches, with channels of all value and interpolation types
+        const auto createAnimations = [](LogicEngine& logicEngine) {
+            const auto timeStamps = logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f, 3.f });
+            const auto floats = logicEngine.createDataArray(std::vector<float>{ 1.f, 5.f, -2.f });
+            const auto vec3fs = logicEngine.createDataArray(std::vector<vec3f>{ {1.f, 2.f, 3.f}, {-4.f, 5.f, 6.f}, {7.f, -8.f, 9.f} });
+            const auto tangents = logicEngine.createDataArray(std::vector<vec3f>{ {0.f, 1.f, 0.f}, {1.f, 0.f, -1.f}, {0.5f, 0.5f, 0.5f} });
+            const auto quaternions = logicEngine.createDataArray(std::vector<vec4f>{ {1.f, 0.f, 0.f, 0.f}, {0.f, 1.f, 0.f, 0.f}, {0.f, 0.f, 0.f, 1.f} });
+            const auto vec2is = logicEngine.createDataArray(std::vector<vec2i>{ {1, 2}, {-10, 20}, {100, 7} });
+            const auto arrays = logicEngine.createDataArray(std::vector<std::vector<float>>{ {1.f, 2.f, 3.f, 4.f, 5.f}, {-1.f, -2.f, -3.f, -4.f, -5.f}, {2.f, 2.f, 2.f, 2.f, 2.f} });
+
+            AnimationNodeConfig config;
+            EXPECT_TRUE(config.addChannel({ "float", timeStamps, floats, EInterpolationType::Linear }));
+            EXPECT_TRUE(config.addChannel({ "floatStep", timeStamps, floats, EInterpolationType::Step }));
+            EXPECT_TRUE(config.addChannel({ "vec3f", timeStamps, vec3fs, EInterpolationType::Cubic, tangents, tangents }));
+            EXPECT_TRUE(config.addChannel({ "quaternion", timeStamps, quaternions, EInterpolationType::Linear_Quaternions }));
+            EXPECT_TRUE(config.addChannel({ "vec2i", timeStamps, vec2is, EInterpolationType::Linear }));
+            EXPECT_TRUE(config.addChannel({ "array", timeStamps, arrays, EInterpolationType::Linear }));
+
+            std::vector<AnimationNode*> animations;
+            for (size_t i = 0u; i < 150u; ++i)
+                animations.push_back(logicEngine.createAnimationNode(config));
+            return animations;
+        };
+
+        LogicEngine otherLogicEngine;
+        const std::vector<AnimationNode*> singleThreaded = createAnimations(m_logicEngine);
+        const std::vector<AnimationNode*> multiThreaded = createAnimations(otherLogicEngine);
+        EXPECT_TRUE(otherLogicEngine.setUpdateThreadCount(4u));
+
+        for (float progress = 0.f; progress <= 1.f; progress += 0.0625f)
+        {
+            for (size_t i = 0u; i < singleThreaded.size(); ++i)
+            {
+                // every node at different point of animation and some not updated at all
+                const float nodeProgress = std::fmod(progress + static_cast<float>(i) / 150.f, 1.f);
+                if (i % 7u != 0u)
+                {
+                    singleThreaded[i]->getInputs()->getChild("progress")->set(nodeProgress);
+                    multiThreaded[i]->getInputs()->getChild("progress")->set(nodeProgress);
+                }
+            }
+            ASSERT_TRUE(m_logicEngine.update());
+            ASSERT_TRUE(otherLogicEngine.update());
+
+            for (size_t i = 0u; i < singleThreaded.size(); ++i)
+            {
+                const Property* outputs = singleThreaded[i]->getOutputs();
+                const Property* otherOutputs = multiThreaded[i]->getOutputs();
+                EXPECT_EQ(*outputs->getChild("float")->get<float>(), *otherOutputs->getChild("float")->get<float>());
+                EXPECT_EQ(*outputs->getChild("floatStep")->get<float>(), *otherOutputs->getChild("floatStep")->get<float>());
+                EXPECT_EQ(*outputs->getChild("vec3f")->get<vec3f>(), *otherOutputs->getChild("vec3f")->get<vec3f>());
+                EXPECT_EQ(*outputs->getChild("quaternion")->get<vec4f>(), *otherOutputs->getChild("quaternion")->get<vec4f>());
+                EXPECT_EQ(*outputs->getChild("vec2i")->get<vec2i>(), *otherOutputs->getChild("vec2i")->get<vec2i>());
+                for (size_t j = 0u; j < 5u; ++j)
+                    EXPECT_EQ(*outputs->getChild("array")->getChild(j)->get<float>(), *otherOutputs->getChild("array")->getChild(j)->get<float>());
+            }
+        }
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, ExecutesOnlyDirtyNodes)
+    {
+        EXPECT_TRUE(m_logicEngine.setUpdateThreadCount(4u));
+        m_logicEngine.enableUpdateReport(true);
+
+        const auto timeStamps = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f });
+        AnimationNodeConfig config;
+        EXPECT_TRUE(config.addChannel({ "channel", timeStamps, timeStamps, EInterpolationType::Linear }));
+        const auto animation1 = m_logicEngine.createAnimationNode(config, "animation1");
+        const auto animation2 = m_logicEngine.createAnimationNode(config, "animation2");
+        const auto animation3 = m_logicEngine.createAnimationNode(config, "animation3");
+
+        // all nodes are executed after creation
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3u, m_logicEngine.getLastUpdateReport().getNodesExecuted().size());
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.getLastUpdateReport().getNodesExecuted().empty());
+        EXPECT_EQ(3u, m_logicEngine.getLastUpdateReport().getNodesSkippedExecution().size());
+
+        animation1->getInputs()->getChild("progress")->set(0.5f);
+        animation3->getInputs()->getChild("progress")->set(0.25f);
+        EXPECT_TRUE(m_logicEngine.update());
+        const auto executedNodes = m_logicEngine.getLastUpdateReport().getNodesExecuted();
+        ASSERT_EQ(2u, executedNodes.size());
+        EXPECT_EQ(animation1, executedNodes[0].first);
+        EXPECT_EQ(animation3, executedNodes[1].first);
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution(), ::testing::ElementsAre(animation2));
+        EXPECT_FLOAT_EQ(0.5f, *animation1->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(0.25f, *animation3->getOutputs()->getChild("channel")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, ProducesErrorIfScriptHasRuntimeError)
+    {
+        EXPECT_TRUE(m_logicEngine.setUpdateThreadCount(2u));
+
+        const auto script = m_logicEngine.createLuaScript(R"(
+            function interface(IN,OUT)
+                IN.param = Type:Float()
+            end
+            function run(IN,OUT)
+                error("This will die")
+            end
+        )", WithStdModules({ EStandardModule::Base }));
+
+        const auto timeStamps = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f });
+        AnimationNodeConfig config;
+        EXPECT_TRUE(config.addChannel({ "channel", timeStamps, timeStamps, EInterpolationType::Linear }));
+        const auto animation1 = m_logicEngine.createAnimationNode(config);
+        const auto animation2 = m_logicEngine.createAnimationNode(config);
+        const auto intf = m_logicEngine.createLuaInterface(R"(
+            function interface(inout)
+                inout.param = Type:Float()
+            end
+        )", "intf");
+        // script and interface end up in the same level and are executed concurrently
+        EXPECT_TRUE(m_logicEngine.link(*animation1->getOutputs()->getChild("channel"), *script->getInputs()->getChild("param")));
+        EXPECT_TRUE(m_logicEngine.link(*animation2->getOutputs()->getChild("channel"), *intf->getInputs()->getChild("param")));
+
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("This will die"));
+        EXPECT_EQ(script, m_logicEngine.getErrors()[0].object);
+    }
 }
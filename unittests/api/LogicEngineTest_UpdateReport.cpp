@@ -68,6 +68,54 @@ namespace rlogic
         EXPECT_EQ(report.getTotalLinkActivations(), 0);
     }
 
+    TEST_F(ALogicEngine_UpdateReport, UpdateReportContainsVisitedAndTotalNodesCount)
+    {
+        constexpr auto scriptSource = R"(
+            function interface(IN,OUT)
+                IN.param = Type:Int32()
+                OUT.param = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.param = IN.param
+            end
+        )";
+
+        auto node1 = m_logicEngine.createLuaScript(scriptSource);
+        auto node2 = m_logicEngine.createLuaScript(scriptSource);
+        auto node3 = m_logicEngine.createLuaScript(scriptSource);
+        m_logicEngine.createLuaScript(scriptSource);
+        m_logicEngine.link(*node1->getOutputs()->getChild(0u), *node2->getInputs()->getChild(0u));
+        m_logicEngine.link(*node2->getOutputs()->getChild(0u), *node3->getInputs()->getChild(0u));
+
+        m_logicEngine.enableUpdateReport(true);
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(4u, m_logicEngine.getLastUpdateReport().getVisitedNodesCount());
+        EXPECT_EQ(4u, m_logicEngine.getLastUpdateReport().getTotalNodesCount());
+
+        // nothing dirty, nothing visited
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(0u, m_logicEngine.getLastUpdateReport().getVisitedNodesCount());
+        EXPECT_EQ(4u, m_logicEngine.getLastUpdateReport().getTotalNodesCount());
+
+        // value change propagates through links to all linked nodes, the unlinked node is not visited
+        node1->getInputs()->getChild(0u)->set(13);
+        EXPECT_TRUE(m_logicEngine.update());
+        {
+            const auto report = m_logicEngine.getLastUpdateReport();
+            EXPECT_EQ(3u, report.getVisitedNodesCount());
+            EXPECT_EQ(4u, report.getTotalNodesCount());
+            expectReportContainsExecutedNodes(report, { node1, node2, node3 });
+        }
+
+        // same value does not dirty the subsequent nodes
+        node1->getInputs()->getChild(0u)->set(13);
+        node1->getInputs()->getChild(0u)->set(14);
+        node1->getInputs()->getChild(0u)->set(13);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1u, m_logicEngine.getLastUpdateReport().getVisitedNodesCount());
+    }
+
     TEST_F(ALogicEngine_UpdateReport, UpdateReportContainsUpdatedAndNotUpdatedNodes)
     {
         constexpr auto scriptSource = R"(
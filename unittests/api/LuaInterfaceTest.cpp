@@ -1012,7 +1012,7 @@ namespace rlogic::internal
                 const std::string_view name = (issue == ESerializationIssue::EmptyName ? "" : "intf");
                 auto intf = rlogic_serialization::CreateLuaInterface(m_flatBufferBuilder,
                     issue == ESerializationIssue::NameIdMissing ? 0 : rlogic_serialization::CreateLogicObject(m_flatBufferBuilder, m_flatBufferBuilder.CreateString(name), 1u, 0u, 0u),
-                    issue == ESerializationIssue::RootMissing ? 0 : PropertyImpl::Serialize(*inputsImpl, m_flatBufferBuilder, m_serializationMap)
+                    issue == ESerializationIssue::RootMissing ? 0 : PropertyImpl::Serialize(*inputsImpl, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_01)
                 );
                 m_flatBufferBuilder.Finish(intf);
             }
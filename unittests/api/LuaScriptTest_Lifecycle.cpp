@@ -12,6 +12,7 @@
 #include "impl/LuaScriptImpl.h"
 #include "impl/LogicEngineImpl.h"
 #include "impl/PropertyImpl.h"
+#include "internals/ApiObjects.h"
 
 #include "fmt/format.h"
 #include <fstream>
@@ -59,6 +60,127 @@ namespace rlogic::internal
         EXPECT_EQ(script->getOutputs()->getChild("result")->get<std::string>(), "localSymbol");
     }
 
+    TEST_F(ALuaScript_Lifecycle, ReusesCompilationOfScriptsWithSameSource)
+    {
+        const std::string_view source = R"(
+            function init()
+                GLOBAL.counter = 0
+            end
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                OUT.value = Type:Int32()
+                OUT.counter = Type:Int32()
+            end
+            function run(IN,OUT)
+                GLOBAL.counter = GLOBAL.counter + 1
+                OUT.value = IN.value
+                OUT.counter = GLOBAL.counter
+            end
+        )";
+
+        auto* script1 = m_logicEngine.createLuaScript(source, {}, "script1");
+        auto* script2 = m_logicEngine.createLuaScript(source, {}, "script2");
+        ASSERT_TRUE(script1 && script2);
+
+        const auto& statistics = m_logicEngine.m_impl->getApiObjects().getLuaCompilationCache().getStatistics();
+        EXPECT_EQ(1u, statistics.hits);
+        EXPECT_EQ(1u, statistics.misses);
+
+        // both scripts have the interface and their own global data
+        ASSERT_NE(nullptr, script2->getInputs()->getChild("value"));
+        ASSERT_NE(nullptr, script2->getOutputs()->getChild("counter"));
+        EXPECT_TRUE(m_logicEngine.update());
+        script1->getInputs()->getChild("value")->set(5);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(5, *script1->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(2, *script1->getOutputs()->getChild("counter")->get<int32_t>());
+        EXPECT_EQ(1, *script2->getOutputs()->getChild("counter")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Lifecycle, SharesPropertyLayoutOfScriptsWithSameSource)
+    {
+        const std::string_view source = R"(
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                IN.struct = { a = Type:Float(), b = Type:String() }
+                OUT.value = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.value = IN.value
+            end
+        )";
+
+        auto* script1 = m_logicEngine.createLuaScript(source, {}, "script1");
+        auto* script2 = m_logicEngine.createLuaScript(source, {}, "script2");
+        ASSERT_TRUE(script1 && script2);
+
+        EXPECT_EQ(&script1->getInputs()->m_impl->getLayout(), &script2->getInputs()->m_impl->getLayout());
+        EXPECT_EQ(&script1->getOutputs()->m_impl->getLayout(), &script2->getOutputs()->m_impl->getLayout());
+        EXPECT_EQ(&script1->getInputs()->getChild("struct")->m_impl->getLayout(), &script2->getInputs()->getChild("struct")->m_impl->getLayout());
+
+        // only values are per script
+        EXPECT_TRUE(script1->getInputs()->getChild("struct")->getChild("b")->set<std::string>("text"));
+        EXPECT_EQ("text", *script1->getInputs()->getChild("struct")->getChild("b")->get<std::string>());
+        EXPECT_EQ("", *script2->getInputs()->getChild("struct")->getChild("b")->get<std::string>());
+
+        // layout stays valid when one of the scripts is destroyed
+        ASSERT_TRUE(m_logicEngine.destroy(*script1));
+        EXPECT_EQ("b", script2->getInputs()->getChild("struct")->getChild("b")->getName());
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALuaScript_Lifecycle, DoesNotReuseCompilationOfScriptsWithSameSourceButDifferentModules)
+    {
+        const std::string_view source = R"(
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+            end
+            function run(IN,OUT)
+            end
+        )";
+
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(source, {}));
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(source, WithStdModules({ EStandardModule::Math })));
+
+        const auto& statistics = m_logicEngine.m_impl->getApiObjects().getLuaCompilationCache().getStatistics();
+        EXPECT_EQ(0u, statistics.hits);
+        EXPECT_EQ(2u, statistics.misses);
+    }
+
+    TEST_F(ALuaScript_Lifecycle, DoesNotReuseCompilationOfScriptsWithSameSourceButDifferentDebugLogFunctions)
+    {
+        const std::string_view source = R"(
+            function interface(IN,OUT)
+                rl_logInfo("interface")
+                IN.value = Type:Int32()
+            end
+            function run(IN,OUT)
+            end
+        )";
+
+        LuaConfig configWithDebugLog;
+        configWithDebugLog.enableDebugLogFunctions();
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(source, configWithDebugLog));
+
+        // interface() is executed again and fails because rl_logInfo is not available
+        EXPECT_EQ(nullptr, m_logicEngine.createLuaScript(source, {}));
+        EXPECT_FALSE(m_logicEngine.getErrors().empty());
+
+        const auto& statistics = m_logicEngine.m_impl->getApiObjects().getLuaCompilationCache().getStatistics();
+        EXPECT_EQ(0u, statistics.hits);
+        EXPECT_EQ(2u, statistics.misses);
+    }
+
+    TEST_F(ALuaScript_Lifecycle, ReportsErrorsOfScriptsWithSameSourceEveryTime)
+    {
+        EXPECT_EQ(nullptr, m_logicEngine.createLuaScript("this.does.not.compile"));
+        EXPECT_FALSE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ(nullptr, m_logicEngine.createLuaScript("this.does.not.compile"));
+        EXPECT_FALSE(m_logicEngine.getErrors().empty());
+
+        EXPECT_EQ(0u, m_logicEngine.m_impl->getApiObjects().getLuaCompilationCache().getStatistics().hits);
+    }
+
     class ALuaScript_LifecycleWithFiles : public ALuaScript_Lifecycle
     {
     };
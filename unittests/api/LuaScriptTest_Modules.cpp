@@ -15,6 +15,7 @@
 #include "ramses-logic/LuaScript.h"
 #include "ramses-logic/Property.h"
 #include "impl/LuaScriptImpl.h"
+#include "fmt/format.h"
 #include <fstream>
 
 using namespace testing;
@@ -557,6 +558,62 @@ namespace rlogic::internal
         EXPECT_EQ(35, *result->get<int32_t>());
     }
 
+    TEST_F(ALuaScriptWithModule, UsesModuleThatDependsOnAnotherModuleInMultipleLuaStates)
+    {
+        ASSERT_TRUE(m_logicEngine.setLuaStateCount(3u));
+
+        const std::string_view wrappedModuleSrc = R"(
+            modules("mymath")
+            local wrapped = {}
+            function wrapped.add(a,b)
+                return mymath.add(a, b) + 5
+            end
+            return wrapped
+        )";
+
+        const auto wrapped = m_logicEngine.createLuaModule(wrappedModuleSrc, createDeps({ { "mymath", m_moduleSourceCode } }));
+
+        LuaConfig config;
+        config.addDependency("wrapped", *wrapped);
+
+        std::vector<LuaScript*> scripts;
+        for (int i = 0; i < 4; ++i)
+        {
+            scripts.push_back(m_logicEngine.createLuaScript(R"(
+                modules("wrapped")
+                function interface(IN,OUT)
+                    OUT.result = Type:Int32()
+                end
+                function run(IN,OUT)
+                    OUT.result = wrapped.add(10, 20)
+                end
+            )", config));
+            ASSERT_TRUE(scripts.back());
+        }
+
+        // scripts are distributed round-robin
+        EXPECT_NE(scripts[0]->m_script.getUpdateLuaState(), scripts[1]->m_script.getUpdateLuaState());
+        EXPECT_NE(scripts[0]->m_script.getUpdateLuaState(), scripts[2]->m_script.getUpdateLuaState());
+        EXPECT_NE(scripts[1]->m_script.getUpdateLuaState(), scripts[2]->m_script.getUpdateLuaState());
+        EXPECT_EQ(scripts[0]->m_script.getUpdateLuaState(), scripts[3]->m_script.getUpdateLuaState());
+
+        EXPECT_TRUE(m_logicEngine.update());
+        for (const auto* script : scripts)
+            EXPECT_EQ(35, *script->getOutputs()->getChild("result")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScriptWithModule, CanNotChangeLuaStateCountWhenModuleExists)
+    {
+        EXPECT_FALSE(m_logicEngine.setLuaStateCount(0u));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to set Lua state count: at least 1 Lua state is required.", m_logicEngine.getErrors()[0].message);
+
+        ASSERT_TRUE(m_logicEngine.createLuaModule(m_moduleSourceCode));
+        EXPECT_FALSE(m_logicEngine.setLuaStateCount(2u));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to set Lua state count: can only be changed before any Lua script or module is created.", m_logicEngine.getErrors()[0].message);
+    }
+
     TEST_F(ALuaScriptWithModule, SecondLevelDependenciesAreHidden)
     {
         const std::string_view wrappedModuleSrc = R"(
@@ -703,6 +760,113 @@ namespace rlogic::internal
         EXPECT_EQ(30, *script2->getOutputs()->getChild("v")->get<int32_t>());
     }
 
+    class ALuaScriptWithModule_MultipleLuaStates : public ALuaScriptWithModule, public ::testing::WithParamInterface<EFeatureLevel>
+    {
+    };
+
+    // feature level 01 has no byte code, modules are compiled again for each Lua state
+    INSTANTIATE_TEST_SUITE_P(
+        ALuaScriptWithModule_MultipleLuaStatesTests,
+        ALuaScriptWithModule_MultipleLuaStates,
+        ::testing::Values(EFeatureLevel_01, EFeatureLevel_02));
+
+    TEST_P(ALuaScriptWithModule_MultipleLuaStates, LoadsModulesIntoLuaStatesOfScriptsUsingThem)
+    {
+        WithTempDirectory tempDir;
+
+        {
+            LogicEngine logic{ GetParam() };
+            const auto module = logic.createLuaModule(m_moduleSourceCode, {}, "mymodule");
+            ASSERT_TRUE(module);
+            LuaConfig config;
+            config.addDependency("mymath", *module);
+
+            for (int i = 0; i < 3; ++i)
+            {
+                ASSERT_TRUE(logic.createLuaScript(R"(
+                    modules("mymath")
+                    function interface(IN,OUT)
+                        IN.v = Type:Int32()
+                        OUT.v = Type:Int32()
+                    end
+                    function run(IN,OUT)
+                        OUT.v = mymath.add(IN.v, 2)
+                    end
+                )", config, fmt::format("script{}", i)));
+            }
+
+            EXPECT_TRUE(logic.saveToFile("multistate.tmp"));
+        }
+
+        LogicEngine otherLogicEngine{ GetParam() };
+        ASSERT_TRUE(otherLogicEngine.setLuaStateCount(2u));
+        ASSERT_TRUE(otherLogicEngine.setUpdateThreadCount(2u));
+        ASSERT_TRUE(otherLogicEngine.loadFromFile("multistate.tmp"));
+
+        const auto script0 = otherLogicEngine.findByName<LuaScript>("script0");
+        const auto script1 = otherLogicEngine.findByName<LuaScript>("script1");
+        const auto script2 = otherLogicEngine.findByName<LuaScript>("script2");
+        ASSERT_TRUE(script0 && script1 && script2);
+        EXPECT_NE(script0->m_script.getUpdateLuaState(), script1->m_script.getUpdateLuaState());
+        EXPECT_EQ(script0->m_script.getUpdateLuaState(), script2->m_script.getUpdateLuaState());
+
+        script0->getInputs()->getChild("v")->set(10);
+        script1->getInputs()->getChild("v")->set(20);
+        script2->getInputs()->getChild("v")->set(30);
+        EXPECT_TRUE(otherLogicEngine.update());
+        EXPECT_EQ(12, *script0->getOutputs()->getChild("v")->get<int32_t>());
+        EXPECT_EQ(22, *script1->getOutputs()->getChild("v")->get<int32_t>());
+        EXPECT_EQ(32, *script2->getOutputs()->getChild("v")->get<int32_t>());
+    }
+
+    TEST_P(ALuaScriptWithModule_MultipleLuaStates, LoadsScriptsIntoLuaStatesConcurrently)
+    {
+        WithTempDirectory tempDir;
+
+        {
+            LogicEngine logic{ GetParam() };
+            const auto module = logic.createLuaModule(m_moduleSourceCode, {}, "mymodule");
+            ASSERT_TRUE(module);
+            LuaConfig config;
+            config.addDependency("mymath", *module);
+
+            for (int i = 0; i < 10; ++i)
+            {
+                ASSERT_TRUE(logic.createLuaScript(R"(
+                    modules("mymath")
+                    function interface(IN,OUT)
+                        IN.v = Type:Int32()
+                        OUT.v = Type:Int32()
+                    end
+                    function run(IN,OUT)
+                        OUT.v = mymath.add(IN.v, 2)
+                    end
+                )", config, fmt::format("script{}", i)));
+            }
+
+            EXPECT_TRUE(logic.saveToFile("multistate.tmp"));
+        }
+
+        LogicEngine otherLogicEngine{ GetParam() };
+        ASSERT_TRUE(otherLogicEngine.setLuaStateCount(3u));
+        ASSERT_TRUE(otherLogicEngine.setLoadThreadCount(3u));
+        ASSERT_TRUE(otherLogicEngine.loadFromFile("multistate.tmp"));
+
+        for (int i = 0; i < 10; ++i)
+        {
+            const auto script = otherLogicEngine.findByName<LuaScript>(fmt::format("script{}", i));
+            ASSERT_TRUE(script);
+            EXPECT_EQ(otherLogicEngine.findByName<LuaScript>(fmt::format("script{}", i % 3))->m_script.getUpdateLuaState(), script->m_script.getUpdateLuaState());
+            script->getInputs()->getChild("v")->set(i);
+        }
+
+        EXPECT_TRUE(otherLogicEngine.update());
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_EQ(i + 2, *otherLogicEngine.findByName<LuaScript>(fmt::format("script{}", i))->getOutputs()->getChild("v")->get<int32_t>());
+        }
+    }
+
     TEST_F(ALuaScriptWithModule, UsesStructPropertyInInterfaceDefinedInModule)
     {
         const std::string_view moduleDefiningInterfaceType = R"(
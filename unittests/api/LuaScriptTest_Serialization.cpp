@@ -71,7 +71,7 @@ namespace rlogic::internal
         // Serialize
         {
             std::unique_ptr<LuaScriptImpl> script = createTestScript(m_minimalScript, "name");
-            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, ELuaSavingMode::ByteCodeOnly);
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, ELuaSavingMode::ByteCodeOnly, m_featureLevel);
         }
 
         // Inspect flatbuffers data
@@ -82,15 +82,26 @@ namespace rlogic::internal
         EXPECT_EQ(serializedScript.base()->name()->string_view(), "name");
         EXPECT_EQ(serializedScript.base()->id(), 1u);
 
-        ASSERT_TRUE(serializedScript.rootInput());
-        EXPECT_EQ(serializedScript.rootInput()->rootType(), rlogic_serialization::EPropertyRootType::Struct);
-        ASSERT_TRUE(serializedScript.rootInput()->children());
-        EXPECT_EQ(serializedScript.rootInput()->children()->size(), 0u);
-
-        ASSERT_TRUE(serializedScript.rootOutput());
-        EXPECT_EQ(serializedScript.rootOutput()->rootType(), rlogic_serialization::EPropertyRootType::Struct);
-        ASSERT_TRUE(serializedScript.rootOutput()->children());
-        EXPECT_EQ(serializedScript.rootOutput()->children()->size(), 0u);
+        const auto expectEmptyStruct = [this](const rlogic_serialization::Property* property) {
+            ASSERT_TRUE(property);
+            if (m_featureLevel >= EFeatureLevel_06)
+            {
+                ASSERT_TRUE(property->treeType());
+                ASSERT_TRUE(property->treeType()->types());
+                ASSERT_EQ(property->treeType()->types()->size(), 1u);
+                EXPECT_EQ(static_cast<rlogic_serialization::EPropertyTreeNodeType>(property->treeType()->types()->Get(0)), rlogic_serialization::EPropertyTreeNodeType::Struct);
+                ASSERT_TRUE(property->treeType()->childCounts());
+                EXPECT_EQ(property->treeType()->childCounts()->Get(0), 0u);
+            }
+            else
+            {
+                EXPECT_EQ(property->rootType(), rlogic_serialization::EPropertyRootType::Struct);
+                ASSERT_TRUE(property->children());
+                EXPECT_EQ(property->children()->size(), 0u);
+            }
+        };
+        expectEmptyStruct(serializedScript.rootInput());
+        expectEmptyStruct(serializedScript.rootOutput());
 
         // Deserialize
         {
@@ -108,7 +119,7 @@ namespace rlogic::internal
     {
         {
             std::unique_ptr<LuaScriptImpl> script = createTestScript(m_minimalScript, "");
-            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, ELuaSavingMode::SourceCodeOnly);
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, ELuaSavingMode::SourceCodeOnly, m_featureLevel);
         }
 
         const auto& serializedScript = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
@@ -120,7 +131,7 @@ namespace rlogic::internal
     {
         {
             std::unique_ptr<LuaScriptImpl> script = createTestScript(m_minimalScript, "");
-            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, ELuaSavingMode::ByteCodeOnly);
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, ELuaSavingMode::ByteCodeOnly, m_featureLevel);
         }
 
         const auto& serializedScript = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
@@ -169,11 +180,11 @@ namespace rlogic::internal
         auto script1 = createTestScript(m_minimalScript, "script");
         auto script2 = createTestScript(m_minimalScript, "script2");
 
-        (void)LuaScriptImpl::Serialize(*script1, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly);
+        (void)LuaScriptImpl::Serialize(*script1, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly, m_featureLevel);
         const auto& serialized1 = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
         const auto byteCode1Offset = serialized1.luaByteCode();
 
-        (void)LuaScriptImpl::Serialize(*script2, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly);
+        (void)LuaScriptImpl::Serialize(*script2, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly, m_featureLevel);
         const auto& serialized2 = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
         const auto byteCode2Offset = serialized2.luaByteCode();
 
@@ -185,7 +196,7 @@ namespace rlogic::internal
         // Serialize
         {
             std::unique_ptr<LuaScriptImpl> script = createTestScript(m_minimalScript, "name");
-            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, ELuaSavingMode::ByteCodeOnly);
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, ELuaSavingMode::ByteCodeOnly, m_featureLevel);
         }
 
         // Deserialize
@@ -503,7 +514,7 @@ namespace rlogic::internal
         // serialize again and check that new byte code is produced
         {
             flatbuffers::FlatBufferBuilder builder;
-            (void)LuaScriptImpl::Serialize(*deserialized, builder, m_serializationMap, ELuaSavingMode::SourceAndByteCode);
+            (void)LuaScriptImpl::Serialize(*deserialized, builder, m_serializationMap, ELuaSavingMode::SourceAndByteCode, m_featureLevel);
             const auto serializedWithValidByteCode = flatbuffers::GetRoot<rlogic_serialization::LuaScript>(builder.GetBufferPointer());
             ASSERT_TRUE(serializedWithValidByteCode);
             ASSERT_TRUE(serializedWithValidByteCode->luaSourceCode());
@@ -520,7 +531,7 @@ namespace rlogic::internal
         auto script = createTestScript(m_minimalScript, "script");
 
         SerializationMap serializationMap;
-        (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::SourceCodeOnly);
+        (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::SourceCodeOnly, m_featureLevel);
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
 
         EXPECT_FALSE(serialized.luaByteCode());
@@ -535,7 +546,7 @@ namespace rlogic::internal
             m_solState, {}, {}, std::string{ m_minimalScript }, "script", m_errorReporting, {}, {}, {}, EFeatureLevel_01, false), "script", 1u);
 
         SerializationMap serializationMap;
-        (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly);
+        (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly, m_featureLevel);
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
 
         EXPECT_FALSE(serialized.luaByteCode());
@@ -550,7 +561,7 @@ namespace rlogic::internal
             m_solState, {}, {}, std::string{ m_minimalScript }, "script", m_errorReporting, {}, {}, {}, EFeatureLevel_01, false), "script", 1u);
 
         SerializationMap serializationMap;
-        (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::SourceAndByteCode);
+        (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::SourceAndByteCode, m_featureLevel);
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
 
         EXPECT_FALSE(serialized.luaByteCode());
@@ -563,7 +574,7 @@ namespace rlogic::internal
         auto script = createTestScript(m_minimalScript, "script");
 
         SerializationMap serializationMap;
-        (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly);
+        (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly, m_featureLevel);
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
 
         if (GetParam() >= EFeatureLevel_02)
@@ -589,7 +600,7 @@ namespace rlogic::internal
             auto script = createTestScript(m_minimalScript, "script");
 
             SerializationMap serializationMap;
-            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly);
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly, m_featureLevel);
             const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
             scriptWithNoSourceCode = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap, m_featureLevel);
             ASSERT_TRUE(scriptWithNoSourceCode);
@@ -597,7 +608,7 @@ namespace rlogic::internal
         }
 
         SerializationMap serializationMap;
-        (void)LuaScriptImpl::Serialize(*scriptWithNoSourceCode, m_flatBufferBuilder, serializationMap, ELuaSavingMode::SourceCodeOnly);
+        (void)LuaScriptImpl::Serialize(*scriptWithNoSourceCode, m_flatBufferBuilder, serializationMap, ELuaSavingMode::SourceCodeOnly, m_featureLevel);
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
 
         if (GetParam() >= EFeatureLevel_02)
@@ -623,7 +634,7 @@ namespace rlogic::internal
             auto script = createTestScript(m_minimalScript, "script");
 
             SerializationMap serializationMap;
-            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly);
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::ByteCodeOnly, m_featureLevel);
             const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
             scriptWithNoSourceCode = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap, m_featureLevel);
             ASSERT_TRUE(scriptWithNoSourceCode);
@@ -631,7 +642,7 @@ namespace rlogic::internal
         }
 
         SerializationMap serializationMap;
-        (void)LuaScriptImpl::Serialize(*scriptWithNoSourceCode, m_flatBufferBuilder, serializationMap, ELuaSavingMode::SourceAndByteCode);
+        (void)LuaScriptImpl::Serialize(*scriptWithNoSourceCode, m_flatBufferBuilder, serializationMap, ELuaSavingMode::SourceAndByteCode, m_featureLevel);
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
 
         if (GetParam() >= EFeatureLevel_02)
@@ -654,7 +665,7 @@ namespace rlogic::internal
         auto script = createTestScript(m_minimalScript, "script");
 
         SerializationMap serializationMap;
-        (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::SourceAndByteCode);
+        (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, serializationMap, ELuaSavingMode::SourceAndByteCode, m_featureLevel);
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
 
         ASSERT_TRUE(serialized.luaSourceCode());
@@ -615,6 +615,22 @@ namespace rlogic::internal
         ASSERT_EQ(true, *boolValue);
     }
 
+    TEST_F(AProperty, SetsAllElementsOfFloatArrayAtOnce)
+    {
+        Property array(CreateProperty(MakeArray("", 4u, EPropertyType::Float), EPropertySemantics::ScriptOutput, false));
+
+        const std::vector<float> values{ 0.1f, 0.2f, 0.3f, 0.4f };
+        EXPECT_TRUE(array.m_impl->setFloatArrayValues(values.data(), values.size()));
+        for (size_t i = 0u; i < values.size(); ++i)
+            EXPECT_EQ(values[i], *array.getChild(i)->get<float>());
+
+        // reports change if any element changed
+        EXPECT_FALSE(array.m_impl->setFloatArrayValues(values.data(), values.size()));
+        const std::vector<float> otherValues{ 0.1f, 0.2f, 0.5f, 0.4f };
+        EXPECT_TRUE(array.m_impl->setFloatArrayValues(otherValues.data(), otherValues.size()));
+        EXPECT_EQ(0.5f, *array.getChild(2u)->get<float>());
+    }
+
     TEST_F(AProperty, DoesNotSetValueIfTheTypeDoesNotMatch)
     {
         Property floatProperty(CreateInputProperty(EPropertyType::Float));
@@ -682,6 +698,39 @@ namespace rlogic::internal
         EXPECT_FALSE(c3);
     }
 
+    TEST_F(AProperty, ReturnsChildByName_InStructWithManyFields)
+    {
+        std::vector<TypeData> fields;
+        for (size_t i = 0; i < 500u; ++i)
+        {
+            fields.emplace_back(fmt::format("field{}", i), EPropertyType::Int32);
+        }
+        const Property root(CreateProperty(MakeStruct("", fields), EPropertySemantics::ScriptInput, true));
+
+        for (size_t i = 0; i < 500u; ++i)
+        {
+            const std::string fieldName = fmt::format("field{}", i);
+            const Property* child = root.getChild(fieldName);
+            ASSERT_NE(nullptr, child);
+            EXPECT_EQ(fieldName, child->getName());
+            EXPECT_EQ(root.getChild(i), child);
+            EXPECT_EQ(i, *root.m_impl->findChildIndex(fieldName));
+            EXPECT_TRUE(root.hasChild(fieldName));
+        }
+
+        EXPECT_EQ(nullptr, root.getChild("field500"));
+        EXPECT_EQ(nullptr, root.getChild(""));
+        EXPECT_FALSE(root.hasChild("field"));
+        EXPECT_FALSE(root.m_impl->findChildIndex("Field0"));
+    }
+
+    TEST_F(AProperty, ReturnsNoChildByNameForEmptyStruct)
+    {
+        const Property root(CreateProperty(MakeType("", EPropertyType::Struct), EPropertySemantics::ScriptInput, true));
+        EXPECT_EQ(nullptr, root.getChild("child"));
+        EXPECT_FALSE(root.hasChild(""));
+    }
+
     class AProperty_SerializationLifecycle : public AProperty
     {
     protected:
@@ -695,7 +744,7 @@ namespace rlogic::internal
     {
         {
             PropertyImpl structNoChildren(MakeType("noChildren", EPropertyType::Struct), EPropertySemantics::ScriptInput);
-            (void)PropertyImpl::Serialize(structNoChildren, m_flatBufferBuilder, m_serializationMap);
+            (void)PropertyImpl::Serialize(structNoChildren, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_01);
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
@@ -722,7 +771,7 @@ namespace rlogic::internal
                     TypeData{"child2", EPropertyType::Float}
                 });
             PropertyImpl structProperty(structType, EPropertySemantics::ScriptInput);
-            (void)PropertyImpl::Serialize(structProperty, m_flatBufferBuilder, m_serializationMap);
+            (void)PropertyImpl::Serialize(structProperty, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_01);
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
@@ -736,6 +785,31 @@ namespace rlogic::internal
         EXPECT_EQ("child2", deserialized->getChild(2)->getName());
     }
 
+    TEST_F(AProperty_SerializationLifecycle, ReturnsChildByNameAfterDeserialization)
+    {
+        {
+            std::vector<TypeData> fields;
+            for (size_t i = 0; i < 100u; ++i)
+            {
+                fields.emplace_back(fmt::format("field{}", i), EPropertyType::Float);
+            }
+            PropertyImpl structProperty(MakeStruct("parent", fields), EPropertySemantics::ScriptInput);
+            (void)PropertyImpl::Serialize(structProperty, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_01);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        ASSERT_TRUE(deserialized);
+
+        for (size_t i = 0; i < 100u; ++i)
+        {
+            const Property* child = deserialized->getChild(fmt::format("field{}", i));
+            ASSERT_NE(nullptr, child);
+            EXPECT_EQ(deserialized->getChild(i), child);
+        }
+        EXPECT_EQ(nullptr, deserialized->getChild("field100"));
+    }
+
     TEST_F(AProperty_SerializationLifecycle, MultiLevelNesting)
     {
         {
@@ -750,7 +824,7 @@ namespace rlogic::internal
             );
 
             PropertyImpl root(rootType, EPropertySemantics::ScriptInput);
-            (void)PropertyImpl::Serialize(root, m_flatBufferBuilder, m_serializationMap);
+            (void)PropertyImpl::Serialize(root, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_01);
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
@@ -823,7 +897,7 @@ namespace rlogic::internal
             propVec3i->set<vec3i>({3, 4, 5});
             propVec4i->set<vec4i>({6, 7, 8, 9});
 
-            (void)PropertyImpl::Serialize(*rootImpl, m_flatBufferBuilder, m_serializationMap);
+            (void)PropertyImpl::Serialize(*rootImpl, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_01);
         }
 
         const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
@@ -1014,6 +1088,242 @@ namespace rlogic::internal
         EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: invalid type!");
     }
 
+    TEST_F(AProperty_SerializationLifecycle, ColumnarEncoding_AllSupportedPropertyTypesAndNesting)
+    {
+        {
+            auto rootImpl = CreateProperty(HierarchicalTypeData(TypeData{"root", EPropertyType::Struct},
+                {
+                    MakeType("Int32", EPropertyType::Int32),
+                    MakeType("Int64", EPropertyType::Int64),
+                    MakeType("Float", EPropertyType::Float),
+                    MakeType("Bool", EPropertyType::Bool),
+                    MakeType("String", EPropertyType::String),
+                    MakeStruct("nested", { {"Vec2f", EPropertyType::Vec2f}, {"Vec3f", EPropertyType::Vec3f}, {"Vec4f", EPropertyType::Vec4f} }),
+                    MakeArray("array", 2, EPropertyType::Vec4i),
+                    MakeType("String2", EPropertyType::String),
+                }), EPropertySemantics::ScriptInput, true);
+
+            rootImpl->getChild("Int32")->set(4711);
+            rootImpl->getChild("Int64")->set<int64_t>(4711111);
+            rootImpl->getChild("Float")->set(47.11f);
+            rootImpl->getChild("Bool")->set(true);
+            rootImpl->getChild("String")->set<std::string>("4711");
+            rootImpl->getChild("nested")->getChild("Vec2f")->set<vec2f>({ 0.1f, 0.2f });
+            rootImpl->getChild("nested")->getChild("Vec3f")->set<vec3f>({ 1.1f, 1.2f, 1.3f });
+            rootImpl->getChild("nested")->getChild("Vec4f")->set<vec4f>({ 2.1f, 2.2f, 2.3f, 2.4f });
+            rootImpl->getChild("array")->getChild(1)->set<vec4i>({ 6, 7, 8, 9 });
+            rootImpl->getChild("String2")->set<std::string>("second");
+
+            (void)PropertyImpl::Serialize(*rootImpl, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_06);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
+        // whole tree is stored in one object, values are packed by type in pre-order
+        ASSERT_NE(nullptr, serialized.treeType());
+        EXPECT_EQ(nullptr, serialized.children());
+        EXPECT_EQ(14u, serialized.treeType()->types()->size());
+        ASSERT_NE(nullptr, serialized.floatValues());
+        EXPECT_EQ(10u, serialized.floatValues()->size());
+        ASSERT_NE(nullptr, serialized.int32Values());
+        EXPECT_EQ(9u, serialized.int32Values()->size());
+        ASSERT_NE(nullptr, serialized.stringValues());
+        EXPECT_EQ("second", serialized.stringValues()->Get(1)->str());
+
+        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        ASSERT_TRUE(deserialized);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+
+        EXPECT_EQ("root", deserialized->getName());
+        ASSERT_EQ(8u, deserialized->getChildCount());
+        EXPECT_EQ(4711, *deserialized->getChild("Int32")->get<int32_t>());
+        EXPECT_EQ(4711111L, *deserialized->getChild("Int64")->get<int64_t>());
+        EXPECT_FLOAT_EQ(47.11f, *deserialized->getChild("Float")->get<float>());
+        EXPECT_TRUE(*deserialized->getChild("Bool")->get<bool>());
+        EXPECT_EQ("4711", *deserialized->getChild("String")->get<std::string>());
+        EXPECT_EQ("second", *deserialized->getChild("String2")->get<std::string>());
+
+        const vec2f expectedValueVec2f{0.1f, 0.2f};
+        const vec3f expectedValueVec3f{1.1f, 1.2f, 1.3f};
+        const vec4f expectedValueVec4f{2.1f, 2.2f, 2.3f, 2.4f};
+        const vec4i expectedDefaultVec4i{0, 0, 0, 0};
+        const vec4i expectedValueVec4i{6, 7, 8, 9};
+
+        const Property* nested = deserialized->getChild("nested");
+        ASSERT_EQ(3u, nested->getChildCount());
+        EXPECT_EQ(expectedValueVec2f, *nested->getChild("Vec2f")->get<vec2f>());
+        EXPECT_EQ(expectedValueVec3f, *nested->getChild("Vec3f")->get<vec3f>());
+        EXPECT_EQ(expectedValueVec4f, *nested->getChild("Vec4f")->get<vec4f>());
+
+        const Property* array = deserialized->getChild("array");
+        EXPECT_EQ(EPropertyType::Array, array->getType());
+        ASSERT_EQ(2u, array->getChildCount());
+        EXPECT_EQ(expectedDefaultVec4i, *array->getChild(0)->get<vec4i>());
+        EXPECT_EQ(expectedValueVec4i, *array->getChild(1)->get<vec4i>());
+
+        // every property of the tree can be resolved (e.g. for links) by its index in pre-order
+        EXPECT_EQ(deserialized.get(), m_deserializationMap.resolvePropertyImpl(serialized, 0u));
+        EXPECT_EQ(nested->getChild("Vec2f")->m_impl.get(), m_deserializationMap.resolvePropertyImpl(serialized, 7u));
+        EXPECT_EQ(nullptr, m_deserializationMap.resolvePropertyImpl(serialized, 14u));
+    }
+
+    TEST_F(AProperty_SerializationLifecycle, ColumnarEncoding_StoresTypeOfEqualTreesOnlyOnce)
+    {
+        const auto type = MakeStruct("root", { {"field1", EPropertyType::Float}, {"field2", EPropertyType::String} });
+        {
+            auto tree1 = CreateProperty(type, EPropertySemantics::ScriptInput, true);
+            auto tree2 = CreateProperty(type, EPropertySemantics::ScriptInput, true);
+            tree1->getChild("field1")->set(1.f);
+            tree2->getChild("field1")->set(2.f);
+
+            const auto tree1Offset = PropertyImpl::Serialize(*tree1, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_06);
+            const auto tree2Offset = PropertyImpl::Serialize(*tree2, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_06);
+            m_flatBufferBuilder.Finish(m_flatBufferBuilder.CreateVector(std::vector{ tree1Offset, tree2Offset }));
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Property>>>(m_flatBufferBuilder.GetBufferPointer());
+        ASSERT_EQ(2u, serialized.size());
+        EXPECT_EQ(serialized.Get(0)->treeType(), serialized.Get(1)->treeType());
+
+        std::unique_ptr<PropertyImpl> tree1 = PropertyImpl::Deserialize(*serialized.Get(0), EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        std::unique_ptr<PropertyImpl> tree2 = PropertyImpl::Deserialize(*serialized.Get(1), EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        ASSERT_TRUE(tree1);
+        ASSERT_TRUE(tree2);
+        EXPECT_EQ(&tree1->getLayout(), &tree2->getLayout());
+        EXPECT_FLOAT_EQ(1.f, *tree1->getChild("field1")->get<float>());
+        EXPECT_FLOAT_EQ(2.f, *tree2->getChild("field1")->get<float>());
+    }
+
+    class AProperty_SerializationLifecycle_Columnar : public AProperty_SerializationLifecycle
+    {
+    protected:
+        // struct "root" with fields "float" and "vec2i"
+        flatbuffers::Offset<rlogic_serialization::PropertyTreeType> createTreeType(const std::vector<uint32_t>& childCounts = { 2u })
+        {
+            const std::vector<flatbuffers::Offset<flatbuffers::String>> names{
+                m_flatBufferBuilder.CreateString("root"),
+                m_flatBufferBuilder.CreateString("float"),
+                m_flatBufferBuilder.CreateString("vec2i")
+            };
+            const std::vector<uint8_t> types{
+                static_cast<uint8_t>(rlogic_serialization::EPropertyTreeNodeType::Struct),
+                static_cast<uint8_t>(rlogic_serialization::EPropertyTreeNodeType::Float),
+                static_cast<uint8_t>(rlogic_serialization::EPropertyTreeNodeType::Vec2i)
+            };
+            return rlogic_serialization::CreatePropertyTreeTypeDirect(m_flatBufferBuilder, &names, &types, &childCounts);
+        }
+
+        std::unique_ptr<PropertyImpl> deserialize(flatbuffers::Offset<rlogic_serialization::PropertyTreeType> treeType, const std::vector<float>& floatValues, const std::vector<int32_t>& int32Values)
+        {
+            auto propertyOffset = rlogic_serialization::CreateProperty(
+                m_flatBufferBuilder,
+                0,
+                rlogic_serialization::EPropertyRootType::Primitive,
+                0,
+                rlogic_serialization::PropertyValue::NONE,
+                0,
+                treeType,
+                m_flatBufferBuilder.CreateVector(floatValues),
+                m_flatBufferBuilder.CreateVector(int32Values)
+            );
+            m_flatBufferBuilder.Finish(propertyOffset);
+
+            const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
+            return PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+        }
+    };
+
+    TEST_F(AProperty_SerializationLifecycle_Columnar, LoadsValidTree)
+    {
+        std::unique_ptr<PropertyImpl> deserialized = deserialize(createTreeType(), { 0.5f }, { 1, 2 });
+
+        ASSERT_TRUE(deserialized);
+        EXPECT_FLOAT_EQ(0.5f, *deserialized->getChild("float")->get<float>());
+        const vec2i expectedValueVec2i{1, 2};
+        EXPECT_EQ(expectedValueVec2i, *deserialized->getChild("vec2i")->get<vec2i>());
+    }
+
+    TEST_F(AProperty_SerializationLifecycle_Columnar, ErrorWhenTooFewValues)
+    {
+        std::unique_ptr<PropertyImpl> deserialized = deserialize(createTreeType(), { 0.5f }, { 1 });
+
+        EXPECT_FALSE(deserialized);
+        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: number of values does not match property types!");
+    }
+
+    TEST_F(AProperty_SerializationLifecycle_Columnar, ErrorWhenTooManyValues)
+    {
+        std::unique_ptr<PropertyImpl> deserialized = deserialize(createTreeType(), { 0.5f, 0.6f }, { 1, 2 });
+
+        EXPECT_FALSE(deserialized);
+        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: number of values does not match property types!");
+    }
+
+    TEST_F(AProperty_SerializationLifecycle_Columnar, ErrorWhenTreeTypeHasWrongChildCount)
+    {
+        for (uint32_t childCount : { 1u, 3u, std::numeric_limits<uint32_t>::max() })
+        {
+            m_errorReporting.clear();
+            std::unique_ptr<PropertyImpl> deserialized = deserialize(createTreeType({ childCount }), { 0.5f }, { 1, 2 });
+
+            EXPECT_FALSE(deserialized);
+            ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+            EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: corrupt tree type info!");
+        }
+    }
+
+    TEST_F(AProperty_SerializationLifecycle_Columnar, ErrorWhenTreeTypeHasInvalidNodeType)
+    {
+        const std::vector<flatbuffers::Offset<flatbuffers::String>> names{ m_flatBufferBuilder.CreateString("root") };
+        const std::vector<uint8_t> types{ std::numeric_limits<uint8_t>::max() };
+        std::unique_ptr<PropertyImpl> deserialized = deserialize(rlogic_serialization::CreatePropertyTreeTypeDirect(m_flatBufferBuilder, &names, &types), {}, {});
+
+        EXPECT_FALSE(deserialized);
+        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: corrupt tree type info!");
+    }
+
+    TEST_F(AProperty_SerializationLifecycle_Columnar, ErrorWhenTreeTypeIsNestedTooDeep)
+    {
+        // chain of structs, each containing the next one, with a float at the end
+        const auto createNestedTreeType = [this](size_t structCount) {
+            std::vector<flatbuffers::Offset<flatbuffers::String>> names(structCount + 1u, m_flatBufferBuilder.CreateString("s"));
+            std::vector<uint8_t> types(structCount, static_cast<uint8_t>(rlogic_serialization::EPropertyTreeNodeType::Struct));
+            types.push_back(static_cast<uint8_t>(rlogic_serialization::EPropertyTreeNodeType::Float));
+            const std::vector<uint32_t> childCounts(structCount, 1u);
+            return rlogic_serialization::CreatePropertyTreeTypeDirect(m_flatBufferBuilder, &names, &types, &childCounts);
+        };
+
+        EXPECT_TRUE(deserialize(createNestedTreeType(63u), { 0.5f }, {}));
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+
+        std::unique_ptr<PropertyImpl> deserialized = deserialize(createNestedTreeType(100000u), { 0.5f }, {});
+        EXPECT_FALSE(deserialized);
+        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: corrupt tree type info!");
+    }
+
+    TEST_F(AProperty_SerializationLifecycle_Columnar, ErrorWhenTreeTypeIsUsedBelowFeatureLevel06)
+    {
+        m_deserializationMap = DeserializationMap{ EFeatureLevel_05 };
+        std::unique_ptr<PropertyImpl> deserialized = deserialize(createTreeType(), { 0.5f }, { 1, 2 });
+
+        EXPECT_FALSE(deserialized);
+        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: tree type info is not supported by feature level of data!");
+    }
+
+    TEST_F(AProperty_SerializationLifecycle_Columnar, ErrorWhenTreeTypeHasNoNames)
+    {
+        const std::vector<uint8_t> types{ static_cast<uint8_t>(rlogic_serialization::EPropertyTreeNodeType::Float) };
+        std::unique_ptr<PropertyImpl> deserialized = deserialize(rlogic_serialization::CreatePropertyTreeTypeDirect(m_flatBufferBuilder, nullptr, &types), { 0.5f }, {});
+
+        EXPECT_FALSE(deserialized);
+        ASSERT_EQ(m_errorReporting.getErrors().size(), 1u);
+        EXPECT_EQ(m_errorReporting.getErrors()[0].message, "Fatal error during loading of Property from serialized data: missing tree type info!");
+    }
+
     // two element type
     template <typename T>
     class AProperty_SerializationLifecycle_T : public AProperty_SerializationLifecycle
@@ -797,7 +797,7 @@ namespace rlogic::internal
             }
             );
 
-            return PropertyImpl::Serialize(PropertyImpl{ cameraBindingInputs, EPropertySemantics::BindingInput }, m_flatBufferBuilder, m_serializationMap);
+            return PropertyImpl::Serialize(PropertyImpl{ cameraBindingInputs, EPropertySemantics::BindingInput }, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_01);
         }
 
         flatbuffers::FlatBufferBuilder m_flatBufferBuilder;
@@ -188,7 +188,7 @@ namespace rlogic::internal
                     logicObject,
                     (issue == ESerializationIssue::MissingBoundObject ? 0 : rlogic_serialization::CreateRamsesReference(m_flatBufferBuilder,
                         1u, (issue == ESerializationIssue::InvalidBoundObjectType ? 0 : static_cast<uint32_t>(ramses::ERamsesObjectType_MeshNode)))),
-                    (issue == ESerializationIssue::MissingRoot ? 0 : PropertyImpl::Serialize(*inputs, m_flatBufferBuilder, serializationMap)));
+                    (issue == ESerializationIssue::MissingRoot ? 0 : PropertyImpl::Serialize(*inputs, m_flatBufferBuilder, serializationMap, EFeatureLevel_01)));
 
                 auto fbMeshNodeBinding = rlogic_serialization::CreateRamsesMeshNodeBinding(m_flatBufferBuilder, (issue == ESerializationIssue::MissingBase ? 0 : fbRamsesBinding));
                 m_flatBufferBuilder.Finish(fbMeshNodeBinding);
@@ -310,7 +310,7 @@ namespace rlogic::internal
                     rlogic_serialization::CreateLogicObject(m_flatBufferBuilder, (issue == ESerializationIssue::MissingName ? 0 : m_flatBufferBuilder.CreateString("name")), 1u, 0u, 0u),
                     (issue == ESerializationIssue::MissingRamsesRefObject ? 0 : rlogic_serialization::CreateRamsesReference(m_flatBufferBuilder,
                         1u, (issue == ESerializationIssue::MismatchedRamsesRefObjectType ? 0 : static_cast<uint32_t>(ramses::ERamsesObjectType_RenderGroup)))),
-                    (issue == ESerializationIssue::MissingRootInput ? 0 : PropertyImpl::Serialize(*inputsImpl, m_flatBufferBuilder, m_serializationMap)));
+                    (issue == ESerializationIssue::MissingRootInput ? 0 : PropertyImpl::Serialize(*inputsImpl, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_01)));
 
                 std::vector<flatbuffers::Offset<rlogic_serialization::Element>> elementsFB;
                 elementsFB.push_back(rlogic_serialization::CreateElement(
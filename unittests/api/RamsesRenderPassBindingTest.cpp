@@ -103,7 +103,7 @@ namespace rlogic::internal
                     rlogic_serialization::CreateLogicObject(m_flatBufferBuilder, m_flatBufferBuilder.CreateString("name"), 1u, 0u, 0u),
                     (issue == ESerializationIssue::BoundObjectReferenceMissing ? 0 : rlogic_serialization::CreateRamsesReference(m_flatBufferBuilder,
                         1u, (issue == ESerializationIssue::BoundObjectTypeMismatch ? 0 : static_cast<uint32_t>(ramses::ERamsesObjectType_RenderPass)))),
-                    PropertyImpl::Serialize(*inputsImpl, m_flatBufferBuilder, m_serializationMap));
+                    PropertyImpl::Serialize(*inputsImpl, m_flatBufferBuilder, m_serializationMap, EFeatureLevel_01));
 
                 auto fbRenderPassBinding = rlogic_serialization::CreateRamsesRenderPassBinding(m_flatBufferBuilder, fbRamsesBinding);
                 m_flatBufferBuilder.Finish(fbRenderPassBinding);
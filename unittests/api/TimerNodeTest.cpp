@@ -219,8 +219,8 @@ namespace rlogic::internal
                     rlogic_serialization::CreateLogicObject(flatBufferBuilder,
                         issue == ESerializationIssue::NameMissing ? 0 : flatBufferBuilder.CreateString("timerNode"),
                         issue == ESerializationIssue::IdMissing ? 0 : 1u),
-                    issue == ESerializationIssue::RootInMissing ? 0 : PropertyImpl::Serialize(*inputsImpl, flatBufferBuilder, serializationMap),
-                    issue == ESerializationIssue::RootOutMissing ? 0 : PropertyImpl::Serialize(*outputsImpl, flatBufferBuilder, serializationMap)
+                    issue == ESerializationIssue::RootInMissing ? 0 : PropertyImpl::Serialize(*inputsImpl, flatBufferBuilder, serializationMap, EFeatureLevel_01),
+                    issue == ESerializationIssue::RootOutMissing ? 0 : PropertyImpl::Serialize(*outputsImpl, flatBufferBuilder, serializationMap, EFeatureLevel_01)
                 );
 
                 flatBufferBuilder.Finish(timerNodeFB);
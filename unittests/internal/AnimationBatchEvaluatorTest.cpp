@@ -0,0 +1,173 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/AnimationBatchEvaluator.h"
+
+#include <vector>
+
+namespace rlogic::internal
+{
+    class AnAnimationBatchEvaluator : public ::testing::Test
+    {
+    protected:
+        static float ExpectedLinear(float lower, float upper, float ratio)
+        {
+            return lower + ratio * (upper - lower);
+        }
+
+        static float ExpectedCubic(float p0, float p1, float tangentOut, float tangentIn, float t, float timeBetweenKeys)
+        {
+            const float m0 = timeBetweenKeys * tangentOut;
+            const float m1 = timeBetweenKeys * tangentIn;
+            return (2.f*t*t*t - 3.f*t*t + 1.f) * p0 + (t*t*t - 2.f*t*t + t) * m0 + (-2.f*t*t*t + 3.f*t*t) * p1 + (t*t*t - t*t) * m1;
+        }
+
+        static float Value(size_t i)
+        {
+            return static_cast<float>(i % 7u) * 1.5f - 3.f;
+        }
+
+        static float Ratio(size_t i)
+        {
+            return static_cast<float>(i % 11u) / 10.f;
+        }
+
+        AnimationBatchEvaluator m_evaluator;
+    };
+
+    TEST_F(AnAnimationBatchEvaluator, IsEmptyInitially)
+    {
+        EXPECT_EQ(0u, m_evaluator.getLinearCount());
+        EXPECT_EQ(0u, m_evaluator.getCubicCount());
+        m_evaluator.evaluate();
+    }
+
+    TEST_F(AnAnimationBatchEvaluator, ReturnsResultIndexOfEachAddedComponentWithinItsBatch)
+    {
+        EXPECT_EQ(0u, m_evaluator.addLinear(0.f, 1.f, 0.5f));
+        EXPECT_EQ(0u, m_evaluator.addCubic(0.f, 1.f, 0.f, 0.f, 0.5f, 1.f));
+        EXPECT_EQ(1u, m_evaluator.addLinear(0.f, 2.f, 0.5f));
+        EXPECT_EQ(2u, m_evaluator.addLinear(0.f, 3.f, 0.5f));
+        EXPECT_EQ(3u, m_evaluator.getLinearCount());
+        EXPECT_EQ(1u, m_evaluator.getCubicCount());
+
+        m_evaluator.evaluate();
+        EXPECT_FLOAT_EQ(0.5f, m_evaluator.getLinearResult(0u));
+        EXPECT_FLOAT_EQ(1.0f, m_evaluator.getLinearResult(1u));
+        EXPECT_FLOAT_EQ(1.5f, m_evaluator.getLinearResult(2u));
+        EXPECT_FLOAT_EQ(0.5f, m_evaluator.getCubicResult(0u));
+    }
+
+    TEST_F(AnAnimationBatchEvaluator, InterpolatesLinearlyAnyNumberOfComponents)
+    {
+        // covers full SIMD registers as well as remainders of any size
+        for (size_t count = 0u; count < 40u; ++count)
+        {
+            m_evaluator.clear();
+            for (size_t i = 0u; i < count; ++i)
+                EXPECT_EQ(i, m_evaluator.addLinear(Value(i), Value(i + 3u), Ratio(i)));
+            m_evaluator.evaluate();
+
+            for (size_t i = 0u; i < count; ++i)
+                EXPECT_FLOAT_EQ(ExpectedLinear(Value(i), Value(i + 3u), Ratio(i)), m_evaluator.getLinearResult(i)) << count << " " << i;
+        }
+    }
+
+    TEST_F(AnAnimationBatchEvaluator, InterpolatesCubicAnyNumberOfComponents)
+    {
+        for (size_t count = 0u; count < 40u; ++count)
+        {
+            m_evaluator.clear();
+            for (size_t i = 0u; i < count; ++i)
+                EXPECT_EQ(i, m_evaluator.addCubic(Value(i), Value(i + 3u), Value(i + 1u), Value(i + 2u), Ratio(i), 0.5f));
+            m_evaluator.evaluate();
+
+            // cubic terms cancel out partially, result may differ in last bits depending on use of fused multiply-add
+            for (size_t i = 0u; i < count; ++i)
+                EXPECT_NEAR(ExpectedCubic(Value(i), Value(i + 3u), Value(i + 1u), Value(i + 2u), Ratio(i), 0.5f), m_evaluator.getCubicResult(i), 1e-5f) << count << " " << i;
+        }
+    }
+
+    TEST_F(AnAnimationBatchEvaluator, HitsKeyframesExactlyAtBordersOfInterval)
+    {
+        for (size_t i = 0u; i < 9u; ++i)
+        {
+            (void)m_evaluator.addLinear(Value(i), Value(i + 3u), 0.f);
+            (void)m_evaluator.addLinear(Value(i), Value(i + 3u), 1.f);
+            (void)m_evaluator.addCubic(Value(i), Value(i + 3u), Value(i + 1u), Value(i + 2u), 0.f, 2.f);
+            (void)m_evaluator.addCubic(Value(i), Value(i + 3u), Value(i + 1u), Value(i + 2u), 1.f, 2.f);
+        }
+        m_evaluator.evaluate();
+
+        for (size_t i = 0u; i < 9u; ++i)
+        {
+            EXPECT_EQ(Value(i), m_evaluator.getLinearResult(2u * i));
+            EXPECT_EQ(Value(i + 3u), m_evaluator.getLinearResult(2u * i + 1u));
+            EXPECT_EQ(Value(i), m_evaluator.getCubicResult(2u * i));
+            EXPECT_EQ(Value(i + 3u), m_evaluator.getCubicResult(2u * i + 1u));
+        }
+    }
+
+    TEST_F(AnAnimationBatchEvaluator, StartsNewBatchAfterClear)
+    {
+        (void)m_evaluator.addLinear(0.f, 1.f, 0.5f);
+        (void)m_evaluator.addCubic(0.f, 1.f, 0.f, 0.f, 0.5f, 1.f);
+        m_evaluator.evaluate();
+
+        m_evaluator.clear();
+        EXPECT_EQ(0u, m_evaluator.getLinearCount());
+        EXPECT_EQ(0u, m_evaluator.getCubicCount());
+
+        EXPECT_EQ(0u, m_evaluator.addLinear(10.f, 20.f, 0.5f));
+        m_evaluator.evaluate();
+        EXPECT_FLOAT_EQ(15.f, m_evaluator.getLinearResult(0u));
+    }
+
+    TEST_F(AnAnimationBatchEvaluator, ProvidesContiguousResultsOfComponentsAddedOneAfterAnother)
+    {
+        (void)m_evaluator.addLinear(0.f, 1.f, 0.5f);
+        (void)m_evaluator.addCubic(0.f, 1.f, 0.f, 0.f, 0.5f, 1.f);
+        // e.g. elements of a float array keyframe
+        const size_t firstLinearIdx = m_evaluator.addLinear(0.f, 2.f, 0.5f);
+        (void)m_evaluator.addLinear(0.f, 4.f, 0.5f);
+        (void)m_evaluator.addLinear(0.f, 6.f, 0.5f);
+        const size_t firstCubicIdx = m_evaluator.addCubic(0.f, 2.f, 0.f, 0.f, 1.f, 1.f);
+        (void)m_evaluator.addCubic(0.f, 4.f, 0.f, 0.f, 1.f, 1.f);
+        m_evaluator.evaluate();
+
+        const float* linearResults = m_evaluator.getLinearResults(firstLinearIdx, 3u);
+        EXPECT_FLOAT_EQ(1.f, linearResults[0]);
+        EXPECT_FLOAT_EQ(2.f, linearResults[1]);
+        EXPECT_FLOAT_EQ(3.f, linearResults[2]);
+        const float* cubicResults = m_evaluator.getCubicResults(firstCubicIdx, 2u);
+        EXPECT_FLOAT_EQ(2.f, cubicResults[0]);
+        EXPECT_FLOAT_EQ(4.f, cubicResults[1]);
+    }
+
+    TEST_F(AnAnimationBatchEvaluator, InterpolatesArraysWithoutEvaluatorInstance)
+    {
+        const std::vector<float> lower{ 0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f };
+        const std::vector<float> upper{ 10.f, 10.f, 10.f, 10.f, 10.f, 10.f, 10.f, 10.f, 10.f, 10.f };
+        const std::vector<float> ratio{ 0.f, .1f, .2f, .3f, .4f, .5f, .6f, .7f, .8f, .9f };
+        std::vector<float> result(lower.size(), -1.f);
+
+        // only first 9 elements, last one must stay untouched
+        AnimationBatchEvaluator::InterpolateLinear(lower.data(), upper.data(), ratio.data(), result.data(), 9u);
+        for (size_t i = 0u; i < 9u; ++i)
+            EXPECT_FLOAT_EQ(ExpectedLinear(lower[i], upper[i], ratio[i]), result[i]);
+        EXPECT_EQ(-1.f, result[9]);
+
+        result.assign(lower.size(), -1.f);
+        AnimationBatchEvaluator::InterpolateCubic(lower.data(), upper.data(), ratio.data(), ratio.data(), ratio.data(), result.data(), 9u);
+        for (size_t i = 0u; i < 9u; ++i)
+            EXPECT_NEAR(ExpectedCubic(lower[i], upper[i], ratio[i], ratio[i], ratio[i], 1.f), result[i], 1e-5f);
+        EXPECT_EQ(-1.f, result[9]);
+    }
+}
@@ -12,6 +12,9 @@
 
 #include "LogicNodeDummy.h"
 
+#include <algorithm>
+#include <memory>
+
 namespace rlogic::internal
 {
 
@@ -78,6 +81,40 @@ namespace rlogic::internal
         EXPECT_FALSE(m_graph.containsNode(N2));
     }
 
+    TEST_F(ADirectedAcyclicGraph, DoesNotContainNodeWhichIsPartOfOtherGraph)
+    {
+        addTestNodesToGraph(1);
+
+        DirectedAcyclicGraph otherGraph;
+        otherGraph.addNode(N2);
+        EXPECT_FALSE(m_graph.containsNode(N2));
+        EXPECT_TRUE(otherGraph.containsNode(N2));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ReusesGraphIndexOfRemovedNode)
+    {
+        addTestNodesToGraph(3);
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+
+        const size_t removedIndex = N2.getGraphIndex();
+        m_graph.removeNode(N2);
+        EXPECT_FALSE(m_graph.containsNode(N2));
+        EXPECT_EQ(LogicNodeImpl::InvalidGraphIndex, N2.getGraphIndex());
+
+        m_graph.addNode(N4);
+        EXPECT_EQ(removedIndex, N4.getGraphIndex());
+        EXPECT_TRUE(m_graph.containsNode(N4));
+        EXPECT_EQ(0u, m_graph.getInDegree(N4));
+        EXPECT_EQ(0u, m_graph.getOutDegree(N4));
+        EXPECT_EQ(0u, m_graph.getOutDegree(N1));
+        EXPECT_EQ(0u, m_graph.getInDegree(N3));
+
+        m_graph.addEdge(N3, N4);
+        m_graph.addEdge(N4, N1);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N3, &N4, &N1));
+    }
+
     TEST_F(ADirectedAcyclicGraph, SingleNodeWithNoEdgesHasZeroDegree)
     {
         addTestNodesToGraph(1);
@@ -517,6 +554,223 @@ namespace rlogic::internal
         EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
     }
 
+    TEST_F(ADirectedAcyclicGraph, ReportsNodesFormingCycle)
+    {
+        addTestNodesToGraph(4);
+
+        // N1 -> N2 -> N3 -> N4 -> N2 .... (infinity)
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N4);
+        m_graph.addEdge(N4, N2);
+
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+        const NodeVector& cycle = m_graph.getCycle();
+        ASSERT_EQ(3u, cycle.size());
+        EXPECT_THAT(cycle, ::testing::UnorderedElementsAre(&N2, &N3, &N4));
+
+        // cycle is reported in direction of edges
+        const auto n2It = std::find(cycle.cbegin(), cycle.cend(), &N2);
+        const size_t n2Idx = static_cast<size_t>(std::distance(cycle.cbegin(), n2It));
+        EXPECT_EQ(&N3, cycle[(n2Idx + 1) % 3]);
+        EXPECT_EQ(&N4, cycle[(n2Idx + 2) % 3]);
+    }
+
+    TEST_F(ADirectedAcyclicGraph, RecoversOrderAfterCycleIsRemoved)
+    {
+        addTestNodesToGraph(3);
+
+        // N1 -> N2 -> N3 -> N1
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N1);
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+        EXPECT_FALSE(m_graph.getCycle().empty());
+
+        // N1 -> N2 -> N3
+        m_graph.removeEdge(N3, N1);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N2, &N3));
+        EXPECT_TRUE(m_graph.getCycle().empty());
+
+        // order is maintained incrementally again
+        // N4 -> N1 -> N2 -> N3
+        m_graph.addNode(N4);
+        m_graph.addEdge(N4, N1);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N4, &N1, &N2, &N3));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ReordersOnlyAffectedNodesWhenEdgeContradictsCurrentOrder)
+    {
+        addTestNodesToGraph(6);
+
+        // N1 -> N2, N3 -> N4, N5 -> N6
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N3, N4);
+        m_graph.addEdge(N5, N6);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N2, &N3, &N4, &N5, &N6));
+
+        // N4 -> N1 contradicts order, N1 and N2 must be moved after N3 and N4, N5 and N6 stay where they are
+        m_graph.addEdge(N4, N1);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N3, &N4, &N1, &N2, &N5, &N6));
+
+        // N6 -> N3 contradicts order, whole chain moves after N5 and N6
+        m_graph.addEdge(N6, N3);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N5, &N6, &N3, &N4, &N1, &N2));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, DetectsCycleWhenAddingEdgeIncrementally_AndKeepsPreviousOrderUnaffectedByUnrelatedRemovals)
+    {
+        addTestNodesToGraph(5);
+
+        // N1 -> N2 -> N3, N4 -> N5
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N4, N5);
+        ASSERT_TRUE(m_graph.getTopologicallySortedNodes().has_value());
+
+        // closes cycle N1 -> N2 -> N3 -> N1
+        m_graph.addEdge(N3, N1);
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+
+        m_graph.removeNode(N4);
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+
+        m_graph.removeNode(N2);
+        updateOrdering();
+        EXPECT_LT(getRank(N3), getRank(N1));
+        EXPECT_THAT(getSortedTestNodes(), ::testing::UnorderedElementsAre(&N1, &N3, &N5));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, KeepsValidOrderForManyRandomlyAddedAndRemovedEdges)
+    {
+        std::vector<std::unique_ptr<LogicNodeDummyImpl>> nodes;
+        for (size_t i = 0; i < 50u; ++i)
+        {
+            nodes.push_back(std::make_unique<LogicNodeDummyImpl>(std::to_string(i), false));
+            m_graph.addNode(*nodes.back());
+        }
+
+        // Generate edges which are guaranteed to form a DAG (only from lower to higher index),
+        // but add them in shuffled order so that the incremental algorithm has to reorder a lot
+        std::vector<std::pair<size_t, size_t>> edges;
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            for (size_t j = i + 1; j < nodes.size(); j += 7)
+                edges.emplace_back(i, j);
+        }
+        std::reverse(edges.begin(), edges.end());
+        for (size_t i = 0; i < edges.size(); i += 3)
+            std::swap(edges[i], edges[edges.size() - 1 - i]);
+
+        const auto expectValidOrder = [&]() {
+            updateOrdering();
+            for (const auto& edge : edges)
+                EXPECT_LT(getRank(*nodes[edge.first]), getRank(*nodes[edge.second]));
+        };
+
+        for (const auto& edge : edges)
+            m_graph.addEdge(*nodes[edge.first], *nodes[edge.second]);
+        expectValidOrder();
+
+        for (size_t i = 0; i < edges.size(); i += 2)
+            m_graph.removeEdge(*nodes[edges[i].first], *nodes[edges[i].second]);
+        for (size_t i = 0; i < edges.size(); i += 2)
+            m_graph.addEdge(*nodes[edges[i].first], *nodes[edges[i].second]);
+        expectValidOrder();
+    }
+
+    TEST_F(ADirectedAcyclicGraph, GroupsIndependentNodesIntoSingleUpdateLevel)
+    {
+        addTestNodesToGraph(3);
+        ASSERT_TRUE(m_graph.getTopologicallySortedNodes());
+
+        EXPECT_THAT(m_graph.getUpdateLevels(), ::testing::ElementsAre(::testing::ElementsAre(&N1, &N2, &N3)));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, GroupsLinkedNodesIntoSubsequentUpdateLevels)
+    {
+        addTestNodesToGraph(5);
+
+        /*
+        *       -> N2 -
+        *     /        \
+        *  N1           -> N4
+        *     \        /
+        *       -> N3 -
+        *  N5
+        */
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N1, N3);
+        m_graph.addEdge(N2, N4);
+        m_graph.addEdge(N3, N4);
+        ASSERT_TRUE(m_graph.getTopologicallySortedNodes());
+
+        EXPECT_THAT(m_graph.getUpdateLevels(), ::testing::ElementsAre(
+            ::testing::ElementsAre(&N1, &N5),
+            ::testing::ElementsAre(&N2, &N3),
+            ::testing::ElementsAre(&N4)));
+
+        // levels are updated after edges or nodes change
+        m_graph.removeEdge(N1, N2);
+        m_graph.removeNode(N5);
+        ASSERT_TRUE(m_graph.getTopologicallySortedNodes());
+        EXPECT_THAT(m_graph.getUpdateLevels(), ::testing::ElementsAre(
+            ::testing::ElementsAre(&N1, &N2),
+            ::testing::ElementsAre(&N3),
+            ::testing::ElementsAre(&N4)));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, WeakEdgesDoNotInfluenceOrder_ButTargetOfWeakEdgeAlongOrderIsInLaterUpdateLevel)
+    {
+        addTestNodesToGraph(2);
+
+        // weak edge in opposite direction would form a cycle with a normal edge
+        m_graph.addEdge(N1, N2);
+        m_graph.addWeakEdge(N2, N1);
+        m_graph.addWeakEdge(N1, N2);
+        ASSERT_TRUE(m_graph.getTopologicallySortedNodes());
+        EXPECT_THAT(*m_graph.getTopologicallySortedNodes(), ::testing::ElementsAre(&N1, &N2));
+
+        m_graph.removeEdge(N1, N2);
+        ASSERT_TRUE(m_graph.getTopologicallySortedNodes());
+        EXPECT_THAT(m_graph.getUpdateLevels(), ::testing::ElementsAre(::testing::ElementsAre(&N1), ::testing::ElementsAre(&N2)));
+
+        m_graph.removeWeakEdge(N1, N2);
+        ASSERT_TRUE(m_graph.getTopologicallySortedNodes());
+        EXPECT_THAT(m_graph.getUpdateLevels(), ::testing::ElementsAre(::testing::ElementsAre(&N1, &N2)));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, SourceOfWeakEdgeAgainstOrderIsNotInEarlierUpdateLevelThanTarget)
+    {
+        addTestNodesToGraph(3);
+
+        /*
+        *  N1 -> N2 <~weak~ N3
+        */
+        m_graph.addEdge(N1, N2);
+        m_graph.addWeakEdge(N3, N2);
+        ASSERT_TRUE(m_graph.getTopologicallySortedNodes());
+
+        // N3 is ranked after N2, it would provide its value to N2 only in next update when executed one by one
+        EXPECT_THAT(m_graph.getUpdateLevels(), ::testing::ElementsAre(::testing::ElementsAre(&N1), ::testing::ElementsAre(&N2, &N3)));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, RemovesWeakEdgesOfRemovedNode)
+    {
+        addTestNodesToGraph(3);
+
+        m_graph.addWeakEdge(N1, N2);
+        m_graph.addWeakEdge(N3, N1);
+        m_graph.removeNode(N1);
+        ASSERT_TRUE(m_graph.getTopologicallySortedNodes());
+        EXPECT_THAT(m_graph.getUpdateLevels(), ::testing::ElementsAre(::testing::ElementsAre(&N2, &N3)));
+
+        // re-added node reuses the slot of the removed one, it must not inherit its weak edges
+        m_graph.addNode(N4);
+        ASSERT_TRUE(m_graph.getTopologicallySortedNodes());
+        EXPECT_THAT(m_graph.getUpdateLevels(), ::testing::ElementsAre(::testing::ElementsAre(&N2, &N3, &N4)));
+    }
+
     TEST_F(ADirectedAcyclicGraph, RemovesMultiLinksBetweenTwoNodes_OneByOne)
     {
         addTestNodesToGraph(2);
@@ -0,0 +1,213 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internals/DirtyNodeQueue.h"
+#include "internals/DirectedAcyclicGraph.h"
+
+#include "LogicNodeDummy.h"
+
+#include "fmt/format.h"
+
+#include <memory>
+
+namespace rlogic::internal
+{
+    class ADirtyNodeQueue : public ::testing::Test
+    {
+    protected:
+        ADirtyNodeQueue()
+        {
+            // chain of nodes, i.e. rank of node is its index
+            for (size_t i = 0; i < 200u; ++i)
+            {
+                m_nodes.push_back(std::make_unique<LogicNodeDummyImpl>(fmt::format("node{}", i)));
+                m_nodes.back()->setDirty(false);
+                m_graph.addNode(*m_nodes.back());
+                m_nodes.back()->setDirtyNodeQueue(&m_queue);
+                if (i > 0u)
+                    m_graph.addEdge(*m_nodes[i - 1u], *m_nodes[i]);
+            }
+        }
+
+        ~ADirtyNodeQueue() override
+        {
+            for (auto& node : m_nodes)
+                node->setDirtyNodeQueue(nullptr);
+        }
+
+        // Processes the queue marking popped nodes as not dirty, calls onPop for every node popped
+        NodeVector processQueue(const std::function<void(LogicNodeImpl&)>& onPop = {})
+        {
+            NodeVector poppedNodes;
+            m_queue.startProcessing(*m_graph.getTopologicallySortedNodes());
+            while (LogicNodeImpl* node = m_queue.popNext())
+            {
+                poppedNodes.push_back(node);
+                if (onPop)
+                    onPop(*node);
+                node->setDirty(false);
+            }
+            m_queue.finishProcessing();
+
+            return poppedNodes;
+        }
+
+        LogicNodeImpl& node(size_t rank)
+        {
+            return *m_nodes[rank];
+        }
+
+        DirectedAcyclicGraph m_graph;
+        DirtyNodeQueue m_queue{ m_graph };
+        std::vector<std::unique_ptr<LogicNodeDummyImpl>> m_nodes;
+    };
+
+    TEST_F(ADirtyNodeQueue, IsEmptyIfNoNodeIsDirty)
+    {
+        EXPECT_TRUE(processQueue().empty());
+        EXPECT_EQ(0u, m_queue.getVisitedNodesCount());
+    }
+
+    TEST_F(ADirtyNodeQueue, HandsOutDirtyNodesInRankOrder)
+    {
+        for (size_t rank : { 130u, 64u, 199u, 0u, 63u })
+            node(rank).setDirty(true);
+
+        EXPECT_THAT(processQueue(), ::testing::ElementsAre(&node(0), &node(63), &node(64), &node(130), &node(199)));
+        EXPECT_EQ(5u, m_queue.getVisitedNodesCount());
+        EXPECT_TRUE(processQueue().empty());
+    }
+
+    TEST_F(ADirtyNodeQueue, HandsOutNodeOnlyOnce)
+    {
+        node(3).setDirty(true);
+        node(3).setDirty(false);
+        node(3).setDirty(true);
+        m_queue.push(node(3));
+
+        EXPECT_THAT(processQueue(), ::testing::ElementsAre(&node(3)));
+    }
+
+    TEST_F(ADirtyNodeQueue, FollowsRankChanges)
+    {
+        node(10).setDirty(true);
+        node(20).setDirty(true);
+
+        // move node 20 before node 10
+        m_graph.removeEdge(node(19), node(20));
+        m_graph.addEdge(node(20), node(5));
+
+        EXPECT_THAT(processQueue(), ::testing::ElementsAre(&node(20), &node(10)));
+    }
+
+    TEST_F(ADirtyNodeQueue, HandsOutNodesDirtiedDuringProcessingWithHigherRank)
+    {
+        node(1).setDirty(true);
+        // emulates link activation
+        const auto dirtyNextNodes = [this](LogicNodeImpl& poppedNode) {
+            if (&poppedNode == &node(1))
+                node(100).setDirty(true);
+            if (&poppedNode == &node(100))
+                node(101).setDirty(true);
+        };
+
+        EXPECT_THAT(processQueue(dirtyNextNodes), ::testing::ElementsAre(&node(1), &node(100), &node(101)));
+        EXPECT_EQ(3u, m_queue.getVisitedNodesCount());
+    }
+
+    TEST_F(ADirtyNodeQueue, KeepsNodesDirtiedDuringProcessingWithLowerRankForNextProcessing)
+    {
+        node(70).setDirty(true);
+        // emulates weak link activation
+        const auto dirtyPreviousNodes = [this](LogicNodeImpl& poppedNode) {
+            if (&poppedNode == &node(70))
+            {
+                node(2).setDirty(true);
+                node(70).setDirty(false);
+                node(70).setDirty(true);
+            }
+        };
+
+        EXPECT_THAT(processQueue(dirtyPreviousNodes), ::testing::ElementsAre(&node(70)));
+        // node 70 was marked not dirty after it was popped
+        EXPECT_THAT(processQueue(), ::testing::ElementsAre(&node(2)));
+    }
+
+    TEST_F(ADirtyNodeQueue, KeepsNotProcessedNodesForNextProcessing)
+    {
+        node(5).setDirty(true);
+        node(6).setDirty(true);
+        node(150).setDirty(true);
+
+        m_queue.startProcessing(*m_graph.getTopologicallySortedNodes());
+        LogicNodeImpl* popped = m_queue.popNext();
+        EXPECT_EQ(&node(5), popped);
+        popped->setDirty(false);
+        m_queue.finishProcessing();
+
+        EXPECT_THAT(processQueue(), ::testing::ElementsAre(&node(6), &node(150)));
+    }
+
+    TEST_F(ADirtyNodeQueue, SkipsNodesWhichAreNotDirtyAnymore)
+    {
+        node(5).setDirty(true);
+        node(6).setDirty(true);
+        node(6).setDirty(false);
+
+        EXPECT_THAT(processQueue(), ::testing::ElementsAre(&node(5)));
+    }
+
+    TEST_F(ADirtyNodeQueue, ForgetsRemovedNodes)
+    {
+        node(5).setDirty(true);
+        node(199).setDirty(true);
+
+        m_queue.remove(node(199));
+        node(199).setDirtyNodeQueue(nullptr);
+        m_graph.removeNode(node(199));
+
+        EXPECT_THAT(processQueue(), ::testing::ElementsAre(&node(5)));
+    }
+
+    TEST_F(ADirtyNodeQueue, KeepsOtherPendingNodesWhenRemovingNodes)
+    {
+        for (size_t rank : { 7u, 3u, 150u, 42u, 199u, 0u })
+            node(rank).setDirty(true);
+
+        // first, last and a node in between of the pending nodes
+        for (size_t rank : { 7u, 0u, 150u })
+        {
+            m_queue.remove(node(rank));
+            node(rank).setDirtyNodeQueue(nullptr);
+            m_graph.removeNode(node(rank));
+        }
+        // removing a node which is not pending has no effect
+        m_queue.remove(node(5));
+
+        EXPECT_THAT(processQueue(), ::testing::ElementsAre(&node(3), &node(42), &node(199)));
+    }
+
+    TEST_F(ADirtyNodeQueue, DropsPendingNodesWhichAreNotDirtyAnymore)
+    {
+        for (size_t rank : { 7u, 3u, 150u, 42u })
+            node(rank).setDirty(true);
+
+        // executed without the queue
+        node(7).setDirty(false);
+        node(42).setDirty(false);
+        m_queue.dropCleanNodes();
+
+        // dropped nodes are handed out again once they get dirty
+        node(42).setDirty(true);
+        m_queue.remove(node(3));
+
+        EXPECT_THAT(processQueue(), ::testing::ElementsAre(&node(42), &node(150)));
+    }
+}
@@ -0,0 +1,150 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/FileUtils.h"
+#include "WithTempDirectory.h"
+#include "FileDescriptorHelper.h"
+
+#include <array>
+#include <numeric>
+#include <thread>
+
+namespace rlogic::internal
+{
+    class AFileUtils : public ::testing::Test
+    {
+    protected:
+        AFileUtils()
+        {
+            std::iota(m_data.begin(), m_data.end(), char(0));
+            EXPECT_TRUE(FileUtils::SaveBinary("file.bin", m_data.data(), m_data.size()));
+        }
+
+        std::vector<char> m_data = std::vector<char>(10000u);
+        WithTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(AFileUtils, MapsWholeFile)
+    {
+        const std::optional<MappedBinary> mappedFile = FileUtils::MapBinary("file.bin");
+        ASSERT_TRUE(mappedFile);
+        ASSERT_EQ(m_data.size(), mappedFile->size());
+        EXPECT_EQ(m_data, std::vector<char>(mappedFile->data(), mappedFile->data() + mappedFile->size()));
+    }
+
+    TEST_F(AFileUtils, MapsPartOfFileFromFileDescriptor)
+    {
+        // offset beyond first memory page
+        const size_t offset = 8192u;
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary("file.bin");
+        ASSERT_LT(0, fd);
+
+        const std::optional<MappedBinary> mappedFile = FileUtils::MapBinary(fd, offset, 100u);
+        ASSERT_TRUE(mappedFile);
+        ASSERT_EQ(100u, mappedFile->size());
+        EXPECT_EQ(std::vector<char>(m_data.cbegin() + offset, m_data.cbegin() + offset + 100u), std::vector<char>(mappedFile->data(), mappedFile->data() + mappedFile->size()));
+    }
+
+    TEST_F(AFileUtils, LoadsPartOfFileFromFileDescriptorWithUnalignedOffset)
+    {
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary("file.bin");
+        ASSERT_LT(0, fd);
+
+        const std::optional<MappedBinary> mappedFile = FileUtils::MapBinary(fd, 13u, 100u);
+        ASSERT_TRUE(mappedFile);
+        EXPECT_FALSE(mappedFile->isMemoryMapped());
+        EXPECT_EQ(std::vector<char>(m_data.cbegin() + 13u, m_data.cbegin() + 113u), std::vector<char>(mappedFile->data(), mappedFile->data() + mappedFile->size()));
+    }
+
+    TEST_F(AFileUtils, FailsToMapRangeOutsideOfFile)
+    {
+        int fd = FileDescriptorHelper::OpenFileDescriptorBinary("file.bin");
+        ASSERT_LT(0, fd);
+        EXPECT_FALSE(FileUtils::MapBinary(fd, 0u, m_data.size() + 1u));
+
+        fd = FileDescriptorHelper::OpenFileDescriptorBinary("file.bin");
+        ASSERT_LT(0, fd);
+        EXPECT_FALSE(FileUtils::MapBinary(fd, m_data.size(), 1u));
+    }
+
+    TEST_F(AFileUtils, FailsToMapFolderOrMissingFile)
+    {
+        fs::create_directories("folder");
+        EXPECT_FALSE(FileUtils::MapBinary("folder"));
+        EXPECT_FALSE(FileUtils::MapBinary("doesNotExist.bin"));
+    }
+
+    TEST_F(AFileUtils, KeepsMappedDataValidWhenMoved)
+    {
+        std::optional<MappedBinary> mappedFile = FileUtils::MapBinary("file.bin");
+        ASSERT_TRUE(mappedFile);
+
+        const MappedBinary movedFile = std::move(*mappedFile);
+        mappedFile.reset();
+        ASSERT_EQ(m_data.size(), movedFile.size());
+        EXPECT_EQ(m_data, std::vector<char>(movedFile.data(), movedFile.data() + movedFile.size()));
+    }
+
+    TEST_F(AFileUtils, SavesToFileDescriptorInChunks)
+    {
+        // more than one chunk
+        std::vector<char> data(3u * 1024u * 1024u + 13u);
+        std::iota(data.begin(), data.end(), char(0));
+
+        const int fd = FileDescriptorHelper::CreateFileDescriptorBinary("fromFd.bin");
+        ASSERT_LT(0, fd);
+        EXPECT_TRUE(FileUtils::SaveBinary(fd, data.data(), data.size()));
+        EXPECT_TRUE(FileUtils::SaveBinary(fd, m_data.data(), m_data.size()));
+        FileDescriptorHelper::CloseFileDescriptor(fd);
+
+        // written one after another
+        data.insert(data.end(), m_data.cbegin(), m_data.cend());
+        EXPECT_EQ(data, *FileUtils::LoadBinary("fromFd.bin"));
+    }
+
+#if !defined(_WIN32)
+    TEST_F(AFileUtils, SavesToPipe)
+    {
+        // more than pipe capacity, i.e. writes partially until reader consumes data
+        std::vector<char> data(2u * 1024u * 1024u);
+        std::iota(data.begin(), data.end(), char(0));
+
+        std::array<int, 2> pipeFds{};
+        ASSERT_EQ(0, ::pipe(pipeFds.data()));
+
+        std::vector<char> readData;
+        std::thread reader([&readData, readFd = pipeFds[0]]() {
+            std::array<char, 4096> chunk{};
+            ssize_t bytesRead = 0;
+            while ((bytesRead = ::read(readFd, chunk.data(), chunk.size())) > 0)
+            {
+                readData.insert(readData.end(), chunk.data(), chunk.data() + bytesRead);
+            }
+        });
+
+        EXPECT_TRUE(FileUtils::SaveBinary(pipeFds[1], data.data(), data.size()));
+        ::close(pipeFds[1]);
+        reader.join();
+        ::close(pipeFds[0]);
+
+        EXPECT_EQ(data, readData);
+    }
+#endif
+
+    TEST_F(AFileUtils, FailsToSaveToInvalidOrReadOnlyFileDescriptor)
+    {
+        EXPECT_FALSE(FileUtils::SaveBinary(-1, m_data.data(), m_data.size()));
+
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary("file.bin");
+        ASSERT_LT(0, fd);
+        EXPECT_FALSE(FileUtils::SaveBinary(fd, m_data.data(), m_data.size()));
+        FileDescriptorHelper::CloseFileDescriptor(fd);
+    }
+}
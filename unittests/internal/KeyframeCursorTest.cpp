@@ -0,0 +1,176 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/KeyframeCursor.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class AKeyframeCursor : public ::testing::Test
+    {
+    protected:
+        static size_t UpperBound(const std::vector<float>& timestamps, float time)
+        {
+            return static_cast<size_t>(std::distance(timestamps.cbegin(), std::upper_bound(timestamps.cbegin(), timestamps.cend(), time)));
+        }
+
+        void expectSameAsUpperBound(const std::vector<float>& timestamps, const std::vector<float>& times)
+        {
+            for (const float time : times)
+                EXPECT_EQ(UpperBound(timestamps, time), m_cursor.findUpperBound(timestamps, time)) << time;
+        }
+
+        static std::vector<float> TimesAroundTimestamps(const std::vector<float>& timestamps)
+        {
+            std::vector<float> times;
+            for (const float timestamp : timestamps)
+            {
+                times.push_back(std::nextafter(timestamp, -std::numeric_limits<float>::infinity()));
+                times.push_back(timestamp);
+                times.push_back(std::nextafter(timestamp, std::numeric_limits<float>::infinity()));
+            }
+            return times;
+        }
+
+        KeyframeCursor m_cursor;
+    };
+
+    TEST_F(AKeyframeCursor, FindsSameKeyframesAsBinarySearchWhenMovingForwardInSmallSteps)
+    {
+        const std::vector<float> timestamps{ 0.f, 0.1f, 0.5f, 0.7f, 2.f, 2.5f };
+        m_cursor.reset(timestamps);
+        EXPECT_FALSE(m_cursor.isUniformlySampled());
+
+        std::vector<float> times;
+        for (float time = -0.2f; time < 3.f; time += 0.05f)
+            times.push_back(time);
+        expectSameAsUpperBound(timestamps, times);
+
+        // exactly at and next to keyframes
+        expectSameAsUpperBound(timestamps, TimesAroundTimestamps(timestamps));
+    }
+
+    TEST_F(AKeyframeCursor, FindsSameKeyframesAsBinarySearchWhenMovingBackwardsOrJumping)
+    {
+        const std::vector<float> timestamps{ 0.f, 0.1f, 0.5f, 0.7f, 2.f, 2.5f, 3.f, 10.f };
+        m_cursor.reset(timestamps);
+
+        std::vector<float> times;
+        for (float time = 11.f; time > -1.f; time -= 0.05f)
+            times.push_back(time);
+        expectSameAsUpperBound(timestamps, times);
+
+        expectSameAsUpperBound(timestamps, { 0.05f, 9.f, 0.6f, 2.1f, -5.f, 100.f, 0.f, 10.f, 0.1f });
+    }
+
+    TEST_F(AKeyframeCursor, FindsSameKeyframesAsBinarySearchForRandomTimes)
+    {
+        std::mt19937 generator(1234u);
+        std::uniform_real_distribution<float> timestampDistribution(0.01f, 1.f);
+        std::vector<float> timestamps{ 0.f };
+        for (size_t i = 0u; i < 1000u; ++i)
+            timestamps.push_back(timestamps.back() + timestampDistribution(generator));
+        m_cursor.reset(timestamps);
+        EXPECT_FALSE(m_cursor.isUniformlySampled());
+
+        std::uniform_real_distribution<float> timeDistribution(-10.f, timestamps.back() + 10.f);
+        std::vector<float> times;
+        for (size_t i = 0u; i < 1000u; ++i)
+            times.push_back(timeDistribution(generator));
+        expectSameAsUpperBound(timestamps, times);
+    }
+
+    TEST_F(AKeyframeCursor, DetectsUniformlySampledTimestamps)
+    {
+        std::vector<float> timestamps;
+        for (size_t i = 0u; i < 10000u; ++i)
+            timestamps.push_back(0.5f + static_cast<float>(i) / 60.f);
+        m_cursor.reset(timestamps);
+        EXPECT_TRUE(m_cursor.isUniformlySampled());
+
+        // accumulated instead of multiplied, deviates slightly from ideal grid
+        timestamps.resize(2000u);
+        float time = 0.f;
+        for (auto& timestamp : timestamps)
+        {
+            timestamp = time;
+            time += 0.1f;
+        }
+        m_cursor.reset(timestamps);
+        EXPECT_TRUE(m_cursor.isUniformlySampled());
+
+        timestamps[1000] += 0.05f;
+        m_cursor.reset(timestamps);
+        EXPECT_FALSE(m_cursor.isUniformlySampled());
+
+        // too few timestamps to benefit from uniform sampling
+        m_cursor.reset({ 0.f, 1.f });
+        EXPECT_FALSE(m_cursor.isUniformlySampled());
+    }
+
+    TEST_F(AKeyframeCursor, FindsSameKeyframesAsBinarySearchInUniformlySampledTimestamps)
+    {
+        std::vector<float> timestamps;
+        float timestamp = -1.f;
+        for (size_t i = 0u; i < 5000u; ++i)
+        {
+            timestamps.push_back(timestamp);
+            timestamp += 1.f / 30.f;
+        }
+        m_cursor.reset(timestamps);
+        ASSERT_TRUE(m_cursor.isUniformlySampled());
+
+        expectSameAsUpperBound(timestamps, TimesAroundTimestamps(timestamps));
+
+        std::mt19937 generator(42u);
+        std::uniform_real_distribution<float> timeDistribution(-2.f, timestamps.back() + 1.f);
+        std::vector<float> times;
+        for (size_t i = 0u; i < 1000u; ++i)
+            times.push_back(timeDistribution(generator));
+        expectSameAsUpperBound(timestamps, times);
+    }
+
+    TEST_F(AKeyframeCursor, HandlesSingleTimestamp)
+    {
+        const std::vector<float> timestamps{ 1.f };
+        m_cursor.reset(timestamps);
+        expectSameAsUpperBound(timestamps, { 0.f, 1.f, 2.f, 0.5f });
+    }
+
+    TEST_F(AKeyframeCursor, HandlesInfiniteAndNaNTimes)
+    {
+        std::vector<float> timestamps{ 0.f, 1.f, 2.f, 3.f };
+        m_cursor.reset(timestamps);
+        ASSERT_TRUE(m_cursor.isUniformlySampled());
+        expectSameAsUpperBound(timestamps, { std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(), 1.5f });
+
+        timestamps = { 0.f, 1.f, 3.f, 7.f };
+        m_cursor.reset(timestamps);
+        ASSERT_FALSE(m_cursor.isUniformlySampled());
+        expectSameAsUpperBound(timestamps, { std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(), 1.5f });
+    }
+
+    TEST_F(AKeyframeCursor, FallsBackToBinarySearchForTimestampsNotInAscendingOrder)
+    {
+        // can happen only if timestamps are modified through animation node properties
+        const std::vector<float> timestamps{ 0.f, 2.f, 1.f, 3.f, 3.f };
+        m_cursor.reset(timestamps);
+        EXPECT_FALSE(m_cursor.isUniformlySampled());
+        expectSameAsUpperBound(timestamps, { 0.5f, 1.5f, 2.5f, 3.f, 4.f, 1.f });
+
+        const std::vector<float> timestampsWithNaN{ 0.f, 1.f, std::numeric_limits<float>::quiet_NaN(), 3.f };
+        m_cursor.reset(timestampsWithNaN);
+        expectSameAsUpperBound(timestampsWithNaN, { 0.5f, 1.5f, 2.5f, 3.f, 4.f, 1.f });
+    }
+}
@@ -0,0 +1,137 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/KeyframeQuantization.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class AKeyframeQuantization : public ::testing::Test
+    {
+    protected:
+        static std::vector<float> Dequantize(const KeyframeQuantization::QuantizedFloats& quantized)
+        {
+            const size_t componentCount = quantized.componentMin.size();
+            std::vector<float> values;
+            for (size_t i = 0u; i < quantized.values.size(); ++i)
+                values.push_back(KeyframeQuantization::DequantizeFloat(quantized.values[i], quantized.componentMin[i % componentCount], quantized.componentMax[i % componentCount]));
+            return values;
+        }
+
+        static vec4f Normalized(vec4f q)
+        {
+            const float length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            return { q[0] / length, q[1] / length, q[2] / length, q[3] / length };
+        }
+    };
+
+    TEST_F(AKeyframeQuantization, QuantizesEveryComponentWithinItsOwnRange)
+    {
+        // vec3f values with very different ranges per component
+        const std::vector<float> values{
+            0.f, -100.f, 5.f,
+            1.f, 100.f, 5.f,
+            0.25f, 0.f, 5.f,
+            0.5f, 33.3f, 5.f };
+        const auto quantized = KeyframeQuantization::QuantizeFloats(values, 3u);
+        ASSERT_TRUE(quantized);
+        EXPECT_EQ((std::vector<float>{ 0.f, -100.f, 5.f }), quantized->componentMin);
+        EXPECT_EQ((std::vector<float>{ 1.f, 100.f, 5.f }), quantized->componentMax);
+        ASSERT_EQ(values.size(), quantized->values.size());
+
+        const std::vector<float> dequantized = Dequantize(*quantized);
+        for (size_t i = 0u; i < values.size(); ++i)
+        {
+            const size_t component = i % 3u;
+            const float maxError = (quantized->componentMax[component] - quantized->componentMin[component]) / 65535.f * 0.5f + 1e-6f;
+            EXPECT_NEAR(values[i], dequantized[i], maxError) << i;
+        }
+    }
+
+    TEST_F(AKeyframeQuantization, RestoresMinimumAndMaximumOfComponentsExactly)
+    {
+        const std::vector<float> values{ -3.1f, 17.7f, 0.3f, 1e-3f, 42.42f, -1e5f };
+        const auto quantized = KeyframeQuantization::QuantizeFloats(values, 2u);
+        ASSERT_TRUE(quantized);
+
+        const std::vector<float> dequantized = Dequantize(*quantized);
+        EXPECT_EQ(-3.1f, dequantized[0]);
+        EXPECT_EQ(42.42f, dequantized[4]);
+        EXPECT_EQ(17.7f, dequantized[1]);
+        EXPECT_EQ(-1e5f, dequantized[5]);
+    }
+
+    TEST_F(AKeyframeQuantization, QuantizesConstantComponentsWithoutError)
+    {
+        const std::vector<float> values{ 1.5f, 1.5f, 1.5f };
+        const auto quantized = KeyframeQuantization::QuantizeFloats(values, 1u);
+        ASSERT_TRUE(quantized);
+        EXPECT_EQ(values, Dequantize(*quantized));
+    }
+
+    TEST_F(AKeyframeQuantization, FailsToQuantizeValuesWhichAreNotFinite)
+    {
+        EXPECT_FALSE(KeyframeQuantization::QuantizeFloats({ 0.f, std::numeric_limits<float>::quiet_NaN() }, 1u));
+        EXPECT_FALSE(KeyframeQuantization::QuantizeFloats({ 0.f, std::numeric_limits<float>::infinity() }, 1u));
+        // range itself overflows
+        EXPECT_FALSE(KeyframeQuantization::QuantizeFloats({ -std::numeric_limits<float>::max(), std::numeric_limits<float>::max() }, 1u));
+    }
+
+    TEST_F(AKeyframeQuantization, DetectsUnitQuaternions)
+    {
+        EXPECT_TRUE(KeyframeQuantization::AreUnitQuaternions({ { 0.f, 0.f, 0.f, 1.f }, Normalized({ 1.f, 2.f, 3.f, 4.f }) }));
+        EXPECT_FALSE(KeyframeQuantization::AreUnitQuaternions({ { 0.f, 0.f, 0.f, 1.f }, { 1.f, 2.f, 3.f, 4.f } }));
+        EXPECT_FALSE(KeyframeQuantization::AreUnitQuaternions({ { 0.f, 0.f, 0.f, 0.f } }));
+        EXPECT_FALSE(KeyframeQuantization::AreUnitQuaternions({ { 0.f, 0.f, std::numeric_limits<float>::quiet_NaN(), 1.f } }));
+    }
+
+    TEST_F(AKeyframeQuantization, PacksQuaternionsIntoSixBytesAndKeepsTheirSign)
+    {
+        const std::vector<vec4f> quaternions{
+            { 0.f, 0.f, 0.f, 1.f },
+            { 0.f, 0.f, 0.f, -1.f },
+            { -1.f, 0.f, 0.f, 0.f },
+            Normalized({ 1.f, -2.f, 3.f, -4.f }),
+            Normalized({ -1.f, 2.f, -3.f, 4.f }),
+            Normalized({ 1.f, 1.f, 1.f, 1.f }),
+            Normalized({ 0.5f, -0.5f, 0.f, 0.f }) };
+        const std::vector<uint16_t> packed = KeyframeQuantization::PackQuaternions(quaternions);
+        ASSERT_EQ(quaternions.size() * KeyframeQuantization::PackedQuaternionSize, packed.size());
+
+        for (size_t i = 0u; i < quaternions.size(); ++i)
+        {
+            const vec4f unpacked = KeyframeQuantization::UnpackQuaternion(packed[3u * i], packed[3u * i + 1u], packed[3u * i + 2u]);
+            for (size_t c = 0u; c < 4u; ++c)
+                EXPECT_NEAR(quaternions[i][c], unpacked[c], 1e-4f) << i << " " << c;
+        }
+    }
+
+    TEST_F(AKeyframeQuantization, PacksRandomQuaternionsWithSmallError)
+    {
+        std::mt19937 generator(7u);
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        std::vector<vec4f> quaternions;
+        for (size_t i = 0u; i < 1000u; ++i)
+            quaternions.push_back(Normalized({ distribution(generator), distribution(generator), distribution(generator), distribution(generator) }));
+        ASSERT_TRUE(KeyframeQuantization::AreUnitQuaternions(quaternions));
+
+        const std::vector<uint16_t> packed = KeyframeQuantization::PackQuaternions(quaternions);
+        for (size_t i = 0u; i < quaternions.size(); ++i)
+        {
+            const vec4f unpacked = KeyframeQuantization::UnpackQuaternion(packed[3u * i], packed[3u * i + 1u], packed[3u * i + 2u]);
+            for (size_t c = 0u; c < 4u; ++c)
+                EXPECT_NEAR(quaternions[i][c], unpacked[c], 1e-4f) << i << " " << c;
+        }
+    }
+}
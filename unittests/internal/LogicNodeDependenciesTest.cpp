@@ -13,6 +13,8 @@
 #include "internals/ErrorReporting.h"
 #include "LogicNodeDummy.h"
 
+#include <algorithm>
+
 namespace rlogic::internal
 {
     class ALogicNodeDependencies : public ::testing::Test
@@ -414,6 +416,55 @@ namespace rlogic::internal
         expectNoLinks(*m_nestedInputB);
     }
 
+    TEST_F(ALogicNodeDependencies_NestedLinks, ListsOutgoingLinksOfNodeInOrderOfOutputs)
+    {
+        PropertyImpl& outputA = *m_nodeANested->getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& inputB = *m_nodeBNested->getInputs()->getChild("input1")->m_impl;
+
+        EXPECT_TRUE(m_nodeANested->getOutgoingLinks().empty());
+
+        // linked in different order than the outputs are declared
+        EXPECT_TRUE(m_dependencies.link(*m_arrayOutputA, *m_arrayInputB, false, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(*m_nestedOutputA, *m_nestedInputB, false, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(outputA, inputB, true, m_errorReporting));
+
+        const auto& outgoingLinks = m_nodeANested->getOutgoingLinks();
+        ASSERT_EQ(3u, outgoingLinks.size());
+        EXPECT_EQ(&outputA, outgoingLinks[0].source);
+        EXPECT_EQ(&inputB, outgoingLinks[0].target);
+        EXPECT_EQ(m_nestedOutputA, outgoingLinks[1].source);
+        EXPECT_EQ(m_nestedInputB, outgoingLinks[1].target);
+        EXPECT_EQ(m_arrayOutputA, outgoingLinks[2].source);
+        EXPECT_EQ(m_arrayInputB, outgoingLinks[2].target);
+
+        EXPECT_TRUE(m_nodeBNested->getOutgoingLinks().empty());
+    }
+
+    TEST_F(ALogicNodeDependencies_NestedLinks, UpdatesOutgoingLinksOfNodeAfterUnlink)
+    {
+        EXPECT_TRUE(m_dependencies.link(*m_nestedOutputA, *m_nestedInputB, false, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(*m_arrayOutputA, *m_arrayInputB, false, m_errorReporting));
+        EXPECT_EQ(2u, m_nodeANested->getOutgoingLinks().size());
+
+        EXPECT_TRUE(m_dependencies.unlink(*m_nestedOutputA, *m_nestedInputB, m_errorReporting));
+
+        const auto& outgoingLinks = m_nodeANested->getOutgoingLinks();
+        ASSERT_EQ(1u, outgoingLinks.size());
+        EXPECT_EQ(m_arrayOutputA, outgoingLinks[0].source);
+        EXPECT_EQ(m_arrayInputB, outgoingLinks[0].target);
+    }
+
+    TEST_F(ALogicNodeDependencies_NestedLinks, UpdatesOutgoingLinksOfNodeAfterTargetNodeRemoved)
+    {
+        EXPECT_TRUE(m_dependencies.link(*m_nestedOutputA, *m_nestedInputB, false, m_errorReporting));
+        EXPECT_EQ(1u, m_nodeANested->getOutgoingLinks().size());
+
+        m_dependencies.removeNode(*m_nodeBNested);
+        m_nodeBNested = nullptr;
+
+        EXPECT_TRUE(m_nodeANested->getOutgoingLinks().empty());
+    }
+
     TEST_F(ALogicNodeDependencies, AddsDependencyToBinding)
     {
         RamsesBindingDummyImpl binding;
@@ -499,4 +550,112 @@ namespace rlogic::internal
         m_dependencies.addBindingDependency(binding2, binding1);
         expectSortedNodeOrder({ &binding2, &binding1 });
     }
+
+    TEST_F(ALogicNodeDependencies, KeepsListOfAllLinksUpToDate)
+    {
+        auto nodeToDelete = std::make_unique<LogicNodeDummyImpl>("node");
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        m_dependencies.addNode(*nodeToDelete);
+
+        PropertyImpl& output1A = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& output2A = *m_nodeA.getOutputs()->getChild("output2")->m_impl;
+        PropertyImpl& input1B = *m_nodeB.getInputs()->getChild("input1")->m_impl;
+        PropertyImpl& input2B = *m_nodeB.getInputs()->getChild("input2")->m_impl;
+        PropertyImpl& input1D = *nodeToDelete->getInputs()->getChild("input1")->m_impl;
+        EXPECT_TRUE(m_dependencies.getLinks().empty());
+
+        EXPECT_TRUE(m_dependencies.link(output1A, input1B, false, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(output2A, input2B, true, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(output1A, input1D, false, m_errorReporting));
+        EXPECT_EQ(3u, m_dependencies.getLinks().size());
+
+        EXPECT_TRUE(m_dependencies.unlink(output1A, input1B, m_errorReporting));
+        ASSERT_EQ(2u, m_dependencies.getLinks().size());
+        EXPECT_TRUE(std::any_of(m_dependencies.getLinks().cbegin(), m_dependencies.getLinks().cend(), [&](const PropertyLink& link) {
+            return link.source == &output2A.getPropertyInstance() && link.target == &input2B.getPropertyInstance() && link.isWeakLink; }));
+        EXPECT_TRUE(std::any_of(m_dependencies.getLinks().cbegin(), m_dependencies.getLinks().cend(), [&](const PropertyLink& link) {
+            return link.source == &output1A.getPropertyInstance() && link.target == &input1D.getPropertyInstance() && !link.isWeakLink; }));
+
+        m_dependencies.removeNode(*nodeToDelete);
+        nodeToDelete = nullptr;
+        ASSERT_EQ(1u, m_dependencies.getLinks().size());
+        EXPECT_EQ(&output2A.getPropertyInstance(), m_dependencies.getLinks()[0].source);
+        EXPECT_EQ(&input2B.getPropertyInstance(), m_dependencies.getLinks()[0].target);
+
+        EXPECT_TRUE(m_dependencies.unlink(output2A, input2B, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.getLinks().empty());
+    }
+
+    TEST_F(ALogicNodeDependencies, KeepsLinksInOrderOfCreationWhenOtherLinksAreRemoved)
+    {
+        LogicNodeDummyImpl nodeC{ "nodeC" };
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        m_dependencies.addNode(nodeC);
+
+        PropertyImpl& output1A = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& output2A = *m_nodeA.getOutputs()->getChild("output2")->m_impl;
+        PropertyImpl& input1B = *m_nodeB.getInputs()->getChild("input1")->m_impl;
+        PropertyImpl& input2B = *m_nodeB.getInputs()->getChild("input2")->m_impl;
+        PropertyImpl& input1C = *nodeC.getInputs()->getChild("input1")->m_impl;
+        PropertyImpl& input2C = *nodeC.getInputs()->getChild("input2")->m_impl;
+
+        const auto expectLinkTargets = [this](const std::vector<const PropertyImpl*>& expectedTargets) {
+            const auto& links = m_dependencies.getLinks();
+            ASSERT_EQ(expectedTargets.size(), links.size());
+            for (size_t i = 0u; i < links.size(); ++i)
+                EXPECT_EQ(&expectedTargets[i]->getPropertyInstance(), links[i].target) << i;
+        };
+
+        EXPECT_TRUE(m_dependencies.link(output1A, input1B, false, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(output2A, input2B, false, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(output1A, input1C, false, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(output2A, input2C, false, m_errorReporting));
+        expectLinkTargets({ &input1B, &input2B, &input1C, &input2C });
+
+        // removing first link keeps order of the others (it does not move the last link to its position)
+        EXPECT_TRUE(m_dependencies.unlink(output1A, input1B, m_errorReporting));
+        expectLinkTargets({ &input2B, &input1C, &input2C });
+
+        // several changes without querying links in between, new links are appended
+        EXPECT_TRUE(m_dependencies.unlink(output1A, input1C, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(output1A, input1B, false, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.unlink(output2A, input2B, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(output2A, input2B, false, m_errorReporting));
+        expectLinkTargets({ &input2C, &input1B, &input2B });
+
+        // links can still be found by their target after compaction
+        EXPECT_TRUE(m_dependencies.unlink(output2A, input2C, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.unlink(output2A, input2B, m_errorReporting));
+        expectLinkTargets({ &input1B });
+        EXPECT_TRUE(m_dependencies.unlink(output1A, input1B, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.getLinks().empty());
+    }
+
+    TEST_F(ALogicNodeDependencies, ChangesLinksGenerationOnlyWhenLinksChange)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+
+        PropertyImpl& output = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& input = *m_nodeB.getInputs()->getChild("input1")->m_impl;
+
+        uint64_t generation = m_dependencies.getLinksGeneration();
+        EXPECT_TRUE(m_dependencies.link(output, input, false, m_errorReporting));
+        EXPECT_NE(generation, m_dependencies.getLinksGeneration());
+
+        // failed link does not change links
+        generation = m_dependencies.getLinksGeneration();
+        EXPECT_FALSE(m_dependencies.link(output, input, false, m_errorReporting));
+        EXPECT_EQ(generation, m_dependencies.getLinksGeneration());
+
+        EXPECT_TRUE(m_dependencies.unlink(output, input, m_errorReporting));
+        EXPECT_NE(generation, m_dependencies.getLinksGeneration());
+
+        // removing node without links does not change links
+        generation = m_dependencies.getLinksGeneration();
+        m_dependencies.removeNode(m_nodeA);
+        EXPECT_EQ(generation, m_dependencies.getLinksGeneration());
+    }
 }
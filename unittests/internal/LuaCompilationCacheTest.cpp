@@ -0,0 +1,95 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/LuaCompilationCache.h"
+
+namespace rlogic::internal
+{
+    class ALuaCompilationCache : public ::testing::Test
+    {
+    protected:
+        static LuaCompilationCache::CompiledChunk MakeChunk(std::string byteCode)
+        {
+            return LuaCompilationCache::CompiledChunk{ std::move(byteCode),
+                std::make_shared<const PropertyTypeLayout>(MakeStruct("", { {"in", EPropertyType::Float} })),
+                std::make_shared<const PropertyTypeLayout>(MakeStruct("", {})) };
+        }
+
+        LuaCompilationCache m_cache;
+        const LuaCompilationCache::Dependencies m_dependencies = LuaCompilationCache::MakeDependencies({ EStandardModule::Math }, { {"mod", 1u} }, "", false);
+    };
+
+    TEST_F(ALuaCompilationCache, FindsCompiledChunkOfSameSourceAndDependencies)
+    {
+        EXPECT_EQ(nullptr, m_cache.find(ELuaChunkType::Script, "source", m_dependencies));
+        m_cache.add(ELuaChunkType::Script, "source", m_dependencies, MakeChunk("byteCode"));
+
+        const auto* chunk = m_cache.find(ELuaChunkType::Script, std::string("source"), m_dependencies);
+        ASSERT_NE(nullptr, chunk);
+        EXPECT_EQ("byteCode", chunk->byteCode);
+        ASSERT_TRUE(chunk->inputsLayout && chunk->outputsLayout);
+        EXPECT_TRUE(chunk->inputsLayout->matches(MakeStruct("", { {"in", EPropertyType::Float} })));
+        EXPECT_TRUE(chunk->outputsLayout->matches(MakeStruct("", {})));
+    }
+
+    TEST_F(ALuaCompilationCache, DoesNotFindChunkOfDifferentSourceOrType)
+    {
+        m_cache.add(ELuaChunkType::Script, "source", m_dependencies, MakeChunk("byteCode"));
+
+        EXPECT_EQ(nullptr, m_cache.find(ELuaChunkType::Script, "source ", m_dependencies));
+        EXPECT_EQ(nullptr, m_cache.find(ELuaChunkType::Module, "source", m_dependencies));
+    }
+
+    TEST_F(ALuaCompilationCache, DoesNotFindChunkWithDifferentDependencies)
+    {
+        m_cache.add(ELuaChunkType::Script, "source", m_dependencies, MakeChunk("byteCode"));
+
+        EXPECT_EQ(nullptr, m_cache.find(ELuaChunkType::Script, "source", LuaCompilationCache::MakeDependencies({ EStandardModule::String }, { {"mod", 1u} }, "", false)));
+        EXPECT_EQ(nullptr, m_cache.find(ELuaChunkType::Script, "source", LuaCompilationCache::MakeDependencies({ EStandardModule::Math }, { {"mod", 2u} }, "", false)));
+        EXPECT_EQ(nullptr, m_cache.find(ELuaChunkType::Script, "source", LuaCompilationCache::MakeDependencies({ EStandardModule::Math }, { {"other", 1u} }, "", false)));
+        EXPECT_EQ(nullptr, m_cache.find(ELuaChunkType::Script, "source", LuaCompilationCache::MakeDependencies({ EStandardModule::Math }, { {"mod", 1u} }, "chunk", false)));
+        EXPECT_EQ(nullptr, m_cache.find(ELuaChunkType::Script, "source", LuaCompilationCache::MakeDependencies({ EStandardModule::Math }, { {"mod", 1u} }, "", true)));
+    }
+
+    TEST_F(ALuaCompilationCache, IgnoresOrderOfModules)
+    {
+        m_cache.add(ELuaChunkType::Module, "source", LuaCompilationCache::MakeDependencies({ EStandardModule::Math, EStandardModule::Base }, { {"b", 2u}, {"a", 1u} }, "", false), MakeChunk("byteCode"));
+
+        EXPECT_NE(nullptr, m_cache.find(ELuaChunkType::Module, "source", LuaCompilationCache::MakeDependencies({ EStandardModule::Base, EStandardModule::Math }, { {"a", 1u}, {"b", 2u} }, "", false)));
+        EXPECT_NE(nullptr, m_cache.find(ELuaChunkType::Module, "source", LuaCompilationCache::MakeDependencies({ EStandardModule::Base, EStandardModule::Math, EStandardModule::Base }, { {"a", 1u}, {"b", 2u} }, "", false)));
+    }
+
+    TEST_F(ALuaCompilationCache, KeepsChunksOfDifferentSourcesWithSameHashApart)
+    {
+        m_cache.add(ELuaChunkType::Script, "source1", m_dependencies, MakeChunk("byteCode1"));
+        m_cache.add(ELuaChunkType::Script, "source2", m_dependencies, MakeChunk("byteCode2"));
+        m_cache.add(ELuaChunkType::Module, "source1", m_dependencies, MakeChunk("byteCode3"));
+
+        EXPECT_EQ("byteCode1", m_cache.find(ELuaChunkType::Script, "source1", m_dependencies)->byteCode);
+        EXPECT_EQ("byteCode2", m_cache.find(ELuaChunkType::Script, "source2", m_dependencies)->byteCode);
+        EXPECT_EQ("byteCode3", m_cache.find(ELuaChunkType::Module, "source1", m_dependencies)->byteCode);
+    }
+
+    TEST_F(ALuaCompilationCache, CountsHitsAndMisses)
+    {
+        EXPECT_EQ(0u, m_cache.getStatistics().hits);
+        EXPECT_EQ(0u, m_cache.getStatistics().misses);
+        EXPECT_EQ(0u, m_cache.getStatistics().entries);
+
+        EXPECT_EQ(nullptr, m_cache.find(ELuaChunkType::Script, "source", m_dependencies));
+        m_cache.add(ELuaChunkType::Script, "source", m_dependencies, MakeChunk("byteCode"));
+        EXPECT_NE(nullptr, m_cache.find(ELuaChunkType::Script, "source", m_dependencies));
+        EXPECT_NE(nullptr, m_cache.find(ELuaChunkType::Script, "source", m_dependencies));
+
+        EXPECT_EQ(2u, m_cache.getStatistics().hits);
+        EXPECT_EQ(1u, m_cache.getStatistics().misses);
+        EXPECT_EQ(1u, m_cache.getStatistics().entries);
+    }
+}
@@ -0,0 +1,114 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/PropertyTypeLayout.h"
+
+namespace rlogic::internal
+{
+    class APropertyTypeLayout : public ::testing::Test
+    {
+    protected:
+        const HierarchicalTypeData m_type = HierarchicalTypeData(TypeData("", EPropertyType::Struct), {
+            MakeType("float1", EPropertyType::Float),
+            MakeStruct("nested", { {"vec", EPropertyType::Vec3f}, {"flag", EPropertyType::Bool} }),
+            MakeArray("array", 2, EPropertyType::Int32)
+        });
+    };
+
+    TEST_F(APropertyTypeLayout, HoldsNamesAndTypesOfWholeHierarchy)
+    {
+        const PropertyTypeLayout layout(m_type);
+
+        EXPECT_EQ("", layout.getName());
+        EXPECT_EQ(EPropertyType::Struct, layout.getType());
+        ASSERT_EQ(3u, layout.getChildren().size());
+        EXPECT_EQ("float1", layout.getChildren()[0].getName());
+        EXPECT_EQ(EPropertyType::Float, layout.getChildren()[0].getType());
+        ASSERT_EQ(2u, layout.getChildren()[1].getChildren().size());
+        EXPECT_EQ("flag", layout.getChildren()[1].getChildren()[1].getName());
+        EXPECT_EQ(EPropertyType::Bool, layout.getChildren()[1].getChildren()[1].getType());
+        ASSERT_EQ(2u, layout.getChildren()[2].getChildren().size());
+        EXPECT_EQ(EPropertyType::Int32, layout.getChildren()[2].getChildren()[0].getType());
+    }
+
+    TEST_F(APropertyTypeLayout, FindsChildrenByName)
+    {
+        const PropertyTypeLayout layout(m_type);
+
+        EXPECT_EQ(0u, layout.findChildIndex("float1"));
+        EXPECT_EQ(1u, layout.findChildIndex("nested"));
+        EXPECT_EQ(2u, layout.findChildIndex("array"));
+        EXPECT_EQ(1u, layout.getChildren()[1].findChildIndex("flag"));
+        EXPECT_FALSE(layout.findChildIndex("vec"));
+        EXPECT_FALSE(layout.findChildIndex(""));
+        EXPECT_FALSE(layout.getChildren()[0].findChildIndex("float1"));
+    }
+
+    TEST_F(APropertyTypeLayout, MatchesOnlyTypeItWasCreatedFrom)
+    {
+        const PropertyTypeLayout layout(m_type);
+
+        EXPECT_TRUE(layout.matches(m_type));
+        EXPECT_EQ(PropertyTypeLayout::Hash(m_type), layout.getHash());
+
+        HierarchicalTypeData renamedChild = m_type;
+        renamedChild.children[1].children[0].typeData.name = "vec2";
+        EXPECT_FALSE(layout.matches(renamedChild));
+
+        HierarchicalTypeData retypedChild = m_type;
+        retypedChild.children[2].children[1].typeData.type = EPropertyType::Int64;
+        EXPECT_FALSE(layout.matches(retypedChild));
+
+        HierarchicalTypeData reorderedChildren = m_type;
+        std::swap(reorderedChildren.children[0], reorderedChildren.children[2]);
+        EXPECT_FALSE(layout.matches(reorderedChildren));
+        EXPECT_FALSE(layout == PropertyTypeLayout(reorderedChildren));
+
+        EXPECT_TRUE(layout == PropertyTypeLayout(m_type));
+    }
+
+    TEST_F(APropertyTypeLayout, RegistryReturnsSameLayoutForEqualTypes)
+    {
+        PropertyTypeLayoutRegistry registry;
+
+        const auto layout1 = registry.getLayout(m_type);
+        const auto layout2 = registry.getLayout(HierarchicalTypeData(m_type));
+        const auto otherLayout = registry.getLayout(MakeStruct("", { {"float1", EPropertyType::Float} }));
+
+        EXPECT_EQ(layout1, layout2);
+        EXPECT_NE(layout1, otherLayout);
+        EXPECT_EQ(2u, registry.getLayoutCount());
+    }
+
+    TEST_F(APropertyTypeLayout, RegistryTakesOverOnlyUnknownLayoutsWhenMerged)
+    {
+        PropertyTypeLayoutRegistry registry;
+        const auto layout = registry.getLayout(m_type);
+
+        PropertyTypeLayoutRegistry otherRegistry;
+        (void)otherRegistry.getLayout(m_type);
+        const auto otherLayout = otherRegistry.getLayout(MakeStruct("", { {"float1", EPropertyType::Float} }));
+
+        registry.merge(otherRegistry);
+        EXPECT_EQ(2u, registry.getLayoutCount());
+        EXPECT_EQ(layout, registry.getLayout(m_type));
+        EXPECT_EQ(otherLayout, registry.getLayout(MakeStruct("", { {"float1", EPropertyType::Float} })));
+    }
+
+    TEST_F(APropertyTypeLayout, CountsMemoryOfWholeHierarchy)
+    {
+        const PropertyTypeLayout primitive(MakeType("float1", EPropertyType::Float));
+        const PropertyTypeLayout layout(m_type);
+
+        EXPECT_EQ(sizeof(PropertyTypeLayout), primitive.getMemoryUsage());
+        // 8 layouts in total, name indices of root struct (8 slots for 3 fields) and of nested struct (4 slots for 2 fields)
+        EXPECT_EQ(8u * sizeof(PropertyTypeLayout) + 12u * sizeof(uint32_t), layout.getMemoryUsage());
+    }
+}
@@ -0,0 +1,107 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/PropertyValueArena.h"
+
+namespace rlogic::internal
+{
+    class APropertyValueArena : public ::testing::Test
+    {
+    protected:
+        const HierarchicalTypeData m_type = HierarchicalTypeData(TypeData("", EPropertyType::Struct), {
+            MakeType("float1", EPropertyType::Float),
+            MakeType("str", EPropertyType::String),
+            MakeStruct("nested", { {"float2", EPropertyType::Float}, {"vec", EPropertyType::Vec3f}, {"flag", EPropertyType::Bool} }),
+            MakeArray("array", 3, EPropertyType::Int32)
+        });
+    };
+
+    TEST_F(APropertyValueArena, AllocatesValuesOfSameTypeNextToEachOther)
+    {
+        PropertyValueArena arena(m_type);
+
+        EXPECT_EQ(0u, arena.allocate(EPropertyType::Float));
+        EXPECT_EQ(0u, arena.allocate(EPropertyType::Int32));
+        EXPECT_EQ(1u, arena.allocate(EPropertyType::Float));
+        EXPECT_EQ(1u, arena.allocate(EPropertyType::Int32));
+        EXPECT_EQ(2u, arena.allocate(EPropertyType::Int32));
+        EXPECT_EQ(0u, arena.allocate(EPropertyType::String));
+
+        EXPECT_EQ(&arena.get<float>(0u) + 1, &arena.get<float>(1u));
+        EXPECT_EQ(&arena.get<int32_t>(0u) + 2, &arena.get<int32_t>(2u));
+    }
+
+    TEST_F(APropertyValueArena, InitializesValuesToDefaults)
+    {
+        PropertyValueArena arena(m_type);
+
+        const uint32_t floatIdx = arena.allocate(EPropertyType::Float);
+        const uint32_t vecIdx = arena.allocate(EPropertyType::Vec3f);
+        const uint32_t boolIdx = arena.allocate(EPropertyType::Bool);
+        const uint32_t strIdx = arena.allocate(EPropertyType::String);
+
+        EXPECT_EQ(0.f, arena.get<float>(floatIdx));
+        EXPECT_EQ(vec3f({ 0.f, 0.f, 0.f }), arena.get<vec3f>(vecIdx));
+        EXPECT_FALSE(arena.get<bool>(boolIdx));
+        EXPECT_EQ("", arena.get<std::string>(strIdx));
+    }
+
+    TEST_F(APropertyValueArena, StoresValuesIndependently)
+    {
+        PropertyValueArena arena(m_type);
+
+        const uint32_t float1 = arena.allocate(EPropertyType::Float);
+        const uint32_t float2 = arena.allocate(EPropertyType::Float);
+        const uint32_t str = arena.allocate(EPropertyType::String);
+
+        arena.get<float>(float1) = 1.5f;
+        arena.get<float>(float2) = -2.f;
+        arena.get<std::string>(str) = "some text long enough to not fit into small string buffer";
+
+        const PropertyValueArena& constArena = arena;
+        EXPECT_EQ(1.5f, constArena.get<float>(float1));
+        EXPECT_EQ(-2.f, constArena.get<float>(float2));
+        EXPECT_EQ("some text long enough to not fit into small string buffer", constArena.get<std::string>(str));
+    }
+
+    TEST_F(APropertyValueArena, ReservesMemoryOnlyForTypesUsedInHierarchy)
+    {
+        const PropertyValueArena arena(m_type);
+        const PropertyValueArena arenaWithoutString(MakeStruct("", { {"float1", EPropertyType::Float}, {"float2", EPropertyType::Float} }));
+
+        EXPECT_EQ(sizeof(PropertyValueArena) + 2 * sizeof(float) + sizeof(std::string) + sizeof(vec3f) + sizeof(bool) + 3 * sizeof(int32_t), arena.getMemoryUsage());
+        EXPECT_EQ(sizeof(PropertyValueArena) + 2 * sizeof(float), arenaWithoutString.getMemoryUsage());
+    }
+
+    TEST_F(APropertyValueArena, ReservesSameMemoryWhenCreatedFromLayout)
+    {
+        const PropertyValueArena arena(m_type);
+        PropertyValueArena arenaFromLayout(PropertyTypeLayout{ m_type });
+
+        EXPECT_EQ(arena.getMemoryUsage(), arenaFromLayout.getMemoryUsage());
+        EXPECT_EQ(0u, arenaFromLayout.allocate(EPropertyType::Int32));
+        EXPECT_EQ(1u, arenaFromLayout.allocate(EPropertyType::Int32));
+        EXPECT_EQ(2u, arenaFromLayout.allocate(EPropertyType::Int32));
+    }
+
+    TEST_F(APropertyValueArena, VisitsCppTypeOfPrimitivePropertyType)
+    {
+        const auto getTypeFromCppType = [](auto typeTag) {
+            return PropertyTypeToEnum<typename decltype(typeTag)::type>::TYPE;
+        };
+
+        for (const auto type : { EPropertyType::Float, EPropertyType::Vec2f, EPropertyType::Vec3f, EPropertyType::Vec4f,
+                EPropertyType::Int32, EPropertyType::Int64, EPropertyType::Vec2i, EPropertyType::Vec3i, EPropertyType::Vec4i,
+                EPropertyType::String, EPropertyType::Bool })
+        {
+            EXPECT_EQ(type, VisitPrimitiveType(type, getTypeFromCppType));
+        }
+    }
+}
@@ -241,4 +241,97 @@ namespace rlogic::internal
         dataStatus = script();
         EXPECT_EQ(dataStatus, "data: a lot of data!");
     }
+
+    class ASolState_StandardModules : public ASolState
+    {
+    protected:
+        std::string runInEnvironment(std::string_view source, sol::environment& env)
+        {
+            sol::protected_function script = m_solState.loadScript(source, "test script");
+            env.set_on(script);
+            sol::protected_function_result result = script();
+            if (!result.valid())
+            {
+                sol::error error = result;
+                return error.what();
+            }
+            return result.get<std::string>();
+        }
+
+        sol::environment m_env1{ m_solState.createEnvironment({ EStandardModule::Base, EStandardModule::Math, EStandardModule::String }, {}, false) };
+        sol::environment m_env2{ m_solState.createEnvironment({ EStandardModule::Base, EStandardModule::Math, EStandardModule::String }, {}, false) };
+    };
+
+    TEST_F(ASolState_StandardModules, SharesModuleFunctionsBetweenEnvironments)
+    {
+        const sol::table math1 = m_env1["math"];
+        const sol::table math2 = m_env2["math"];
+        EXPECT_NE(math1, math2);
+        EXPECT_EQ(math1.get<sol::object>("floor"), math2.get<sol::object>("floor"));
+
+        EXPECT_EQ("2 abc", runInEnvironment("return tostring(math.floor(2.5)) .. ' ' .. string.lower('ABC')", m_env1));
+    }
+
+    TEST_F(ASolState_StandardModules, ModifyingModuleDoesNotAffectOtherEnvironments)
+    {
+        EXPECT_EQ("nil 2", runInEnvironment(R"(
+            math.floor = nil
+            math.myConstant = 42
+            return tostring(math.floor) .. ' ' .. tostring(math.ceil(1.5))
+        )", m_env1));
+
+        // other environment is not affected
+        EXPECT_EQ("2 nil", runInEnvironment("return tostring(math.floor(2.5)) .. ' ' .. tostring(math.myConstant)", m_env2));
+    }
+
+    TEST_F(ASolState_StandardModules, RawWritesToModuleDoNotAffectOtherEnvironments)
+    {
+        EXPECT_EQ("1", runInEnvironment(R"(
+            rawset(math, "floor", function() return 1 end)
+            return tostring(math.floor(2.5))
+        )", m_env1));
+
+        EXPECT_EQ("2", runInEnvironment("return tostring(math.floor(2.5))", m_env2));
+    }
+
+    TEST_F(ASolState_StandardModules, IteratesOverFunctionsOfUnmodifiedModule)
+    {
+        EXPECT_EQ("true true", runInEnvironment(R"(
+            local foundFloor = false
+            local foundLower = false
+            for name, func in pairs(math) do
+                if name == "floor" then foundFloor = (func == math.floor) end
+            end
+            for name, func in pairs(string) do
+                if name == "lower" then foundLower = (func == string.lower) end
+            end
+            return tostring(foundFloor) .. ' ' .. tostring(foundLower)
+        )", m_env1));
+    }
+
+    TEST_F(ASolState_StandardModules, NextReturnsElementOfUnmodifiedModule)
+    {
+        EXPECT_EQ("string true", runInEnvironment(R"(
+            local name, func = next(math)
+            return type(name) .. ' ' .. tostring(func == math[name])
+        )", m_env1));
+        EXPECT_EQ("string", runInEnvironment("return type(next(string))", m_env1));
+    }
+
+    TEST_F(ASolState_StandardModules, RawGetReturnsFunctionOfUnmodifiedModule)
+    {
+        EXPECT_EQ("true true", runInEnvironment("return tostring(rawget(math, 'floor') == math.floor) .. ' ' .. tostring(rawget(string, 'lower') == string.lower)", m_env1));
+    }
+
+    TEST_F(ASolState_StandardModules, ModuleHasNoMetatable)
+    {
+        EXPECT_EQ("nil", runInEnvironment("return tostring(getmetatable(math))", m_env1));
+
+        // metatable of a module affects only the environment which set it
+        EXPECT_EQ("42", runInEnvironment(R"(
+            setmetatable(math, {__index = function() return 42 end})
+            return tostring(math.notAFunction)
+        )", m_env1));
+        EXPECT_EQ("nil nil", runInEnvironment("return tostring(getmetatable(math)) .. ' ' .. tostring(math.notAFunction)", m_env2));
+    }
 }
@@ -0,0 +1,76 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internals/ThreadPool.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace rlogic::internal
+{
+    TEST(AThreadPool, ReportsThreadCountIncludingCallingThread)
+    {
+        EXPECT_EQ(1u, ThreadPool(1u).getThreadCount());
+        EXPECT_EQ(4u, ThreadPool(4u).getThreadCount());
+    }
+
+    TEST(AThreadPool, ExecutesEveryTaskExactlyOnce)
+    {
+        ThreadPool pool(4u);
+
+        std::vector<std::atomic<size_t>> executionCounts(1000u);
+        pool.execute(executionCounts.size(), [&executionCounts](size_t taskIdx) { ++executionCounts[taskIdx]; }, []() {});
+
+        for (const auto& count : executionCounts)
+            EXPECT_EQ(1u, count);
+    }
+
+    TEST(AThreadPool, ExecutesCallerTaskOnCallingThread)
+    {
+        ThreadPool pool(3u);
+
+        std::thread::id callerTaskThread;
+        std::atomic<size_t> tasksExecuted{ 0u };
+        pool.execute(100u, [&tasksExecuted](size_t /*taskIdx*/) { ++tasksExecuted; }, [&callerTaskThread]() { callerTaskThread = std::this_thread::get_id(); });
+
+        EXPECT_EQ(std::this_thread::get_id(), callerTaskThread);
+        EXPECT_EQ(100u, tasksExecuted);
+    }
+
+    TEST(AThreadPool, ExecutesAllTasksOnCallingThreadIfThereAreNoWorkers)
+    {
+        ThreadPool pool(1u);
+
+        std::vector<std::thread::id> taskThreads(10u);
+        pool.execute(taskThreads.size(), [&taskThreads](size_t taskIdx) { taskThreads[taskIdx] = std::this_thread::get_id(); }, []() {});
+
+        for (const auto& id : taskThreads)
+            EXPECT_EQ(std::this_thread::get_id(), id);
+    }
+
+    TEST(AThreadPool, CanExecuteManyBatchesOfTasks)
+    {
+        ThreadPool pool(4u);
+
+        std::vector<size_t> results(16u);
+        for (size_t batch = 0u; batch < 1000u; ++batch)
+        {
+            pool.execute(results.size(), [&results](size_t taskIdx) { results[taskIdx] += taskIdx; }, []() {});
+            // also batches with less tasks than workers
+            pool.execute(1u, [&results](size_t taskIdx) { results[taskIdx] += 1u; }, []() {});
+            pool.execute(0u, [](size_t /*taskIdx*/) { FAIL(); }, []() {});
+        }
+
+        EXPECT_EQ(1000u, results[0]);
+        for (size_t i = 1u; i < results.size(); ++i)
+            EXPECT_EQ(1000u * i, results[i]);
+    }
+}
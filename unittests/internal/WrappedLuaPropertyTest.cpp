@@ -207,6 +207,36 @@ namespace rlogic::internal
         }
     }
 
+    TEST_F(AWrappedLuaProperty_Access, ResolvesStructFieldsWithInternedNames)
+    {
+        const std::string longName = "field_with_a_name_too_long_to_be_interned_by_lua";
+        PropertyImpl nestedStruct(HierarchicalTypeData{ TypeData("Nested", EPropertyType::Struct), {
+                m_structWithAllPrimitiveTypes,
+                MakeType(longName, EPropertyType::Int32),
+                MakeStruct("nested", { TypeData{"Int32", EPropertyType::Int32} })
+            } }, EPropertySemantics::ScriptOutput);
+        setDummyDataRecursively(nestedStruct);
+        nestedStruct.getChild("nested")->getChild("Int32")->m_impl->setValue(7);
+        WrappedLuaProperty wrapped(nestedStruct);
+        wrapped.internFieldNames(m_sol);
+        m_sol["Nested"] = std::ref(wrapped);
+
+        EXPECT_EQ(42, extractValue<int32_t>("Nested.ROOT.Int32"));
+        EXPECT_EQ(7, extractValue<int32_t>("Nested.nested.Int32"));
+        EXPECT_EQ(42, extractValue<int32_t>(fmt::format("Nested.{}", longName)));
+        // strings created at runtime are interned too
+        EXPECT_EQ(42, extractValue<int32_t>("Nested['RO'..'OT']['Int'..tostring(32)]"));
+        EXPECT_EQ("hello", extractValue<std::string>("Nested.ROOT.String"));
+
+        run_WithResult("Nested.nested.Int32 = 13");
+        EXPECT_EQ(13, *nestedStruct.getChild("nested")->getChild("Int32")->get<int32_t>());
+
+        const sol::protected_function_result result = run_WithResult("value = Nested.ROOT.Int33");
+        ASSERT_FALSE(result.valid());
+        const sol::error error = result;
+        EXPECT_THAT(error.what(), ::testing::HasSubstr("Tried to access undefined struct property 'Int33'"));
+    }
+
     TEST_F(AWrappedLuaProperty_Access, ResolvesArrayElements)
     {
         for (auto semantics : std::vector<EPropertySemantics>{ EPropertySemantics::ScriptInput, EPropertySemantics::ScriptOutput })
@@ -14,9 +14,9 @@
 namespace rlogic::internal
 {
     static
-        ::testing::internal::ValueArray<rlogic::EFeatureLevel, rlogic::EFeatureLevel, rlogic::EFeatureLevel, rlogic::EFeatureLevel, rlogic::EFeatureLevel>
+        ::testing::internal::ValueArray<rlogic::EFeatureLevel, rlogic::EFeatureLevel, rlogic::EFeatureLevel, rlogic::EFeatureLevel, rlogic::EFeatureLevel, rlogic::EFeatureLevel, rlogic::EFeatureLevel>
         GetFeatureLevelTestValues()
     {
-        return ::testing::Values(rlogic::EFeatureLevel_01, rlogic::EFeatureLevel_02, rlogic::EFeatureLevel_03, rlogic::EFeatureLevel_04, rlogic::EFeatureLevel_05);
+        return ::testing::Values(rlogic::EFeatureLevel_01, rlogic::EFeatureLevel_02, rlogic::EFeatureLevel_03, rlogic::EFeatureLevel_04, rlogic::EFeatureLevel_05, rlogic::EFeatureLevel_06, rlogic::EFeatureLevel_07);
     }
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <fcntl.h>
+#include <sys/stat.h>
 #if _WIN32
 #  include <io.h>
 #else
@@ -26,6 +27,26 @@ namespace rlogic
 #else
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) system call
             return ::open(path, flags);
+#endif
+        }
+
+        // Creates new (or truncates existing) file opened for writing
+        inline int CreateFileDescriptorBinary(const char* path)
+        {
+#if _WIN32
+            return ::open(path, O_CREAT | O_TRUNC | O_WRONLY | O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) system call
+            return ::open(path, O_CREAT | O_TRUNC | O_WRONLY, S_IRUSR | S_IWUSR);
+#endif
+        }
+
+        inline void CloseFileDescriptor(int fd)
+        {
+#if _WIN32
+            ::_close(fd);
+#else
+            ::close(fd);
 #endif
         }
     }
@@ -25,6 +25,8 @@
 #include "ramses-utils.h"
 
 #include <iostream>
+#include <string>
+#include <cstdlib>
 
 ramses::Appearance* createTestAppearance(ramses::Scene& scene)
 {
@@ -65,26 +67,44 @@ int main(int argc, char* argv[])
     std::string basePath {"."};
     std::string ramsesFilename = "testScene.ramses";
     std::string logicFilename = "testLogic.rlogic";
+    rlogic::EFeatureLevel featureLevel = rlogic::EFeatureLevel_Latest;
+    bool validArgs = true;
 
     if (args.size() == 2u)
     {
         basePath = args[1];
     }
+    else if (args.size() == 3u)
+    {
+        // file names of compatibility test assets, e.g. testScene_06.ramses and testLogic_06.rlogic
+        basePath = args[1];
+        const int featureLevelInt = std::atoi(args[2]);
+        validArgs = (featureLevelInt >= rlogic::EFeatureLevel_05 && featureLevelInt <= rlogic::EFeatureLevel_Latest);
+        featureLevel = static_cast<rlogic::EFeatureLevel>(featureLevelInt);
+        ramsesFilename = "testScene_0" + std::to_string(featureLevelInt) + ".ramses";
+        logicFilename = "testLogic_0" + std::to_string(featureLevelInt) + ".rlogic";
+    }
     else if (args.size() == 4u)
     {
         basePath = args[1];
         ramsesFilename = args[2];
         logicFilename = args[3];
     }
+    else if (args.size() > 4u)
+    {
+        validArgs = false;
+    }
 
-    if (args.size() == 3 || args.size() > 4u)
+    if (!validArgs)
     {
         std::cerr
             << "Generator of ramses and ramses logic test content.\n\n"
             << "Synopsis:\n"
             << "  testAssetProducer\n"
             << "  testAssetProducer <basePath>\n"
-            << "  testAssetProducer <basePath> <ramsesFileName> <logicFileName>\n\n";
+            << "  testAssetProducer <basePath> <featureLevel>\n"
+            << "  testAssetProducer <basePath> <ramsesFileName> <logicFileName>\n\n"
+            << "Content is created with latest feature level unless <featureLevel> (5 or higher) is given.\n\n";
         return 1;
     }
 
@@ -93,7 +113,7 @@ int main(int argc, char* argv[])
 
     ramses::Scene* scene = ramsesClient->createScene(ramses::sceneId_t(123u), ramses::SceneConfig(), "");
     scene->flush();
-    rlogic::LogicEngine logicEngine{ rlogic::EFeatureLevel_05 };
+    rlogic::LogicEngine logicEngine{ featureLevel };
 
     rlogic::LuaScript* script1 = logicEngine.createLuaScript(R"(
         function interface(IN,OUT)
@@ -231,6 +251,18 @@ int main(int argc, char* argv[])
     logicEngine.createAnimationNode(animConfig, "animNodeWithDataProperties");
     logicEngine.createTimerNode("timerNode");
 
+    if (featureLevel >= rlogic::EFeatureLevel_07)
+    {
+        // saved compressed below, translations are quantized and rotations packed as quaternions
+        const auto timestamps = logicEngine.createDataArray(std::vector<float>{ 0.f, 0.5f, 1.f }, "compressedTimestamps");
+        const auto translations = logicEngine.createDataArray(std::vector<rlogic::vec3f>{ { 0.f, 1.f, -2.f }, { 0.25f, 2.f, -1.f }, { 1.f, 3.f, 0.f } }, "compressedTranslations");
+        const auto rotations = logicEngine.createDataArray(std::vector<rlogic::vec4f>{ { 0.f, 0.f, 0.f, 1.f }, { 0.f, 0.6f, 0.f, 0.8f }, { 0.f, 0.8f, 0.f, -0.6f } }, "compressedRotations");
+        rlogic::AnimationNodeConfig compressedAnimConfig;
+        compressedAnimConfig.addChannel({ "translation", timestamps, translations, rlogic::EInterpolationType::Linear });
+        compressedAnimConfig.addChannel({ "rotation", timestamps, rotations, rlogic::EInterpolationType::Linear_Quaternions });
+        logicEngine.createAnimationNode(compressedAnimConfig, "animNodeCompressed");
+    }
+
     logicEngine.link(*intf->getOutputs()->getChild("struct")->getChild("floatInput"), *script1->getInputs()->getChild("floatInput"));
     logicEngine.link(*script1->getOutputs()->getChild("floatOutput"), *script2->getInputs()->getChild("floatInput"));
     logicEngine.link(*script1->getOutputs()->getChild("nodeTranslation"), *nodeBinding->getInputs()->getChild("translation"));
@@ -248,6 +280,8 @@ int main(int argc, char* argv[])
 
     rlogic::SaveFileConfig noValidationConfig;
     noValidationConfig.setValidationEnabled(false);
+    if (featureLevel >= rlogic::EFeatureLevel_07)
+        noValidationConfig.setDataArrayCompression(rlogic::EDataArrayCompression::QuantizedKeyframes);
     logicEngine.saveToFile(basePath + "/" + logicFilename, noValidationConfig);
 
     scene->saveToFile((basePath +  "/" + ramsesFilename).c_str(), false);